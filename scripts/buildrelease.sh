@@ -0,0 +1,90 @@
+#!/bin/bash
+#
+# 构建发布版本：每个指令集先做插桩构建，运行 `chinesecheckers_cli bench` 收集 profile，
+# 再用 profile 和 LTO 构建最终版本，并输出每一步的 NPS 变化。
+#
+# Usage: scripts/buildrelease.sh [output-dir] [bench-depth]
+
+set -e
+
+ROOT_DIR=$(cd "$(dirname "$0")/.." && pwd)
+OUTPUT_DIR=${1:-$ROOT_DIR/dist}
+BENCH_DEPTH=${2:-7}
+BUILD_ROOT=$ROOT_DIR/build/release
+MARCHS="x86-64 x86-64-v2 x86-64-v3"
+TARGETS="chinesecheckers_server chinesecheckers_cli bookmaker chinesecheckers"
+
+BASELINE_NPS=""
+
+# configure <build-dir> [cmake args...]
+configure() {
+    local dir=$1
+    shift
+    cmake -S "$ROOT_DIR" -B "$dir" -DCMAKE_BUILD_TYPE=Release "$@" > /dev/null
+}
+
+# build <build-dir>
+build() {
+    local targets=()
+    for target in $TARGETS; do
+        targets+=(--target "$target")
+    done
+    cmake --build "$1" -j"$(nproc)" "${targets[@]}" > /dev/null
+}
+
+# bench <build-dir> <label>，输出 NPS 以及相对第一步的变化
+bench() {
+    local nps
+    nps=$("$1/chinesecheckers_cli" bench "$BENCH_DEPTH" | awk '/^nps/ { print $2 }')
+    if [ -z "$BASELINE_NPS" ]; then
+        BASELINE_NPS=$nps
+    fi
+    awk -v label="$2" -v nps="$nps" -v base="$BASELINE_NPS" \
+        'BEGIN { printf "%-28s %10d nps  %+6.1f%%\n", label, nps, (nps - base) * 100 / base }'
+}
+
+# 基准：不启用 LTO 的 Release 构建
+configure "$BUILD_ROOT/nolto" -DENGINE_LTO=OFF
+build "$BUILD_ROOT/nolto"
+bench "$BUILD_ROOT/nolto" "release"
+
+configure "$BUILD_ROOT/lto" -DENGINE_LTO=ON
+build "$BUILD_ROOT/lto"
+bench "$BUILD_ROOT/lto" "release + lto"
+
+mkdir -p "$OUTPUT_DIR"
+cp "$BUILD_ROOT/lto/chinesecheckers" "$OUTPUT_DIR/"
+
+for march in $MARCHS; do
+    dir=$BUILD_ROOT/$march
+    pgo_dir=$dir/pgo
+    rm -rf "$pgo_dir"
+    mkdir -p "$pgo_dir"
+
+    configure "$dir" -DENGINE_MARCH="$march" -DENGINE_PGO= -DENGINE_PGO_DIR="$pgo_dir"
+    build "$dir"
+    bench "$dir" "lto + $march"
+
+    # 插桩构建和最终构建必须使用同一个构建目录，gcc 按目标文件路径查找 profile
+    configure "$dir" -DENGINE_PGO=GENERATE
+    build "$dir"
+    "$dir/chinesecheckers_cli" bench "$BENCH_DEPTH" > /dev/null
+    if ls "$pgo_dir"/*.profraw > /dev/null 2>&1; then
+        llvm-profdata merge -output="$pgo_dir/default.profdata" "$pgo_dir"/*.profraw
+    fi
+
+    configure "$dir" -DENGINE_PGO=USE
+    build "$dir"
+    bench "$dir" "lto + $march + pgo"
+
+    # x86-64 是不带后缀的默认版本，启动器在 CPU 不支持 v2/v3 时使用
+    suffix=""
+    if [ "$march" != "x86-64" ]; then
+        suffix="-$march"
+    fi
+    for target in chinesecheckers_server chinesecheckers_cli bookmaker; do
+        cp "$dir/$target" "$OUTPUT_DIR/$target$suffix"
+    done
+done
+
+echo "release binaries written to $OUTPUT_DIR"
@@ -5,7 +5,7 @@ def hex128(n):
 
 
 def uint128array(name, values):
-    print(f"const uint128_t {name}[81] = {{")
+    print(f"constexpr uint128_t {name}[81] = {{")
     for i in range(81):
         print(f"    {hex128(values[i])},")
     print("};")
@@ -263,24 +263,12 @@ JUMP_POSITIONS_MASK = [
     [71, 79],
 ]
 
+JUMP_TABLE = []
 for i in range(81):
-
-    table = {}
-    for j in range(2 ** len(JUMP_POSITIONS[i])):
-        mask = 0
-        to = 0
-        for k in range(len(JUMP_POSITIONS[i])):
-            if j & (1 << k):
-                mask |= 1 << JUMP_POSITIONS_MASK[i][k]
-                to |= 1 << JUMP_POSITIONS[i][k]
-        table[mask] = to
-    if len(JUMP_POSITIONS[i]) != len(ADJ_POSITIONS[i]):
-        diff = list(set(ADJ_POSITIONS[i]) - set(JUMP_POSITIONS_MASK[i]))
-        for j in range(len(diff)):
-            for key in list(table.keys()):
-                add_key = key | (1 << diff[j])
-                table[add_key] = table[key]
-    JUMP_POSITIONS[i] = table
+    # 每个位置最多 6 个跳跃方向，(被跳过的位置, 落点)，不足 6 个用 -1 补齐
+    entries = list(zip(JUMP_POSITIONS_MASK[i], JUMP_POSITIONS[i]))
+    entries += [(-1, -1)] * (6 - len(entries))
+    JUMP_TABLE.append(entries)
 
     mask = 0
     for pos in ADJ_POSITIONS[i]:
@@ -289,16 +277,11 @@ for i in range(81):
 
 
 print("#pragma once")
-print("#include <map>")
+print("#include <cstdint>")
 print("using uint128_t = __uint128_t;")
 uint128array("ADJ_POSITIONS", ADJ_POSITIONS)
 
-print("const std::map<uint128_t, uint128_t> JUMP_POSITIONS[81] = {")
+print("constexpr int8_t JUMP_TABLE[81][6][2] = {")
 for i in range(81):
-    keys = JUMP_POSITIONS[i].keys()
-    print(f"    {{")
-    for key in keys:
-        print("{", hex128(key), ",", hex128(JUMP_POSITIONS[i][key]), "},")
-    print("    },")
-
+    print("    {" + ", ".join(f"{{{a}, {b}}}" for a, b in JUMP_TABLE[i]) + "},")
 print("};")
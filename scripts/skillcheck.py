@@ -0,0 +1,68 @@
+import subprocess
+import sys
+
+# 检查棋力等级的走法不受之前搜索的影响：每个局面先在新进程中用 1-5 级各搜索一次，
+# 再全力搜索同一局面把深层结果写入置换表，然后重新用各等级搜索，两次的着法必须相同。
+# 有不同时返回 1。
+#
+# 用法: python3 scripts/skillcheck.py <path/to/chinesecheckers_cli> [tests/a.txt ...]
+
+LEVELS = range(1, 6)
+# 全力搜索的思考时间 (秒)
+FULL_TIME = 2
+
+
+def command(process, line):
+    process.stdin.write(line + "\n")
+    process.stdin.flush()
+    return process.stdout.readline().strip()
+
+
+def skill_moves(process, state):
+    moves = []
+    for level in LEVELS:
+        command(process, "SKILL {}".format(level))
+        moves.append(command(process, "SEARCH {}".format(state)))
+    command(process, "SKILL 0")
+    return moves
+
+
+def check(cli, state):
+    process = subprocess.Popen([cli], stdin=subprocess.PIPE, stdout=subprocess.PIPE, text=True)
+    command(process, "LOG ERR")
+    command(process, "TIMELIMIT {}".format(FULL_TIME))
+    cold = skill_moves(process, state)
+    command(process, "SEARCH {}".format(state))
+    warm = skill_moves(process, state)
+    command(process, "QUIT")
+    process.wait()
+    return cold, warm
+
+
+def main():
+    if len(sys.argv) < 2:
+        print("Usage: {} <path/to/chinesecheckers_cli> [tests/a.txt ...]".format(sys.argv[0]))
+        sys.exit(1)
+    cli = sys.argv[1]
+    states = []
+    for path in sys.argv[2:] or ["tests/a.txt", "tests/b.txt", "tests/c.txt"]:
+        with open(path) as file:
+            for line in file:
+                if line.startswith("SEARCH ") and line[7:].strip() not in states:
+                    states.append(line[7:].strip())
+    failed = 0
+    for state in states:
+        cold, warm = check(cli, state)
+        ok = cold == warm
+        failed += 0 if ok else 1
+        print("{} {}".format("ok  " if ok else "DIFF", state))
+        if not ok:
+            for level, a, b in zip(LEVELS, cold, warm):
+                if a != b:
+                    print("  level {}: cold {}, after full search {}".format(level, a, b))
+    print("{}/{} positions consistent".format(len(states) - failed, len(states)))
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,40 @@
+import statistics
+import subprocess
+import sys
+import time
+
+# 测量从启动 chinesecheckers_cli 进程到收到第一个 bestmove 的延迟。
+# 初始局面命中开局库，测到的几乎全部是进程启动和引擎初始化的开销。
+#
+# 用法: python3 scripts/startuplatency.py <path/to/chinesecheckers_cli> [runs]
+
+START_POSITION = "222200000/222000000/220000000/200000000/000000000/000000001/000000011/000000111/000001111 r 1"
+
+if len(sys.argv) < 2:
+    print("Usage: {} <path/to/chinesecheckers_cli> [runs]".format(sys.argv[0]))
+    sys.exit(1)
+
+cli = sys.argv[1]
+runs = int(sys.argv[2]) if len(sys.argv) > 2 else 50
+
+latencies = []
+for _ in range(runs):
+    start = time.perf_counter()
+    process = subprocess.Popen([cli], stdin=subprocess.PIPE, stdout=subprocess.PIPE, text=True)
+    process.stdin.write("SEARCH {}\n".format(START_POSITION))
+    process.stdin.flush()
+    bestmove = process.stdout.readline()
+    latencies.append((time.perf_counter() - start) * 1000)
+    process.stdin.write("QUIT\n")
+    process.stdin.flush()
+    process.wait()
+    if len(bestmove.split()) != 2:
+        print("unexpected response: {!r}".format(bestmove))
+        sys.exit(1)
+
+latencies.sort()
+print("runs   {}".format(runs))
+print("min    {:.2f} ms".format(latencies[0]))
+print("median {:.2f} ms".format(statistics.median(latencies)))
+print("mean   {:.2f} ms".format(statistics.mean(latencies)))
+print("p90    {:.2f} ms".format(latencies[int(runs * 0.9) - 1]))
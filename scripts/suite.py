@@ -0,0 +1,162 @@
+import argparse
+import json
+import os
+import subprocess
+import threading
+
+# 战术测试集：用多个单线程的 chinesecheckers_cli 进程并行搜索测试集中的局面，
+# 记录每个局面第一次找到正确着法 (并且之后的迭代都没有改变) 时的深度、时间和结点数，
+# 最后给出在不同时间和结点数预算下的解出率。每个局面搜索前清空置换表，结果与 --jobs 和局面顺序无关。
+#
+# 测试集每行一个局面，字段之间用分号分隔，# 开头的行为注释：
+#   <局面> ; bm src dst, src dst ; am src dst ; score >= 9999 ; id 名称
+# bm 为正确着法 (任意一个即可)，am 为必须避免的着法，score 为要求的最低评分，都可以省略。
+#
+# 用法: python3 scripts/suite.py <path/to/chinesecheckers_cli> <suite.txt> [--jobs N] [--time 10]
+
+TIME_BUDGETS = [10, 100, 1000, 10000]
+NODE_BUDGETS = [10 ** 4, 10 ** 5, 10 ** 6, 10 ** 7]
+
+
+def parse_moves(text):
+    moves = []
+    for item in text.split(","):
+        numbers = item.split()
+        if len(numbers) == 2:
+            moves.append((int(numbers[0]), int(numbers[1])))
+    return moves
+
+
+def parse_suite(path):
+    cases = []
+    with open(path) as file:
+        for number, line in enumerate(file, 1):
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            fields = [field.strip() for field in line.split(";")]
+            case = {"state": fields[0], "id": "{}:{}".format(os.path.basename(path), number),
+                    "bm": [], "am": [], "score": None}
+            for field in fields[1:]:
+                key, _, value = field.partition(" ")
+                if key == "bm":
+                    case["bm"] = parse_moves(value)
+                elif key == "am":
+                    case["am"] = parse_moves(value)
+                elif key == "score":
+                    case["score"] = int(value.replace(">=", ""))
+                elif key == "id":
+                    case["id"] = value
+            cases.append(case)
+    return cases
+
+
+def correct(case, move, score):
+    if case["bm"] and move not in case["bm"]:
+        return False
+    if move in case["am"]:
+        return False
+    if case["score"] is not None and score is not None and score < case["score"]:
+        return False
+    return True
+
+
+def run_case(process, case):
+    process.stdin.write("CLEARHASH\n")
+    process.stdin.flush()
+    process.stdout.readline()
+    process.stdin.write("SEARCH {}\n".format(case["state"]))
+    process.stdin.flush()
+    infos = []
+    while True:
+        words = process.stdout.readline().split()
+        if not words:
+            raise RuntimeError("engine exited while searching {}".format(case["id"]))
+        if words[0] == "info":
+            values = dict(zip(words[1:9:2], (int(word) for word in words[2:9:2])))
+            pv = [int(word) for word in words[10:]]
+            infos.append((values["depth"], values["score"], values["nodes"], values["time"], (pv[0], pv[1])))
+            continue
+        move = (int(words[0]), int(words[1]))
+        break
+    result = dict(case, move=move, solved=False, late=False, depth=None, time=None, nodes=None)
+    if not correct(case, move, infos[-1][1] if infos else None):
+        return result
+    if not infos:
+        # 开局库着法，没有迭代信息
+        result["solved"] = True
+        result["depth"], result["nodes"], result["time"] = 0, 0, 0
+        return result
+    # 找出最早的一层，从这一层开始到搜索结束给出的着法都正确
+    first = len(infos)
+    while first > 0 and correct(case, infos[first - 1][4], infos[first - 1][1]):
+        first -= 1
+    if first == len(infos):
+        # 只在被时间打断的最后一层找到，没有完成的迭代支持，不计入解出
+        result["late"] = True
+        return result
+    result["solved"] = True
+    result["depth"], _, result["nodes"], result["time"], _ = infos[first]
+    return result
+
+
+def worker(cli, seconds, cases, results):
+    process = subprocess.Popen([cli], stdin=subprocess.PIPE, stdout=subprocess.PIPE, text=True)
+    process.stdin.write("LOG ERR\nTHREADS 1\nTIMELIMIT {}\nINFO ON\n".format(seconds))
+    process.stdin.flush()
+    for _ in range(4):
+        process.stdout.readline()
+    for case in cases:
+        results.append(run_case(process, case))
+    process.stdin.write("QUIT\n")
+    process.stdin.flush()
+    process.wait()
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("cli")
+    parser.add_argument("suite")
+    parser.add_argument("--jobs", type=int, default=os.cpu_count())
+    parser.add_argument("--time", type=int, default=10, help="每个局面的思考时间 (秒)")
+    parser.add_argument("--json", help="把每个局面的结果写入 JSON 文件")
+    args = parser.parse_args()
+
+    cases = parse_suite(args.suite)
+    jobs = max(1, min(args.jobs, len(cases)))
+    results = []
+    threads = [threading.Thread(target=worker, args=(args.cli, args.time, cases[i::jobs], results))
+               for i in range(jobs)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    order = {case["id"]: i for i, case in enumerate(cases)}
+    results.sort(key=lambda result: order[result["id"]])
+
+    for result in results:
+        if result["solved"]:
+            print("{:<24} solved  depth {:>2}  time {:>6} ms  nodes {:>10}".format(
+                result["id"], result["depth"], result["time"], result["nodes"]))
+        elif result["late"]:
+            print("{:<24} LATE    move {} {} found only in the interrupted last iteration".format(
+                result["id"], *result["move"]))
+        else:
+            print("{:<24} FAILED  move {} {}".format(result["id"], *result["move"]))
+    solved = [result for result in results if result["solved"]]
+    print()
+    print("solved {}/{}".format(len(solved), len(results)))
+    for budget in TIME_BUDGETS:
+        if budget <= args.time * 1000:
+            count = sum(1 for result in solved if result["time"] <= budget)
+            print("  within {:>6} ms    {:>3}/{}".format(budget, count, len(results)))
+    for budget in NODE_BUDGETS:
+        count = sum(1 for result in solved if result["nodes"] <= budget)
+        print("  within {:>9} nodes {:>3}/{}".format(budget, count, len(results)))
+    if args.json:
+        with open(args.json, "w") as file:
+            json.dump(results, file, indent=2)
+
+
+if __name__ == "__main__":
+    main()
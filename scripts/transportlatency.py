@@ -0,0 +1,85 @@
+import socket
+import statistics
+import struct
+import sys
+import time
+import urllib.parse
+import urllib.request
+
+# 比较 HTTP (/search) 和 Unix 域套接字两种调用方式的往返延迟。
+# 两边都以 1 层深度搜索同一个局面，搜索本身只占几十微秒，测到的主要是传输和解析的开销。
+#
+# 用法: python3 scripts/transportlatency.py <host:port> <socket path> [runs]
+
+POSITION = "000000000/101000000/201201000/000001000/000201010/000220220/000011200/000010200/000000200 r 19"
+SOCKET_MAGIC = 0x43434531
+# magic, moveTime, red[2], green[2], turn, depth, round, reserved
+REQUEST = struct.Struct("<II2Q2QBBHI")
+# magic, src, dst, score, depth, reserved, nodes
+RESPONSE = struct.Struct("<IiiiiIQ")
+
+
+def bitboards(state):
+    red = green = 0
+    p = 0
+    for c in state.split()[0]:
+        if c in "012":
+            if c == "1":
+                red |= 1 << p
+            elif c == "2":
+                green |= 1 << p
+            p += 1
+    turn = 1 if state.split()[1] == "r" else 2
+    return red, green, turn, int(state.split()[2])
+
+
+def report(name, latencies):
+    latencies.sort()
+    print("{:<6} median {:.3f} ms  mean {:.3f} ms  p90 {:.3f} ms  min {:.3f} ms".format(
+        name, statistics.median(latencies), statistics.mean(latencies),
+        latencies[int(len(latencies) * 0.9) - 1], latencies[0]))
+
+
+if len(sys.argv) < 3:
+    print("Usage: {} <host:port> <socket path> [runs]".format(sys.argv[0]))
+    sys.exit(1)
+
+address = sys.argv[1]
+path = sys.argv[2]
+runs = int(sys.argv[3]) if len(sys.argv) > 3 else 200
+
+url = "http://{}/search?state={}&time=1&depth=1".format(address, urllib.parse.quote(POSITION))
+http = []
+for _ in range(runs):
+    start = time.perf_counter()
+    body = urllib.request.urlopen(url).read().decode()
+    http.append((time.perf_counter() - start) * 1000)
+    if len(body.split()) != 2:
+        print("unexpected response: {!r}".format(body))
+        sys.exit(1)
+
+red, green, turn, rnd = bitboards(POSITION)
+request = REQUEST.pack(SOCKET_MAGIC, 1000, red & (2**64 - 1), red >> 64, green & (2**64 - 1), green >> 64,
+                       turn, 1, rnd, 0)
+unix = []
+with socket.socket(socket.AF_UNIX, socket.SOCK_STREAM) as sock:
+    sock.connect(path)
+    for _ in range(runs):
+        start = time.perf_counter()
+        sock.sendall(request)
+        data = b""
+        while len(data) < RESPONSE.size:
+            chunk = sock.recv(RESPONSE.size - len(data))
+            if not chunk:
+                print("connection closed")
+                sys.exit(1)
+            data += chunk
+        unix.append((time.perf_counter() - start) * 1000)
+        magic, src, dst, score, depth, _, nodes = RESPONSE.unpack(data)
+        if magic != SOCKET_MAGIC or src < 0:
+            print("unexpected response: {}".format(RESPONSE.unpack(data)))
+            sys.exit(1)
+
+print("runs   {}".format(runs))
+report("http", http)
+report("unix", unix)
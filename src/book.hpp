@@ -1,4705 +1,3533 @@
-unsigned char book_dat[] = {
-  0x12, 0x5d, 0x1b, 0x30, 0xeb, 0xc8, 0x0e, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0xd0, 0xfa, 0xbd, 0x6e, 0x23, 0x46, 0x10, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x95, 0xa2, 0x20, 0x03,
-  0xdc, 0xc1, 0x11, 0x00, 0x45, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
-  0x82, 0x84, 0xa7, 0xd5, 0xa9, 0x6b, 0x12, 0x00, 0x3b, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0xb3, 0x2b, 0x6b, 0x86, 0x8b, 0x5b, 0x7d, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x7a, 0x1a, 0x94, 0x62,
-  0x09, 0x4a, 0xb3, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x16, 0x9c, 0x39, 0x75, 0x6c, 0xe0, 0x37, 0x01, 0x20, 0x00, 0x00, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x94, 0x9a, 0x98, 0xaa, 0xa7, 0x87, 0x53, 0x01,
-  0x28, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x87, 0xad, 0xec, 0x72,
-  0xb4, 0x11, 0x5a, 0x01, 0x3d, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0xf5, 0x62, 0xa0, 0xae, 0x28, 0x99, 0x5a, 0x01, 0x29, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0x47, 0x03, 0xc1, 0x72, 0x7c, 0xc8, 0x86, 0x01,
-  0x1e, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xb7, 0xe9, 0xa6, 0x9f,
-  0x67, 0x1a, 0x8d, 0x01, 0x44, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x35, 0xef, 0xe3, 0x19, 0xc7, 0x31, 0x99, 0x01, 0x33, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x99, 0xa4, 0x60, 0x18, 0xf3, 0x68, 0x9a, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0xb2, 0x94, 0x22, 0x5a,
-  0x04, 0xaa, 0xa8, 0x01, 0x3d, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x70, 0xc9, 0x0c, 0x80, 0x31, 0xd6, 0xc0, 0x01, 0x21, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x58, 0x5b, 0x71, 0x27, 0x30, 0xcb, 0xc4, 0x01,
-  0x47, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0xa0, 0x92, 0xd0, 0xe9,
-  0x60, 0x91, 0xdf, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x93, 0xbe, 0x0a, 0xb3, 0xcc, 0x1b, 0x2d, 0x02, 0x45, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x93, 0xbe, 0x0a, 0xb3, 0xcc, 0x1b, 0x2d, 0x02,
-  0x2a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x2f, 0x16, 0x2b, 0x12,
-  0xd5, 0x94, 0x2e, 0x02, 0x47, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x2f, 0x16, 0x2b, 0x12, 0xd5, 0x94, 0x2e, 0x02, 0x46, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0xa5, 0xef, 0x75, 0x99, 0xe4, 0x24, 0x33, 0x02,
-  0x02, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x79, 0x38, 0x4c, 0xec,
-  0xcf, 0x46, 0x38, 0x02, 0x46, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x1f, 0xc3, 0xdd, 0x24, 0xd5, 0x9f, 0x3a, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x1f, 0xc3, 0xdd, 0x24, 0xd5, 0x9f, 0x3a, 0x02,
-  0x1c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1f, 0xc3, 0xdd, 0x24,
-  0xd5, 0x9f, 0x3a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x1f, 0xc3, 0xdd, 0x24, 0xd5, 0x9f, 0x3a, 0x02, 0x12, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x1f, 0xc3, 0xdd, 0x24, 0xd5, 0x9f, 0x3a, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1f, 0xc3, 0xdd, 0x24,
-  0xd5, 0x9f, 0x3a, 0x02, 0x1b, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0x1f, 0xc3, 0xdd, 0x24, 0xd5, 0x9f, 0x3a, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x8d, 0x49, 0x83, 0x13, 0x09, 0x63, 0x55, 0x02,
-  0x1d, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x58, 0x1c, 0xb3, 0x24,
-  0xbe, 0x7e, 0x7d, 0x02, 0x2f, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00,
-  0x30, 0x89, 0x25, 0x44, 0xa6, 0x3a, 0x91, 0x02, 0x16, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x3f, 0xdd, 0x60, 0xd6, 0xba, 0xd2, 0x92, 0x02,
-  0x0a, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xd6, 0x43, 0xe4, 0x4c,
-  0xed, 0xb2, 0x95, 0x02, 0x2a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x8d, 0x4a, 0x66, 0x45, 0xac, 0x49, 0xb1, 0x02, 0x12, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0xcc, 0xbe, 0xae, 0x6d, 0x0e, 0x80, 0xe4, 0x02,
-  0x4e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0xed, 0x13, 0xd1, 0xde,
-  0x41, 0xbb, 0x0b, 0x03, 0x45, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x8b, 0x01, 0xf6, 0xf5, 0xfe, 0x6f, 0x1b, 0x03, 0x13, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x52, 0x7c, 0x51, 0x4b, 0x8c, 0x7f, 0x22, 0x03,
-  0x29, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x52, 0x7c, 0x51, 0x4b,
-  0x8c, 0x7f, 0x22, 0x03, 0x34, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x7a, 0xec, 0x33, 0x19, 0x37, 0x86, 0x22, 0x03, 0x33, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0xf9, 0x30, 0x43, 0x07, 0xdc, 0x96, 0x3a, 0x03,
-  0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x80, 0xeb, 0xc9, 0xd0,
-  0xce, 0x3f, 0x79, 0x03, 0x0e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x47, 0x26, 0x07, 0x1e, 0x5a, 0x4c, 0xee, 0x03, 0x0a, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0xd7, 0x7a, 0x0a, 0xfc, 0xd7, 0xe5, 0x1a, 0x04,
-  0x0b, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x8e, 0x41, 0x21, 0x7f,
-  0x85, 0x2e, 0x25, 0x04, 0x16, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x8d, 0x52, 0x1a, 0xfa, 0x97, 0x08, 0x29, 0x04, 0x50, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x8d, 0x52, 0x1a, 0xfa, 0x97, 0x08, 0x29, 0x04,
-  0x21, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x8d, 0x52, 0x1a, 0xfa,
-  0x97, 0x08, 0x29, 0x04, 0x50, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0xb7, 0x4d, 0xbd, 0x21, 0xc0, 0x8e, 0x70, 0x04, 0x20, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x9b, 0xbb, 0x52, 0xea, 0x11, 0xaa, 0x88, 0x04,
-  0x30, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0xa2, 0xa4, 0x7f, 0xda,
-  0x79, 0x91, 0x97, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0xcb, 0x37, 0x40, 0x40, 0x9e, 0x6c, 0xad, 0x04, 0x50, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0xcb, 0x37, 0x40, 0x40, 0x9e, 0x6c, 0xad, 0x04,
-  0x4d, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x83, 0x3a, 0xa4, 0xff,
-  0xef, 0xc6, 0xad, 0x04, 0x1d, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
-  0x4c, 0x8e, 0xc2, 0x83, 0xff, 0x2a, 0xf6, 0x04, 0x0c, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x4c, 0x8e, 0xc2, 0x83, 0xff, 0x2a, 0xf6, 0x04,
-  0x27, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x9f, 0xc2, 0x11, 0x9e,
-  0xe3, 0x99, 0xfb, 0x04, 0x3b, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x9f, 0xc2, 0x11, 0x9e, 0xe3, 0x99, 0xfb, 0x04, 0x21, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x0a, 0x23, 0xee, 0xa8, 0x0b, 0x7e, 0x09, 0x05,
-  0x34, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x0a, 0x23, 0xee, 0xa8,
-  0x0b, 0x7e, 0x09, 0x05, 0x20, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x53, 0xbb, 0xaf, 0x3c, 0x95, 0x7a, 0x59, 0x05, 0x15, 0x00, 0x00, 0x00,
-  0x3d, 0x00, 0x00, 0x00, 0x0e, 0x4a, 0xdd, 0xef, 0x73, 0x0e, 0x5a, 0x05,
-  0x45, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0xfe, 0xfc, 0x36, 0x80,
-  0xe7, 0xb5, 0x6a, 0x05, 0x1f, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0x00, 0xb9, 0x4c, 0x60, 0x13, 0x77, 0x9e, 0x05, 0x15, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x30, 0xbe, 0x17, 0x9a, 0x79, 0xed, 0xad, 0x05,
-  0x27, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x8c, 0x29, 0x1b, 0x58,
-  0x65, 0x91, 0xe7, 0x05, 0x1f, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-  0x82, 0xd0, 0xaa, 0x46, 0x95, 0x72, 0xf1, 0x05, 0x4e, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x05, 0xba, 0xfc, 0x3c, 0xc4, 0x86, 0xff, 0x05,
-  0x39, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x46, 0xe6, 0x8c, 0x79,
-  0xa3, 0x92, 0x0d, 0x06, 0x3c, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0xe4, 0x9f, 0x3d, 0x1a, 0xf5, 0xf5, 0x35, 0x06, 0x0c, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x9a, 0xd5, 0x8f, 0x02, 0x78, 0x46, 0x54, 0x06,
-  0x13, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x6a, 0x63, 0x25, 0x12,
-  0xfa, 0xee, 0x54, 0x06, 0x29, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0xae, 0x04, 0xeb, 0xf3, 0x5e, 0x8d, 0x5f, 0x06, 0x15, 0x00, 0x00, 0x00,
-  0x4f, 0x00, 0x00, 0x00, 0xfe, 0x3b, 0x34, 0x96, 0xf3, 0xbf, 0x71, 0x06,
-  0x43, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0xfe, 0x3b, 0x34, 0x96,
-  0xf3, 0xbf, 0x71, 0x06, 0x1c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x14, 0xba, 0x68, 0x6a, 0xe4, 0x92, 0x91, 0x06, 0x44, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x14, 0xba, 0x68, 0x6a, 0xe4, 0x92, 0x91, 0x06,
-  0x09, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x19, 0x8d, 0x6e, 0xe4,
-  0xae, 0x6b, 0xbb, 0x06, 0x3b, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0x8b, 0xd8, 0x6e, 0x0a, 0xa8, 0x88, 0xfc, 0x06, 0x1d, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0xa5, 0x6c, 0x12, 0xed, 0xe9, 0x62, 0x1c, 0x07,
-  0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xa6, 0x04, 0xca, 0x23,
-  0x10, 0x63, 0x2e, 0x07, 0x0c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0xf7, 0x0f, 0xef, 0x47, 0x06, 0xc0, 0x39, 0x07, 0x12, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0xf7, 0x0f, 0xef, 0x47, 0x06, 0xc0, 0x39, 0x07,
-  0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xf7, 0x0f, 0xef, 0x47,
-  0x06, 0xc0, 0x39, 0x07, 0x1d, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0xf7, 0x0f, 0xef, 0x47, 0x06, 0xc0, 0x39, 0x07, 0x1c, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0xf7, 0x0f, 0xef, 0x47, 0x06, 0xc0, 0x39, 0x07,
-  0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xf7, 0x0f, 0xef, 0x47,
-  0x06, 0xc0, 0x39, 0x07, 0x16, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0xf7, 0x0f, 0xef, 0x47, 0x06, 0xc0, 0x39, 0x07, 0x12, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0xa1, 0x11, 0x66, 0xbe, 0x45, 0x0b, 0x3f, 0x07,
-  0x1d, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x78, 0xa7, 0x20, 0x91,
-  0x90, 0x98, 0x6f, 0x07, 0x27, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0xcd, 0xb3, 0x03, 0xe6, 0xc8, 0x4c, 0x72, 0x07, 0x15, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x08, 0x42, 0x97, 0x59, 0xf9, 0x26, 0xac, 0x07,
-  0x33, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x92, 0x7c, 0x02, 0x47,
-  0xd7, 0x8c, 0xc5, 0x07, 0x4e, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x15, 0xc1, 0xeb, 0xe2, 0xbb, 0x79, 0x10, 0x08, 0x35, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0xa0, 0x33, 0xe0, 0x67, 0xdd, 0xb0, 0x19, 0x08,
-  0x3d, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x4a, 0x9f, 0x96, 0xbc,
-  0x10, 0x6d, 0x2b, 0x08, 0x3c, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-  0x47, 0x33, 0xc6, 0x74, 0xdc, 0x37, 0x36, 0x08, 0x21, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x0b, 0x5c, 0x70, 0x28, 0xb7, 0xe3, 0x64, 0x08,
-  0x3b, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x74, 0xb3, 0x4c, 0x44,
-  0x1c, 0xe6, 0x82, 0x08, 0x14, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0xf2, 0x3c, 0x66, 0x72, 0x42, 0xaa, 0x8d, 0x08, 0x33, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x15, 0xda, 0xcf, 0x23, 0x94, 0xfd, 0x93, 0x08,
-  0x2e, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x77, 0xfc, 0xf6, 0xfb,
-  0x72, 0xab, 0xb3, 0x08, 0x2a, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0x27, 0x16, 0x4a, 0xc2, 0xac, 0x7b, 0xbe, 0x08, 0x1c, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x27, 0x16, 0x4a, 0xc2, 0xac, 0x7b, 0xbe, 0x08,
-  0x1b, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x27, 0x16, 0x4a, 0xc2,
-  0xac, 0x7b, 0xbe, 0x08, 0x1c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0xf9, 0x7b, 0xd2, 0x16, 0x45, 0x55, 0xf5, 0x08, 0x30, 0x00, 0x00, 0x00,
-  0x42, 0x00, 0x00, 0x00, 0xf9, 0x28, 0xac, 0xd8, 0x97, 0xda, 0x15, 0x09,
-  0x3b, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x14, 0x0a, 0x13, 0xeb,
-  0x57, 0xeb, 0x36, 0x09, 0x31, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0x4f, 0xd9, 0x82, 0x4d, 0x37, 0xbe, 0x71, 0x09, 0x3d, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x8a, 0x7e, 0xac, 0x91, 0x28, 0x46, 0x88, 0x09,
-  0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x97, 0x6a, 0xae, 0x73,
-  0x20, 0x35, 0x89, 0x09, 0x46, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0x97, 0x6a, 0xae, 0x73, 0x20, 0x35, 0x89, 0x09, 0x3d, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0x97, 0x6a, 0xae, 0x73, 0x20, 0x35, 0x89, 0x09,
-  0x3d, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x5d, 0xd1, 0x3b, 0x20,
-  0x99, 0x69, 0x90, 0x09, 0x34, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
-  0x5d, 0xd1, 0x3b, 0x20, 0x99, 0x69, 0x90, 0x09, 0x3b, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0x1e, 0x19, 0x0e, 0x49, 0xa0, 0x41, 0xae, 0x09,
-  0x1c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x8b, 0xce, 0x62, 0x04,
-  0x93, 0xe9, 0xb4, 0x09, 0x14, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0x25, 0xe8, 0x03, 0x93, 0xc6, 0x35, 0xc6, 0x09, 0x26, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x06, 0xb2, 0x66, 0xd2, 0x1f, 0xaa, 0xcb, 0x09,
-  0x2b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x99, 0x56, 0x72, 0x7f,
-  0x51, 0x6d, 0xce, 0x09, 0x44, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
-  0xac, 0x92, 0x55, 0xed, 0x31, 0xa4, 0xef, 0x09, 0x17, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x23, 0x9b, 0x5c, 0x3d, 0x7e, 0x2e, 0xf3, 0x09,
-  0x0c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x0f, 0xa0, 0x29, 0x58,
-  0xb2, 0xbc, 0x19, 0x0a, 0x1e, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
-  0xf9, 0x68, 0x16, 0x5b, 0x3a, 0x3c, 0x20, 0x0a, 0x3b, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0xb3, 0xdd, 0xc1, 0x0d, 0xe9, 0xbf, 0x26, 0x0a,
-  0x09, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x60, 0x5c, 0xf3, 0xf7,
-  0xe5, 0x93, 0x6f, 0x0a, 0x3c, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-  0xed, 0xd1, 0x25, 0x22, 0x90, 0x4f, 0x77, 0x0a, 0x46, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x65, 0xbe, 0x49, 0xe0, 0x80, 0xde, 0xae, 0x0a,
-  0x46, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x6a, 0x85, 0x0f, 0x76,
-  0xff, 0x8d, 0xb6, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0xa2, 0x56, 0x6c, 0x80, 0xe4, 0x97, 0xe8, 0x0a, 0x1d, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0xec, 0x24, 0xb7, 0xd9, 0xb3, 0xaa, 0xf5, 0x0a,
-  0x34, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0xc5, 0xb5, 0xd0, 0x70,
-  0x0b, 0x50, 0x1a, 0x0b, 0x18, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
-  0xc5, 0xb5, 0xd0, 0x70, 0x0b, 0x50, 0x1a, 0x0b, 0x15, 0x00, 0x00, 0x00,
-  0x25, 0x00, 0x00, 0x00, 0xc5, 0xb5, 0xd0, 0x70, 0x0b, 0x50, 0x1a, 0x0b,
-  0x3b, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x4b, 0x44, 0x39, 0x14,
-  0xce, 0xde, 0x1c, 0x0b, 0x01, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0xf5, 0x9a, 0xe5, 0xb9, 0x76, 0x4b, 0x27, 0x0b, 0x3c, 0x00, 0x00, 0x00,
-  0x3b, 0x00, 0x00, 0x00, 0xf5, 0x9a, 0xe5, 0xb9, 0x76, 0x4b, 0x27, 0x0b,
-  0x17, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x2e, 0x0c, 0x11, 0x5f,
-  0x81, 0x4e, 0x79, 0x0b, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x7c, 0xa5, 0xd2, 0xd4, 0xe2, 0x23, 0xc4, 0x0b, 0x3a, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0xef, 0xf1, 0xf4, 0xee, 0xe7, 0xbe, 0xf3, 0x0b,
-  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xe3, 0x45, 0xe3, 0x93,
-  0xa7, 0x1e, 0x0e, 0x0c, 0x26, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0x63, 0x07, 0x95, 0x89, 0x2e, 0x52, 0x12, 0x0c, 0x1d, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0xc4, 0xc2, 0xf1, 0xa2, 0xbc, 0x0e, 0x34, 0x0c,
-  0x0b, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1e, 0xd4, 0x69, 0xc3,
-  0x97, 0xba, 0x3a, 0x0c, 0x3e, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
-  0x52, 0xd0, 0x0e, 0x90, 0xd1, 0x7c, 0x85, 0x0c, 0x1d, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0xbe, 0xe5, 0xba, 0xf1, 0xb0, 0xf6, 0x9a, 0x0c,
-  0x1d, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x4e, 0xcd, 0xcf, 0x17,
-  0x6a, 0x20, 0xa5, 0x0c, 0x32, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x50, 0xc4, 0xb3, 0x7e, 0x6e, 0xab, 0xba, 0x0c, 0x26, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x50, 0xc4, 0xb3, 0x7e, 0x6e, 0xab, 0xba, 0x0c,
-  0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x50, 0xc4, 0xb3, 0x7e,
-  0x6e, 0xab, 0xba, 0x0c, 0x26, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0x5d, 0xd1, 0x51, 0x33, 0x5b, 0x1f, 0xcb, 0x0c, 0x34, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x5d, 0xd1, 0x51, 0x33, 0x5b, 0x1f, 0xcb, 0x0c,
-  0x35, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x5d, 0xd1, 0x51, 0x33,
-  0x5b, 0x1f, 0xcb, 0x0c, 0x34, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0x9b, 0x41, 0xc6, 0x9f, 0x03, 0xea, 0xec, 0x0c, 0x1f, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x94, 0x42, 0xbd, 0x6a, 0x5b, 0xa0, 0xf8, 0x0c,
-  0x32, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xcb, 0x21, 0xfc, 0x0d,
-  0xc5, 0x96, 0x0f, 0x0d, 0x39, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0x6a, 0xd1, 0xfe, 0x7d, 0xf1, 0x0c, 0x14, 0x0d, 0x09, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0x20, 0x8a, 0x28, 0xa3, 0xad, 0xc1, 0x22, 0x0d,
-  0x0b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xfd, 0xda, 0xff, 0xc5,
-  0xbc, 0x35, 0x26, 0x0d, 0x46, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0xf1, 0xa9, 0x7b, 0xdf, 0xb3, 0xab, 0x2e, 0x0d, 0x0d, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x2e, 0x86, 0x48, 0x5a, 0x43, 0x8c, 0x6a, 0x0d,
-  0x14, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x2e, 0x86, 0x48, 0x5a,
-  0x43, 0x8c, 0x6a, 0x0d, 0x14, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0xd7, 0x38, 0x95, 0x95, 0x0e, 0xc7, 0x75, 0x0d, 0x27, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x6f, 0x88, 0x5f, 0xd7, 0xab, 0x22, 0x79, 0x0d,
-  0x31, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x35, 0xd4, 0xd6, 0x98,
-  0xad, 0x0f, 0x7b, 0x0d, 0x13, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0x78, 0xc6, 0x43, 0x58, 0xd8, 0xcf, 0xc7, 0x0d, 0x33, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x64, 0x49, 0x47, 0x61, 0xbd, 0x95, 0xc9, 0x0d,
-  0x4d, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x94, 0x7e, 0x65, 0x13,
-  0xa2, 0xe4, 0xcd, 0x0d, 0x26, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0x94, 0x7e, 0x65, 0x13, 0xa2, 0xe4, 0xcd, 0x0d, 0x1d, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x94, 0x7e, 0x65, 0x13, 0xa2, 0xe4, 0xcd, 0x0d,
-  0x26, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x94, 0x7e, 0x65, 0x13,
-  0xa2, 0xe4, 0xcd, 0x0d, 0x16, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x94, 0x7e, 0x65, 0x13, 0xa2, 0xe4, 0xcd, 0x0d, 0x26, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0xd6, 0xff, 0xdd, 0x32, 0xf1, 0xc6, 0xe2, 0x0d,
-  0x4e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x99, 0xef, 0x54, 0x40,
-  0xe2, 0x0b, 0xe5, 0x0d, 0x3c, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
-  0x41, 0x70, 0x0c, 0x79, 0x49, 0x27, 0x20, 0x0e, 0x21, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0xd3, 0xcf, 0x36, 0x7e, 0x9d, 0xd1, 0x2e, 0x0e,
-  0x19, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xef, 0x80, 0x58, 0xab,
-  0x65, 0xa3, 0x35, 0x0e, 0x1d, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x24, 0x49, 0x9f, 0x7c, 0xda, 0x8e, 0x92, 0x0e, 0x3a, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x98, 0x3e, 0xbe, 0xc5, 0xd1, 0x08, 0xd1, 0x0e,
-  0x47, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x98, 0x3e, 0xbe, 0xc5,
-  0xd1, 0x08, 0xd1, 0x0e, 0x4e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0xdf, 0x3a, 0xcf, 0x67, 0x98, 0x9d, 0xe7, 0x0e, 0x4e, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x17, 0x83, 0x37, 0xf4, 0x0e, 0xca, 0xf3, 0x0e,
-  0x4d, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x4a, 0xfb, 0x86, 0x8a,
-  0x99, 0xd2, 0x20, 0x0f, 0x18, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-  0x55, 0x30, 0x17, 0xa8, 0x8c, 0x8a, 0x2e, 0x0f, 0x32, 0x00, 0x00, 0x00,
-  0x46, 0x00, 0x00, 0x00, 0x55, 0x30, 0x17, 0xa8, 0x8c, 0x8a, 0x2e, 0x0f,
-  0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x8d, 0xd0, 0xf5, 0xe2,
-  0xe7, 0x96, 0x4f, 0x0f, 0x2a, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x40, 0x59, 0xdf, 0xf1, 0xcf, 0x01, 0x89, 0x0f, 0x12, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0xed, 0x05, 0xd5, 0xff, 0x93, 0x4d, 0x90, 0x0f,
-  0x29, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0xed, 0x05, 0xd5, 0xff,
-  0x93, 0x4d, 0x90, 0x0f, 0x4f, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
-  0xed, 0x05, 0xd5, 0xff, 0x93, 0x4d, 0x90, 0x0f, 0x29, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0xed, 0x05, 0xd5, 0xff, 0x93, 0x4d, 0x90, 0x0f,
-  0x4f, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0xed, 0x05, 0xd5, 0xff,
-  0x93, 0x4d, 0x90, 0x0f, 0x29, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x2c, 0x41, 0x89, 0x1b, 0x92, 0xfa, 0x9f, 0x0f, 0x20, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x51, 0xb6, 0xd3, 0x6d, 0x66, 0x12, 0xb6, 0x0f,
-  0x16, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x23, 0x90, 0x90, 0x09,
-  0x73, 0xc7, 0x09, 0x10, 0x0b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x43, 0xbf, 0x1d, 0x41, 0x1b, 0x80, 0x47, 0x10, 0x4f, 0x00, 0x00, 0x00,
-  0x46, 0x00, 0x00, 0x00, 0x5f, 0x5c, 0x9c, 0x44, 0x12, 0x6a, 0x48, 0x10,
-  0x1d, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x47, 0xa7, 0x0d, 0x0a,
-  0x40, 0x7a, 0x54, 0x10, 0x3e, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00,
-  0x56, 0x6e, 0x3c, 0xbe, 0x03, 0x55, 0x79, 0x10, 0x1c, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x01, 0x51, 0x4f, 0x6a, 0xec, 0x94, 0x99, 0x10,
-  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xea, 0xa7, 0x06, 0xd8,
-  0x28, 0xca, 0xae, 0x10, 0x13, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0x55, 0xce, 0x8f, 0xa2, 0xcc, 0x42, 0xba, 0x10, 0x21, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0xfc, 0x0b, 0xb3, 0xea, 0x0f, 0x08, 0xee, 0x10,
-  0x15, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x13, 0xb1, 0x07, 0x47,
-  0xe1, 0xab, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
-  0x13, 0xb1, 0x07, 0x47, 0xe1, 0xab, 0xff, 0x10, 0x1b, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x13, 0xb1, 0x07, 0x47, 0xe1, 0xab, 0xff, 0x10,
-  0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0xbb, 0xf6, 0xe6, 0xbc,
-  0xa0, 0x43, 0x11, 0x11, 0x1e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x0f, 0x7f, 0x55, 0x70, 0x7a, 0x5f, 0x1a, 0x11, 0x3b, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0xfd, 0x6e, 0xe4, 0x04, 0xb1, 0xf6, 0x29, 0x11,
-  0x02, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xc5, 0x81, 0xd0, 0x6d,
-  0xce, 0x4e, 0x50, 0x11, 0x03, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0xc5, 0x81, 0xd0, 0x6d, 0xce, 0x4e, 0x50, 0x11, 0x03, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x08, 0x40, 0xd1, 0x33, 0x07, 0xe2, 0x96, 0x11,
-  0x4f, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x25, 0x18, 0x79, 0x58,
-  0x82, 0x15, 0xbc, 0x11, 0x45, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x2b, 0x02, 0x81, 0xb9, 0xfe, 0xd5, 0xcb, 0x11, 0x28, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x57, 0x7c, 0xba, 0xaa, 0xc2, 0xab, 0xe0, 0x11,
-  0x1c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x99, 0x1f, 0x3b, 0x27,
-  0xa5, 0x8e, 0xee, 0x11, 0x0e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x6b, 0x84, 0x88, 0x5c, 0xd2, 0xb9, 0xf6, 0x11, 0x2a, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0xf6, 0xd8, 0x5f, 0x9a, 0xd2, 0x0e, 0x4f, 0x12,
-  0x45, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0xb6, 0x35, 0x36, 0x25,
-  0x7d, 0x87, 0x5e, 0x12, 0x39, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0xb6, 0x35, 0x36, 0x25, 0x7d, 0x87, 0x5e, 0x12, 0x33, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0xc3, 0xaa, 0x2c, 0x11, 0xf8, 0xfc, 0x6c, 0x12,
-  0x1d, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x93, 0xda, 0xc9, 0xb6,
-  0x9f, 0x44, 0x6e, 0x12, 0x30, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
-  0xe6, 0x3d, 0xd7, 0x34, 0xc4, 0x48, 0xca, 0x12, 0x3d, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0xe6, 0x3d, 0xd7, 0x34, 0xc4, 0x48, 0xca, 0x12,
-  0x3d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0xe6, 0x3d, 0xd7, 0x34,
-  0xc4, 0x48, 0xca, 0x12, 0x3d, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0x38, 0x54, 0x1a, 0xee, 0xba, 0x01, 0xdb, 0x12, 0x1d, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0xb2, 0xf7, 0x58, 0x48, 0x4d, 0x5d, 0xe5, 0x12,
-  0x50, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x05, 0xf0, 0x54, 0xc5,
-  0x94, 0x68, 0xff, 0x12, 0x39, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0x05, 0xf0, 0x54, 0xc5, 0x94, 0x68, 0xff, 0x12, 0x32, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x05, 0xf0, 0x54, 0xc5, 0x94, 0x68, 0xff, 0x12,
-  0x45, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0xa4, 0x0f, 0xcc, 0x1e,
-  0xb9, 0x17, 0x1f, 0x13, 0x2f, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0xa4, 0x0f, 0xcc, 0x1e, 0xb9, 0x17, 0x1f, 0x13, 0x28, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x27, 0x59, 0x41, 0xdf, 0x34, 0x74, 0x37, 0x13,
-  0x4e, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x44, 0xb8, 0x3f, 0x62,
-  0x8d, 0x8b, 0x9b, 0x13, 0x1d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0xfd, 0x76, 0x6e, 0x06, 0xba, 0x80, 0xae, 0x13, 0x27, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0xf1, 0x8c, 0x16, 0x9c, 0x97, 0x12, 0xaf, 0x13,
-  0x33, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x0d, 0x58, 0xba, 0x47,
-  0x20, 0x2c, 0xbc, 0x13, 0x45, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x7f, 0x55, 0x20, 0x64, 0x79, 0xa6, 0xcd, 0x13, 0x00, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0x77, 0x3a, 0x59, 0x6d, 0x97, 0x5f, 0xd9, 0x13,
-  0x34, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xb1, 0x48, 0xb8, 0x40,
-  0x7d, 0x5e, 0xe0, 0x13, 0x3c, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0xc7, 0x26, 0x8d, 0x21, 0xcf, 0x2c, 0xf5, 0x13, 0x30, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0xd9, 0xf8, 0xca, 0xe5, 0x09, 0xea, 0x06, 0x14,
-  0x44, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x38, 0xe7, 0xda, 0x1b,
-  0xff, 0x6e, 0x0d, 0x14, 0x3d, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0x38, 0x39, 0x36, 0xb1, 0x35, 0x83, 0x10, 0x14, 0x45, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x06, 0x35, 0x8f, 0x77, 0xc7, 0xdd, 0x2f, 0x14,
-  0x32, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x9d, 0xe4, 0x29, 0xfc,
-  0x3e, 0x8e, 0x31, 0x14, 0x1f, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0x3a, 0x58, 0x9c, 0xe9, 0x28, 0x1e, 0x5b, 0x14, 0x32, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x49, 0xfd, 0xf2, 0x84, 0x68, 0xed, 0x5d, 0x14,
-  0x12, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x32, 0x9a, 0x42, 0xf5,
-  0x5f, 0x19, 0x68, 0x14, 0x46, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x0a, 0xa5, 0x52, 0x4a, 0x13, 0x77, 0x68, 0x14, 0x1d, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0xf7, 0x98, 0x8b, 0x0a, 0x38, 0xfe, 0xa7, 0x14,
-  0x1d, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf7, 0x98, 0x8b, 0x0a,
-  0x38, 0xfe, 0xa7, 0x14, 0x1d, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
-  0xf7, 0x98, 0x8b, 0x0a, 0x38, 0xfe, 0xa7, 0x14, 0x1d, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0xf7, 0x98, 0x8b, 0x0a, 0x38, 0xfe, 0xa7, 0x14,
-  0x1d, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x94, 0x38, 0xd7, 0x63,
-  0x1e, 0xe9, 0xb2, 0x14, 0x14, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0x04, 0xe4, 0x27, 0x2f, 0xc3, 0xf3, 0xc9, 0x14, 0x3c, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0x26, 0x17, 0xdb, 0x33, 0x44, 0x0d, 0xd1, 0x14,
-  0x45, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0xc2, 0xec, 0xcd, 0x71,
-  0xa9, 0x67, 0xfd, 0x14, 0x02, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0xc9, 0xaa, 0x0c, 0xcb, 0xde, 0xbe, 0x11, 0x15, 0x33, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0xc9, 0xaa, 0x0c, 0xcb, 0xde, 0xbe, 0x11, 0x15,
-  0x2b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0xaa, 0x84, 0x6a, 0xdc,
-  0xc4, 0x10, 0x14, 0x15, 0x14, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0xaa, 0x84, 0x6a, 0xdc, 0xc4, 0x10, 0x14, 0x15, 0x26, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0x20, 0xf1, 0xda, 0x5d, 0xfe, 0xb1, 0x33, 0x15,
-  0x32, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x20, 0xf1, 0xda, 0x5d,
-  0xfe, 0xb1, 0x33, 0x15, 0x45, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
-  0x5c, 0x60, 0x9c, 0x81, 0x2d, 0x45, 0x3d, 0x15, 0x17, 0x00, 0x00, 0x00,
-  0x3b, 0x00, 0x00, 0x00, 0x29, 0x39, 0x41, 0xe8, 0xba, 0xf6, 0x4b, 0x15,
-  0x0b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x29, 0x39, 0x41, 0xe8,
-  0xba, 0xf6, 0x4b, 0x15, 0x0b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x2a, 0x61, 0xdc, 0xd1, 0xf5, 0x33, 0x52, 0x15, 0x13, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0x46, 0x04, 0xa8, 0xd1, 0xb4, 0xb8, 0x7b, 0x15,
-  0x3b, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x46, 0x04, 0xa8, 0xd1,
-  0xb4, 0xb8, 0x7b, 0x15, 0x3c, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
-  0x46, 0x04, 0xa8, 0xd1, 0xb4, 0xb8, 0x7b, 0x15, 0x1f, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x46, 0x04, 0xa8, 0xd1, 0xb4, 0xb8, 0x7b, 0x15,
-  0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0xcd, 0x99,
-  0x0d, 0x69, 0x9b, 0x15, 0x3c, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
-  0x34, 0x60, 0xf9, 0x6b, 0xf3, 0x97, 0x9c, 0x15, 0x26, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0xd5, 0x68, 0xcd, 0x80, 0x68, 0x2f, 0xa8, 0x15,
-  0x02, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x0f, 0x4d, 0x1b, 0x91,
-  0x37, 0xfa, 0xd7, 0x15, 0x3c, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-  0x6e, 0x9f, 0x73, 0xa5, 0xdf, 0x3a, 0x0c, 0x16, 0x46, 0x00, 0x00, 0x00,
-  0x22, 0x00, 0x00, 0x00, 0xc2, 0x21, 0x8e, 0x79, 0x8c, 0xec, 0x24, 0x16,
-  0x21, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0xc2, 0x21, 0x8e, 0x79,
-  0x8c, 0xec, 0x24, 0x16, 0x0c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0xbf, 0xf9, 0xe5, 0x9a, 0x72, 0x9a, 0x3c, 0x16, 0x02, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0x67, 0x66, 0xb2, 0xb8, 0x83, 0x63, 0x52, 0x16,
-  0x1e, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0xee, 0xc2, 0x33, 0x6f,
-  0x0a, 0x66, 0x54, 0x16, 0x12, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0xa4, 0xb5, 0xc5, 0x65, 0x5f, 0xe3, 0x6f, 0x16, 0x4f, 0x00, 0x00, 0x00,
-  0x3d, 0x00, 0x00, 0x00, 0x40, 0xf0, 0xf4, 0xcb, 0xef, 0x86, 0xc6, 0x16,
-  0x13, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x40, 0xf0, 0xf4, 0xcb,
-  0xef, 0x86, 0xc6, 0x16, 0x13, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0x40, 0xf0, 0xf4, 0xcb, 0xef, 0x86, 0xc6, 0x16, 0x13, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x40, 0xf0, 0xf4, 0xcb, 0xef, 0x86, 0xc6, 0x16,
-  0x13, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x40, 0xf0, 0xf4, 0xcb,
-  0xef, 0x86, 0xc6, 0x16, 0x13, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0x40, 0xf0, 0xf4, 0xcb, 0xef, 0x86, 0xc6, 0x16, 0x13, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0x40, 0xf0, 0xf4, 0xcb, 0xef, 0x86, 0xc6, 0x16,
-  0x13, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x40, 0xf0, 0xf4, 0xcb,
-  0xef, 0x86, 0xc6, 0x16, 0x13, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0x40, 0xf0, 0xf4, 0xcb, 0xef, 0x86, 0xc6, 0x16, 0x13, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x40, 0xf0, 0xf4, 0xcb, 0xef, 0x86, 0xc6, 0x16,
-  0x13, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x40, 0xf0, 0xf4, 0xcb,
-  0xef, 0x86, 0xc6, 0x16, 0x13, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0x02, 0x43, 0x73, 0x9d, 0xa0, 0xd6, 0xd6, 0x16, 0x2a, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x02, 0x43, 0x73, 0x9d, 0xa0, 0xd6, 0xd6, 0x16,
-  0x4d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x02, 0x43, 0x73, 0x9d,
-  0xa0, 0xd6, 0xd6, 0x16, 0x2a, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x3a, 0xc4, 0x81, 0xa0, 0x33, 0x2d, 0xdf, 0x16, 0x0b, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x99, 0x3e, 0x6f, 0xb3, 0xa2, 0x1e, 0xec, 0x16,
-  0x1d, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x62, 0x84, 0xa2, 0xc9,
-  0x36, 0x5c, 0xec, 0x16, 0x0a, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x94, 0xb9, 0x05, 0xf5, 0xcd, 0x02, 0xf9, 0x16, 0x12, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0xd7, 0x20, 0x23, 0xa2, 0x16, 0x60, 0x1f, 0x17,
-  0x27, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x26, 0xe5, 0xdc, 0x2f,
-  0xfe, 0x4c, 0x4f, 0x17, 0x0b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0xe0, 0x10, 0xeb, 0x08, 0x90, 0x38, 0x50, 0x17, 0x01, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0xa8, 0xef, 0x21, 0xb6, 0x61, 0x37, 0x6f, 0x17,
-  0x33, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x9d, 0xd3, 0x3f, 0x31,
-  0x42, 0x8d, 0x92, 0x17, 0x33, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
-  0x18, 0xce, 0xfe, 0x69, 0xce, 0x82, 0xbc, 0x17, 0x4d, 0x00, 0x00, 0x00,
-  0x3b, 0x00, 0x00, 0x00, 0x3b, 0x4c, 0x37, 0x16, 0xac, 0xec, 0xc6, 0x17,
-  0x44, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x79, 0x6f, 0x3c, 0x77,
-  0x5d, 0xc5, 0xca, 0x17, 0x1d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x2c, 0xac, 0x39, 0x34, 0xd2, 0xa7, 0xce, 0x17, 0x1d, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0xbb, 0xa0, 0x5e, 0x7a, 0x22, 0xe5, 0xdc, 0x17,
-  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0b, 0x8a, 0x5f, 0x00,
-  0x19, 0xa9, 0xde, 0x17, 0x27, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x7d, 0xc3, 0x5b, 0x63, 0x9d, 0x0c, 0xe9, 0x17, 0x15, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0xf9, 0xe8, 0xac, 0xd6, 0xd4, 0x99, 0xe9, 0x17,
-  0x50, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xf1, 0x2e, 0x0e, 0x9c,
-  0xba, 0x6b, 0xf7, 0x17, 0x33, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0x6a, 0xd4, 0x3c, 0xd5, 0x86, 0xbf, 0xfe, 0x17, 0x1e, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x0f, 0x43, 0xe8, 0x43, 0x56, 0x63, 0xff, 0x17,
-  0x2a, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x1c, 0x06, 0x4e, 0xb2,
-  0xe2, 0x5d, 0x19, 0x18, 0x2f, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0xfd, 0x9a, 0x89, 0x73, 0xbe, 0x18, 0x31, 0x18, 0x30, 0x00, 0x00, 0x00,
-  0x42, 0x00, 0x00, 0x00, 0x98, 0x8a, 0x98, 0x59, 0x80, 0xaf, 0x38, 0x18,
-  0x1d, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x98, 0x8a, 0x98, 0x59,
-  0x80, 0xaf, 0x38, 0x18, 0x30, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0xeb, 0xf6, 0x2f, 0xc3, 0x75, 0xea, 0x4f, 0x18, 0x33, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0xc1, 0x59, 0xf8, 0x3a, 0xc7, 0x1e, 0x50, 0x18,
-  0x0b, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0xf2, 0x07, 0x18, 0x75,
-  0x47, 0x3e, 0x8b, 0x18, 0x0a, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x96, 0xd2, 0xb1, 0xb9, 0x24, 0x07, 0xa7, 0x18, 0x28, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x18, 0xe2, 0xe0, 0x08, 0x2e, 0x7e, 0xa8, 0x18,
-  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf7, 0x04, 0x8a, 0x7e,
-  0xd2, 0x46, 0xb0, 0x18, 0x3b, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0xd9, 0x67, 0x5f, 0xe6, 0xa3, 0x5d, 0xba, 0x18, 0x13, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x8a, 0xc2, 0xac, 0x30, 0xe2, 0x30, 0xd3, 0x18,
-  0x1d, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0xa7, 0x54, 0x4c, 0xbd,
-  0xde, 0x4e, 0xdd, 0x18, 0x14, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x45, 0x05, 0xe5, 0x2c, 0x43, 0x04, 0xfa, 0x18, 0x21, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x7b, 0x44, 0xb5, 0xca, 0x61, 0x18, 0x10, 0x19,
-  0x16, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x44, 0x35, 0x49, 0x4a,
-  0x70, 0x97, 0x27, 0x19, 0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x44, 0x28, 0x03, 0x9e, 0x78, 0x60, 0x3e, 0x19, 0x45, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x24, 0x6c, 0x5a, 0x11, 0xe2, 0xe8, 0x4c, 0x19,
-  0x2f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x3c, 0x6c, 0xc9, 0x6a,
-  0x01, 0x24, 0x6e, 0x19, 0x0a, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x3c, 0x6c, 0xc9, 0x6a, 0x01, 0x24, 0x6e, 0x19, 0x0a, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0xef, 0x12, 0x44, 0x01, 0x85, 0xe8, 0x92, 0x19,
-  0x44, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0xf8, 0xe9, 0xdd,
-  0x08, 0x24, 0xb8, 0x19, 0x45, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x9f, 0x30, 0x23, 0x21, 0xc7, 0xc5, 0x0d, 0x1a, 0x3a, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0x45, 0x47, 0x2f, 0x1a, 0x63, 0x16, 0x23, 0x1a,
-  0x3a, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xc3, 0x32, 0x0e, 0xe5,
-  0xda, 0x13, 0x31, 0x1a, 0x1b, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0x05, 0x31, 0x6a, 0xc5, 0x6d, 0x3a, 0x34, 0x1a, 0x14, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0x05, 0x4e, 0x11, 0xeb, 0xb7, 0x5a, 0x3c, 0x1a,
-  0x34, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xd4, 0xf5, 0xb5, 0xce,
-  0x64, 0xba, 0x3f, 0x1a, 0x3c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0xa9, 0xcf, 0x26, 0xfb, 0xe1, 0xcb, 0x51, 0x1a, 0x31, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0xa9, 0xcf, 0x26, 0xfb, 0xe1, 0xcb, 0x51, 0x1a,
-  0x31, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x8e, 0xc5, 0x03, 0x33,
-  0xb2, 0xe9, 0x5c, 0x1a, 0x29, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0xca, 0x90, 0x30, 0xe0, 0xe7, 0x46, 0x5f, 0x1a, 0x2f, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0xec, 0x56, 0x66, 0x6a, 0x69, 0xff, 0x6e, 0x1a,
-  0x32, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x17, 0x3e, 0xb3, 0x5e,
-  0x19, 0x73, 0x8e, 0x1a, 0x14, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
-  0xea, 0x42, 0x38, 0x9c, 0x16, 0xbe, 0x9d, 0x1a, 0x21, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x3e, 0x45, 0xd3, 0xc7, 0x85, 0xdb, 0xbf, 0x1a,
-  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0xee, 0x62, 0x79, 0x1f,
-  0x92, 0xc1, 0xc5, 0x1a, 0x1c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x54, 0x10, 0x7e, 0xa7, 0xea, 0x09, 0x1d, 0x1b, 0x15, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0x51, 0x9f, 0x35, 0x1c, 0xa8, 0x47, 0x26, 0x1b,
-  0x27, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x19, 0x00, 0x6e, 0x77,
-  0x78, 0xd9, 0x80, 0x1b, 0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x63, 0x21, 0x7a, 0x97, 0x7f, 0x2c, 0x87, 0x1b, 0x4f, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0xae, 0x51, 0xec, 0x58, 0x27, 0x4d, 0xd0, 0x1b,
-  0x0f, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x35, 0x39, 0x1a, 0x95,
-  0xfe, 0x71, 0xdf, 0x1b, 0x26, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0xcb, 0x88, 0x61, 0xfc, 0xb7, 0x4c, 0x2f, 0x1c, 0x09, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0x32, 0x02, 0x14, 0xce, 0x00, 0x77, 0x56, 0x1c,
-  0x3b, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0xb7, 0x0c, 0xb3, 0xf1,
-  0xe7, 0xa6, 0x5a, 0x1c, 0x47, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
-  0x06, 0xa9, 0xaa, 0x29, 0x88, 0x1a, 0x77, 0x1c, 0x45, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x25, 0x0d, 0xe5, 0xd1, 0xc0, 0x9d, 0x89, 0x1c,
-  0x29, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x25, 0x0d, 0xe5, 0xd1,
-  0xc0, 0x9d, 0x89, 0x1c, 0x44, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0xa9, 0xa2, 0x3b, 0xc7, 0xf6, 0xb0, 0xe6, 0x1c, 0x46, 0x00, 0x00, 0x00,
-  0x3e, 0x00, 0x00, 0x00, 0xed, 0xc1, 0x0b, 0x0f, 0x23, 0xc5, 0xea, 0x1c,
-  0x3a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x26, 0xe1, 0x98, 0x62,
-  0xeb, 0x87, 0x30, 0x1d, 0x25, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
-  0x1d, 0x8f, 0x48, 0xf6, 0xa7, 0xff, 0x37, 0x1d, 0x3a, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x2c, 0x16, 0x6a, 0x3d, 0x34, 0x30, 0x43, 0x1d,
-  0x1d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x7b, 0x93, 0xda, 0x97,
-  0x6a, 0x40, 0x46, 0x1d, 0x13, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0xeb, 0xe3, 0x76, 0x26, 0x23, 0xfe, 0x4d, 0x1d, 0x3d, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0x5a, 0xef, 0xf0, 0x2c, 0xe3, 0xab, 0x5c, 0x1d,
-  0x27, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x27, 0x66, 0x60, 0x61,
-  0x43, 0x6f, 0x62, 0x1d, 0x1e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x60, 0x8e, 0x20, 0xc7, 0xf5, 0x30, 0x74, 0x1d, 0x4e, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x91, 0xcb, 0xf5, 0x87, 0x8b, 0x60, 0x84, 0x1d,
-  0x29, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x53, 0x1d, 0x83, 0x13,
-  0x5f, 0x90, 0x8c, 0x1d, 0x43, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0xb9, 0xf9, 0x66, 0xe8, 0xd8, 0x4e, 0x91, 0x1d, 0x20, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x05, 0xf5, 0x09, 0xba, 0xbd, 0xd5, 0xdc, 0x1d,
-  0x34, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x05, 0xf5, 0x09, 0xba,
-  0xbd, 0xd5, 0xdc, 0x1d, 0x0d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0xbe, 0xc2, 0x29, 0xf4, 0x1d, 0x8a, 0xe5, 0x1d, 0x0a, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x69, 0xb2, 0x62, 0xaa, 0x38, 0x07, 0xed, 0x1d,
-  0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x4b, 0xa5, 0xf5, 0x3d,
-  0xc2, 0x10, 0xf1, 0x1d, 0x0b, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0x8a, 0xed, 0x07, 0x09, 0x9b, 0x72, 0x1e, 0x1e, 0x3a, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x8a, 0xed, 0x07, 0x09, 0x9b, 0x72, 0x1e, 0x1e,
-  0x2a, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0xbc, 0xba, 0xae, 0x13,
-  0xc7, 0xb7, 0x40, 0x1e, 0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x62, 0x78, 0x2e, 0xb2, 0x8f, 0x24, 0x45, 0x1e, 0x15, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x62, 0x78, 0x2e, 0xb2, 0x8f, 0x24, 0x45, 0x1e,
-  0x14, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x62, 0x78, 0x2e, 0xb2,
-  0x8f, 0x24, 0x45, 0x1e, 0x15, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-  0x75, 0x3d, 0x69, 0xbf, 0x94, 0x54, 0x64, 0x1e, 0x3d, 0x00, 0x00, 0x00,
-  0x3b, 0x00, 0x00, 0x00, 0x2c, 0x6e, 0x49, 0x58, 0x63, 0xf3, 0x6f, 0x1e,
-  0x3d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0xf6, 0x59, 0x5b, 0xda,
-  0xe8, 0x25, 0x87, 0x1e, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0x8f, 0x19, 0x44, 0x16, 0x07, 0x1a, 0x8e, 0x1e, 0x44, 0x00, 0x00, 0x00,
-  0x22, 0x00, 0x00, 0x00, 0xb6, 0xa4, 0xf8, 0xcd, 0xb8, 0xbb, 0xc3, 0x1e,
-  0x3e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x83, 0xfb, 0xc5, 0x87,
-  0x3f, 0xdc, 0xd4, 0x1e, 0x4f, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
-  0x83, 0xfb, 0xc5, 0x87, 0x3f, 0xdc, 0xd4, 0x1e, 0x3b, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0x3e, 0x89, 0x99, 0xef, 0x40, 0xed, 0x1d, 0x1f,
-  0x0d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xb8, 0xd6, 0x8a, 0x30,
-  0x10, 0x9f, 0x8c, 0x1f, 0x45, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x5f, 0xb1, 0xa1, 0x49, 0x9c, 0x19, 0xa1, 0x1f, 0x25, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0x35, 0x93, 0xbb, 0xcc, 0x47, 0x90, 0xaf, 0x1f,
-  0x0b, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x91, 0x05, 0x63, 0x1b,
-  0xb5, 0xa5, 0xce, 0x1f, 0x30, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
-  0x9e, 0x3a, 0x2b, 0xcd, 0x36, 0x7a, 0xd0, 0x1f, 0x20, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x4f, 0xcb, 0x76, 0xfe, 0x91, 0xe1, 0xe7, 0x1f,
-  0x02, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x75, 0x38, 0xd6, 0xf2,
-  0x05, 0xd0, 0x08, 0x20, 0x21, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0xbc, 0xaf, 0x03, 0x61, 0x12, 0x6c, 0x1c, 0x20, 0x3a, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0xbc, 0xaf, 0x03, 0x61, 0x12, 0x6c, 0x1c, 0x20,
-  0x44, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0xe0, 0x6f, 0x4b, 0x47,
-  0x8b, 0x6d, 0x26, 0x20, 0x20, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
-  0xd1, 0x3b, 0x41, 0x0a, 0xd3, 0xae, 0x46, 0x20, 0x14, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0xd1, 0x06, 0x3c, 0xc2, 0x27, 0x3f, 0x53, 0x20,
-  0x39, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xae, 0x3c, 0xdf, 0x60,
-  0x5e, 0x8c, 0xac, 0x20, 0x13, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0x1a, 0x8d, 0xa5, 0x51, 0xc7, 0x4a, 0xc3, 0x20, 0x1e, 0x00, 0x00, 0x00,
-  0x22, 0x00, 0x00, 0x00, 0x13, 0xe1, 0x10, 0x8a, 0xf8, 0x4d, 0xdc, 0x20,
-  0x20, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x64, 0xed, 0x0c, 0xa1,
-  0xc2, 0xc9, 0xe3, 0x20, 0x14, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0xad, 0xd7, 0x5e, 0x42, 0x09, 0xce, 0xf1, 0x20, 0x33, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x60, 0xb3, 0x1c, 0x59, 0x1f, 0x09, 0x20, 0x21,
-  0x02, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0xf1, 0x16, 0xf2, 0x0e,
-  0xf4, 0xc0, 0x21, 0x21, 0x1e, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0xc8, 0xa9, 0xa3, 0x34, 0x9a, 0x18, 0x8d, 0x21, 0x15, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x82, 0xe6, 0x9e, 0x21, 0xc7, 0xe8, 0xc9, 0x21,
-  0x1d, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x82, 0xe6, 0x9e, 0x21,
-  0xc7, 0xe8, 0xc9, 0x21, 0x1d, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x9e, 0x7d, 0x57, 0x8f, 0xd9, 0x9a, 0xd2, 0x21, 0x1e, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x2b, 0xef, 0xfc, 0xbb, 0x22, 0x39, 0xf8, 0x21,
-  0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x7f, 0x96, 0xb9, 0x32,
-  0xdd, 0x32, 0x00, 0x22, 0x3a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0xa8, 0x76, 0x30, 0x01, 0xe8, 0x4e, 0x0d, 0x22, 0x42, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x96, 0xbf, 0x54, 0x85, 0x90, 0xc2, 0x31, 0x22,
-  0x46, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x96, 0xbf, 0x54, 0x85,
-  0x90, 0xc2, 0x31, 0x22, 0x46, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
-  0x96, 0xbf, 0x54, 0x85, 0x90, 0xc2, 0x31, 0x22, 0x45, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0xaf, 0x8b, 0xfb, 0x86, 0x0f, 0xbb, 0x36, 0x22,
-  0x3b, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0xfd, 0xbe, 0x0e, 0xe5,
-  0x60, 0xf1, 0x80, 0x22, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0xfd, 0xbe, 0x0e, 0xe5, 0x60, 0xf1, 0x80, 0x22, 0x1b, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0xfd, 0xbe, 0x0e, 0xe5, 0x60, 0xf1, 0x80, 0x22,
-  0x13, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xfd, 0xbe, 0x0e, 0xe5,
-  0x60, 0xf1, 0x80, 0x22, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x65, 0x97, 0x74, 0xc5, 0xf4, 0xf4, 0x90, 0x22, 0x00, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x2b, 0x9f, 0xdb, 0x97, 0xc8, 0x0d, 0xaf, 0x22,
-  0x2a, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x1d, 0x9a, 0x3c, 0xeb,
-  0x62, 0xc4, 0xbc, 0x22, 0x1c, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
-  0x1d, 0x9a, 0x3c, 0xeb, 0x62, 0xc4, 0xbc, 0x22, 0x26, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0x1d, 0x9a, 0x3c, 0xeb, 0x62, 0xc4, 0xbc, 0x22,
-  0x16, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x97, 0x9c, 0x57, 0x8d,
-  0x04, 0x03, 0xf0, 0x22, 0x26, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-  0x3a, 0xb4, 0x8e, 0x83, 0x79, 0xd3, 0xfd, 0x22, 0x46, 0x00, 0x00, 0x00,
-  0x45, 0x00, 0x00, 0x00, 0x08, 0xa5, 0x98, 0xb8, 0x6e, 0x2e, 0x0b, 0x23,
-  0x20, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xa4, 0x30, 0xae, 0x4c,
-  0x7a, 0x00, 0x17, 0x23, 0x1d, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x46, 0xea, 0x31, 0x2d, 0xfb, 0xe5, 0x55, 0x23, 0x26, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x27, 0x8c, 0x57, 0x70, 0x5c, 0x5a, 0x97, 0x23,
-  0x25, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x13, 0xec, 0xf1, 0x04,
-  0x60, 0xad, 0xa6, 0x23, 0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x62, 0x11, 0xca, 0x33, 0xe9, 0xd1, 0xbb, 0x23, 0x0b, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x39, 0xc9, 0x7d, 0x03, 0x12, 0xa8, 0xd1, 0x23,
-  0x13, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0xc3, 0x5e, 0x6b, 0x58,
-  0xf3, 0xc1, 0xd2, 0x23, 0x16, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x66, 0x19, 0xba, 0xd3, 0x63, 0x95, 0xd4, 0x23, 0x29, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0x3a, 0x99, 0x7e, 0x94, 0x8e, 0x0c, 0xd5, 0x23,
-  0x3e, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xef, 0x25, 0x0d, 0xfa,
-  0x04, 0x42, 0xd8, 0x23, 0x4f, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0x58, 0xe0, 0xf5, 0x1d, 0x7e, 0xdc, 0xe4, 0x23, 0x2e, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x58, 0xe0, 0xf5, 0x1d, 0x7e, 0xdc, 0xe4, 0x23,
-  0x16, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0b, 0x82, 0x45, 0xa2,
-  0x56, 0xf2, 0xe8, 0x23, 0x27, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0x4a, 0x17, 0x9d, 0x39, 0xa5, 0x00, 0xf9, 0x23, 0x09, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x34, 0x75, 0xae, 0x96, 0x2d, 0x30, 0xfc, 0x23,
-  0x4f, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0xa9, 0x9a, 0x11, 0xd2,
-  0xe7, 0x20, 0x07, 0x24, 0x17, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0xa9, 0x9a, 0x11, 0xd2, 0xe7, 0x20, 0x07, 0x24, 0x16, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x64, 0x27, 0xd6, 0x58, 0x0b, 0x02, 0x11, 0x24,
-  0x29, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x0d, 0xc6, 0xb5, 0xb3,
-  0x60, 0x70, 0x2e, 0x24, 0x01, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
-  0x49, 0xa0, 0x5e, 0x84, 0x27, 0x53, 0x40, 0x24, 0x3e, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x9b, 0x1c, 0x5a, 0x51, 0x3e, 0x93, 0x4a, 0x24,
-  0x46, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x57, 0x17, 0xac, 0x46,
-  0x6a, 0x16, 0x4f, 0x24, 0x42, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x9e, 0xcf, 0x8e, 0x31, 0xb8, 0x61, 0x65, 0x24, 0x3e, 0x00, 0x00, 0x00,
-  0x46, 0x00, 0x00, 0x00, 0x5a, 0x33, 0xb2, 0x02, 0x4a, 0x97, 0x68, 0x24,
-  0x14, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x5a, 0x33, 0xb2, 0x02,
-  0x4a, 0x97, 0x68, 0x24, 0x1d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
-  0x94, 0x64, 0x62, 0x5f, 0x8b, 0xaf, 0x8e, 0x24, 0x3b, 0x00, 0x00, 0x00,
-  0x37, 0x00, 0x00, 0x00, 0x3f, 0x97, 0x01, 0xe4, 0x39, 0x32, 0x9f, 0x24,
-  0x1c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x3f, 0x97, 0x01, 0xe4,
-  0x39, 0x32, 0x9f, 0x24, 0x2f, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00,
-  0xa6, 0x2e, 0x0e, 0xf7, 0x3f, 0xb4, 0xc5, 0x24, 0x2f, 0x00, 0x00, 0x00,
-  0x43, 0x00, 0x00, 0x00, 0x6e, 0xb2, 0xe4, 0x7f, 0xf8, 0xf7, 0xcd, 0x24,
-  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0xb0, 0xfd, 0x30, 0x49,
-  0xf9, 0x26, 0xef, 0x24, 0x3b, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
-  0xbc, 0x18, 0x17, 0x67, 0xdc, 0xd1, 0x0d, 0x25, 0x33, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0xbc, 0x18, 0x17, 0x67, 0xdc, 0xd1, 0x0d, 0x25,
-  0x2f, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x7f, 0x2d, 0xd2, 0x65,
-  0x8d, 0xa7, 0x2d, 0x25, 0x33, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0xa3, 0xa4, 0x9f, 0x05, 0xcb, 0x6e, 0x47, 0x25, 0x32, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x9f, 0x35, 0x46, 0x3a, 0x81, 0xa9, 0x5c, 0x25,
-  0x1e, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x9f, 0x35, 0x46, 0x3a,
-  0x81, 0xa9, 0x5c, 0x25, 0x3c, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-  0xbd, 0xd6, 0xd1, 0x17, 0x8f, 0xe7, 0x5e, 0x25, 0x16, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0xa0, 0x2d, 0x23, 0x07, 0xec, 0xd9, 0x6d, 0x25,
-  0x29, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x71, 0xb2, 0x9c, 0x2d,
-  0x9c, 0x70, 0x71, 0x25, 0x18, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x71, 0xb2, 0x9c, 0x2d, 0x9c, 0x70, 0x71, 0x25, 0x1d, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x84, 0x61, 0x2e, 0xaa, 0x33, 0x6b, 0xab, 0x25,
-  0x4f, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xdb, 0x66, 0x7a, 0x17,
-  0x2b, 0x06, 0xba, 0x25, 0x26, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0xd9, 0x84, 0xe2, 0x90, 0x52, 0x5e, 0xbc, 0x25, 0x1f, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0xef, 0x7f, 0x12, 0x9c, 0xec, 0x8a, 0xe3, 0x25,
-  0x3a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xb1, 0xc0, 0x7d, 0xf3,
-  0xd5, 0x34, 0x02, 0x26, 0x3a, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0x82, 0xf7, 0xe9, 0x97, 0x4a, 0xbf, 0x30, 0x26, 0x3e, 0x00, 0x00, 0x00,
-  0x46, 0x00, 0x00, 0x00, 0x7a, 0x3a, 0xbb, 0xec, 0xd8, 0x2f, 0x49, 0x26,
-  0x46, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x83, 0xa6, 0x86, 0xa9,
-  0xee, 0xc2, 0x7a, 0x26, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x60, 0xff, 0x2e, 0x82, 0x40, 0xe7, 0x98, 0x26, 0x16, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x7e, 0x30, 0x75, 0xfe, 0x82, 0x3c, 0x9e, 0x26,
-  0x50, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xb8, 0xe6, 0x36, 0x44,
-  0xa1, 0x41, 0xbf, 0x26, 0x1d, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
-  0x5a, 0x4f, 0x34, 0xc8, 0x78, 0xa6, 0xe7, 0x26, 0x26, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0xa6, 0x52, 0xdd, 0x5c, 0xd0, 0x7d, 0x0d, 0x27,
-  0x4d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x53, 0x0d, 0x40, 0x71,
-  0xb0, 0x0b, 0x13, 0x27, 0x27, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x6d, 0x8a, 0xfb, 0x8b, 0x6e, 0xae, 0x24, 0x27, 0x16, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x9a, 0xc9, 0x27, 0x0a, 0x91, 0x40, 0x3c, 0x27,
-  0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x31, 0x10, 0x5b, 0xa8,
-  0x09, 0x53, 0x3f, 0x27, 0x38, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0x31, 0x10, 0x5b, 0xa8, 0x09, 0x53, 0x3f, 0x27, 0x2b, 0x00, 0x00, 0x00,
-  0x3b, 0x00, 0x00, 0x00, 0xb0, 0xc7, 0x7e, 0xb7, 0xc0, 0x11, 0x51, 0x27,
-  0x15, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x3c, 0x17, 0x1a, 0x36,
-  0xd9, 0x5b, 0x71, 0x27, 0x0b, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00,
-  0xd6, 0xd4, 0x7d, 0x65, 0xcc, 0xdf, 0x75, 0x27, 0x0d, 0x00, 0x00, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x6a, 0x42, 0xb6, 0x25, 0x8a, 0x5e, 0x7e, 0x27,
-  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x96, 0xed, 0x7d,
-  0xbe, 0xff, 0xa2, 0x27, 0x2a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0xa8, 0x10, 0xe5, 0xc8, 0xbc, 0x42, 0xba, 0x27, 0x32, 0x00, 0x00, 0x00,
-  0x2e, 0x00, 0x00, 0x00, 0xc1, 0xb5, 0x1d, 0x7d, 0xce, 0x07, 0xd2, 0x27,
-  0x4e, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xd8, 0x3d, 0x9e, 0xb7,
-  0x0a, 0xbc, 0x00, 0x28, 0x2a, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x26, 0x0d, 0xfd, 0x46, 0xd8, 0x18, 0x2e, 0x28, 0x1e, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x28, 0x84, 0x0e, 0x82, 0xf0, 0x64, 0x5d, 0x28,
-  0x45, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x28, 0x84, 0x0e, 0x82,
-  0xf0, 0x64, 0x5d, 0x28, 0x3b, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x37, 0x24, 0xd7, 0x8a, 0x62, 0x91, 0x76, 0x28, 0x15, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0x84, 0xe6, 0x76, 0x6f, 0x9d, 0xd3, 0x80, 0x28,
-  0x3c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x20, 0x7c, 0xe3, 0x81,
-  0xdc, 0x49, 0x85, 0x28, 0x29, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00,
-  0x55, 0x02, 0x12, 0x64, 0x5d, 0x66, 0x86, 0x28, 0x3c, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0xda, 0x16, 0xbf, 0x9d, 0x02, 0x4c, 0x9e, 0x28,
-  0x15, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x3f, 0xc9, 0x68, 0x29,
-  0x75, 0xc4, 0xa4, 0x28, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0xa5, 0x9d, 0xe1, 0xb6, 0x7d, 0x80, 0xba, 0x28, 0x29, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x67, 0x65, 0xfd, 0xf0, 0x36, 0x4d, 0xcc, 0x28,
-  0x13, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xe7, 0x7f, 0x16, 0xe8,
-  0x92, 0x81, 0xcc, 0x28, 0x3a, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x24, 0xd9, 0x0c, 0xf6, 0x56, 0x09, 0xd6, 0x28, 0x3c, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0xd1, 0xd4, 0x2f, 0xc5, 0xd1, 0x4a, 0xd9, 0x28,
-  0x3c, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0xd1, 0xd4, 0x2f, 0xc5,
-  0xd1, 0x4a, 0xd9, 0x28, 0x3c, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
-  0xed, 0x9a, 0x16, 0xb0, 0x94, 0xb6, 0x0a, 0x29, 0x03, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x48, 0xeb, 0x5a, 0x3a, 0x3d, 0x37, 0x0d, 0x29,
-  0x2a, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0xf7, 0x4c, 0x4b, 0x45,
-  0x5a, 0xb0, 0x9d, 0x29, 0x33, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0xf7, 0x4c, 0x4b, 0x45, 0x5a, 0xb0, 0x9d, 0x29, 0x44, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0xf7, 0x4c, 0x4b, 0x45, 0x5a, 0xb0, 0x9d, 0x29,
-  0x33, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xc6, 0x4f, 0xe5, 0xaf,
-  0x0e, 0x5a, 0xbc, 0x29, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x6d, 0x2c, 0x84, 0x9b, 0x2c, 0xec, 0xd0, 0x29, 0x30, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0x3b, 0x2a, 0xa3, 0x63, 0xbc, 0x00, 0xe5, 0x29,
-  0x50, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0xe2, 0x7e, 0x38, 0x10,
-  0x5e, 0xc4, 0xeb, 0x29, 0x2a, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x46, 0x54, 0x90, 0xa5, 0xd0, 0x46, 0x15, 0x2a, 0x31, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0xb4, 0x63, 0xeb, 0x92, 0x25, 0x87, 0x3b, 0x2a,
-  0x15, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xb4, 0x63, 0xeb, 0x92,
-  0x25, 0x87, 0x3b, 0x2a, 0x2a, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0x18, 0x5a, 0x87, 0x2d, 0xed, 0x22, 0x61, 0x2a, 0x44, 0x00, 0x00, 0x00,
-  0x42, 0x00, 0x00, 0x00, 0x22, 0xe5, 0x20, 0x38, 0x38, 0xd5, 0x95, 0x2a,
-  0x09, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x5f, 0x2a, 0x91, 0xd5,
-  0x40, 0x15, 0xbb, 0x2a, 0x4d, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x2b, 0x92, 0x68, 0x49, 0x7b, 0x8f, 0xbb, 0x2a, 0x0b, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x0e, 0xcc, 0xd6, 0xb7, 0xce, 0x2a,
-  0x27, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x2b, 0x8b, 0xd2, 0x4a,
-  0xc9, 0xbf, 0xef, 0x2a, 0x4d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-  0xf4, 0x45, 0xee, 0x9e, 0x5a, 0x27, 0xf3, 0x2a, 0x3b, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0xc2, 0xf1, 0x8e, 0x84, 0x2f, 0x6a, 0xf5, 0x2a,
-  0x21, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x27, 0xd4, 0xd7, 0x82,
-  0xd4, 0xf7, 0x07, 0x2b, 0x21, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x27, 0xd4, 0xd7, 0x82, 0xd4, 0xf7, 0x07, 0x2b, 0x16, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x27, 0xd4, 0xd7, 0x82, 0xd4, 0xf7, 0x07, 0x2b,
-  0x29, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0xc8, 0x8c, 0x87, 0x2e,
-  0x96, 0x0b, 0x15, 0x2b, 0x30, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0xb6, 0xdd, 0xaf, 0xb2, 0xfe, 0x19, 0x18, 0x2b, 0x13, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0xc4, 0xa8, 0x08, 0x7d, 0xe3, 0x2c, 0x35, 0x2b,
-  0x45, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x95, 0x6c, 0x83, 0xc0,
-  0x43, 0xe1, 0x61, 0x2b, 0x0c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0xde, 0x3a, 0x62, 0xfe, 0x1e, 0xf0, 0x90, 0x2b, 0x16, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x0e, 0x7f, 0x89, 0xbf, 0xf7, 0x00, 0x98, 0x2b,
-  0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x11, 0xd3, 0x92, 0xaf,
-  0x57, 0x72, 0x99, 0x2b, 0x2f, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0xa5, 0xfa, 0x70, 0x91, 0x1d, 0x4e, 0xb7, 0x2b, 0x18, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x4d, 0x74, 0xf0, 0x62, 0x3e, 0xc1, 0xb7, 0x2b,
-  0x0b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x5c, 0x26, 0x7b, 0x3b,
-  0x3a, 0x48, 0xb8, 0x2b, 0x14, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0xe6, 0xe7, 0x97, 0x40, 0xfa, 0xd5, 0xc8, 0x2b, 0x03, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0xcd, 0xf8, 0x95, 0x21, 0x88, 0xf4, 0xe5, 0x2b,
-  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x52, 0xb6, 0xa8, 0x2a,
-  0xcf, 0x20, 0xe6, 0x2b, 0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x3d, 0xda, 0x63, 0xa1, 0x82, 0x0c, 0xfd, 0x2b, 0x3b, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x3d, 0xda, 0x63, 0xa1, 0x82, 0x0c, 0xfd, 0x2b,
-  0x1d, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x7c, 0x9e, 0x57, 0xda,
-  0x34, 0x21, 0x05, 0x2c, 0x39, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x2f, 0x70, 0x68, 0x3a, 0xe4, 0xbc, 0x24, 0x2c, 0x33, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x39, 0x1c, 0x5e, 0x6a, 0xad, 0x00, 0x32, 0x2c,
-  0x47, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x62, 0xe0, 0x79, 0xd3,
-  0xe7, 0x82, 0x65, 0x2c, 0x03, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0x21, 0xb4, 0xff, 0x22, 0xa3, 0xc8, 0x6e, 0x2c, 0x28, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x2c, 0x4e, 0xc1, 0x97, 0x4f, 0xac, 0xd1, 0x2c,
-  0x1d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xa0, 0x52, 0x66, 0xf7,
-  0x8d, 0xb5, 0xea, 0x2c, 0x3b, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0xe9, 0x24, 0x7c, 0xf0, 0x66, 0xb2, 0xed, 0x2c, 0x31, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0xdf, 0x4b, 0x4d, 0x33, 0xf7, 0xe3, 0xfb, 0x2c,
-  0x21, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0xdf, 0x4b, 0x4d, 0x33,
-  0xf7, 0xe3, 0xfb, 0x2c, 0x30, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x34, 0xb5, 0xfe, 0x34, 0xb9, 0x15, 0x12, 0x2d, 0x35, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0xea, 0x11, 0xa4, 0xc8, 0xac, 0x8f, 0x20, 0x2d,
-  0x0b, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x2f, 0x28, 0x42, 0x89,
-  0xe6, 0xb6, 0x33, 0x2d, 0x09, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
-  0x75, 0xd7, 0x6e, 0xbb, 0xe6, 0xfc, 0x41, 0x2d, 0x33, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0xa2, 0x05, 0x78, 0x4b, 0x0c, 0x73, 0x4b, 0x2d,
-  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x35, 0x60, 0xfe, 0xf9,
-  0xef, 0xb7, 0x4e, 0x2d, 0x3a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x56, 0x31, 0x77, 0xde, 0xb7, 0x51, 0x54, 0x2d, 0x1b, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0x61, 0x3a, 0x62, 0x90, 0x05, 0x1e, 0x5a, 0x2d,
-  0x45, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x05, 0x71, 0x3c, 0x11,
-  0x29, 0xd2, 0x76, 0x2d, 0x37, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0x05, 0x71, 0x3c, 0x11, 0x29, 0xd2, 0x76, 0x2d, 0x17, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0xdd, 0x7f, 0xe6, 0x9b, 0x3d, 0xed, 0x7f, 0x2d,
-  0x31, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x9e, 0x87, 0x4a, 0xba,
-  0xa9, 0x99, 0x89, 0x2d, 0x3d, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0xd2, 0xb4, 0xfc, 0x5e, 0x20, 0x0e, 0xa0, 0x2d, 0x35, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0xa2, 0x29, 0xe7, 0xde, 0xaf, 0x4e, 0xa1, 0x2d,
-  0x2b, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x6a, 0x1e, 0xa3, 0xb9,
-  0x2c, 0x68, 0xc3, 0x2d, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0x2e, 0x14, 0xc9, 0xa1, 0xb4, 0x28, 0x16, 0x2e, 0x46, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0xf2, 0x88, 0x65, 0xc5, 0xa3, 0x90, 0x2e, 0x2e,
-  0x13, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xfe, 0xf5, 0xc3, 0x62,
-  0x71, 0xc2, 0x2e, 0x2e, 0x46, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0xfe, 0xf5, 0xc3, 0x62, 0x71, 0xc2, 0x2e, 0x2e, 0x46, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0xfe, 0xf5, 0xc3, 0x62, 0x71, 0xc2, 0x2e, 0x2e,
-  0x46, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0xfe, 0xf5, 0xc3, 0x62,
-  0x71, 0xc2, 0x2e, 0x2e, 0x46, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0xfe, 0xf5, 0xc3, 0x62, 0x71, 0xc2, 0x2e, 0x2e, 0x46, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0xfe, 0xf5, 0xc3, 0x62, 0x71, 0xc2, 0x2e, 0x2e,
-  0x46, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xfe, 0xf5, 0xc3, 0x62,
-  0x71, 0xc2, 0x2e, 0x2e, 0x46, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0xfe, 0xf5, 0xc3, 0x62, 0x71, 0xc2, 0x2e, 0x2e, 0x46, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0xfe, 0xf5, 0xc3, 0x62, 0x71, 0xc2, 0x2e, 0x2e,
-  0x46, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0xfe, 0xf5, 0xc3, 0x62,
-  0x71, 0xc2, 0x2e, 0x2e, 0x46, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x31, 0xca, 0x32, 0x23, 0x08, 0xd6, 0x5e, 0x2e, 0x17, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0x03, 0x15, 0x20, 0xbc, 0x72, 0xf7, 0x77, 0x2e,
-  0x4f, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x39, 0x2b, 0x68, 0x43,
-  0xe6, 0x92, 0x8b, 0x2e, 0x33, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x74, 0x71, 0xa9, 0x04, 0x04, 0xb1, 0x02, 0x2f, 0x26, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0x8c, 0x7f, 0x26, 0x43, 0x52, 0x65, 0x03, 0x2f,
-  0x4e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x37, 0x53, 0x7f, 0xc5,
-  0x63, 0xdd, 0x42, 0x2f, 0x2a, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x60, 0xc5, 0xab, 0x83, 0x06, 0xd0, 0x76, 0x2f, 0x0b, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0xed, 0x73, 0xc3, 0x97, 0xaa, 0x2b, 0x77, 0x2f,
-  0x21, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x7a, 0xbf, 0x94, 0xe2,
-  0x22, 0xb4, 0xa8, 0x2f, 0x2a, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0xc9, 0x5e, 0x54, 0x12, 0x6e, 0xf0, 0xc6, 0x2f, 0x14, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0x9a, 0xfb, 0x69, 0x35, 0xa0, 0x20, 0xcf, 0x2f,
-  0x28, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x94, 0xf7, 0xd7, 0x82,
-  0x25, 0x71, 0xd8, 0x2f, 0x26, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x5f, 0x02, 0x55, 0x0a, 0x89, 0x7a, 0xdd, 0x2f, 0x13, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0xe1, 0x0a, 0x45, 0x93, 0xc9, 0x7f, 0xdf, 0x2f,
-  0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xe7, 0xda, 0xb6, 0x62,
-  0x02, 0xf6, 0xe1, 0x2f, 0x2f, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00,
-  0x5e, 0xc0, 0xf6, 0x20, 0x13, 0x36, 0xf2, 0x2f, 0x20, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0xd5, 0x87, 0xfd, 0x41, 0x17, 0xd8, 0xf4, 0x2f,
-  0x16, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf7, 0x48, 0x6f, 0xa4,
-  0xdf, 0xab, 0x01, 0x30, 0x3a, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0xc0, 0x27, 0x63, 0xe0, 0xb2, 0xd4, 0x03, 0x30, 0x34, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x37, 0x7c, 0xc0, 0xd5, 0x2c, 0x0c, 0x3f, 0x30,
-  0x0a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0a, 0xf8, 0x7c, 0x7f,
-  0x4e, 0x99, 0x54, 0x30, 0x4d, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0x0a, 0xf8, 0x7c, 0x7f, 0x4e, 0x99, 0x54, 0x30, 0x33, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x0a, 0xf8, 0x7c, 0x7f, 0x4e, 0x99, 0x54, 0x30,
-  0x4d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x0a, 0xf8, 0x7c, 0x7f,
-  0x4e, 0x99, 0x54, 0x30, 0x33, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-  0xbe, 0xd5, 0xdc, 0x91, 0xfc, 0xc5, 0x70, 0x30, 0x28, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0x47, 0xbe, 0xf4, 0x62, 0x57, 0xe0, 0x85, 0x30,
-  0x3a, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x76, 0x5e, 0xda, 0x3f,
-  0x50, 0xab, 0x8e, 0x30, 0x20, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0xa3, 0x3e, 0x70, 0x8e, 0xcd, 0xb3, 0xa1, 0x30, 0x46, 0x00, 0x00, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0xa3, 0x3e, 0x70, 0x8e, 0xcd, 0xb3, 0xa1, 0x30,
-  0x31, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xa9, 0x71, 0xe9, 0xba,
-  0xa0, 0x8c, 0xca, 0x30, 0x46, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x89, 0x12, 0x0c, 0xb2, 0x47, 0x35, 0xfb, 0x30, 0x15, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x70, 0x04, 0x8a, 0x9c, 0x52, 0x10, 0x00, 0x31,
-  0x3c, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x33, 0x48, 0xcc, 0x2f,
-  0xa7, 0x9a, 0x13, 0x31, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0x74, 0xf9, 0x93, 0x1c, 0x5b, 0xcc, 0x36, 0x31, 0x3e, 0x00, 0x00, 0x00,
-  0x3d, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x64, 0x5b, 0x39, 0x2d, 0x46, 0x31,
-  0x4f, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x64, 0x5b,
-  0x39, 0x2d, 0x46, 0x31, 0x33, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x00, 0x1e, 0x64, 0x5b, 0x39, 0x2d, 0x46, 0x31, 0x4f, 0x00, 0x00, 0x00,
-  0x46, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x64, 0x5b, 0x39, 0x2d, 0x46, 0x31,
-  0x34, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x64, 0x5b,
-  0x39, 0x2d, 0x46, 0x31, 0x4f, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
-  0xfa, 0xc4, 0xc6, 0xb7, 0x63, 0x94, 0x61, 0x31, 0x2f, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0x26, 0x85, 0xc6, 0x1e, 0x52, 0x2b, 0x70, 0x31,
-  0x34, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x72, 0x25, 0x7f, 0xcc,
-  0x9d, 0xb3, 0x9c, 0x31, 0x3b, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x72, 0x25, 0x7f, 0xcc, 0x9d, 0xb3, 0x9c, 0x31, 0x31, 0x00, 0x00, 0x00,
-  0x1b, 0x00, 0x00, 0x00, 0x72, 0x25, 0x7f, 0xcc, 0x9d, 0xb3, 0x9c, 0x31,
-  0x20, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0xf9, 0x34, 0x1d, 0x85,
-  0xc3, 0xce, 0x9d, 0x31, 0x17, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x6a, 0x10, 0xd3, 0xbf, 0x6e, 0x9d, 0xa2, 0x31, 0x00, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x6a, 0x10, 0xd3, 0xbf, 0x6e, 0x9d, 0xa2, 0x31,
-  0x12, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x7b, 0xc2, 0x8d, 0x65,
-  0x19, 0xd5, 0xb2, 0x31, 0x39, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0xf7, 0xcd, 0x3b, 0xdf, 0xbb, 0x43, 0xbd, 0x31, 0x47, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0x98, 0x15, 0xa6, 0x8a, 0xb2, 0x44, 0xc3, 0x31,
-  0x3c, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x23, 0xe9, 0xbd, 0x06,
-  0xd2, 0x25, 0x19, 0x32, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0x90, 0x51, 0xf3, 0x8d, 0x74, 0x8b, 0x2c, 0x32, 0x29, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0xfb, 0xfc, 0xdb, 0x1b, 0xf4, 0x5b, 0x71, 0x32,
-  0x1c, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x84, 0x5f, 0x3c, 0x88,
-  0xad, 0xb5, 0x80, 0x32, 0x27, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x4f, 0xbe, 0xd3, 0xee, 0x29, 0x5e, 0x85, 0x32, 0x44, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x59, 0xd9, 0xe4, 0x35, 0xbd, 0x2f, 0x87, 0x32,
-  0x1d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x50, 0xc1, 0x1c, 0x3f,
-  0x1e, 0xdc, 0x9e, 0x32, 0x47, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x82, 0xd3, 0xb1, 0x63, 0x6c, 0x49, 0xd2, 0x32, 0x01, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x31, 0xa1, 0xb1, 0xeb, 0xa9, 0xbd, 0xde, 0x32,
-  0x1f, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xe2, 0xde, 0x44, 0x07,
-  0x61, 0xbd, 0xe8, 0x32, 0x0c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x65, 0xef, 0x50, 0xfb, 0xb2, 0xe0, 0xfc, 0x32, 0x31, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x65, 0xef, 0x50, 0xfb, 0xb2, 0xe0, 0xfc, 0x32,
-  0x31, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x65, 0xef, 0x50, 0xfb,
-  0xb2, 0xe0, 0xfc, 0x32, 0x31, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x65, 0xef, 0x50, 0xfb, 0xb2, 0xe0, 0xfc, 0x32, 0x31, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0xcd, 0x5b, 0x7d, 0x5d, 0x17, 0xeb, 0x19, 0x33,
-  0x38, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x17, 0xe9, 0x61, 0x7a,
-  0xfc, 0xce, 0x1a, 0x33, 0x14, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0xa2, 0xfc, 0x61, 0xb7, 0xa0, 0x0e, 0x35, 0x33, 0x1d, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0x9f, 0x05, 0x34, 0x7f, 0x37, 0x64, 0x3f, 0x33,
-  0x16, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x9f, 0x05, 0x34, 0x7f,
-  0x37, 0x64, 0x3f, 0x33, 0x12, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0xff, 0x7c, 0x48, 0x55, 0xe6, 0x96, 0x63, 0x33, 0x14, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0x4f, 0xc2, 0xe1, 0xb2, 0x9f, 0x38, 0x71, 0x33,
-  0x16, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x2e, 0x58, 0xc3, 0x10,
-  0x9b, 0x62, 0x77, 0x33, 0x3a, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x2f, 0x06, 0x55, 0x74, 0x40, 0x4d, 0x79, 0x33, 0x4e, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x0e, 0xdd, 0xfc, 0xde, 0x08, 0xfb, 0x7d, 0x33,
-  0x3d, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x09, 0xf3, 0x3f, 0xa0,
-  0x08, 0x12, 0x92, 0x33, 0x32, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x52, 0xd6, 0x8d, 0x4b, 0x1c, 0xda, 0x9d, 0x33, 0x2f, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0x44, 0x71, 0x41, 0x59, 0x1d, 0xdd, 0xa4, 0x33,
-  0x46, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x5e, 0x71, 0x18, 0xa9,
-  0x02, 0x4b, 0xa9, 0x33, 0x3e, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0xf1, 0x22, 0xd3, 0x56, 0xd4, 0x73, 0xaa, 0x33, 0x4e, 0x00, 0x00, 0x00,
-  0x46, 0x00, 0x00, 0x00, 0x11, 0x84, 0x84, 0xf5, 0x64, 0xf8, 0xd7, 0x33,
-  0x14, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x99, 0xfb, 0xef, 0xef,
-  0x74, 0x36, 0xf0, 0x33, 0x12, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x35, 0x32, 0xaf, 0x79, 0xd6, 0x39, 0x08, 0x34, 0x29, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0x9c, 0x06, 0x22, 0x10, 0x16, 0xbb, 0x19, 0x34,
-  0x3b, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xd4, 0xf8, 0x9a, 0xf2,
-  0xea, 0x05, 0x42, 0x34, 0x28, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0xe6, 0xa6, 0xf4, 0x7b, 0xdd, 0x0e, 0x6d, 0x34, 0x3e, 0x00, 0x00, 0x00,
-  0x46, 0x00, 0x00, 0x00, 0x22, 0x90, 0x3a, 0x4e, 0x6c, 0xba, 0x8e, 0x34,
-  0x16, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x32, 0xfa, 0xfe, 0x30,
-  0x46, 0xf2, 0x9c, 0x34, 0x3c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x35, 0x5c, 0x36, 0x02, 0x54, 0xac, 0xab, 0x34, 0x1d, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0x02, 0x41, 0x0d, 0x26, 0xb7, 0xd7, 0xab, 0x34,
-  0x3a, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x02, 0x41, 0x0d, 0x26,
-  0xb7, 0xd7, 0xab, 0x34, 0x3a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x02, 0x41, 0x0d, 0x26, 0xb7, 0xd7, 0xab, 0x34, 0x3a, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0x61, 0x46, 0x6d, 0x9f, 0x42, 0x7a, 0xbf, 0x34,
-  0x21, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x61, 0x46, 0x6d, 0x9f,
-  0x42, 0x7a, 0xbf, 0x34, 0x44, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
-  0xcb, 0xbb, 0xac, 0x73, 0x16, 0xd4, 0xcc, 0x34, 0x21, 0x00, 0x00, 0x00,
-  0x22, 0x00, 0x00, 0x00, 0xb7, 0x44, 0x46, 0x23, 0xbc, 0x86, 0xe5, 0x34,
-  0x4d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x8c, 0x9c, 0x15, 0x10,
-  0xcf, 0x00, 0xe8, 0x34, 0x21, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
-  0x01, 0x64, 0x77, 0x6a, 0x93, 0x99, 0xef, 0x34, 0x17, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0xeb, 0x29, 0xa6, 0x2a, 0x3c, 0x2a, 0xf6, 0x34,
-  0x3a, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x70, 0x7e, 0xc8, 0xcf,
-  0xff, 0x30, 0xf6, 0x34, 0x32, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x8f, 0x3a, 0x74, 0xd5, 0x61, 0xb2, 0x01, 0x35, 0x38, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x99, 0x65, 0xe4, 0x9d, 0x3d, 0x6a, 0x6c, 0x35,
-  0x46, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x09, 0xdb, 0xe6, 0x67,
-  0xf9, 0x1f, 0x79, 0x35, 0x13, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0x2f, 0xf1, 0x4e, 0xf3, 0x26, 0x89, 0x9d, 0x35, 0x17, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0xa3, 0x4b, 0xf8, 0xbc, 0x67, 0x21, 0xfe, 0x35,
-  0x1e, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0xa3, 0x4b, 0xf8, 0xbc,
-  0x67, 0x21, 0xfe, 0x35, 0x09, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0xa3, 0x4b, 0xf8, 0xbc, 0x67, 0x21, 0xfe, 0x35, 0x1e, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0xa3, 0x4b, 0xf8, 0xbc, 0x67, 0x21, 0xfe, 0x35,
-  0x1f, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x31, 0x0e, 0x9d, 0xb5,
-  0xce, 0x24, 0x18, 0x36, 0x33, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x08, 0x6c, 0xe4, 0x52, 0xc0, 0x02, 0x24, 0x36, 0x3a, 0x00, 0x00, 0x00,
-  0x43, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xc7, 0xa8, 0xf5, 0xa5, 0x2e, 0x36,
-  0x3d, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x4f, 0x4c, 0x6c, 0xbb,
-  0xb2, 0x34, 0x35, 0x36, 0x4e, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x27, 0x0b, 0xb8, 0xe0, 0xae, 0xf8, 0x59, 0x36, 0x46, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0xea, 0xce, 0x42, 0x08, 0x45, 0x6f, 0x71, 0x36,
-  0x14, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xa6, 0xb1, 0x66, 0x54,
-  0x0e, 0x5e, 0x7d, 0x36, 0x4f, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-  0xba, 0x4a, 0x2b, 0x3a, 0x7d, 0xa9, 0x8f, 0x36, 0x0b, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0xba, 0x4a, 0x2b, 0x3a, 0x7d, 0xa9, 0x8f, 0x36,
-  0x0b, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x18, 0x46, 0xaf, 0x83,
-  0x8e, 0x9e, 0x90, 0x36, 0x17, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x7f, 0xf0, 0x27, 0x40, 0xfc, 0xbe, 0x91, 0x36, 0x15, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x7f, 0xf0, 0x27, 0x40, 0xfc, 0xbe, 0x91, 0x36,
-  0x0b, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x20, 0x15, 0x41, 0xd2,
-  0xe5, 0x80, 0x94, 0x36, 0x29, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0xdc, 0xff, 0x6a, 0x75, 0x21, 0x62, 0xa7, 0x36, 0x21, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0xa7, 0xc6, 0xd7, 0xa2, 0xc6, 0x4d, 0xb6, 0x36,
-  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x74, 0x46, 0x55, 0x74,
-  0x18, 0x87, 0xd8, 0x36, 0x4e, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x4f, 0x3f, 0xb4, 0x09, 0x6d, 0xe6, 0xdd, 0x36, 0x26, 0x00, 0x00, 0x00,
-  0x4e, 0x00, 0x00, 0x00, 0x1f, 0x0a, 0x01, 0x35, 0xf7, 0x03, 0x04, 0x37,
-  0x16, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x9a, 0x82, 0x49, 0x82,
-  0x88, 0xa1, 0x0b, 0x37, 0x0a, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0xc2, 0xcb, 0x9d, 0xf1, 0xa9, 0x2d, 0x20, 0x37, 0x25, 0x00, 0x00, 0x00,
-  0x2e, 0x00, 0x00, 0x00, 0x70, 0x43, 0x28, 0x28, 0x78, 0x8e, 0x20, 0x37,
-  0x13, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x70, 0x43, 0x28, 0x28,
-  0x78, 0x8e, 0x20, 0x37, 0x13, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0x41, 0xc6, 0x9e, 0x23, 0x23, 0x3c, 0x38, 0x37, 0x3a, 0x00, 0x00, 0x00,
-  0x43, 0x00, 0x00, 0x00, 0x41, 0xc6, 0x9e, 0x23, 0x23, 0x3c, 0x38, 0x37,
-  0x16, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x78, 0x0a, 0xb5, 0x34,
-  0xf7, 0x0d, 0x40, 0x37, 0x1f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
-  0xf6, 0x20, 0x96, 0x49, 0xbf, 0x5e, 0x6a, 0x37, 0x21, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0x06, 0x59, 0x52, 0x6d, 0x96, 0x8a, 0x84, 0x37,
-  0x1d, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x24, 0x5d, 0x85, 0x8d,
-  0x08, 0x06, 0x9a, 0x37, 0x1c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x24, 0x5d, 0x85, 0x8d, 0x08, 0x06, 0x9a, 0x37, 0x00, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x24, 0x5d, 0x85, 0x8d, 0x08, 0x06, 0x9a, 0x37,
-  0x1c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x24, 0x5d, 0x85, 0x8d,
-  0x08, 0x06, 0x9a, 0x37, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x24, 0x5d, 0x85, 0x8d, 0x08, 0x06, 0x9a, 0x37, 0x1c, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x24, 0x5d, 0x85, 0x8d, 0x08, 0x06, 0x9a, 0x37,
-  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x24, 0x5d, 0x85, 0x8d,
-  0x08, 0x06, 0x9a, 0x37, 0x1c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x90, 0x57, 0x50, 0x00, 0x54, 0xc5, 0xa1, 0x37, 0x09, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0xfa, 0x33, 0x95, 0x19, 0xcd, 0x3f, 0xcc, 0x37,
-  0x34, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x33, 0xca, 0xc4,
-  0x26, 0x37, 0xf0, 0x37, 0x26, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x07, 0x33, 0xca, 0xc4, 0x26, 0x37, 0xf0, 0x37, 0x01, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x9e, 0x05, 0x29, 0xac, 0x73, 0xd9, 0x2a, 0x38,
-  0x17, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x7f, 0xab, 0x21, 0x59,
-  0xbd, 0x85, 0x68, 0x38, 0x14, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0xe7, 0x13, 0xdf, 0xc8, 0x08, 0x72, 0x8b, 0x38, 0x3a, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x08, 0xdb, 0x50, 0x68, 0xce, 0xd7, 0x91, 0x38,
-  0x46, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xa3, 0xa0, 0x35, 0xc8,
-  0x3a, 0x27, 0x96, 0x38, 0x1f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
-  0x52, 0x3a, 0xc6, 0xb2, 0x93, 0x52, 0xa1, 0x38, 0x34, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0x58, 0xc5, 0xdc, 0xab, 0x73, 0x85, 0xbd, 0x38,
-  0x0c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x98, 0x0e, 0xdc, 0x94,
-  0x91, 0x27, 0xc6, 0x38, 0x3b, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x49, 0x4e, 0xce, 0xbd, 0x8f, 0xa9, 0xcb, 0x38, 0x00, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x9d, 0x34, 0x1b, 0xa2, 0x35, 0x81, 0x2a, 0x39,
-  0x1e, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0xbc, 0x33, 0xf2, 0xbd,
-  0xf7, 0x36, 0x30, 0x39, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x11, 0xd3, 0x30, 0x56, 0xaf, 0x26, 0x48, 0x39, 0x1d, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x11, 0xd3, 0x30, 0x56, 0xaf, 0x26, 0x48, 0x39,
-  0x1d, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x11, 0xd3, 0x30, 0x56,
-  0xaf, 0x26, 0x48, 0x39, 0x16, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0x11, 0xd3, 0x30, 0x56, 0xaf, 0x26, 0x48, 0x39, 0x16, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x03, 0xd6, 0xb6, 0xda, 0x6a, 0xfb, 0x49, 0x39,
-  0x4e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x5d, 0x98, 0x76, 0x09,
-  0xf6, 0x96, 0x58, 0x39, 0x1f, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x5d, 0x98, 0x76, 0x09, 0xf6, 0x96, 0x58, 0x39, 0x1f, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x3b, 0xa8, 0x0f, 0x29, 0xd9, 0x36, 0x73, 0x39,
-  0x33, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x3b, 0xa8, 0x0f, 0x29,
-  0xd9, 0x36, 0x73, 0x39, 0x33, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
-  0xea, 0x4c, 0xbe, 0x1a, 0x5b, 0x17, 0xbc, 0x39, 0x45, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x45, 0x15, 0x56, 0x70, 0xb4, 0x71, 0xd0, 0x39,
-  0x3b, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x80, 0x84, 0xa7, 0x46,
-  0xf0, 0xda, 0xf1, 0x39, 0x50, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-  0x7b, 0x71, 0x34, 0x79, 0x12, 0x52, 0x06, 0x3a, 0x20, 0x00, 0x00, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x7b, 0x71, 0x34, 0x79, 0x12, 0x52, 0x06, 0x3a,
-  0x31, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x28, 0xc1, 0x21, 0x82,
-  0xbc, 0xa5, 0x29, 0x3a, 0x14, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x2b, 0x43, 0x5d, 0x25, 0x12, 0xf9, 0x55, 0x3a, 0x4f, 0x00, 0x00, 0x00,
-  0x46, 0x00, 0x00, 0x00, 0x5a, 0x64, 0x60, 0x67, 0x89, 0x3b, 0x8b, 0x3a,
-  0x1e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xf7, 0x5a, 0x57, 0x1a,
-  0x5e, 0xdc, 0xcb, 0x3a, 0x45, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x7c, 0x87, 0x7d, 0x26, 0xa2, 0x8c, 0x01, 0x3b, 0x2a, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x5b, 0x0d, 0x34, 0x96, 0x9d, 0xca, 0x0e, 0x3b,
-  0x20, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x6a, 0x21, 0x4a, 0x8d,
-  0x26, 0x8a, 0x14, 0x3b, 0x17, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x77, 0x98, 0x09, 0x75, 0x93, 0x49, 0x1f, 0x3b, 0x3d, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0x9f, 0x1e, 0xf0, 0xb8, 0x99, 0xce, 0x42, 0x3b,
-  0x31, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0xc2, 0xaf, 0xed, 0x16,
-  0x8f, 0x55, 0x45, 0x3b, 0x2a, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0x48, 0x35, 0x32, 0x83, 0x27, 0x74, 0x93, 0x3b, 0x46, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x31, 0x91, 0x87, 0xa5, 0xd8, 0x22, 0xa7, 0x3b,
-  0x2a, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x8b, 0xa0, 0x99, 0x55,
-  0x8b, 0x9a, 0xa8, 0x3b, 0x1b, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x14, 0x52, 0x0e, 0xb4, 0xf5, 0x18, 0xc4, 0x3b, 0x28, 0x00, 0x00, 0x00,
-  0x4e, 0x00, 0x00, 0x00, 0x20, 0xbf, 0x98, 0x0c, 0x88, 0xa8, 0xd3, 0x3b,
-  0x16, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x1a, 0xdc, 0x64, 0x2a,
-  0xba, 0xde, 0xde, 0x3b, 0x3d, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0x9f, 0x39, 0x7e, 0x89, 0x8a, 0x5e, 0x18, 0x3c, 0x33, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x66, 0xd0, 0x8b, 0x33, 0xe3, 0x6d, 0x3b, 0x3c,
-  0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xc3, 0xf4, 0x1a, 0x82,
-  0xa6, 0x1a, 0x62, 0x3c, 0x28, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0xdf, 0xc5, 0x15, 0x61, 0xbd, 0x83, 0x88, 0x3c, 0x3c, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0x4e, 0x44, 0xab, 0x10, 0x7f, 0xc7, 0xd3, 0x3c,
-  0x14, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0e, 0x71, 0xe8, 0x93,
-  0x8e, 0xdb, 0xd7, 0x3c, 0x16, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
-  0x15, 0x3c, 0xde, 0xc6, 0x4a, 0xf9, 0xdf, 0x3c, 0x0b, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x49, 0xf3, 0x3a, 0x90, 0x8d, 0x7e, 0xe3, 0x3c,
-  0x3e, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xe7, 0x1d, 0x7d, 0xd0,
-  0xf7, 0x10, 0x15, 0x3d, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0x41, 0x55, 0xac, 0x7b, 0xd1, 0x62, 0x1e, 0x3d, 0x1c, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x82, 0x70, 0x86, 0x57, 0x84, 0x29, 0x92, 0x3d,
-  0x50, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x79, 0x84, 0xf2, 0x04,
-  0x27, 0x92, 0xa9, 0x3d, 0x3c, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-  0xfa, 0x5c, 0xe8, 0x9a, 0xac, 0x86, 0xc4, 0x3d, 0x2a, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0xe9, 0x87, 0x0c, 0x48, 0xdb, 0x67, 0xef, 0x3d,
-  0x15, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0xbf, 0x59, 0x93, 0x5c,
-  0xe3, 0xf0, 0x2e, 0x3e, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x04, 0x56, 0x01, 0xe1, 0xf9, 0x4d, 0x40, 0x3e, 0x46, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x78, 0x5e, 0xde, 0xf0, 0x0a, 0x5e, 0x40, 0x3e,
-  0x1e, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x42, 0xc7, 0x86, 0x3d,
-  0x18, 0xa1, 0x40, 0x3e, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0xc0, 0xcc, 0xfe, 0x8a, 0x94, 0x5d, 0x3e, 0x3d, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0xfe, 0x43, 0x01, 0xcf, 0xf7, 0x19, 0x70, 0x3e,
-  0x29, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xe1, 0xc3, 0x32, 0xa9,
-  0xc2, 0x7f, 0x78, 0x3e, 0x4f, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-  0x08, 0x9a, 0x6f, 0x17, 0xf3, 0x2a, 0x7f, 0x3e, 0x1c, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x8b, 0xc4, 0xe9, 0xe5, 0xf5, 0x58, 0x8c, 0x3e,
-  0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x2d, 0x06, 0x77, 0xec,
-  0xb1, 0x95, 0xad, 0x3e, 0x32, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0x33, 0xe8, 0x8e, 0x6a, 0xf5, 0x37, 0xd4, 0x3e, 0x4e, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x1a, 0xb8, 0xb5, 0x6f, 0xca, 0xdc, 0xd6, 0x3e,
-  0x30, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x7b, 0xcc, 0x59, 0xb2,
-  0xe0, 0xed, 0xd6, 0x3e, 0x2a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0xb2, 0x71, 0xc6, 0x0a, 0xe9, 0x13, 0xed, 0x3e, 0x1d, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0xaf, 0x64, 0xa5, 0xf0, 0x2b, 0x86, 0xf6, 0x3e,
-  0x30, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x99, 0x38, 0x8c, 0x95,
-  0x74, 0xc4, 0xfc, 0x3e, 0x32, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
-  0x72, 0xc0, 0x39, 0xe8, 0x1a, 0xe8, 0x0c, 0x3f, 0x14, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x20, 0xd0, 0x27, 0xdd, 0xbe, 0x3e, 0x33, 0x3f,
-  0x15, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0xa9, 0xde, 0xc9, 0xa0,
-  0x72, 0x30, 0x41, 0x3f, 0x34, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0xd2, 0xf8, 0x5e, 0x2f, 0x31, 0x2b, 0x68, 0x3f, 0x2a, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0xe2, 0x47, 0x47, 0x0a, 0xcc, 0x96, 0x7e, 0x3f,
-  0x1c, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xd3, 0x02, 0xf7, 0x5d,
-  0xc7, 0x92, 0xd1, 0x3f, 0x21, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
-  0x91, 0x7c, 0x94, 0x5c, 0xfc, 0x50, 0x6a, 0x40, 0x28, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0xd2, 0xf4, 0xa9, 0x69, 0xc6, 0xf4, 0x6b, 0x40,
-  0x44, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0xa3, 0x73, 0xcc, 0x5b,
-  0x22, 0x84, 0x7d, 0x40, 0x0a, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0xcf, 0x2c, 0xd6, 0xc1, 0x48, 0xfd, 0x8d, 0x40, 0x28, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0xac, 0x6c, 0x89, 0xf4, 0x11, 0x1f, 0x90, 0x40,
-  0x50, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xac, 0x6c, 0x89, 0xf4,
-  0x11, 0x1f, 0x90, 0x40, 0x34, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0xac, 0x6c, 0x89, 0xf4, 0x11, 0x1f, 0x90, 0x40, 0x50, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0xac, 0x6c, 0x89, 0xf4, 0x11, 0x1f, 0x90, 0x40,
-  0x34, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xac, 0x6c, 0x89, 0xf4,
-  0x11, 0x1f, 0x90, 0x40, 0x50, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-  0xac, 0x6c, 0x89, 0xf4, 0x11, 0x1f, 0x90, 0x40, 0x34, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0xac, 0x6c, 0x89, 0xf4, 0x11, 0x1f, 0x90, 0x40,
-  0x50, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xac, 0x6c, 0x89, 0xf4,
-  0x11, 0x1f, 0x90, 0x40, 0x34, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0xac, 0x6c, 0x89, 0xf4, 0x11, 0x1f, 0x90, 0x40, 0x50, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0xac, 0x6c, 0x89, 0xf4, 0x11, 0x1f, 0x90, 0x40,
-  0x34, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x7f, 0x67, 0x6c, 0x28,
-  0x2f, 0xd2, 0x92, 0x40, 0x3c, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0x98, 0xd7, 0xca, 0x75, 0xc3, 0xf2, 0xc9, 0x40, 0x14, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0xd9, 0x73, 0xd4, 0x0e, 0x51, 0xa2, 0xd7, 0x40,
-  0x3c, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x5c, 0x46, 0xc1, 0x0c,
-  0x91, 0x85, 0xdc, 0x40, 0x2f, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0x66, 0x6f, 0x0c, 0x16, 0x4e, 0x23, 0x4b, 0x41, 0x33, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x6a, 0x82, 0xcc, 0x9c, 0xe8, 0x28, 0x5e, 0x41,
-  0x25, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x2e, 0x73, 0xd7, 0x57,
-  0xc2, 0xe4, 0x5e, 0x41, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0xd6, 0x63, 0x05, 0x30, 0x72, 0x02, 0x65, 0x41, 0x15, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0xfc, 0xc1, 0xc5, 0x5f, 0x6e, 0x28, 0x69, 0x41,
-  0x28, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x72, 0xb4, 0xfc, 0x2f,
-  0x59, 0x79, 0x7a, 0x41, 0x15, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x4d, 0xfa, 0x7a, 0xfa, 0x8f, 0x9e, 0x82, 0x41, 0x4d, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0x4d, 0xfa, 0x7a, 0xfa, 0x8f, 0x9e, 0x82, 0x41,
-  0x4d, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x90, 0x1a, 0x7e, 0x34,
-  0x0b, 0xc3, 0x86, 0x41, 0x3e, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
-  0xb9, 0x57, 0x32, 0xae, 0x78, 0x9b, 0x8b, 0x41, 0x44, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0xfc, 0xd5, 0xe7, 0xdd, 0xc5, 0x2e, 0x8c, 0x41,
-  0x39, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0xfc, 0xd5, 0xe7, 0xdd,
-  0xc5, 0x2e, 0x8c, 0x41, 0x44, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
-  0x81, 0xb5, 0xa4, 0x07, 0xf1, 0xf1, 0xb2, 0x41, 0x3a, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0x2f, 0x73, 0x07, 0x99, 0xfd, 0x30, 0xd3, 0x41,
-  0x26, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2f, 0x73, 0x07, 0x99,
-  0xfd, 0x30, 0xd3, 0x41, 0x1f, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0xbe, 0x80, 0x9f, 0x00, 0xaa, 0x53, 0xde, 0x41, 0x2f, 0x00, 0x00, 0x00,
-  0x43, 0x00, 0x00, 0x00, 0x30, 0x4a, 0x8a, 0xf2, 0x32, 0x7c, 0xe4, 0x41,
-  0x46, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x42, 0x21, 0x66, 0xc1,
-  0x17, 0x88, 0xff, 0x41, 0x2f, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
-  0xda, 0x6e, 0x4e, 0xf2, 0x53, 0x66, 0x15, 0x42, 0x31, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0x10, 0xad, 0x42, 0x11, 0xda, 0x28, 0x7d, 0x42,
-  0x4f, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x01, 0x6b, 0xa3, 0xf5,
-  0x92, 0xc9, 0x98, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0x01, 0x6b, 0xa3, 0xf5, 0x92, 0xc9, 0x98, 0x42, 0x0a, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0x50, 0x20, 0x33, 0xe7, 0x74, 0xe6, 0xa7, 0x42,
-  0x30, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x0e, 0x23, 0xe3, 0x5e,
-  0x4f, 0xc0, 0xcf, 0x42, 0x34, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x2a, 0x9f, 0xce, 0xbf, 0x97, 0x16, 0xd7, 0x42, 0x2b, 0x00, 0x00, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0x29, 0xa2, 0x3c, 0x41, 0x21, 0x2f, 0xf1, 0x42,
-  0x3a, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x19, 0x60, 0xb9, 0x63,
-  0x76, 0x96, 0xf8, 0x42, 0x2b, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0xe4, 0x76, 0x0d, 0xb4, 0xb9, 0xa4, 0x06, 0x43, 0x3c, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0xf3, 0xca, 0xf7, 0x49, 0xe0, 0x3d, 0x2b, 0x43,
-  0x2f, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xee, 0x16, 0xb1, 0xe9,
-  0xb6, 0xd8, 0x8c, 0x43, 0x3e, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
-  0x2c, 0x31, 0x38, 0x75, 0x9b, 0x82, 0xa9, 0x43, 0x3b, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x00, 0x21, 0x20, 0x73, 0x5c, 0x66, 0x19, 0x44,
-  0x15, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x8b, 0xf3, 0x59, 0x1d,
-  0x81, 0x78, 0x22, 0x44, 0x27, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0xc5, 0x42, 0xcd, 0xf3, 0x93, 0xc1, 0x65, 0x44, 0x46, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0xca, 0x9b, 0x7e, 0x38, 0xc4, 0xd7, 0x69, 0x44,
-  0x0b, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x9f, 0x60, 0x2e, 0x62,
-  0x15, 0x5d, 0xaa, 0x44, 0x29, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x90, 0x61, 0xef, 0x05, 0x1c, 0xc6, 0xd9, 0x44, 0x0e, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0xa4, 0xaa, 0x03, 0xa2, 0x73, 0xe2, 0x02, 0x45,
-  0x37, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x81, 0x31, 0x16, 0xa0,
-  0x89, 0x97, 0x04, 0x45, 0x27, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00,
-  0x90, 0xb6, 0xa1, 0x26, 0x87, 0x2b, 0x34, 0x45, 0x2f, 0x00, 0x00, 0x00,
-  0x2e, 0x00, 0x00, 0x00, 0x90, 0xb6, 0xa1, 0x26, 0x87, 0x2b, 0x34, 0x45,
-  0x20, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x56, 0xf6, 0xec, 0x5b,
-  0xee, 0x17, 0x3c, 0x45, 0x0d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x56, 0xf6, 0xec, 0x5b, 0xee, 0x17, 0x3c, 0x45, 0x14, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0x55, 0x7f, 0xe6, 0xc5, 0x93, 0x48, 0x3d, 0x45,
-  0x33, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x55, 0x7f, 0xe6, 0xc5,
-  0x93, 0x48, 0x3d, 0x45, 0x3c, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-  0x96, 0x58, 0x86, 0x6b, 0xb1, 0x4b, 0x5c, 0x45, 0x45, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0xa0, 0x88, 0x44, 0x4e, 0x60, 0xc1, 0x6b, 0x45,
-  0x0c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x49, 0x8c, 0x56, 0x95,
-  0x5f, 0x1f, 0x7a, 0x45, 0x15, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0xe2, 0x48, 0x06, 0xb2, 0xf7, 0xf5, 0x9d, 0x45, 0x28, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x54, 0x30, 0x74, 0xc0, 0x7f, 0x08, 0xdf, 0x45,
-  0x3c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x8a, 0x42, 0x2d, 0x0f,
-  0x66, 0xc4, 0xe8, 0x45, 0x1f, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0xf4, 0xc3, 0x06, 0xdd, 0x48, 0xda, 0x04, 0x46, 0x2a, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0x59, 0x5d, 0xca, 0x21, 0x7e, 0x1b, 0x24, 0x46,
-  0x26, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xd7, 0xa9, 0xf6, 0x3b,
-  0x56, 0x21, 0x4c, 0x46, 0x29, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0xfb, 0x15, 0x08, 0x48, 0xc8, 0x3c, 0x61, 0x46, 0x43, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x28, 0xea, 0x39, 0xae, 0x0c, 0xb7, 0x8c, 0x46,
-  0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x80, 0xfb, 0x5f, 0xb3,
-  0x64, 0xfa, 0x9f, 0x46, 0x45, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0xb7, 0x29, 0xa1, 0x72, 0x40, 0x55, 0xa6, 0x46, 0x29, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0x8d, 0xf7, 0x7d, 0xf6, 0xae, 0x4f, 0xab, 0x46,
-  0x1f, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x8d, 0xf7, 0x7d, 0xf6,
-  0xae, 0x4f, 0xab, 0x46, 0x3b, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x8d, 0xf7, 0x7d, 0xf6, 0xae, 0x4f, 0xab, 0x46, 0x32, 0x00, 0x00, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x2f, 0xd8, 0xca, 0x39, 0x5a, 0x32, 0xec, 0x46,
-  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x02, 0x47, 0x66,
-  0x3d, 0xf6, 0xee, 0x46, 0x37, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0x39, 0x75, 0xeb, 0xf0, 0x81, 0xba, 0xf6, 0x46, 0x30, 0x00, 0x00, 0x00,
-  0x42, 0x00, 0x00, 0x00, 0x7c, 0x25, 0xb2, 0x64, 0xa0, 0x2b, 0xf9, 0x46,
-  0x33, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x05, 0xf4, 0xa7, 0xc7,
-  0x24, 0x6e, 0x10, 0x47, 0x29, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0xd7, 0xd9, 0xcf, 0x1c, 0x5e, 0x6c, 0x13, 0x47, 0x4f, 0x00, 0x00, 0x00,
-  0x3b, 0x00, 0x00, 0x00, 0xcb, 0x6a, 0x60, 0xf6, 0xd9, 0x31, 0x17, 0x47,
-  0x25, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0e, 0xe1, 0x5d, 0xf6,
-  0x31, 0x6d, 0x3d, 0x47, 0x1f, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x05, 0x68, 0xfe, 0x2e, 0x4f, 0x55, 0x5d, 0x47, 0x16, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x57, 0x2f, 0xb8, 0xdc, 0xd6, 0x3f, 0x6b, 0x47,
-  0x26, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x48, 0x85, 0xff, 0x36,
-  0xbd, 0xf2, 0x84, 0x47, 0x12, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
-  0x48, 0x85, 0xff, 0x36, 0xbd, 0xf2, 0x84, 0x47, 0x02, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0x48, 0x85, 0xff, 0x36, 0xbd, 0xf2, 0x84, 0x47,
-  0x12, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x48, 0x85, 0xff, 0x36,
-  0xbd, 0xf2, 0x84, 0x47, 0x02, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
-  0x48, 0x85, 0xff, 0x36, 0xbd, 0xf2, 0x84, 0x47, 0x12, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0x48, 0x85, 0xff, 0x36, 0xbd, 0xf2, 0x84, 0x47,
-  0x02, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x48, 0x85, 0xff, 0x36,
-  0xbd, 0xf2, 0x84, 0x47, 0x12, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
-  0x48, 0x85, 0xff, 0x36, 0xbd, 0xf2, 0x84, 0x47, 0x02, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0x48, 0x85, 0xff, 0x36, 0xbd, 0xf2, 0x84, 0x47,
-  0x12, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x48, 0x85, 0xff, 0x36,
-  0xbd, 0xf2, 0x84, 0x47, 0x02, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
-  0x48, 0x85, 0xff, 0x36, 0xbd, 0xf2, 0x84, 0x47, 0x12, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0x48, 0x85, 0xff, 0x36, 0xbd, 0xf2, 0x84, 0x47,
-  0x02, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x48, 0x85, 0xff, 0x36,
-  0xbd, 0xf2, 0x84, 0x47, 0x12, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
-  0x48, 0x85, 0xff, 0x36, 0xbd, 0xf2, 0x84, 0x47, 0x02, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0x48, 0x85, 0xff, 0x36, 0xbd, 0xf2, 0x84, 0x47,
-  0x12, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x48, 0x85, 0xff, 0x36,
-  0xbd, 0xf2, 0x84, 0x47, 0x02, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
-  0x01, 0x37, 0x50, 0x90, 0xee, 0x6d, 0xa3, 0x47, 0x2f, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x6d, 0x1e, 0xc6, 0x04, 0x28, 0xed, 0xe1, 0x47,
-  0x16, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0xb8, 0x5a, 0x73, 0xb6,
-  0xae, 0xb2, 0x01, 0x48, 0x15, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0xc4, 0xc2, 0x0a, 0x2f, 0x34, 0xee, 0x2b, 0x48, 0x14, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0xa0, 0x89, 0xf3, 0x6c, 0x3d, 0xf5, 0x46, 0x48,
-  0x0c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xa0, 0x89, 0xf3, 0x6c,
-  0x3d, 0xf5, 0x46, 0x48, 0x0c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x61, 0xd0, 0x95, 0x4a, 0x65, 0x86, 0x4d, 0x48, 0x3a, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0xa7, 0xe9, 0x4f, 0x18, 0x23, 0x6b, 0x50, 0x48,
-  0x33, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0xe1, 0xbe, 0x85, 0x51,
-  0xcb, 0x3c, 0x6e, 0x48, 0x15, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0x92, 0x69, 0x0b, 0x8b, 0xad, 0xca, 0x94, 0x48, 0x1e, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x88, 0x78, 0xa2, 0x06, 0x28, 0xbe, 0xa2, 0x48,
-  0x45, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x68, 0x8a, 0x03, 0x4b,
-  0x9d, 0xdf, 0xe1, 0x48, 0x0c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x5f, 0x9f, 0xd8, 0x35, 0x87, 0x02, 0xe2, 0x48, 0x50, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0x9b, 0x48, 0x3a, 0x35, 0xdb, 0x9a, 0xff, 0x48,
-  0x46, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x9b, 0x48, 0x3a, 0x35,
-  0xdb, 0x9a, 0xff, 0x48, 0x33, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0x9b, 0x48, 0x3a, 0x35, 0xdb, 0x9a, 0xff, 0x48, 0x46, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0xd1, 0xff, 0x84, 0x46, 0x7d, 0x11, 0x06, 0x49,
-  0x0c, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xb7, 0x46, 0x93, 0x49,
-  0x2d, 0x97, 0x0d, 0x49, 0x32, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x2f, 0xf2, 0xaf, 0x91, 0x70, 0x3c, 0x82, 0x49, 0x2a, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x26, 0xd4, 0x8d, 0x6c, 0x8c, 0x5c, 0x9e, 0x49,
-  0x2f, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x37, 0xe2, 0xcb, 0x24,
-  0x43, 0x87, 0xc7, 0x49, 0x3b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0x8d, 0x4f, 0xe1, 0x7f, 0x6e, 0x13, 0xd3, 0x49, 0x3d, 0x00, 0x00, 0x00,
-  0x3b, 0x00, 0x00, 0x00, 0xac, 0x5c, 0x55, 0x61, 0xce, 0x9a, 0xf1, 0x49,
-  0x45, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xaf, 0x6b, 0x20, 0xe6,
-  0x1b, 0xe1, 0x29, 0x4a, 0x33, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0x41, 0xe0, 0x37, 0xd1, 0xa8, 0x0f, 0x53, 0x4a, 0x3c, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0xb2, 0x8b, 0xba, 0xe3, 0x91, 0x37, 0x55, 0x4a,
-  0x3b, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0xfa, 0x1a, 0xbb, 0x84,
-  0x6e, 0x5c, 0x57, 0x4a, 0x0c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x38, 0x1e, 0x36, 0xcb, 0x48, 0x9a, 0x6c, 0x4a, 0x1d, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0x8f, 0xa7, 0x8f, 0x83, 0x7c, 0x08, 0x86, 0x4a,
-  0x0b, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x03, 0xc3, 0x1c, 0x7a,
-  0x3e, 0x42, 0x8a, 0x4a, 0x28, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
-  0xba, 0x08, 0xd2, 0x6d, 0x53, 0x3d, 0x8c, 0x4a, 0x39, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0xba, 0x08, 0xd2, 0x6d, 0x53, 0x3d, 0x8c, 0x4a,
-  0x19, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x05, 0x79, 0xe5, 0xf7,
-  0xe0, 0xb0, 0x91, 0x4a, 0x47, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
-  0xe9, 0x5c, 0x57, 0xc3, 0x63, 0x12, 0xc0, 0x4a, 0x3a, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0xe9, 0x5c, 0x57, 0xc3, 0x63, 0x12, 0xc0, 0x4a,
-  0x16, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x80, 0xae, 0x24, 0xa3,
-  0xcd, 0x0d, 0xdc, 0x4a, 0x27, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x80, 0xae, 0x24, 0xa3, 0xcd, 0x0d, 0xdc, 0x4a, 0x1c, 0x00, 0x00, 0x00,
-  0x25, 0x00, 0x00, 0x00, 0x80, 0xae, 0x24, 0xa3, 0xcd, 0x0d, 0xdc, 0x4a,
-  0x27, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x80, 0xae, 0x24, 0xa3,
-  0xcd, 0x0d, 0xdc, 0x4a, 0x0c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
-  0x80, 0xae, 0x24, 0xa3, 0xcd, 0x0d, 0xdc, 0x4a, 0x27, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0x80, 0xae, 0x24, 0xa3, 0xcd, 0x0d, 0xdc, 0x4a,
-  0x1c, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0xb7, 0xf0, 0x41, 0xef,
-  0x7c, 0xe0, 0xdd, 0x4a, 0x33, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0xdf, 0xc9, 0xea, 0x8a, 0xbb, 0x80, 0xe1, 0x4a, 0x0b, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x64, 0xdd, 0xfd, 0x4a, 0x59, 0x2d, 0x09, 0x4b,
-  0x29, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0xd7, 0x3f, 0x28, 0xe9,
-  0xb8, 0x83, 0x1f, 0x4b, 0x2f, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
-  0xbf, 0xf9, 0xf2, 0x4b, 0x1a, 0x9e, 0x24, 0x4b, 0x20, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0xbf, 0xf9, 0xf2, 0x4b, 0x1a, 0x9e, 0x24, 0x4b,
-  0x33, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0xac, 0x4f, 0xbd, 0x96,
-  0x84, 0x8a, 0x27, 0x4b, 0x12, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x6d, 0x41, 0x7b, 0x3e, 0x29, 0x23, 0x50, 0x4b, 0x0b, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0xf7, 0xde, 0x59, 0x6c, 0x69, 0x5a, 0x79, 0x4b,
-  0x16, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xf7, 0xde, 0x59, 0x6c,
-  0x69, 0x5a, 0x79, 0x4b, 0x30, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0xf7, 0xde, 0x59, 0x6c, 0x69, 0x5a, 0x79, 0x4b, 0x16, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0xf7, 0xde, 0x59, 0x6c, 0x69, 0x5a, 0x79, 0x4b,
-  0x30, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf7, 0xde, 0x59, 0x6c,
-  0x69, 0x5a, 0x79, 0x4b, 0x16, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0xf7, 0xde, 0x59, 0x6c, 0x69, 0x5a, 0x79, 0x4b, 0x30, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0xf7, 0xde, 0x59, 0x6c, 0x69, 0x5a, 0x79, 0x4b,
-  0x1d, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0xf7, 0xde, 0x59, 0x6c,
-  0x69, 0x5a, 0x79, 0x4b, 0x30, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x56, 0xa1, 0x8a, 0x54, 0xe7, 0x8c, 0xb1, 0x4b, 0x35, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x38, 0xe5, 0xc5, 0xe2, 0x45, 0x8e, 0xed, 0x4b,
-  0x2a, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0xec, 0xb9, 0x3e, 0x11,
-  0x5a, 0x0a, 0x0f, 0x4c, 0x21, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00,
-  0xd4, 0xb0, 0x3d, 0x99, 0x60, 0xcf, 0x52, 0x4c, 0x34, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x34, 0x61, 0x30, 0xb7, 0x7c, 0xff, 0x8e, 0x4c,
-  0x12, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x40, 0x01, 0x45, 0x39,
-  0xad, 0x26, 0x98, 0x4c, 0x29, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0x40, 0x01, 0x45, 0x39, 0xad, 0x26, 0x98, 0x4c, 0x45, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x87, 0x4a, 0x44, 0x40, 0x58, 0x66, 0x10, 0x4d,
-  0x45, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x87, 0x4a, 0x44, 0x40,
-  0x58, 0x66, 0x10, 0x4d, 0x45, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
-  0x87, 0x4a, 0x44, 0x40, 0x58, 0x66, 0x10, 0x4d, 0x45, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x87, 0x4a, 0x44, 0x40, 0x58, 0x66, 0x10, 0x4d,
-  0x45, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x87, 0x4a, 0x44, 0x40,
-  0x58, 0x66, 0x10, 0x4d, 0x45, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x87, 0x4a, 0x44, 0x40, 0x58, 0x66, 0x10, 0x4d, 0x45, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0x87, 0x4a, 0x44, 0x40, 0x58, 0x66, 0x10, 0x4d,
-  0x45, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xe7, 0x49, 0x1d, 0x90,
-  0x8a, 0x94, 0x2f, 0x4d, 0x0e, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
-  0xdb, 0x99, 0xcb, 0x87, 0x35, 0x37, 0x7b, 0x4d, 0x3c, 0x00, 0x00, 0x00,
-  0x3b, 0x00, 0x00, 0x00, 0x11, 0x74, 0x90, 0xac, 0x28, 0xe4, 0xa2, 0x4d,
-  0x16, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x87, 0xbb, 0xd6, 0x56,
-  0x00, 0x1b, 0xc8, 0x4d, 0x13, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0x8d, 0x42, 0x9a, 0x46, 0x6c, 0x08, 0xfa, 0x4d, 0x15, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0xd3, 0xdc, 0xd8, 0xf4, 0x3d, 0x1c, 0x00, 0x4e,
-  0x34, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xba, 0x54, 0x32, 0x72,
-  0xf7, 0x5e, 0x39, 0x4e, 0x1d, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x3e, 0x91, 0x65, 0x34, 0x14, 0x70, 0x44, 0x4e, 0x20, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x14, 0x79, 0xd7, 0x8d, 0xb8, 0x03, 0x4a, 0x4e,
-  0x38, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x14, 0x79, 0xd7, 0x8d,
-  0xb8, 0x03, 0x4a, 0x4e, 0x3b, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
-  0x14, 0x79, 0xd7, 0x8d, 0xb8, 0x03, 0x4a, 0x4e, 0x15, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x16, 0x7c, 0xd2, 0xdf, 0xb3, 0xbe, 0x82, 0x4e,
-  0x15, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0xbf, 0x3b, 0x38, 0xac,
-  0x2b, 0x3c, 0x86, 0x4e, 0x14, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0xe5, 0xfe, 0x0b, 0xf8, 0x7a, 0x69, 0x8c, 0x4e, 0x0a, 0x00, 0x00, 0x00,
-  0x0b, 0x00, 0x00, 0x00, 0xe5, 0xfe, 0x0b, 0xf8, 0x7a, 0x69, 0x8c, 0x4e,
-  0x34, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xe5, 0xfe, 0x0b, 0xf8,
-  0x7a, 0x69, 0x8c, 0x4e, 0x3d, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x48, 0xc1, 0x76, 0x3d, 0x77, 0xf6, 0x9a, 0x4e, 0x15, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0x13, 0xac, 0x00, 0x03, 0xc5, 0xd7, 0xc3, 0x4e,
-  0x3a, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x20, 0xe8, 0x9a, 0x73,
-  0x07, 0xd8, 0xce, 0x4e, 0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x08, 0x40, 0xf9, 0x8c, 0x6b, 0xb3, 0xd4, 0x4e, 0x21, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0xd0, 0xe9, 0x94, 0xd3, 0x04, 0x6f, 0xf4, 0x4e,
-  0x16, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xd0, 0xe9, 0x94, 0xd3,
-  0x04, 0x6f, 0xf4, 0x4e, 0x20, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x80, 0x4a, 0xaf, 0xd7, 0x8d, 0x4b, 0xfd, 0x4e, 0x30, 0x00, 0x00, 0x00,
-  0x42, 0x00, 0x00, 0x00, 0x46, 0xe0, 0xbf, 0x8c, 0x03, 0x60, 0x02, 0x4f,
-  0x33, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0xae, 0xe4, 0x31, 0x14,
-  0x4f, 0xc5, 0x0d, 0x4f, 0x33, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0x88, 0x12, 0xdb, 0xa1, 0x18, 0xca, 0x23, 0x4f, 0x27, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0x88, 0x12, 0xdb, 0xa1, 0x18, 0xca, 0x23, 0x4f,
-  0x0b, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x8d, 0x6b, 0x7e, 0xc8,
-  0xb5, 0xa7, 0x30, 0x4f, 0x4d, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
-  0x8d, 0x6b, 0x7e, 0xc8, 0xb5, 0xa7, 0x30, 0x4f, 0x35, 0x00, 0x00, 0x00,
-  0x3d, 0x00, 0x00, 0x00, 0x8d, 0x6b, 0x7e, 0xc8, 0xb5, 0xa7, 0x30, 0x4f,
-  0x4d, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x8d, 0x6b, 0x7e, 0xc8,
-  0xb5, 0xa7, 0x30, 0x4f, 0x35, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
-  0x8d, 0x6b, 0x7e, 0xc8, 0xb5, 0xa7, 0x30, 0x4f, 0x4d, 0x00, 0x00, 0x00,
-  0x2b, 0x00, 0x00, 0x00, 0x8d, 0x6b, 0x7e, 0xc8, 0xb5, 0xa7, 0x30, 0x4f,
-  0x35, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x8d, 0x6b, 0x7e, 0xc8,
-  0xb5, 0xa7, 0x30, 0x4f, 0x4e, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x8d, 0x6b, 0x7e, 0xc8, 0xb5, 0xa7, 0x30, 0x4f, 0x4d, 0x00, 0x00, 0x00,
-  0x2b, 0x00, 0x00, 0x00, 0xea, 0x36, 0xde, 0x39, 0xd5, 0xbd, 0x34, 0x4f,
-  0x3b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0xd6, 0xe4, 0x1b, 0x88,
-  0x70, 0x15, 0x45, 0x4f, 0x0b, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0x4e, 0x58, 0x53, 0x84, 0xa7, 0x97, 0x55, 0x4f, 0x1e, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x60, 0xc2, 0x83, 0x20, 0xe2, 0xec, 0x71, 0x4f,
-  0x42, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x7d, 0x90, 0xfd, 0xce,
-  0x53, 0x84, 0x8e, 0x4f, 0x42, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
-  0xe9, 0x3f, 0x80, 0xbe, 0xdf, 0xe7, 0x9c, 0x4f, 0x3d, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0xd5, 0x26, 0x37, 0xa3, 0x4b, 0x78, 0xf9, 0x4f,
-  0x1f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x25, 0x2a, 0x57, 0x73,
-  0xb1, 0xcf, 0x06, 0x50, 0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x17, 0x06, 0xdb, 0xc2, 0x9f, 0xf5, 0x13, 0x50, 0x0c, 0x00, 0x00, 0x00,
-  0x46, 0x00, 0x00, 0x00, 0x83, 0xe5, 0x2a, 0x97, 0xb0, 0x59, 0x15, 0x50,
-  0x16, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x19, 0xe8, 0x3a, 0x6a,
-  0x00, 0x7d, 0x5c, 0x50, 0x1d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x4c, 0x0d, 0xb7, 0xf4, 0xb5, 0xf2, 0x60, 0x50, 0x15, 0x00, 0x00, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0x4c, 0x0d, 0xb7, 0xf4, 0xb5, 0xf2, 0x60, 0x50,
-  0x15, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x4c, 0x0d, 0xb7, 0xf4,
-  0xb5, 0xf2, 0x60, 0x50, 0x25, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
-  0x4c, 0x0d, 0xb7, 0xf4, 0xb5, 0xf2, 0x60, 0x50, 0x15, 0x00, 0x00, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0x42, 0xb6, 0x41, 0xb7, 0x04, 0xa0, 0x88, 0x50,
-  0x46, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0xe4, 0x89, 0xa7, 0x93,
-  0x90, 0x77, 0x9c, 0x50, 0x27, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0xc8, 0x96, 0x64, 0xe4, 0xdd, 0x1b, 0xa1, 0x50, 0x0b, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0x03, 0xb1, 0xbd, 0x1e, 0x97, 0x2f, 0xa5, 0x50,
-  0x29, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x51, 0x53, 0x9c, 0xdb,
-  0xdb, 0x5d, 0xc8, 0x50, 0x3e, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-  0xdc, 0xdd, 0xe9, 0x59, 0xaf, 0xbb, 0xd0, 0x50, 0x28, 0x00, 0x00, 0x00,
-  0x3e, 0x00, 0x00, 0x00, 0x4d, 0xb2, 0xfb, 0xc7, 0x4c, 0x3f, 0xdd, 0x50,
-  0x16, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x58, 0x1c, 0x63, 0x8b,
-  0x6a, 0x4e, 0xf8, 0x50, 0x44, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x8c, 0x3e, 0x62, 0x2f, 0x19, 0xdb, 0x00, 0x51, 0x29, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x87, 0xb1, 0x55, 0xd5, 0x8e, 0x1a, 0x06, 0x51,
-  0x3d, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x14, 0x51, 0x1c, 0xe6,
-  0x5e, 0x73, 0x10, 0x51, 0x50, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x14, 0x51, 0x1c, 0xe6, 0x5e, 0x73, 0x10, 0x51, 0x34, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x14, 0x51, 0x1c, 0xe6, 0x5e, 0x73, 0x10, 0x51,
-  0x50, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x51, 0x1c, 0xe6,
-  0x5e, 0x73, 0x10, 0x51, 0x35, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x14, 0x51, 0x1c, 0xe6, 0x5e, 0x73, 0x10, 0x51, 0x3e, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x14, 0x51, 0x1c, 0xe6, 0x5e, 0x73, 0x10, 0x51,
-  0x50, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xe7, 0xbe, 0x56, 0xf7,
-  0x13, 0xe8, 0x26, 0x51, 0x34, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0xd9, 0x60, 0x05, 0xbf, 0x33, 0xeb, 0x2e, 0x51, 0x50, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0xb3, 0x44, 0x0c, 0x7d, 0x57, 0x1d, 0x48, 0x51,
-  0x35, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x94, 0xe1, 0x34, 0x20,
-  0x12, 0x99, 0x4a, 0x51, 0x43, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-  0xea, 0xab, 0xb4, 0xba, 0x26, 0x5c, 0x57, 0x51, 0x02, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x77, 0x59, 0xe0, 0x54, 0x52, 0xbb, 0x57, 0x51,
-  0x20, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0b, 0x97, 0x8a, 0xd0,
-  0xf7, 0xdb, 0x70, 0x51, 0x26, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0xd3, 0x90, 0x0d, 0x7b, 0xb8, 0x91, 0x75, 0x51, 0x0c, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0xf3, 0x4d, 0x11, 0x41, 0x08, 0x22, 0x79, 0x51,
-  0x3b, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x91, 0xc8, 0xe4, 0xfa,
-  0x2c, 0xf6, 0x98, 0x51, 0x50, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-  0x6e, 0x5a, 0xba, 0xfe, 0xb3, 0xa1, 0xa9, 0x51, 0x38, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0xe0, 0xf5, 0xa9, 0xee, 0x88, 0x46, 0xc0, 0x51,
-  0x2a, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xe0, 0xf5, 0xa9, 0xee,
-  0x88, 0x46, 0xc0, 0x51, 0x21, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x99, 0x0d, 0xfe, 0x67, 0x4a, 0x1d, 0xc4, 0x51, 0x2a, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x99, 0x0d, 0xfe, 0x67, 0x4a, 0x1d, 0xc4, 0x51,
-  0x28, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x99, 0x0d, 0xfe, 0x67,
-  0x4a, 0x1d, 0xc4, 0x51, 0x50, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-  0x99, 0x0d, 0xfe, 0x67, 0x4a, 0x1d, 0xc4, 0x51, 0x2a, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x99, 0x0d, 0xfe, 0x67, 0x4a, 0x1d, 0xc4, 0x51,
-  0x50, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xc8, 0x72, 0x05, 0x61,
-  0x13, 0xa0, 0xdf, 0x51, 0x27, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00,
-  0xe5, 0xba, 0x58, 0xa0, 0xda, 0x9e, 0xe2, 0x51, 0x13, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0x77, 0x3b, 0xe1, 0x15, 0x41, 0x54, 0xfb, 0x51,
-  0x4f, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x33, 0x22, 0xb6, 0xea,
-  0x26, 0xcf, 0xff, 0x51, 0x1f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
-  0x2f, 0x61, 0x69, 0xc8, 0x4f, 0x1e, 0x28, 0x52, 0x03, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0xd1, 0x39, 0x8f, 0xd0, 0x79, 0xb1, 0x40, 0x52,
-  0x0a, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x19, 0xdb, 0x91, 0xeb,
-  0xce, 0xc6, 0x45, 0x52, 0x45, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xe1, 0xcc, 0x0b, 0xc4, 0x65, 0x52, 0x01, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0xa2, 0x8d, 0xa9, 0x11, 0x47, 0x40, 0xaf, 0x52,
-  0x50, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x32, 0x00, 0x56, 0x90,
-  0x93, 0x95, 0xc4, 0x52, 0x2a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x95, 0x0c, 0xe2, 0x4a, 0xd2, 0xd8, 0xea, 0x52, 0x1c, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x72, 0xb6, 0x4f, 0x87, 0xc3, 0xb1, 0xed, 0x52,
-  0x3b, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x26, 0x87, 0x19, 0x91,
-  0x91, 0xe6, 0x1f, 0x53, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x9f, 0x78, 0x4c, 0x3d, 0xca, 0x74, 0x21, 0x53, 0x01, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x3b, 0xc2, 0xb4, 0xc1, 0xc1, 0xe8, 0x5c, 0x53,
-  0x3e, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x9d, 0x8e, 0xe8, 0x84,
-  0x8e, 0x56, 0x60, 0x53, 0x2e, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x6e, 0xb5, 0x3d, 0xe0, 0x95, 0x6f, 0x70, 0x53, 0x20, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0xc4, 0xcb, 0xa5, 0x90, 0x5c, 0xf4, 0xa6, 0x53,
-  0x02, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x12, 0xd8, 0x23, 0xc7,
-  0xa1, 0x6d, 0xc6, 0x53, 0x29, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0x80, 0xb8, 0x94, 0xe5, 0x2c, 0x8e, 0xd7, 0x53, 0x12, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x7b, 0xaa, 0x2c, 0xe1, 0x70, 0xab, 0xd8, 0x53,
-  0x2b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x97, 0x5c, 0xe8, 0xe3,
-  0x99, 0x3f, 0xdb, 0x53, 0x4f, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
-  0xa3, 0xe0, 0xa6, 0x9e, 0x81, 0xa5, 0xe2, 0x53, 0x20, 0x00, 0x00, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0xab, 0x6a, 0x57, 0x0e, 0xcf, 0xb0, 0xe3, 0x53,
-  0x2a, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0xc8, 0x44, 0x31, 0x19,
-  0xd5, 0x1e, 0xe6, 0x53, 0x33, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0xf8, 0x10, 0xfa, 0x3d, 0x5e, 0x0c, 0xef, 0x53, 0x16, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x9c, 0x5c, 0x34, 0x15, 0x5a, 0x7d, 0x03, 0x54,
-  0x1d, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x56, 0x07, 0xf4, 0x64,
-  0xa9, 0x11, 0x0a, 0x54, 0x20, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x76, 0xd4, 0x8a, 0xf8, 0xbd, 0xa7, 0x11, 0x54, 0x2b, 0x00, 0x00, 0x00,
-  0x22, 0x00, 0x00, 0x00, 0x8d, 0xbd, 0x4b, 0x01, 0xdb, 0x06, 0x20, 0x54,
-  0x26, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0xc1, 0xdd, 0xb1, 0xbf,
-  0xea, 0x1a, 0x25, 0x54, 0x1c, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
-  0x65, 0x03, 0x64, 0xa7, 0x83, 0xa0, 0x7b, 0x54, 0x33, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x65, 0x03, 0x64, 0xa7, 0x83, 0xa0, 0x7b, 0x54,
-  0x33, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x65, 0x03, 0x64, 0xa7,
-  0x83, 0xa0, 0x7b, 0x54, 0x34, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
-  0x65, 0x03, 0x64, 0xa7, 0x83, 0xa0, 0x7b, 0x54, 0x33, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0x65, 0x03, 0x64, 0xa7, 0x83, 0xa0, 0x7b, 0x54,
-  0x33, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x65, 0x03, 0x64, 0xa7,
-  0x83, 0xa0, 0x7b, 0x54, 0x33, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
-  0x65, 0x03, 0x64, 0xa7, 0x83, 0xa0, 0x7b, 0x54, 0x34, 0x00, 0x00, 0x00,
-  0x42, 0x00, 0x00, 0x00, 0x65, 0x03, 0x64, 0xa7, 0x83, 0xa0, 0x7b, 0x54,
-  0x33, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x65, 0x03, 0x64, 0xa7,
-  0x83, 0xa0, 0x7b, 0x54, 0x33, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
-  0x65, 0x03, 0x64, 0xa7, 0x83, 0xa0, 0x7b, 0x54, 0x33, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0xe9, 0x7d, 0xa1, 0x3b, 0x5e, 0xfb, 0x7f, 0x54,
-  0x0b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xe9, 0x7d, 0xa1, 0x3b,
-  0x5e, 0xfb, 0x7f, 0x54, 0x33, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-  0xa4, 0xf4, 0x63, 0xa5, 0xbf, 0x14, 0x89, 0x54, 0x18, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x80, 0xaa, 0xdf, 0x0f, 0x68, 0x69, 0xae, 0x54,
-  0x4e, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x40, 0xfe, 0xe2, 0x83,
-  0xac, 0x81, 0xb1, 0x54, 0x3a, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x2d, 0xf1, 0x29, 0x63, 0x51, 0xac, 0xcd, 0x54, 0x25, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x2d, 0xf1, 0x29, 0x63, 0x51, 0xac, 0xcd, 0x54,
-  0x30, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xee, 0x48, 0xc6, 0xb9,
-  0x0f, 0xa7, 0xd9, 0x54, 0x39, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0xc8, 0xb4, 0xbe, 0x04, 0xa6, 0x19, 0xef, 0x54, 0x31, 0x00, 0x00, 0x00,
-  0x45, 0x00, 0x00, 0x00, 0xd6, 0xf0, 0x53, 0x37, 0xce, 0x4c, 0x01, 0x55,
-  0x3a, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x27, 0xf0, 0x12, 0x2d,
-  0x2e, 0x5a, 0x16, 0x55, 0x1d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
-  0xbb, 0xde, 0x88, 0xba, 0x4c, 0x8f, 0x2e, 0x55, 0x28, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0xbb, 0xde, 0x88, 0xba, 0x4c, 0x8f, 0x2e, 0x55,
-  0x28, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x6b, 0x47, 0x82, 0x7e,
-  0xfb, 0x28, 0x39, 0x55, 0x46, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0xd2, 0xdd, 0xca, 0xc0, 0x17, 0xa8, 0x3d, 0x55, 0x02, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0xd2, 0xdd, 0xca, 0xc0, 0x17, 0xa8, 0x3d, 0x55,
-  0x09, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x96, 0x64, 0x88, 0x6c,
-  0xc3, 0xe6, 0x41, 0x55, 0x0c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
-  0xd0, 0x6e, 0x42, 0x39, 0xdd, 0x13, 0x63, 0x55, 0x30, 0x00, 0x00, 0x00,
-  0x42, 0x00, 0x00, 0x00, 0x8c, 0x79, 0x80, 0x27, 0x7a, 0xb1, 0x63, 0x55,
-  0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x07, 0xaa, 0x6b, 0xbd,
-  0xd4, 0x93, 0x74, 0x55, 0x4e, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x07, 0xaa, 0x6b, 0xbd, 0xd4, 0x93, 0x74, 0x55, 0x35, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0x07, 0xaa, 0x6b, 0xbd, 0xd4, 0x93, 0x74, 0x55,
-  0x4d, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x9f, 0x3e, 0x3f, 0x84,
-  0xe0, 0xaa, 0xb9, 0x55, 0x30, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0xf9, 0xe6, 0x1e, 0xa3, 0xa2, 0x8d, 0xc4, 0x55, 0x2a, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x13, 0xe1, 0x4e, 0x20, 0x96, 0xb3, 0xe0, 0x55,
-  0x2f, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0xec, 0x39, 0x49, 0x42,
-  0x7e, 0xa7, 0x1d, 0x56, 0x30, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0x06, 0xe8, 0x79, 0x3b, 0xc5, 0x96, 0x2d, 0x56, 0x14, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x95, 0x77, 0x90, 0x21, 0xe6, 0x69, 0x53, 0x56,
-  0x44, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x68, 0x8a, 0x9f, 0x42,
-  0x59, 0x79, 0xd1, 0x56, 0x46, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x07, 0x3e, 0xa5, 0x1c, 0x85, 0x57, 0x0b, 0x57, 0x4e, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x28, 0x64, 0x5c, 0xa4, 0x30, 0x89, 0x0e, 0x57,
-  0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x1f, 0x11, 0x32, 0xb1,
-  0xac, 0xfa, 0x27, 0x57, 0x3a, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0x49, 0x32, 0x9b, 0x67, 0xba, 0x23, 0x2d, 0x57, 0x4e, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0x85, 0x76, 0x0f, 0x2c, 0x28, 0x84, 0x2e, 0x57,
-  0x1b, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x56, 0x8c, 0x81, 0x84,
-  0x8f, 0x94, 0x56, 0x57, 0x15, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0xd2, 0x93, 0x71, 0x99, 0xdd, 0x7e, 0x6e, 0x57, 0x3a, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x8a, 0x12, 0xef, 0x04, 0xff, 0x02, 0x85, 0x57,
-  0x16, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0xfa, 0x17, 0x91, 0x19,
-  0x27, 0xa5, 0xa7, 0x57, 0x1d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x22, 0x28, 0x12, 0xfb, 0x38, 0x85, 0xe7, 0x57, 0x2f, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x22, 0x28, 0x12, 0xfb, 0x38, 0x85, 0xe7, 0x57,
-  0x15, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x9c, 0x85, 0x5e, 0x53,
-  0x9e, 0x4e, 0xe9, 0x57, 0x35, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x87, 0xc6, 0x17, 0xaf, 0xfa, 0x4d, 0x25, 0x58, 0x3c, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0x7b, 0xff, 0x89, 0x3e, 0xaf, 0x8d, 0x2e, 0x58,
-  0x27, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x7b, 0xff, 0x89, 0x3e,
-  0xaf, 0x8d, 0x2e, 0x58, 0x01, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
-  0x7b, 0xff, 0x89, 0x3e, 0xaf, 0x8d, 0x2e, 0x58, 0x27, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x7b, 0xff, 0x89, 0x3e, 0xaf, 0x8d, 0x2e, 0x58,
-  0x01, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x2d, 0xed, 0xac, 0x5e,
-  0x1c, 0xa1, 0x6f, 0x58, 0x2f, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0x73, 0x41, 0xba, 0x72, 0x03, 0x53, 0x72, 0x58, 0x33, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x9d, 0x29, 0x05, 0x89, 0xda, 0xd4, 0x82, 0x58,
-  0x1d, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x08, 0xe2, 0x91, 0x15,
-  0x71, 0x89, 0x8a, 0x58, 0x21, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
-  0x08, 0xe2, 0x91, 0x15, 0x71, 0x89, 0x8a, 0x58, 0x0a, 0x00, 0x00, 0x00,
-  0x0b, 0x00, 0x00, 0x00, 0x2e, 0xa1, 0x14, 0x58, 0x64, 0x4d, 0xb3, 0x58,
-  0x35, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x10, 0xb1, 0xca, 0x2e,
-  0x9c, 0xe5, 0xbb, 0x58, 0x0b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x4c, 0xbb, 0x46, 0x7e, 0x49, 0x8f, 0xcd, 0x58, 0x26, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x4c, 0xbb, 0x46, 0x7e, 0x49, 0x8f, 0xcd, 0x58,
-  0x3b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x38, 0x37, 0x85, 0x92,
-  0xa5, 0xac, 0xe2, 0x58, 0x1d, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00,
-  0xed, 0x26, 0xee, 0x90, 0xd6, 0x10, 0xe9, 0x58, 0x12, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x5f, 0x44, 0x87, 0xf6, 0xd4, 0x87, 0xee, 0x58,
-  0x16, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x70, 0x9e, 0x47, 0x66,
-  0xf4, 0xa2, 0xf5, 0x58, 0x20, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0xc9, 0xb5, 0x94, 0x09, 0x2e, 0xfc, 0xf5, 0x58, 0x14, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x26, 0xdc, 0xf9, 0x6f, 0x8c, 0xda, 0x0b, 0x59,
-  0x09, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x26, 0xdc, 0xf9, 0x6f,
-  0x8c, 0xda, 0x0b, 0x59, 0x0a, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x11, 0xd7, 0x12, 0xf2, 0x65, 0xd7, 0x0e, 0x59, 0x33, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x2e, 0xf4, 0xc4, 0xc0, 0x5a, 0x85, 0x1e, 0x59,
-  0x0b, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x54, 0x93, 0x2e, 0x4d,
-  0xcc, 0x4b, 0x26, 0x59, 0x3b, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x71, 0xdb, 0x09, 0xf3, 0x8c, 0xb2, 0x46, 0x59, 0x0d, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0xf8, 0x56, 0xec, 0xfe, 0x18, 0xf6, 0x59, 0x59,
-  0x14, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x57, 0x01, 0xa9, 0x0f,
-  0x26, 0xf8, 0xb0, 0x59, 0x1e, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
-  0x57, 0x01, 0xa9, 0x0f, 0x26, 0xf8, 0xb0, 0x59, 0x26, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x57, 0x01, 0xa9, 0x0f, 0x26, 0xf8, 0xb0, 0x59,
-  0x1e, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x57, 0x01, 0xa9, 0x0f,
-  0x26, 0xf8, 0xb0, 0x59, 0x16, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x57, 0x01, 0xa9, 0x0f, 0x26, 0xf8, 0xb0, 0x59, 0x1e, 0x00, 0x00, 0x00,
-  0x22, 0x00, 0x00, 0x00, 0x57, 0x01, 0xa9, 0x0f, 0x26, 0xf8, 0xb0, 0x59,
-  0x1c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x6a, 0xac, 0x6e, 0xd6,
-  0x64, 0xab, 0xcc, 0x59, 0x50, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-  0x9f, 0x60, 0x22, 0x45, 0xfc, 0x12, 0xdc, 0x59, 0x00, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0xb1, 0xe3, 0xb7, 0x56, 0xdc, 0x9e, 0x09, 0x5a,
-  0x38, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x86, 0x54, 0x9a, 0x83,
-  0xab, 0xb1, 0x0b, 0x5a, 0x1c, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0x47, 0x09, 0xda, 0x2e, 0x96, 0x9d, 0x0c, 0x5a, 0x27, 0x00, 0x00, 0x00,
-  0x3b, 0x00, 0x00, 0x00, 0xd2, 0x7b, 0x75, 0x75, 0xf2, 0xd4, 0x0e, 0x5a,
-  0x35, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x29, 0xf6, 0x10, 0x03,
-  0x7d, 0xf6, 0x14, 0x5a, 0x47, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0x29, 0xf6, 0x10, 0x03, 0x7d, 0xf6, 0x14, 0x5a, 0x47, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x29, 0xf6, 0x10, 0x03, 0x7d, 0xf6, 0x14, 0x5a,
-  0x47, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x29, 0xf6, 0x10, 0x03,
-  0x7d, 0xf6, 0x14, 0x5a, 0x47, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x29, 0xf6, 0x10, 0x03, 0x7d, 0xf6, 0x14, 0x5a, 0x47, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0xb7, 0x73, 0xbc, 0x0b, 0x86, 0x36, 0x16, 0x5a,
-  0x13, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xde, 0xec, 0x4a, 0xd5,
-  0x7f, 0x40, 0x18, 0x5a, 0x13, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0x47, 0xa7, 0x07, 0x0c, 0x7c, 0x7d, 0x2c, 0x5a, 0x29, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x78, 0x24, 0xa6, 0xb9, 0x9d, 0x13, 0x4a, 0x5a,
-  0x14, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xcb, 0xf0, 0x27, 0xa5,
-  0x22, 0x93, 0x87, 0x5a, 0x50, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0xef, 0xd4, 0x6f, 0xf2, 0x4b, 0x61, 0xd0, 0x5a, 0x20, 0x00, 0x00, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x9a, 0xf7, 0x18, 0x0a, 0xd3, 0x3d, 0xd1, 0x5a,
-  0x13, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x29, 0x44, 0xdc, 0x75,
-  0x41, 0x49, 0xd3, 0x5a, 0x0c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0xf3, 0xc1, 0x3c, 0x65, 0x47, 0x98, 0xfc, 0x5a, 0x00, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0xdf, 0xb9, 0x5b, 0x9d, 0xcf, 0xae, 0x0e, 0x5b,
-  0x31, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x79, 0x26, 0x5f, 0xb5,
-  0x07, 0xc3, 0x18, 0x5b, 0x27, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x00, 0x5b, 0x98, 0x57, 0x75, 0x22, 0x25, 0x5b, 0x38, 0x00, 0x00, 0x00,
-  0x37, 0x00, 0x00, 0x00, 0xe4, 0x42, 0x85, 0x8d, 0x66, 0x3b, 0x3e, 0x5b,
-  0x0b, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x3b, 0x1f, 0x44, 0xc5,
-  0xd1, 0x68, 0x62, 0x5b, 0x28, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x52, 0x9d, 0x49, 0x53, 0x34, 0x03, 0x9b, 0x5b, 0x31, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0x59, 0xc8, 0x73, 0xa4, 0x52, 0xe8, 0x9e, 0x5b,
-  0x18, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x14, 0x02, 0xf5, 0x09,
-  0xa8, 0x7c, 0xb2, 0x5b, 0x32, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0xd6, 0x64, 0x16, 0x79, 0xdb, 0x08, 0xcd, 0x5b, 0x1b, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x40, 0xed, 0xe8, 0x7c, 0x3f, 0xd7, 0xdd, 0x5b,
-  0x14, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x2c, 0x79, 0xb4, 0x34,
-  0xef, 0x9c, 0xf5, 0x5b, 0x17, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0x90, 0x76, 0x05, 0x30, 0x3f, 0x1c, 0x13, 0x5c, 0x0b, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x1d, 0x1a, 0x8b, 0xd6, 0xf7, 0xe2, 0x18, 0x5c,
-  0x44, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xf8, 0x50, 0x46, 0x42,
-  0xe7, 0xcd, 0x24, 0x5c, 0x14, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0xf8, 0x50, 0x46, 0x42, 0xe7, 0xcd, 0x24, 0x5c, 0x1d, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x02, 0xf0, 0x0f, 0xe1, 0x48, 0xe5, 0x2c, 0x5c,
-  0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xa8, 0x56, 0xd3, 0xb8,
-  0x8d, 0x7d, 0x52, 0x5c, 0x43, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x18, 0x52, 0xa9, 0x4b, 0xa6, 0x75, 0x56, 0x5c, 0x3b, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0xe9, 0x73, 0xb2, 0x71, 0x59, 0x64, 0x66, 0x5c,
-  0x1f, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0xe9, 0x73, 0xb2, 0x71,
-  0x59, 0x64, 0x66, 0x5c, 0x16, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0xe9, 0x73, 0xb2, 0x71, 0x59, 0x64, 0x66, 0x5c, 0x14, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0xe9, 0x73, 0xb2, 0x71, 0x59, 0x64, 0x66, 0x5c,
-  0x1d, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xe9, 0x73, 0xb2, 0x71,
-  0x59, 0x64, 0x66, 0x5c, 0x0a, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x8b, 0x52, 0xdc, 0xbd, 0xfa, 0xc6, 0x67, 0x5c, 0x35, 0x00, 0x00, 0x00,
-  0x43, 0x00, 0x00, 0x00, 0x42, 0x44, 0xe6, 0x5a, 0x3b, 0x44, 0xc5, 0x5c,
-  0x33, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x63, 0x9e, 0xba, 0x98,
-  0x6b, 0xa3, 0x0a, 0x5d, 0x47, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x55, 0x32, 0xc2, 0xd8, 0x3a, 0x5c, 0x21, 0x5d, 0x26, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x9b, 0x2b, 0x3f, 0xa5, 0xc9, 0x34, 0x3c, 0x5d,
-  0x3c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x4a, 0x8f, 0xe1, 0x7c,
-  0x5a, 0xa0, 0x4a, 0x5d, 0x3e, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x8f, 0x79, 0x06, 0xc9, 0xaa, 0xd7, 0x51, 0x5d, 0x4e, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0x40, 0x68, 0x1b, 0xb2, 0xd9, 0xbb, 0x58, 0x5d,
-  0x29, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x29, 0x4c, 0x0b, 0x13,
-  0xf1, 0x78, 0x7a, 0x5d, 0x1d, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0xfb, 0x8d, 0x11, 0xe1, 0x35, 0x2c, 0x7e, 0x5d, 0x33, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x0c, 0xf9, 0xdd, 0x08, 0x82, 0x7a, 0xb8, 0x5d,
-  0x26, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x03, 0xaf, 0xc5, 0xd8,
-  0x4f, 0x16, 0xd2, 0x5d, 0x4f, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
-  0xab, 0xcd, 0xe6, 0xbd, 0x19, 0x06, 0xda, 0x5d, 0x03, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0x8f, 0x83, 0xa3, 0x77, 0x99, 0xf2, 0xe0, 0x5d,
-  0x39, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xf3, 0x3f, 0x0b, 0xe8,
-  0x29, 0x8d, 0xe1, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0xf8, 0x17, 0x31, 0x8c, 0x75, 0xa2, 0xe5, 0x5d, 0x3a, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0x22, 0x21, 0x5f, 0xbb, 0x50, 0xe4, 0x02, 0x5e,
-  0x3a, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x35, 0xab, 0xce, 0x53,
-  0x53, 0x58, 0x05, 0x5e, 0x0d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x1a, 0x49, 0xb3, 0xde, 0x92, 0x96, 0x05, 0x5e, 0x2b, 0x00, 0x00, 0x00,
-  0x22, 0x00, 0x00, 0x00, 0x38, 0x68, 0x5f, 0xb0, 0x4e, 0x28, 0x13, 0x5e,
-  0x3a, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3e, 0xc9, 0x04, 0xcc,
-  0x5c, 0xea, 0x17, 0x5e, 0x1b, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0x69, 0xca, 0x56, 0xcf, 0xb4, 0x48, 0x23, 0x5e, 0x0f, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x63, 0x48, 0xad, 0x60, 0xb0, 0xa1, 0x7f, 0x5e,
-  0x31, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xd6, 0x2c, 0x9a, 0x32,
-  0xdc, 0xfc, 0x9b, 0x5e, 0x45, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x17, 0x8e, 0x73, 0xe8, 0x20, 0xd4, 0xfe, 0x5e, 0x35, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0xfd, 0xc2, 0x56, 0xcb, 0x4b, 0x00, 0x15, 0x5f,
-  0x14, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x69, 0x0d, 0x8b, 0x92,
-  0x3e, 0xb4, 0x29, 0x5f, 0x30, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0x69, 0x0d, 0x8b, 0x92, 0x3e, 0xb4, 0x29, 0x5f, 0x1c, 0x00, 0x00, 0x00,
-  0x25, 0x00, 0x00, 0x00, 0xf0, 0x7c, 0x66, 0xb1, 0x4e, 0xb6, 0x2c, 0x5f,
-  0x15, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xf0, 0x7c, 0x66, 0xb1,
-  0x4e, 0xb6, 0x2c, 0x5f, 0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x0c, 0xff, 0x57, 0x7b, 0x02, 0x70, 0x4c, 0x5f, 0x46, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0xd1, 0xc6, 0x70, 0x83, 0xdf, 0x1b, 0x6a, 0x5f,
-  0x14, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1f, 0x25, 0x24, 0x65,
-  0x79, 0x61, 0xa0, 0x5f, 0x32, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0xfa, 0x17, 0xba, 0x86, 0x5d, 0x3a, 0xaf, 0x5f, 0x33, 0x00, 0x00, 0x00,
-  0x0f, 0x00, 0x00, 0x00, 0x75, 0xeb, 0x0b, 0x40, 0x79, 0x29, 0xb3, 0x5f,
-  0x2a, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x27, 0x83, 0xdb, 0x5e,
-  0x68, 0xc3, 0xb3, 0x5f, 0x13, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0x19, 0x3b, 0x4d, 0x3c, 0xdc, 0x61, 0xb9, 0x5f, 0x29, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0xaa, 0x3f, 0x19, 0x7b, 0xc4, 0xdb, 0xb9, 0x5f,
-  0x3d, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x79, 0xd6, 0x8f, 0xab,
-  0xcb, 0xdb, 0xc3, 0x5f, 0x19, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0x0f, 0x88, 0x2d, 0xb5, 0xe8, 0xff, 0xc6, 0x5f, 0x3b, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0xd9, 0x80, 0xde, 0x82, 0xc9, 0x83, 0xe4, 0x5f,
-  0x1c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x48, 0xbc, 0xe7, 0x6d,
-  0x48, 0x73, 0x0c, 0x60, 0x1e, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0x15, 0xf5, 0x96, 0xae, 0x47, 0xba, 0x1f, 0x60, 0x2f, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0x15, 0xf5, 0x96, 0xae, 0x47, 0xba, 0x1f, 0x60,
-  0x46, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0xea, 0xc8, 0x94, 0x9c,
-  0x9f, 0xa1, 0x39, 0x60, 0x45, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0xea, 0xc8, 0x94, 0x9c, 0x9f, 0xa1, 0x39, 0x60, 0x21, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x88, 0x15, 0xe4, 0x7e, 0x79, 0xe1, 0x76, 0x60,
-  0x27, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x9c, 0xed, 0xbc, 0x6b,
-  0x13, 0x21, 0x81, 0x60, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x5e, 0xd6, 0x32, 0x08, 0x6e, 0x52, 0x96, 0x60, 0x1f, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x5e, 0xd6, 0x32, 0x08, 0x6e, 0x52, 0x96, 0x60,
-  0x3c, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x86, 0x5c, 0x05, 0xc4,
-  0xe0, 0x75, 0x9f, 0x60, 0x44, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
-  0x93, 0x36, 0x96, 0xde, 0x60, 0xa1, 0xc5, 0x60, 0x30, 0x00, 0x00, 0x00,
-  0x42, 0x00, 0x00, 0x00, 0xbb, 0xa5, 0x7d, 0x91, 0x78, 0xdb, 0xd9, 0x60,
-  0x27, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x72, 0xc8, 0xd6, 0x86,
-  0x7d, 0xad, 0xe3, 0x60, 0x13, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
-  0x0b, 0xdd, 0x69, 0xf4, 0x51, 0x32, 0xf7, 0x60, 0x46, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x07, 0xc3, 0x8e, 0x45, 0x73, 0x0c, 0xfb, 0x60,
-  0x20, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xa9, 0x42, 0x16, 0xd1,
-  0xc8, 0xe0, 0x29, 0x61, 0x3c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0xb7, 0x65, 0x61, 0x11, 0xf0, 0xac, 0x3a, 0x61, 0x34, 0x00, 0x00, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0xd8, 0x89, 0xa4, 0xb0, 0x78, 0xc0, 0x3d, 0x61,
-  0x43, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0xce, 0xc8, 0x4f, 0x82,
-  0x7e, 0x96, 0x54, 0x61, 0x1f, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00,
-  0x5f, 0x58, 0x2f, 0xe1, 0x96, 0x89, 0x69, 0x61, 0x01, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x8a, 0x9c, 0x02, 0xfb, 0xbb, 0x3d, 0x7a, 0x61,
-  0x1d, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0xb1, 0xab, 0x20, 0x14,
-  0x4a, 0x43, 0x82, 0x61, 0x3e, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
-  0xa1, 0x1f, 0x61, 0x92, 0xa5, 0x77, 0x8d, 0x61, 0x1d, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0xec, 0xe0, 0xc2, 0xaf, 0x87, 0xbc, 0x93, 0x61,
-  0x1d, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x30, 0x16, 0x30, 0xe6,
-  0x58, 0xce, 0xa0, 0x61, 0x1e, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
-  0x5b, 0xc5, 0xc3, 0x7e, 0xff, 0xce, 0xaa, 0x61, 0x3a, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x5b, 0xc5, 0xc3, 0x7e, 0xff, 0xce, 0xaa, 0x61,
-  0x33, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xe9, 0x15, 0x67, 0x12,
-  0xd7, 0x84, 0xb1, 0x61, 0x15, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0xa0, 0x88, 0xd4, 0x27, 0xf4, 0xea, 0xc0, 0x61, 0x3a, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0xb9, 0x09, 0xc5, 0xc4, 0x09, 0x54, 0xc8, 0x61,
-  0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x5c, 0x28, 0xf4, 0x20,
-  0xf7, 0x2e, 0xe4, 0x61, 0x0a, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0xf3, 0x7e, 0x33, 0xce, 0x5c, 0xd1, 0xf3, 0x61, 0x4d, 0x00, 0x00, 0x00,
-  0x3b, 0x00, 0x00, 0x00, 0x09, 0x1e, 0xda, 0x27, 0x43, 0x35, 0x03, 0x62,
-  0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x7f, 0x51, 0x18, 0xe2,
-  0x75, 0x28, 0x41, 0x62, 0x45, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x95, 0x0e, 0xfc, 0xd1, 0x8a, 0x1a, 0x5a, 0x62, 0x09, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x5a, 0x71, 0x83, 0x13, 0x70, 0x76, 0x6c, 0x62,
-  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xfe, 0x19, 0x76, 0x2e,
-  0x18, 0x20, 0x8c, 0x62, 0x45, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x3e, 0x3d, 0x01, 0xba, 0xeb, 0xf8, 0xc4, 0x62, 0x26, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0x0b, 0x2e, 0x90, 0x9f, 0xd6, 0x96, 0xd3, 0x62,
-  0x14, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xab, 0x08, 0x61, 0xad,
-  0xc3, 0xaf, 0xe4, 0x62, 0x1d, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0xab, 0x08, 0x61, 0xad, 0xc3, 0xaf, 0xe4, 0x62, 0x45, 0x00, 0x00, 0x00,
-  0x46, 0x00, 0x00, 0x00, 0x5b, 0x60, 0x1d, 0x32, 0x69, 0x3b, 0xe7, 0x62,
-  0x3b, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x38, 0xd1, 0xe7, 0x43,
-  0x37, 0x16, 0xfc, 0x62, 0x14, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0x38, 0xd1, 0xe7, 0x43, 0x37, 0x16, 0xfc, 0x62, 0x14, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x95, 0x1c, 0x69, 0x96, 0x01, 0x63,
-  0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x86, 0x0c, 0x70, 0x47,
-  0x44, 0xc4, 0x0c, 0x63, 0x4f, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
-  0xb1, 0x5f, 0xde, 0x6e, 0xa2, 0xf1, 0x17, 0x63, 0x28, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x51, 0x55, 0x9f, 0x9d, 0x72, 0xdb, 0x25, 0x63,
-  0x33, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x03, 0x22, 0xe7, 0xf4,
-  0x50, 0xcc, 0x52, 0x63, 0x21, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0x03, 0x22, 0xe7, 0xf4, 0x50, 0xcc, 0x52, 0x63, 0x3c, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x91, 0x4d, 0xc4, 0x81, 0xd2, 0x33, 0x53, 0x63,
-  0x28, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x16, 0xd6, 0x2d, 0x04,
-  0xec, 0xa5, 0x6e, 0x63, 0x3c, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-  0x63, 0x07, 0x0c, 0xf2, 0x0c, 0x16, 0x84, 0x63, 0x09, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0xff, 0xa2, 0x46, 0x74, 0xfe, 0xfa, 0x8c, 0x63,
-  0x2f, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xfb, 0x55, 0x27, 0xb2,
-  0xc7, 0xf4, 0x9e, 0x63, 0x14, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0xf4, 0xba, 0x36, 0xc7, 0x63, 0xc7, 0xcc, 0x63, 0x39, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0xb2, 0xd4, 0x9c, 0x87, 0xbb, 0x5e, 0x51, 0x64,
-  0x14, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x28, 0x2f, 0x54, 0x00,
-  0x0e, 0xd6, 0x5a, 0x64, 0x30, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
-  0x90, 0x9d, 0x97, 0x2c, 0x44, 0x3a, 0x8d, 0x64, 0x12, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0xc8, 0x35, 0x9e, 0x04, 0x27, 0x1d, 0x93, 0x64,
-  0x4d, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x63, 0x67, 0x6d, 0xe5,
-  0xd6, 0x2d, 0xe7, 0x64, 0x3b, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-  0xa2, 0x50, 0x83, 0x77, 0xd3, 0x8a, 0x0f, 0x65, 0x1c, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x0b, 0x54, 0x51, 0x75, 0x8d, 0x21, 0x4b, 0x65,
-  0x50, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x82, 0x1f, 0x45, 0xe2,
-  0xf1, 0x77, 0x5d, 0x65, 0x20, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x82, 0x1f, 0x45, 0xe2, 0xf1, 0x77, 0x5d, 0x65, 0x20, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x82, 0x1f, 0x45, 0xe2, 0xf1, 0x77, 0x5d, 0x65,
-  0x20, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x15, 0xec, 0x9a, 0x33,
-  0x85, 0x9e, 0xb4, 0x65, 0x27, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00,
-  0xc1, 0x78, 0x77, 0x0e, 0xc5, 0x4e, 0xbb, 0x65, 0x4d, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0xc1, 0x78, 0x77, 0x0e, 0xc5, 0x4e, 0xbb, 0x65,
-  0x4d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0xc3, 0x65, 0xa5, 0x3a,
-  0x2a, 0x26, 0xc2, 0x65, 0x1c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x40, 0x4e, 0xc7, 0x54, 0x81, 0x4c, 0xd5, 0x65, 0x2f, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x40, 0x4e, 0xc7, 0x54, 0x81, 0x4c, 0xd5, 0x65,
-  0x0c, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x1e, 0x46, 0x6f, 0x38,
-  0x1a, 0xad, 0x16, 0x66, 0x45, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x1e, 0x46, 0x6f, 0x38, 0x1a, 0xad, 0x16, 0x66, 0x29, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x1e, 0x46, 0x6f, 0x38, 0x1a, 0xad, 0x16, 0x66,
-  0x31, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1e, 0x46, 0x6f, 0x38,
-  0x1a, 0xad, 0x16, 0x66, 0x20, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x1e, 0x46, 0x6f, 0x38, 0x1a, 0xad, 0x16, 0x66, 0x45, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x53, 0xfb, 0xe7, 0x6f, 0x21, 0x68, 0x46, 0x66,
-  0x3c, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x59, 0x46, 0xdf, 0xb5,
-  0xb1, 0x76, 0x70, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-  0x14, 0xc5, 0xa3, 0x2e, 0x5b, 0xe3, 0x92, 0x66, 0x3b, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x02, 0xdd, 0xc4, 0x5a, 0xa0, 0x88, 0xb7, 0x66,
-  0x3c, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0xc9, 0x72, 0x3b, 0xfa,
-  0xc2, 0xad, 0xbf, 0x66, 0x1c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0xf2, 0xd2, 0x30, 0x50, 0x0c, 0x74, 0xe3, 0x66, 0x3b, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0xea, 0x71, 0xbd, 0x1e, 0xff, 0x40, 0x0c, 0x67,
-  0x15, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x50, 0x52, 0x1a, 0x4e,
-  0x6d, 0x69, 0x48, 0x67, 0x0a, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x90, 0x91, 0xa7, 0x1b, 0xf3, 0x16, 0x4c, 0x67, 0x32, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x90, 0x91, 0xa7, 0x1b, 0xf3, 0x16, 0x4c, 0x67,
-  0x31, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x90, 0x91, 0xa7, 0x1b,
-  0xf3, 0x16, 0x4c, 0x67, 0x32, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x90, 0x91, 0xa7, 0x1b, 0xf3, 0x16, 0x4c, 0x67, 0x47, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0x6a, 0x87, 0x16, 0xa8, 0xbc, 0x48, 0x82, 0x67,
-  0x47, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x55, 0x86, 0x8d, 0x01,
-  0xae, 0x03, 0x9f, 0x67, 0x29, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0xf4, 0x8c, 0x8c, 0xde, 0x29, 0x8a, 0xa5, 0x67, 0x1d, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0xf4, 0x8c, 0x8c, 0xde, 0x29, 0x8a, 0xa5, 0x67,
-  0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xf4, 0x8c, 0x8c, 0xde,
-  0x29, 0x8a, 0xa5, 0x67, 0x0a, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0xf4, 0x8c, 0x8c, 0xde, 0x29, 0x8a, 0xa5, 0x67, 0x1d, 0x00, 0x00, 0x00,
-  0x43, 0x00, 0x00, 0x00, 0xf4, 0x8c, 0x8c, 0xde, 0x29, 0x8a, 0xa5, 0x67,
-  0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xf4, 0x8c, 0x8c, 0xde,
-  0x29, 0x8a, 0xa5, 0x67, 0x1c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x06, 0x58, 0xb4, 0xe9, 0xe6, 0x78, 0xda, 0x67, 0x1d, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x35, 0xcc, 0xae, 0x17, 0x60, 0x71, 0xdb, 0x67,
-  0x14, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xfc, 0x49, 0x96, 0x43,
-  0x4f, 0x61, 0xf9, 0x67, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x5e, 0xcc, 0x16, 0x69, 0xc9, 0xd6, 0x63, 0x68, 0x09, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x03, 0x2f, 0x7d, 0x4b, 0xb9, 0xa6, 0x97, 0x68,
-  0x1f, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x03, 0x2f, 0x7d, 0x4b,
-  0xb9, 0xa6, 0x97, 0x68, 0x15, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
-  0x03, 0x2f, 0x7d, 0x4b, 0xb9, 0xa6, 0x97, 0x68, 0x3a, 0x00, 0x00, 0x00,
-  0x12, 0x00, 0x00, 0x00, 0x48, 0x5a, 0xd5, 0xaa, 0x37, 0x0d, 0xdd, 0x68,
-  0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x61, 0xa9, 0x07, 0x96,
-  0x86, 0xae, 0x04, 0x69, 0x4f, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
-  0x27, 0x08, 0xa3, 0xfc, 0x6c, 0x4a, 0x14, 0x69, 0x35, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0xe3, 0x47, 0xc2, 0xa1, 0x79, 0x53, 0x2a, 0x69,
-  0x2b, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0xe3, 0x47, 0xc2, 0xa1,
-  0x79, 0x53, 0x2a, 0x69, 0x2b, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0xe3, 0x47, 0xc2, 0xa1, 0x79, 0x53, 0x2a, 0x69, 0x2b, 0x00, 0x00, 0x00,
-  0x37, 0x00, 0x00, 0x00, 0x6d, 0xbd, 0xfc, 0xc4, 0x8f, 0x32, 0x46, 0x69,
-  0x1e, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x46, 0x5a, 0xc8, 0xe5,
-  0xb4, 0xed, 0x7f, 0x69, 0x3b, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0xcb, 0x3b, 0x15, 0x36, 0x40, 0xae, 0x94, 0x69, 0x2f, 0x00, 0x00, 0x00,
-  0x43, 0x00, 0x00, 0x00, 0x9a, 0xa9, 0x0a, 0xe0, 0x45, 0x6c, 0xb8, 0x69,
-  0x1c, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0xb0, 0xfa, 0xb2, 0xc3,
-  0xea, 0x5a, 0xc2, 0x69, 0x1d, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
-  0x80, 0xb0, 0xf6, 0x41, 0xa5, 0xee, 0xe8, 0x69, 0x2f, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0xf2, 0xc7, 0xe1, 0xcf, 0x16, 0x12, 0x02, 0x6a,
-  0x2f, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x77, 0x8f, 0x62, 0x4c,
-  0x4b, 0xde, 0x22, 0x6a, 0x12, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x0d, 0x5c, 0xd7, 0x6d, 0xc7, 0x12, 0x2d, 0x6a, 0x46, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x2e, 0x49, 0xa3, 0x49, 0x50, 0x27, 0x37, 0x6a,
-  0x47, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x3c, 0x33, 0xb5, 0xce,
-  0x22, 0x0e, 0x3e, 0x6a, 0x1e, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x17, 0x68, 0x19, 0xf4, 0x74, 0x16, 0x50, 0x6a, 0x44, 0x00, 0x00, 0x00,
-  0x3b, 0x00, 0x00, 0x00, 0x8c, 0xd6, 0xef, 0xcb, 0xdc, 0x8c, 0x5a, 0x6a,
-  0x1f, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x08, 0x44, 0x77, 0x18,
-  0xe1, 0x17, 0x63, 0x6a, 0x02, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
-  0xc8, 0xd5, 0x6e, 0x06, 0xf1, 0xb4, 0x6d, 0x6a, 0x16, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0xdb, 0x39, 0x04, 0x51, 0x3a, 0x08, 0xbd, 0x6a,
-  0x02, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x62, 0x08, 0x55, 0x3b,
-  0x86, 0x1a, 0xee, 0x6a, 0x4f, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
-  0x1a, 0x83, 0xde, 0x73, 0x25, 0x00, 0xf0, 0x6a, 0x02, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0xe2, 0x2b, 0x62, 0x0e, 0x98, 0x29, 0xfe, 0x6a,
-  0x46, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0xe2, 0x26, 0x5f, 0xe6,
-  0x3a, 0xb8, 0x1f, 0x6b, 0x1d, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x3f, 0xfc, 0x19, 0xc1, 0x58, 0xec, 0x35, 0x6b, 0x3c, 0x00, 0x00, 0x00,
-  0x3b, 0x00, 0x00, 0x00, 0x3f, 0xfc, 0x19, 0xc1, 0x58, 0xec, 0x35, 0x6b,
-  0x31, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x3f, 0xfc, 0x19, 0xc1,
-  0x58, 0xec, 0x35, 0x6b, 0x3c, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-  0x1a, 0xe2, 0xdf, 0x02, 0xfd, 0x84, 0x4b, 0x6b, 0x26, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0x4d, 0x74, 0x6f, 0x88, 0x3a, 0xeb, 0x64, 0x6b,
-  0x3c, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x7c, 0xed, 0x74, 0x30,
-  0x7a, 0x85, 0x85, 0x6b, 0x25, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x06, 0xa8, 0x90, 0x05, 0x75, 0x8a, 0x96, 0x6b, 0x0a, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0xd8, 0x05, 0x44, 0xe8, 0xc2, 0x19, 0xc7, 0x6b,
-  0x30, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x7e, 0xc0, 0xea, 0xd6,
-  0x0d, 0x0a, 0x23, 0x6c, 0x1e, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0x89, 0x99, 0x4e, 0x8e, 0x19, 0xf2, 0x24, 0x6c, 0x0a, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x89, 0x99, 0x4e, 0x8e, 0x19, 0xf2, 0x24, 0x6c,
-  0x1d, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x89, 0x99, 0x4e, 0x8e,
-  0x19, 0xf2, 0x24, 0x6c, 0x0a, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x6a, 0x1b, 0xa6, 0xfd, 0x83, 0x49, 0x37, 0x6c, 0x3b, 0x00, 0x00, 0x00,
-  0x3d, 0x00, 0x00, 0x00, 0xb3, 0xdb, 0x00, 0x30, 0xc4, 0xc1, 0x57, 0x6c,
-  0x28, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xe5, 0x09, 0xd6, 0x4e,
-  0xd8, 0x66, 0x6d, 0x6c, 0x3c, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-  0x7e, 0x64, 0x9e, 0x80, 0xb4, 0x26, 0x75, 0x6c, 0x25, 0x00, 0x00, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0x7e, 0x64, 0x9e, 0x80, 0xb4, 0x26, 0x75, 0x6c,
-  0x25, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x3b, 0xb7, 0xee, 0xac,
-  0xc7, 0x75, 0xa7, 0x6c, 0x1d, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x3b, 0xb7, 0xee, 0xac, 0xc7, 0x75, 0xa7, 0x6c, 0x1d, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x3b, 0xb7, 0xee, 0xac, 0xc7, 0x75, 0xa7, 0x6c,
-  0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x44, 0xfa, 0x97, 0x03,
-  0xfa, 0x5b, 0xac, 0x6c, 0x2a, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x44, 0xfa, 0x97, 0x03, 0xfa, 0x5b, 0xac, 0x6c, 0x34, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0x44, 0xfa, 0x97, 0x03, 0xfa, 0x5b, 0xac, 0x6c,
-  0x2a, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x5c, 0xf8, 0x29, 0xfa,
-  0xf6, 0xf8, 0xc9, 0x6c, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x2a, 0x48, 0x96, 0x34, 0x3e, 0x20, 0xcc, 0x6c, 0x0b, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x84, 0x8f, 0xf0, 0x5e, 0x82, 0xcb, 0xdb, 0x6c,
-  0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0xf7, 0x9d, 0x57, 0x65,
-  0xd5, 0x96, 0xe2, 0x6c, 0x15, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0xc5, 0x98, 0x2b, 0xec, 0xb2, 0xa2, 0xf7, 0x6c, 0x1d, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0xeb, 0x79, 0x04, 0x5f, 0x89, 0xe4, 0xf8, 0x6c,
-  0x3a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xb3, 0x7e, 0x27, 0xe7,
-  0x60, 0xfa, 0xfe, 0x6c, 0x16, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0x11, 0x24, 0x91, 0x27, 0x2e, 0x29, 0x5d, 0x6d, 0x03, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x79, 0x1b, 0x80, 0x7d, 0xf0, 0xa4, 0x68, 0x6d,
-  0x4f, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x66, 0xbe, 0x79, 0xee,
-  0x8a, 0x96, 0x6a, 0x6d, 0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0xdb, 0x58, 0x9a, 0xfc, 0x5f, 0xb9, 0x80, 0x6d, 0x46, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0xba, 0x34, 0xe0, 0x19, 0xc6, 0xc1, 0x90, 0x6d,
-  0x46, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0xe5, 0x77, 0x50, 0x2e,
-  0x09, 0x97, 0xa1, 0x6d, 0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0xbe, 0x16, 0x25, 0xb4, 0x7c, 0x1c, 0xc1, 0x6d, 0x12, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0xc7, 0x1b, 0x25, 0x6e, 0xe6, 0x33, 0xd7, 0x6d,
-  0x12, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xe8, 0xda, 0x85, 0xbb,
-  0x23, 0xff, 0xdf, 0x6d, 0x1d, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x2c, 0x80, 0x45, 0x0e, 0x7c, 0x9c, 0xf7, 0x6d, 0x3c, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0x2c, 0x80, 0x45, 0x0e, 0x7c, 0x9c, 0xf7, 0x6d,
-  0x3c, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0xfb, 0x38, 0x34, 0xfb,
-  0x92, 0x82, 0x06, 0x6e, 0x14, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0xfb, 0x38, 0x34, 0xfb, 0x92, 0x82, 0x06, 0x6e, 0x3a, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0xfb, 0x38, 0x34, 0xfb, 0x92, 0x82, 0x06, 0x6e,
-  0x14, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xa4, 0xdf, 0x70, 0xe2,
-  0x32, 0x04, 0x31, 0x6e, 0x14, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x40, 0x8a, 0x48, 0x3b, 0x6e, 0x6e, 0x3c, 0x6e, 0x16, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x75, 0x41, 0xde, 0xf8, 0xb5, 0x4a, 0x79, 0x6e,
-  0x15, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x97, 0x23, 0x92, 0xf8,
-  0xe1, 0x6a, 0x7a, 0x6e, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0xc4, 0x4f, 0x55, 0xd8, 0x3b, 0xe9, 0x88, 0x6e, 0x1f, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x3c, 0x3b, 0x8d, 0xcb, 0x8e, 0x6d, 0x99, 0x6e,
-  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xfb, 0xc7, 0xb6, 0x9c,
-  0x28, 0x2f, 0xfd, 0x6e, 0x30, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0xbd, 0x1b, 0xdc, 0x67, 0x3e, 0xbb, 0x05, 0x6f, 0x3a, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0x16, 0x8b, 0x85, 0x7b, 0xd1, 0x8e, 0x25, 0x6f,
-  0x15, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x64, 0xe3, 0x57, 0xd6,
-  0x3e, 0x34, 0x29, 0x6f, 0x2a, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x6a, 0x5d, 0xfd, 0x36, 0xb6, 0x7b, 0x31, 0x6f, 0x1c, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x6a, 0x5d, 0xfd, 0x36, 0xb6, 0x7b, 0x31, 0x6f,
-  0x22, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x6a, 0x5d, 0xfd, 0x36,
-  0xb6, 0x7b, 0x31, 0x6f, 0x16, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0xd3, 0x0f, 0x7e, 0x81, 0xfd, 0xbe, 0x36, 0x6f, 0x02, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0xd3, 0x0f, 0x7e, 0x81, 0xfd, 0xbe, 0x36, 0x6f,
-  0x1b, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xd3, 0x0f, 0x7e, 0x81,
-  0xfd, 0xbe, 0x36, 0x6f, 0x03, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
-  0xd3, 0x0f, 0x7e, 0x81, 0xfd, 0xbe, 0x36, 0x6f, 0x1b, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0xd3, 0x0f, 0x7e, 0x81, 0xfd, 0xbe, 0x36, 0x6f,
-  0x03, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0xd3, 0x0f, 0x7e, 0x81,
-  0xfd, 0xbe, 0x36, 0x6f, 0x1b, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0xd3, 0x0f, 0x7e, 0x81, 0xfd, 0xbe, 0x36, 0x6f, 0x03, 0x00, 0x00, 0x00,
-  0x25, 0x00, 0x00, 0x00, 0x4b, 0x26, 0xa5, 0x9b, 0x78, 0xe0, 0x3e, 0x6f,
-  0x13, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x3e, 0x66, 0xa6, 0x65,
-  0xcd, 0x33, 0x45, 0x6f, 0x0a, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x3e, 0x66, 0xa6, 0x65, 0xcd, 0x33, 0x45, 0x6f, 0x0a, 0x00, 0x00, 0x00,
-  0x2e, 0x00, 0x00, 0x00, 0x3e, 0x66, 0xa6, 0x65, 0xcd, 0x33, 0x45, 0x6f,
-  0x0b, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x38, 0xcd, 0x63, 0xce,
-  0x81, 0x6e, 0x60, 0x6f, 0x1c, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0x23, 0x88, 0xc8, 0x95, 0xa3, 0x0d, 0x79, 0x6f, 0x34, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x29, 0x44, 0x94, 0xb4, 0xa5, 0xd3, 0x97, 0x6f,
-  0x26, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1c, 0xdb, 0x48, 0x45,
-  0xe1, 0x15, 0x98, 0x6f, 0x1c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x07, 0x2d, 0x1c, 0x6f, 0x07, 0x3c, 0xad, 0x6f, 0x15, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0xd2, 0x4d, 0xb6, 0x6d, 0x32, 0xab, 0xc2, 0x6f,
-  0x26, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0xfa, 0x9b, 0x46, 0x1f,
-  0x3d, 0x77, 0xdc, 0x6f, 0x20, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0xae, 0x8b, 0x92, 0x8f, 0x9b, 0x12, 0x01, 0x70, 0x18, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x81, 0x56, 0x27, 0x18, 0xae, 0xbf, 0x02, 0x70,
-  0x0e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x2b, 0x81, 0x70, 0x04,
-  0x43, 0x01, 0x03, 0x70, 0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x93, 0x05, 0xb0, 0xce, 0x4e, 0xcc, 0x17, 0x70, 0x1f, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x93, 0x05, 0xb0, 0xce, 0x4e, 0xcc, 0x17, 0x70,
-  0x4f, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x93, 0x05, 0xb0, 0xce,
-  0x4e, 0xcc, 0x17, 0x70, 0x4f, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
-  0x93, 0x05, 0xb0, 0xce, 0x4e, 0xcc, 0x17, 0x70, 0x3b, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0x45, 0xf3, 0x8b, 0xe5, 0x7a, 0x1e, 0x26, 0x70,
-  0x35, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xdd, 0x87, 0x31, 0x34,
-  0x97, 0xf9, 0x2f, 0x70, 0x2f, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0xdd, 0x87, 0x31, 0x34, 0x97, 0xf9, 0x2f, 0x70, 0x26, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0x53, 0x6e, 0x8f, 0x75, 0xba, 0x3f, 0x42, 0x70,
-  0x33, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x18, 0x62, 0x1a, 0x9a,
-  0xeb, 0x19, 0x4b, 0x70, 0x4f, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-  0x2b, 0xf8, 0x62, 0xa7, 0x79, 0x7f, 0x59, 0x70, 0x44, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x2b, 0xf8, 0x62, 0xa7, 0x79, 0x7f, 0x59, 0x70,
-  0x2f, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x6d, 0xf3, 0x9e, 0x95,
-  0x8b, 0x74, 0x6e, 0x70, 0x3e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00,
-  0x1f, 0x04, 0xde, 0x9a, 0x09, 0xff, 0x78, 0x70, 0x1e, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0xd6, 0x02, 0x89, 0x93, 0x8e, 0xb3, 0x8b, 0x70,
-  0x26, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x9e, 0x15, 0x71, 0xd1,
-  0x85, 0xac, 0x8f, 0x70, 0x50, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x2f, 0xf5, 0x97, 0x6d, 0x77, 0x5d, 0xa8, 0x70, 0x2f, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x1a, 0x2b, 0x10, 0x51, 0x24, 0xc5, 0xae, 0x70,
-  0x20, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1a, 0x2b, 0x10, 0x51,
-  0x24, 0xc5, 0xae, 0x70, 0x2a, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x1b, 0xe4, 0x8a, 0xee, 0xe3, 0xdd, 0xca, 0x70, 0x16, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x6d, 0x68, 0xd1, 0x5a, 0xeb, 0x45, 0xd2, 0x70,
-  0x0b, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x93, 0x9c, 0x1a, 0x8c,
-  0x71, 0x23, 0xd8, 0x70, 0x2a, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0xab, 0x7c, 0x8d, 0x58, 0xa4, 0x2d, 0xe0, 0x70, 0x30, 0x00, 0x00, 0x00,
-  0x42, 0x00, 0x00, 0x00, 0x51, 0x71, 0x36, 0xe8, 0x75, 0x03, 0xfb, 0x70,
-  0x50, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xa2, 0x7c, 0x39, 0x17,
-  0x94, 0x24, 0x29, 0x71, 0x29, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0xb4, 0x62, 0xde, 0x59, 0xc0, 0x7e, 0x40, 0x71, 0x4e, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x66, 0x74, 0x7b, 0x51, 0x1e, 0xfb, 0x43, 0x71,
-  0x09, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x20, 0xc5, 0xfb, 0xf4,
-  0x75, 0x1d, 0x44, 0x71, 0x20, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0xf0, 0x30, 0x76, 0x32, 0x4d, 0x6b, 0x92, 0x71, 0x20, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x99, 0x6c, 0x91, 0x92, 0x61, 0xd0, 0x9f, 0x71,
-  0x3a, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x7d, 0x6c, 0xe1, 0xf1,
-  0xca, 0xb9, 0xa1, 0x71, 0x12, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x9e, 0x69, 0x60, 0xd5, 0xc0, 0xeb, 0xab, 0x71, 0x4e, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0xe4, 0x9c, 0x79, 0xf9, 0x29, 0xe4, 0xb6, 0x71,
-  0x45, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x86, 0xda, 0xf3, 0x42,
-  0x18, 0xc5, 0xc4, 0x71, 0x33, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x9d, 0xfa, 0x98, 0x18, 0xf2, 0x64, 0xd9, 0x71, 0x1b, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x80, 0xf8, 0x81, 0x36, 0xf3, 0x68, 0xe8, 0x71,
-  0x0a, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0xde, 0x2b, 0x4d, 0x75,
-  0x5b, 0xa4, 0x04, 0x72, 0x0b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0xde, 0x2b, 0x4d, 0x75, 0x5b, 0xa4, 0x04, 0x72, 0x27, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0xde, 0x2b, 0x4d, 0x75, 0x5b, 0xa4, 0x04, 0x72,
-  0x1f, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xde, 0x2b, 0x4d, 0x75,
-  0x5b, 0xa4, 0x04, 0x72, 0x30, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0xde, 0x2b, 0x4d, 0x75, 0x5b, 0xa4, 0x04, 0x72, 0x0b, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x04, 0x20, 0x8b, 0x7c, 0xb2, 0x3d, 0x4a, 0x72,
-  0x26, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x7f, 0x5a, 0xe7, 0xa2,
-  0x49, 0x46, 0x7f, 0x72, 0x3c, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
-  0x25, 0x25, 0xc5, 0x7b, 0x83, 0x66, 0x9b, 0x72, 0x1e, 0x00, 0x00, 0x00,
-  0x42, 0x00, 0x00, 0x00, 0x6b, 0xdb, 0x22, 0xfb, 0x2b, 0x95, 0xa0, 0x72,
-  0x34, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x66, 0xce, 0xc0, 0xb6,
-  0x1e, 0x21, 0xd1, 0x72, 0x1d, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0xe7, 0x39, 0x41, 0x99, 0x82, 0x57, 0xed, 0x72, 0x30, 0x00, 0x00, 0x00,
-  0x42, 0x00, 0x00, 0x00, 0xe7, 0x39, 0x41, 0x99, 0x82, 0x57, 0xed, 0x72,
-  0x1f, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x8f, 0xf8, 0x15, 0xb6,
-  0xd1, 0x5e, 0x05, 0x73, 0x3a, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0xa7, 0x87, 0xba, 0x03, 0x35, 0x0e, 0x39, 0x73, 0x0b, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x18, 0x31, 0x40, 0xda, 0x95, 0xc1, 0x3d, 0x73,
-  0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x54, 0x0e, 0x34, 0x81,
-  0x79, 0xd4, 0x56, 0x73, 0x45, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0x88, 0xe5, 0xd8, 0x05, 0x70, 0xa9, 0x64, 0x73, 0x3e, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0x59, 0x51, 0xdf, 0x16, 0xc6, 0x1a, 0x78, 0x73,
-  0x27, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0xde, 0x72, 0xd7, 0xcc,
-  0x49, 0x73, 0x97, 0x73, 0x45, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x45, 0x4e, 0x1b, 0x62, 0x9e, 0x85, 0xd2, 0x73, 0x29, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x90, 0xf4, 0x91, 0x85, 0xb1, 0xa3, 0xf4, 0x73,
-  0x1c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x94, 0x84, 0xf9, 0x02,
-  0x4d, 0xcd, 0xf8, 0x73, 0x38, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0x94, 0x84, 0xf9, 0x02, 0x4d, 0xcd, 0xf8, 0x73, 0x33, 0x00, 0x00, 0x00,
-  0x3b, 0x00, 0x00, 0x00, 0xc4, 0x01, 0x7f, 0xfe, 0xe8, 0x17, 0xfe, 0x73,
-  0x3d, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0xf2, 0x0d, 0xfa, 0xf9,
-  0x01, 0x96, 0x11, 0x74, 0x26, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0xf2, 0x0d, 0xfa, 0xf9, 0x01, 0x96, 0x11, 0x74, 0x27, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0xf2, 0x0d, 0xfa, 0xf9, 0x01, 0x96, 0x11, 0x74,
-  0x14, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xf2, 0x0d, 0xfa, 0xf9,
-  0x01, 0x96, 0x11, 0x74, 0x29, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0x1f, 0x6e, 0x5d, 0x84, 0x4d, 0xd6, 0x18, 0x74, 0x21, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0xe2, 0x7c, 0x8d, 0x5b, 0xec, 0x1b, 0x27, 0x74,
-  0x34, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xf3, 0x61, 0x9b, 0x90,
-  0x71, 0x31, 0x69, 0x74, 0x0a, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0xd7, 0x92, 0xd8, 0x90, 0x1a, 0xbf, 0x6a, 0x74, 0x1c, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0xb1, 0xce, 0xcd, 0x1e, 0x08, 0x07, 0x72, 0x74,
-  0x45, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0xe5, 0xdc, 0xcd, 0x89,
-  0x21, 0x84, 0x94, 0x74, 0x30, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0xe5, 0xdc, 0xcd, 0x89, 0x21, 0x84, 0x94, 0x74, 0x3c, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0xe5, 0xdc, 0xcd, 0x89, 0x21, 0x84, 0x94, 0x74,
-  0x33, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0xf0, 0x7a, 0x6a, 0x33,
-  0x00, 0xd4, 0x9a, 0x74, 0x21, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
-  0xf6, 0x7f, 0xcf, 0x37, 0xcd, 0x94, 0xa9, 0x74, 0x1d, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0xf6, 0x7f, 0xcf, 0x37, 0xcd, 0x94, 0xa9, 0x74,
-  0x0a, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xf6, 0x7f, 0xcf, 0x37,
-  0xcd, 0x94, 0xa9, 0x74, 0x27, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0xd8, 0x94, 0xd8, 0xb6, 0xd5, 0x6a, 0xb1, 0x74, 0x4e, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0xb9, 0x81, 0xe7, 0x0f, 0x69, 0x99, 0xb1, 0x74,
-  0x30, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x59, 0x7c, 0x2c, 0x97,
-  0x4a, 0x0b, 0xc7, 0x74, 0x14, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
-  0x59, 0x7c, 0x2c, 0x97, 0x4a, 0x0b, 0xc7, 0x74, 0x20, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x59, 0x7c, 0x2c, 0x97, 0x4a, 0x0b, 0xc7, 0x74,
-  0x1d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x82, 0x95, 0x48, 0xfb,
-  0x2b, 0x25, 0xca, 0x74, 0x2a, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0xa2, 0x2c, 0xae, 0x3e, 0x38, 0xed, 0xcd, 0x74, 0x0b, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x9d, 0xa4, 0x13, 0x1c, 0xc0, 0xc5, 0xfd, 0x74,
-  0x50, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xe2, 0x7e, 0xc6, 0xc5,
-  0xa2, 0x8b, 0x02, 0x75, 0x4f, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
-  0x2d, 0x9d, 0xf1, 0x4e, 0xb3, 0x0e, 0x12, 0x75, 0x21, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x2d, 0x9d, 0xf1, 0x4e, 0xb3, 0x0e, 0x12, 0x75,
-  0x3c, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0xe1, 0x55, 0x9c, 0x63,
-  0x42, 0xe0, 0x4c, 0x75, 0x31, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-  0x19, 0x70, 0x38, 0xe4, 0x12, 0x60, 0x70, 0x75, 0x2b, 0x00, 0x00, 0x00,
-  0x3b, 0x00, 0x00, 0x00, 0xc8, 0x7c, 0x68, 0x2b, 0xf8, 0x91, 0x83, 0x75,
-  0x26, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x26, 0x8d, 0x3d, 0xca,
-  0xec, 0x27, 0x8a, 0x75, 0x3d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-  0x53, 0x31, 0x08, 0x61, 0x60, 0x36, 0x90, 0x75, 0x46, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0xeb, 0x31, 0xba, 0x57, 0xbd, 0x33, 0x9b, 0x75,
-  0x27, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0xaf, 0xe5, 0xf3, 0xe8,
-  0x58, 0x8f, 0xa2, 0x75, 0x12, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0xb7, 0x18, 0x32, 0xe9, 0xc1, 0x59, 0xa4, 0x75, 0x3e, 0x00, 0x00, 0x00,
-  0x3d, 0x00, 0x00, 0x00, 0x46, 0xf8, 0x8e, 0x8e, 0x6c, 0x01, 0xa9, 0x75,
-  0x1d, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x19, 0x46, 0xfe, 0x6b,
-  0x35, 0xb3, 0xab, 0x75, 0x0a, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0xd6, 0x93, 0x65, 0x9f, 0x93, 0xf0, 0xcb, 0x75, 0x44, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x93, 0xc8, 0x39, 0xf7, 0xec, 0xf4, 0xe9, 0x75,
-  0x15, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x8e, 0xc8, 0x18, 0x79,
-  0x1d, 0xe4, 0x14, 0x76, 0x34, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
-  0x26, 0xfb, 0x9d, 0x7f, 0x5f, 0x28, 0x25, 0x76, 0x0a, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0xaa, 0x98, 0x36, 0x71, 0x0a, 0xd8, 0x4c, 0x76,
-  0x17, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x9a, 0x6d, 0x3a, 0x94,
-  0x46, 0xb2, 0x57, 0x76, 0x2a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0xf2, 0x70, 0xc6, 0xd3, 0xfa, 0x82, 0x5a, 0x76, 0x14, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0xf2, 0x70, 0xc6, 0xd3, 0xfa, 0x82, 0x5a, 0x76,
-  0x32, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x75, 0x50, 0x32, 0x25,
-  0x84, 0x61, 0x6c, 0x76, 0x1f, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x75, 0x50, 0x32, 0x25, 0x84, 0x61, 0x6c, 0x76, 0x0c, 0x00, 0x00, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x6b, 0xc4, 0xc7, 0x06, 0xcd, 0x77, 0x96, 0x76,
-  0x0a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x6b, 0xc4, 0xc7, 0x06,
-  0xcd, 0x77, 0x96, 0x76, 0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x6b, 0xc4, 0xc7, 0x06, 0xcd, 0x77, 0x96, 0x76, 0x0b, 0x00, 0x00, 0x00,
-  0x41, 0x00, 0x00, 0x00, 0x60, 0xf0, 0x16, 0x3c, 0x2c, 0xea, 0x9a, 0x76,
-  0x2a, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x73, 0xe4, 0x5e, 0xcd,
-  0x48, 0xf1, 0xac, 0x76, 0x32, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
-  0x68, 0xa4, 0x48, 0x11, 0xf8, 0xb7, 0xb4, 0x76, 0x09, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0x68, 0xa4, 0x48, 0x11, 0xf8, 0xb7, 0xb4, 0x76,
-  0x14, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x56, 0x1e, 0x48, 0xcc,
-  0xad, 0xe5, 0xc3, 0x76, 0x27, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-  0x52, 0x16, 0x90, 0x29, 0x62, 0x28, 0xc8, 0x76, 0x33, 0x00, 0x00, 0x00,
-  0x09, 0x00, 0x00, 0x00, 0x66, 0xfb, 0x99, 0xc5, 0x7a, 0x3f, 0xcc, 0x76,
-  0x28, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x22, 0x59, 0x74, 0x33,
-  0xee, 0x19, 0xe7, 0x76, 0x3a, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0x7b, 0xd4, 0xcf, 0xb1, 0xe9, 0x30, 0xee, 0x76, 0x0b, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x84, 0xd5, 0x55, 0x0d, 0x69, 0xa4, 0xef, 0x76,
-  0x47, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x7b, 0x0e, 0xe5, 0x6e,
-  0xe3, 0xd1, 0x3f, 0x77, 0x3b, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0x7b, 0x0e, 0xe5, 0x6e, 0xe3, 0xd1, 0x3f, 0x77, 0x3c, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0x7b, 0x0e, 0xe5, 0x6e, 0xe3, 0xd1, 0x3f, 0x77,
-  0x3b, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x7b, 0x0e, 0xe5, 0x6e,
-  0xe3, 0xd1, 0x3f, 0x77, 0x3c, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
-  0xbd, 0xa3, 0x7d, 0x46, 0x70, 0x5b, 0x53, 0x77, 0x0a, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x61, 0xcd, 0x6e, 0x05, 0x0a, 0x8a, 0x42, 0x78,
-  0x0a, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x80, 0x16, 0x2f, 0x02,
-  0x08, 0xcb, 0x65, 0x78, 0x3a, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x97, 0xd6, 0x56, 0x53, 0x62, 0x93, 0x6a, 0x78, 0x1b, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x97, 0xd6, 0x56, 0x53, 0x62, 0x93, 0x6a, 0x78,
-  0x13, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x97, 0xd6, 0x56, 0x53,
-  0x62, 0x93, 0x6a, 0x78, 0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x97, 0xd6, 0x56, 0x53, 0x62, 0x93, 0x6a, 0x78, 0x13, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x97, 0xd6, 0x56, 0x53, 0x62, 0x93, 0x6a, 0x78,
-  0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x97, 0xd6, 0x56, 0x53,
-  0x62, 0x93, 0x6a, 0x78, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x97, 0xd6, 0x56, 0x53, 0x62, 0x93, 0x6a, 0x78, 0x12, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x97, 0xd6, 0x56, 0x53, 0x62, 0x93, 0x6a, 0x78,
-  0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x97, 0xd6, 0x56, 0x53,
-  0x62, 0x93, 0x6a, 0x78, 0x13, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x97, 0xd6, 0x56, 0x53, 0x62, 0x93, 0x6a, 0x78, 0x1b, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x97, 0xd6, 0x56, 0x53, 0x62, 0x93, 0x6a, 0x78,
-  0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x97, 0xd6, 0x56, 0x53,
-  0x62, 0x93, 0x6a, 0x78, 0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x97, 0xd6, 0x56, 0x53, 0x62, 0x93, 0x6a, 0x78, 0x03, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x97, 0xd6, 0x56, 0x53, 0x62, 0x93, 0x6a, 0x78,
-  0x13, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x97, 0xd6, 0x56, 0x53,
-  0x62, 0x93, 0x6a, 0x78, 0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x97, 0xd6, 0x56, 0x53, 0x62, 0x93, 0x6a, 0x78, 0x13, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x97, 0xd6, 0x56, 0x53, 0x62, 0x93, 0x6a, 0x78,
-  0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x97, 0xd6, 0x56, 0x53,
-  0x62, 0x93, 0x6a, 0x78, 0x0a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x97, 0xd6, 0x56, 0x53, 0x62, 0x93, 0x6a, 0x78, 0x1b, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x97, 0xd6, 0x56, 0x53, 0x62, 0x93, 0x6a, 0x78,
-  0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x97, 0xd6, 0x56, 0x53,
-  0x62, 0x93, 0x6a, 0x78, 0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x97, 0xd6, 0x56, 0x53, 0x62, 0x93, 0x6a, 0x78, 0x13, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x97, 0xd6, 0x56, 0x53, 0x62, 0x93, 0x6a, 0x78,
-  0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x97, 0xd6, 0x56, 0x53,
-  0x62, 0x93, 0x6a, 0x78, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x97, 0xd6, 0x56, 0x53, 0x62, 0x93, 0x6a, 0x78, 0x1b, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x97, 0xd6, 0x56, 0x53, 0x62, 0x93, 0x6a, 0x78,
-  0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x97, 0xd6, 0x56, 0x53,
-  0x62, 0x93, 0x6a, 0x78, 0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x97, 0xd6, 0x56, 0x53, 0x62, 0x93, 0x6a, 0x78, 0x03, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x97, 0xd6, 0x56, 0x53, 0x62, 0x93, 0x6a, 0x78,
-  0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xde, 0x03, 0xf0, 0x3c,
-  0x0d, 0x99, 0x98, 0x78, 0x4e, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0xec, 0x27, 0x02, 0xa5, 0xce, 0x00, 0xd7, 0x78, 0x3c, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0xec, 0x27, 0x02, 0xa5, 0xce, 0x00, 0xd7, 0x78,
-  0x29, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0xec, 0x27, 0x02, 0xa5,
-  0xce, 0x00, 0xd7, 0x78, 0x1f, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
-  0x5c, 0x91, 0x54, 0x13, 0x18, 0x0c, 0xd7, 0x78, 0x30, 0x00, 0x00, 0x00,
-  0x42, 0x00, 0x00, 0x00, 0xd7, 0x7a, 0x79, 0x0a, 0x29, 0x20, 0xf7, 0x78,
-  0x39, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0xaa, 0x55, 0x4e, 0xbf,
-  0xea, 0x41, 0xfd, 0x78, 0x30, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0xee, 0x98, 0x6c, 0xfb, 0xf5, 0x20, 0x3d, 0x79, 0x14, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0xb1, 0x6b, 0xaa, 0x88, 0x12, 0xce, 0x3e, 0x79,
-  0x4d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x67, 0x99, 0x00, 0xe6,
-  0x4b, 0x25, 0x44, 0x79, 0x35, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
-  0x67, 0x99, 0x00, 0xe6, 0x4b, 0x25, 0x44, 0x79, 0x3a, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x67, 0x99, 0x00, 0xe6, 0x4b, 0x25, 0x44, 0x79,
-  0x35, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0xd9, 0xe7, 0xb2, 0xde,
-  0x59, 0x76, 0x5d, 0x79, 0x20, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x83, 0x2c, 0x34, 0xdc, 0x73, 0xc7, 0x76, 0x79, 0x1f, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0xc7, 0x20, 0xd7, 0xd8, 0x31, 0x0c, 0xa0, 0x79,
-  0x27, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x70, 0x3e, 0x53, 0xd4,
-  0x0b, 0x71, 0xa8, 0x79, 0x0b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
-  0x91, 0x5c, 0x6f, 0xe4, 0x4b, 0x1d, 0xc5, 0x79, 0x0c, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x4a, 0x33, 0xca, 0x91, 0x62, 0xc7, 0xde, 0x79,
-  0x29, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x83, 0xb2, 0x1b, 0xfe,
-  0x29, 0xaa, 0x08, 0x7a, 0x14, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0xb6, 0x71, 0x83, 0x06, 0xf8, 0x85, 0x25, 0x7a, 0x1d, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x6d, 0x48, 0xf9, 0xa4, 0x3e, 0xfe, 0x2b, 0x7a,
-  0x12, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x94, 0x82, 0x5e, 0x7b,
-  0x02, 0xad, 0x32, 0x7a, 0x0b, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0x24, 0xdc, 0xd1, 0x82, 0x2b, 0x8b, 0x37, 0x7a, 0x16, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x55, 0x6d, 0xe1, 0x2c, 0xf2, 0x1c, 0x38, 0x7a,
-  0x20, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x94, 0xb1, 0xec, 0x38,
-  0x70, 0x3e, 0x63, 0x7a, 0x16, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x94, 0xb1, 0xec, 0x38, 0x70, 0x3e, 0x63, 0x7a, 0x16, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x8f, 0x12, 0xec, 0xc2, 0x1a, 0x3e, 0x67, 0x7a,
-  0x30, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xa9, 0x63, 0xc0, 0x50,
-  0xdd, 0x61, 0x81, 0x7a, 0x46, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0xa9, 0x63, 0xc0, 0x50, 0xdd, 0x61, 0x81, 0x7a, 0x46, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0xa9, 0x63, 0xc0, 0x50, 0xdd, 0x61, 0x81, 0x7a,
-  0x46, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x57, 0xb4, 0xc3, 0xe7,
-  0x58, 0x29, 0x90, 0x7a, 0x14, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0xc3, 0x02, 0x4b, 0x40, 0xef, 0xc4, 0xa2, 0x7a, 0x3a, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0x1d, 0x6c, 0xd6, 0xbf, 0xa0, 0x7a, 0xae, 0x7a,
-  0x46, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x92, 0xaa, 0x94, 0xdc,
-  0x5b, 0x22, 0xf0, 0x7a, 0x26, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0x2a, 0x0d, 0x64, 0x54, 0x21, 0x32, 0xf1, 0x7a, 0x0c, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0xe2, 0xe3, 0x55, 0x2f, 0x58, 0x5d, 0x18, 0x7b,
-  0x34, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xc7, 0xc3, 0x3c, 0xd6,
-  0x45, 0x46, 0x28, 0x7b, 0x1c, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0xd5, 0x99, 0x3a, 0x94, 0xf7, 0xbd, 0x2d, 0x7b, 0x09, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0x10, 0x7f, 0xf0, 0xc3, 0xb7, 0xaf, 0x77, 0x7b,
-  0x1f, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x4c, 0xdb, 0x32, 0xc7,
-  0x67, 0x14, 0x7f, 0x7b, 0x3b, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x0d, 0xa0, 0x56, 0x64, 0x1e, 0xfa, 0xdd, 0x7b, 0x50, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x2d, 0xbb, 0xbd, 0x25, 0x41, 0x3c, 0xf3, 0x7b,
-  0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xc5, 0xe2, 0x2d, 0xc8,
-  0x52, 0x0b, 0x0c, 0x7c, 0x13, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0x29, 0x51, 0xff, 0xf5, 0xea, 0x8b, 0x1c, 0x7c, 0x27, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0x8f, 0x95, 0xdb, 0xc2, 0x07, 0x8e, 0x37, 0x7c,
-  0x3d, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0xae, 0x47, 0xbe, 0x71,
-  0x24, 0x48, 0x42, 0x7c, 0x0b, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x59, 0xd8, 0x54, 0x21, 0xac, 0xeb, 0x7d, 0x7c, 0x4f, 0x00, 0x00, 0x00,
-  0x4e, 0x00, 0x00, 0x00, 0x90, 0x11, 0x37, 0x01, 0x33, 0xd6, 0xa6, 0x7c,
-  0x32, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xa7, 0xcd, 0x84, 0xca,
-  0x52, 0xf2, 0xcc, 0x7c, 0x29, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0xa1, 0xc0, 0x52, 0xfe, 0xbe, 0x37, 0x01, 0x7d, 0x15, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0xdb, 0xe7, 0x67, 0xbc, 0xbb, 0x66, 0x0b, 0x7d,
-  0x3c, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x1d, 0x2a, 0x90, 0x00,
-  0xe1, 0xa7, 0x41, 0x7d, 0x3a, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0x1d, 0x2a, 0x90, 0x00, 0xe1, 0xa7, 0x41, 0x7d, 0x33, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x1d, 0x2a, 0x90, 0x00, 0xe1, 0xa7, 0x41, 0x7d,
-  0x3a, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x1d, 0x2a, 0x90, 0x00,
-  0xe1, 0xa7, 0x41, 0x7d, 0x33, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0x26, 0x60, 0x28, 0xbf, 0xf5, 0x2d, 0x8b, 0x7d, 0x45, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x8b, 0x2c, 0x61, 0x9e, 0xaf, 0xda, 0x8d, 0x7d,
-  0x46, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x75, 0x5e, 0xa3, 0x7e,
-  0xac, 0xc7, 0xa3, 0x7d, 0x1c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x54, 0xed, 0x46, 0x57, 0x79, 0x72, 0xbe, 0x7d, 0x31, 0x00, 0x00, 0x00,
-  0x0b, 0x00, 0x00, 0x00, 0x04, 0xb4, 0xe2, 0x26, 0x84, 0x65, 0xbf, 0x7d,
-  0x28, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x2d, 0x26, 0x65, 0x12,
-  0xb7, 0xd2, 0xe0, 0x7d, 0x0b, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
-  0x32, 0x1e, 0xaa, 0x8c, 0xe4, 0x95, 0x83, 0x7e, 0x4f, 0x00, 0x00, 0x00,
-  0x2b, 0x00, 0x00, 0x00, 0x32, 0x1e, 0xaa, 0x8c, 0xe4, 0x95, 0x83, 0x7e,
-  0x29, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x32, 0x1e, 0xaa, 0x8c,
-  0xe4, 0x95, 0x83, 0x7e, 0x4f, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
-  0x08, 0x99, 0xef, 0xa8, 0x92, 0x8e, 0xb9, 0x7e, 0x1e, 0x00, 0x00, 0x00,
-  0x22, 0x00, 0x00, 0x00, 0x91, 0x97, 0x38, 0x3f, 0x3d, 0xe4, 0xd7, 0x7e,
-  0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x26, 0x24, 0x81, 0x6a,
-  0xd8, 0x8f, 0xe4, 0x7e, 0x3b, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x24, 0x6d, 0x89, 0x2c, 0xed, 0x9d, 0xf2, 0x7e, 0x46, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0xed, 0x32, 0x18, 0xdc, 0xe1, 0x84, 0xf4, 0x7e,
-  0x26, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0xc5, 0x66, 0x9f, 0x14,
-  0x14, 0x34, 0x0b, 0x7f, 0x20, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0xad, 0x31, 0x4d, 0xe9, 0xfa, 0x9a, 0x16, 0x7f, 0x3a, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0x48, 0x3e, 0x78, 0xe8, 0xd9, 0xbb, 0x2f, 0x7f,
-  0x3a, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x89, 0xac, 0x61, 0xcc,
-  0xb2, 0x53, 0x3f, 0x7f, 0x0a, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x3b, 0x45, 0x26, 0x0d, 0xc9, 0x6e, 0x9d, 0x7f, 0x1d, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x3b, 0x45, 0x26, 0x0d, 0xc9, 0x6e, 0x9d, 0x7f,
-  0x28, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x3b, 0x45, 0x26, 0x0d,
-  0xc9, 0x6e, 0x9d, 0x7f, 0x1d, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0xf7, 0xec, 0x65, 0x30, 0xd7, 0x97, 0xb0, 0x7f, 0x1f, 0x00, 0x00, 0x00,
-  0x43, 0x00, 0x00, 0x00, 0x3e, 0x7e, 0x77, 0xcb, 0xd7, 0xff, 0xb1, 0x7f,
-  0x30, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x8b, 0x8e, 0x47, 0x5b,
-  0x85, 0x5b, 0xbd, 0x7f, 0x14, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0x8b, 0x8e, 0x47, 0x5b, 0x85, 0x5b, 0xbd, 0x7f, 0x1c, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x8b, 0x8e, 0x47, 0x5b, 0x85, 0x5b, 0xbd, 0x7f,
-  0x14, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xb1, 0xcc, 0x4f, 0x56,
-  0x7f, 0xf0, 0xfc, 0x7f, 0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x1d, 0x18, 0x71, 0xb9, 0x57, 0xaf, 0x22, 0x80, 0x15, 0x00, 0x00, 0x00,
-  0x3d, 0x00, 0x00, 0x00, 0x09, 0x91, 0x54, 0x7f, 0xbd, 0x31, 0x3e, 0x80,
-  0x09, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x01, 0x32, 0x9a, 0x0c,
-  0xb4, 0xa2, 0x40, 0x80, 0x50, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-  0x5d, 0xda, 0x78, 0xd6, 0x31, 0xb5, 0x57, 0x80, 0x1d, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x3b, 0xed, 0x5f, 0xa3, 0xa7, 0xd0, 0x61, 0x80,
-  0x37, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x9c, 0xf3, 0xad, 0x34,
-  0x3d, 0x73, 0x7c, 0x80, 0x26, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x86, 0x84, 0x31, 0x20, 0x37, 0x87, 0xa4, 0x80, 0x50, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x5e, 0xea, 0x4a, 0x5c, 0x80, 0xb8, 0xcb, 0x80,
-  0x33, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x66, 0x80, 0x36, 0x60,
-  0xbf, 0x5f, 0xd0, 0x80, 0x33, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0x5d, 0xb4, 0x7f, 0x19, 0x27, 0x4a, 0xdb, 0x80, 0x44, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x9b, 0xef, 0x34, 0x67, 0x89, 0x43, 0x35, 0x81,
-  0x26, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x8b, 0x70, 0xb5, 0x9a,
-  0x5d, 0xeb, 0x3d, 0x81, 0x14, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0x6f, 0x17, 0x0b, 0xdc, 0x62, 0x5e, 0x4a, 0x81, 0x2f, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0xa7, 0x42, 0xfe, 0x6f, 0x59, 0x0c, 0x6b, 0x81,
-  0x14, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xc8, 0x6d, 0x33, 0xc6,
-  0xcb, 0xb9, 0x9b, 0x81, 0x27, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x37, 0xe7, 0xee, 0x28, 0xf0, 0x5f, 0xa0, 0x81, 0x02, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x43, 0x89, 0x6f, 0x82, 0x16, 0xf4, 0xa7, 0x81,
-  0x2f, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x2a, 0x57, 0x3b, 0xe6,
-  0x34, 0x94, 0xb0, 0x81, 0x16, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0xa0, 0x80, 0xa6, 0xdb, 0x48, 0xa7, 0xb0, 0x81, 0x21, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0xad, 0x95, 0x44, 0x96, 0x7d, 0x13, 0xc1, 0x81,
-  0x34, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x4e, 0xd1, 0x3c, 0xed,
-  0xb0, 0x4f, 0xc3, 0x81, 0x47, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
-  0x69, 0x08, 0x7f, 0xcb, 0x78, 0x5d, 0xc8, 0x81, 0x29, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x21, 0xdc, 0x77, 0x27, 0xb7, 0x28, 0xd6, 0x81,
-  0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xc9, 0xd8, 0x27, 0x5d,
-  0xa0, 0xe0, 0x02, 0x82, 0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0xce, 0xef, 0x5b, 0x76, 0x30, 0x4c, 0x21, 0x82, 0x50, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0x4e, 0x70, 0xca, 0x58, 0xac, 0x18, 0x40, 0x82,
-  0x3b, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xca, 0x76, 0x03, 0x1c,
-  0x06, 0x2e, 0x77, 0x82, 0x31, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x8d, 0x9f, 0xad, 0xa8, 0xf0, 0xd2, 0x87, 0x82, 0x3e, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x8d, 0x9f, 0xad, 0xa8, 0xf0, 0xd2, 0x87, 0x82,
-  0x4e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x8d, 0x9f, 0xad, 0xa8,
-  0xf0, 0xd2, 0x87, 0x82, 0x3e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0x8d, 0x9f, 0xad, 0xa8, 0xf0, 0xd2, 0x87, 0x82, 0x4e, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x8d, 0x9f, 0xad, 0xa8, 0xf0, 0xd2, 0x87, 0x82,
-  0x3e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x8d, 0x9f, 0xad, 0xa8,
-  0xf0, 0xd2, 0x87, 0x82, 0x4e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0x8d, 0x9f, 0xad, 0xa8, 0xf0, 0xd2, 0x87, 0x82, 0x3e, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x8d, 0x9f, 0xad, 0xa8, 0xf0, 0xd2, 0x87, 0x82,
-  0x4e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x8d, 0x9f, 0xad, 0xa8,
-  0xf0, 0xd2, 0x87, 0x82, 0x3e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0x8d, 0x9f, 0xad, 0xa8, 0xf0, 0xd2, 0x87, 0x82, 0x4e, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x8d, 0x9f, 0xad, 0xa8, 0xf0, 0xd2, 0x87, 0x82,
-  0x3e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x8d, 0x9f, 0xad, 0xa8,
-  0xf0, 0xd2, 0x87, 0x82, 0x4e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0x8d, 0x9f, 0xad, 0xa8, 0xf0, 0xd2, 0x87, 0x82, 0x3e, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x8d, 0x9f, 0xad, 0xa8, 0xf0, 0xd2, 0x87, 0x82,
-  0x4e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x8d, 0x9f, 0xad, 0xa8,
-  0xf0, 0xd2, 0x87, 0x82, 0x3e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0x8d, 0x9f, 0xad, 0xa8, 0xf0, 0xd2, 0x87, 0x82, 0x4e, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x8d, 0x9f, 0xad, 0xa8, 0xf0, 0xd2, 0x87, 0x82,
-  0x3e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x8d, 0x9f, 0xad, 0xa8,
-  0xf0, 0xd2, 0x87, 0x82, 0x4e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0x03, 0x87, 0xd4, 0x95, 0x40, 0xaa, 0x8c, 0x82, 0x14, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0xf3, 0x5a, 0x07, 0x72, 0x4c, 0x7f, 0xa6, 0x82,
-  0x27, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0xf3, 0x5a, 0x07, 0x72,
-  0x4c, 0x7f, 0xa6, 0x82, 0x2b, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0xf3, 0x5a, 0x07, 0x72, 0x4c, 0x7f, 0xa6, 0x82, 0x2b, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0xcc, 0xf4, 0x76, 0xe1, 0xb0, 0x4d, 0xa7, 0x82,
-  0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x20, 0xc7, 0xbc, 0xa7,
-  0x5a, 0x15, 0xa9, 0x82, 0x30, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x31, 0x58, 0xfb, 0x45, 0x42, 0x44, 0xa9, 0x82, 0x26, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0x11, 0xff, 0xc6, 0xb5, 0x0f, 0xa4, 0xd5, 0x82,
-  0x3c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xd1, 0x67, 0xa2, 0xa9,
-  0x6c, 0xd1, 0xdc, 0x82, 0x3b, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x2d, 0x6a, 0x06, 0x4d, 0x3c, 0xba, 0xe4, 0x82, 0x3d, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0x7c, 0xca, 0x82, 0xb0, 0x78, 0x28, 0xf8, 0x82,
-  0x13, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x48, 0xdf, 0xea, 0x11,
-  0x55, 0x7a, 0x28, 0x83, 0x29, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x02, 0xbb, 0xed, 0x92, 0xc1, 0x96, 0x2a, 0x83, 0x27, 0x00, 0x00, 0x00,
-  0x3d, 0x00, 0x00, 0x00, 0x6b, 0x17, 0x5e, 0x69, 0x07, 0xc1, 0x66, 0x83,
-  0x4e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x0d, 0x10, 0xf5, 0xcf,
-  0x08, 0x77, 0x69, 0x83, 0x4e, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x73, 0x9e, 0x1f, 0x7d, 0x97, 0x9c, 0x69, 0x83, 0x4f, 0x00, 0x00, 0x00,
-  0x3d, 0x00, 0x00, 0x00, 0x10, 0x12, 0x0d, 0xc0, 0x5e, 0xae, 0x78, 0x83,
-  0x16, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xed, 0xf9, 0x6a, 0xad,
-  0x78, 0x08, 0x97, 0x83, 0x1b, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0xe5, 0xf3, 0x53, 0xdc, 0x7b, 0x3d, 0xb5, 0x83, 0x2a, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0x9e, 0xef, 0xc9, 0x04, 0x5c, 0x16, 0xdc, 0x83,
-  0x46, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0xf2, 0x6b, 0xf1, 0xf3,
-  0xf6, 0x17, 0x12, 0x84, 0x21, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0xc6, 0xfb, 0xe0, 0x67, 0x14, 0x1b, 0x1b, 0x84, 0x14, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0xef, 0xac, 0xac, 0xc6, 0x6f, 0x23, 0x21, 0x84,
-  0x3c, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x19, 0x03, 0x10, 0x41,
-  0xaa, 0x84, 0x29, 0x84, 0x34, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0xe6, 0x7c, 0x67, 0x84, 0xba, 0x70, 0x2c, 0x84, 0x34, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x76, 0x49, 0x75, 0x0c, 0xf8, 0x3a, 0x31, 0x84,
-  0x1d, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x27, 0x8d, 0x07, 0x3b,
-  0x57, 0x99, 0x5e, 0x84, 0x21, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
-  0x27, 0x8d, 0x07, 0x3b, 0x57, 0x99, 0x5e, 0x84, 0x1d, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x5d, 0xfb, 0xaa, 0x86, 0xeb, 0xd0, 0x60, 0x84,
-  0x33, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xef, 0x9c, 0x90, 0x1c,
-  0xe3, 0x96, 0x86, 0x84, 0x2a, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0xcd, 0x9f, 0xfd, 0x3c, 0xac, 0x3c, 0xc5, 0x84, 0x0c, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x53, 0x28, 0x91, 0xeb, 0xff, 0x39, 0xd2, 0x84,
-  0x27, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xf5, 0x50, 0xd8, 0x6c,
-  0x7f, 0x5c, 0xe7, 0x84, 0x0a, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0xa5, 0xa6, 0x0d, 0x53, 0x7f, 0x43, 0xfe, 0x84, 0x38, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0x6f, 0xe6, 0x85, 0x5e, 0xc8, 0x84, 0x1e, 0x85,
-  0x26, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x53, 0x9c, 0xf2, 0x47,
-  0x03, 0x4f, 0x22, 0x85, 0x33, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0xef, 0x13, 0xe5, 0xa1, 0xe8, 0xea, 0x37, 0x85, 0x1c, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0x4f, 0x6b, 0xde, 0x2a, 0x8d, 0x5c, 0x39, 0x85,
-  0x02, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x4f, 0x6b, 0xde, 0x2a,
-  0x8d, 0x5c, 0x39, 0x85, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
-  0x61, 0xb0, 0x53, 0x89, 0xbe, 0xbb, 0x41, 0x85, 0x30, 0x00, 0x00, 0x00,
-  0x42, 0x00, 0x00, 0x00, 0xca, 0xaf, 0xb7, 0x44, 0x9a, 0x7d, 0x45, 0x85,
-  0x0e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x96, 0x72, 0xfe, 0x33,
-  0x42, 0x0d, 0x85, 0x85, 0x3c, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
-  0xa8, 0xb6, 0x5a, 0x77, 0x15, 0x62, 0xa3, 0x85, 0x3c, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x48, 0xa9, 0x3b, 0xb5, 0xb2, 0x38, 0xbd, 0x85,
-  0x50, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xd7, 0xd2, 0x74, 0x7a,
-  0x53, 0x72, 0xdd, 0x85, 0x4f, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
-  0x89, 0x9e, 0xe1, 0xd1, 0xbe, 0x07, 0xed, 0x85, 0x0a, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x3c, 0x27, 0x4b, 0x3b, 0x1d, 0x25, 0x01, 0x86,
-  0x26, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1b, 0x5f, 0x23, 0x17,
-  0x9f, 0xda, 0x24, 0x86, 0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x18, 0x4f, 0x37, 0x54, 0x0a, 0xf7, 0x87, 0x86, 0x3c, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0x01, 0x90, 0xda, 0xcc, 0xf4, 0x31, 0x9c, 0x86,
-  0x3c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x3f, 0x4d, 0x19, 0xef,
-  0xec, 0xa2, 0xca, 0x86, 0x0b, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
-  0x37, 0xd7, 0x11, 0xfd, 0xaa, 0xb4, 0x08, 0x87, 0x45, 0x00, 0x00, 0x00,
-  0x43, 0x00, 0x00, 0x00, 0x77, 0x4e, 0xee, 0x7f, 0x48, 0xcd, 0x0f, 0x87,
-  0x44, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x77, 0x4e, 0xee, 0x7f,
-  0x48, 0xcd, 0x0f, 0x87, 0x31, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0x38, 0x63, 0xfc, 0x3a, 0x9b, 0x64, 0x12, 0x87, 0x1d, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0xef, 0x10, 0x55, 0x02, 0xa9, 0x00, 0x61, 0x87,
-  0x17, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0xef, 0x10, 0x55, 0x02,
-  0xa9, 0x00, 0x61, 0x87, 0x17, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0x32, 0xc1, 0x49, 0xb3, 0xa9, 0xf7, 0x6a, 0x87, 0x0b, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0x32, 0xc1, 0x49, 0xb3, 0xa9, 0xf7, 0x6a, 0x87,
-  0x15, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xc6, 0xb5, 0x06, 0x18,
-  0xe2, 0x7f, 0x8a, 0x87, 0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0xc6, 0xb5, 0x06, 0x18, 0xe2, 0x7f, 0x8a, 0x87, 0x26, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x93, 0x38, 0x12, 0xf4, 0xda, 0x57, 0xa7, 0x87,
-  0x16, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x12, 0x02, 0x91, 0xc0,
-  0xdc, 0x69, 0xb9, 0x87, 0x09, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x6f, 0xa4, 0x4f, 0x68, 0xe8, 0x96, 0xc7, 0x87, 0x26, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x6f, 0xa4, 0x4f, 0x68, 0xe8, 0x96, 0xc7, 0x87,
-  0x14, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x42, 0x20, 0x7c, 0x7b,
-  0x01, 0x85, 0xcd, 0x87, 0x46, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0xbe, 0xbb, 0xf3, 0x4e, 0x3f, 0xc5, 0xe4, 0x87, 0x02, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0xa3, 0xe9, 0xc7, 0x42, 0xfc, 0x77, 0xf7, 0x87,
-  0x13, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0xa3, 0xe9, 0xc7, 0x42,
-  0xfc, 0x77, 0xf7, 0x87, 0x0a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0xa3, 0xe9, 0xc7, 0x42, 0xfc, 0x77, 0xf7, 0x87, 0x13, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0xad, 0x59, 0xad, 0x49, 0x35, 0xd0, 0x05, 0x88,
-  0x14, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xf3, 0x14, 0xea, 0x71,
-  0x6c, 0xf8, 0x2b, 0x88, 0x31, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x98, 0xa7, 0x47, 0x6b, 0x0a, 0x14, 0x4b, 0x88, 0x15, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0xcf, 0x69, 0x72, 0x9a, 0xe7, 0x92, 0x97, 0x88,
-  0x43, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x05, 0xcf, 0xaf, 0xa2,
-  0xa3, 0x05, 0xa0, 0x88, 0x33, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0x63, 0xcd, 0x26, 0xb3, 0xcf, 0x83, 0xe1, 0x88, 0x33, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x7c, 0xb4, 0x78, 0xc7, 0xd0, 0x14, 0x0b, 0x89,
-  0x46, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0xdf, 0x3c, 0xd9, 0xe6,
-  0x47, 0x0c, 0x1b, 0x89, 0x25, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0xf7, 0x3b, 0xce, 0xc9, 0x5a, 0x14, 0x79, 0x89, 0x31, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x75, 0x43, 0x89, 0x8b, 0x93, 0x55, 0x81, 0x89,
-  0x4f, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x6f, 0x97, 0x7e, 0xa2,
-  0x3c, 0x78, 0x87, 0x89, 0x33, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x3a, 0xe2, 0xda, 0xcd, 0xc1, 0x51, 0x8b, 0x89, 0x1d, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x3a, 0xe2, 0xda, 0xcd, 0xc1, 0x51, 0x8b, 0x89,
-  0x20, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xfc, 0x94, 0xb8, 0xcc,
-  0xbf, 0x26, 0x8c, 0x89, 0x27, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0x3d, 0xe5, 0x48, 0x52, 0xa3, 0x0a, 0x9e, 0x89, 0x0a, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0xda, 0x0a, 0x59, 0xb9, 0x9f, 0xe0, 0xb8, 0x89,
-  0x30, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0xda, 0x0a, 0x59, 0xb9,
-  0x9f, 0xe0, 0xb8, 0x89, 0x30, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0xda, 0x0a, 0x59, 0xb9, 0x9f, 0xe0, 0xb8, 0x89, 0x30, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0xc4, 0x14, 0xbf, 0xe9, 0x66, 0x42, 0xd2, 0x89,
-  0x0a, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xdb, 0xc5, 0x95, 0x27,
-  0xd5, 0x34, 0xd4, 0x89, 0x30, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x33, 0xfc, 0xe8, 0x72, 0xf4, 0xef, 0xe9, 0x89, 0x4f, 0x00, 0x00, 0x00,
-  0x46, 0x00, 0x00, 0x00, 0x7a, 0x4d, 0x85, 0x9b, 0x75, 0x46, 0xfe, 0x89,
-  0x4f, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0xd1, 0x21, 0x11, 0xda,
-  0xcf, 0x20, 0x03, 0x8a, 0x29, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0xa4, 0x17, 0x1d, 0x20, 0xe5, 0x18, 0x1e, 0x8a, 0x3b, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x42, 0xa0, 0x89, 0x48, 0x7d, 0x75, 0x1e, 0x8a,
-  0x3e, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xf7, 0x9b, 0x55, 0xbb,
-  0x0c, 0x53, 0x51, 0x8a, 0x1d, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0x91, 0x30, 0x5c, 0x0e, 0xf1, 0xc0, 0x80, 0x8a, 0x0c, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x91, 0x30, 0x5c, 0x0e, 0xf1, 0xc0, 0x80, 0x8a,
-  0x17, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x7f, 0xa7, 0x32, 0x2d,
-  0x3c, 0xb5, 0x8f, 0x8a, 0x17, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x5d, 0x8c, 0x77, 0xf2, 0xbd, 0xef, 0x9c, 0x8a, 0x3c, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0xe4, 0x8c, 0x01, 0x58, 0x36, 0x41, 0xa1, 0x8a,
-  0x3d, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0xed, 0x52, 0x76, 0xba,
-  0x80, 0x96, 0xaa, 0x8a, 0x47, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0xed, 0x52, 0x76, 0xba, 0x80, 0x96, 0xaa, 0x8a, 0x4e, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0xed, 0x52, 0x76, 0xba, 0x80, 0x96, 0xaa, 0x8a,
-  0x47, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0xd3, 0x5d, 0xad, 0xce,
-  0x3a, 0xd7, 0xbf, 0x8a, 0x35, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x65, 0x53, 0x4b, 0xec, 0x10, 0xbb, 0xe1, 0x8a, 0x50, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0x9c, 0x25, 0xbe, 0x43, 0xc4, 0x74, 0xf1, 0x8a,
-  0x34, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x09, 0xef, 0xd8, 0x79,
-  0xd7, 0x52, 0xfe, 0x8a, 0x12, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x1f, 0x93, 0x38, 0x45, 0x9e, 0x22, 0x01, 0x8b, 0x32, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x10, 0xd5, 0xd6, 0x67, 0xe5, 0x38, 0x15, 0x8b,
-  0x30, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0xc9, 0x95, 0xae, 0x2f,
-  0x09, 0xf9, 0x65, 0x8b, 0x0b, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0xc9, 0x95, 0xae, 0x2f, 0x09, 0xf9, 0x65, 0x8b, 0x0b, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0xc9, 0x95, 0xae, 0x2f, 0x09, 0xf9, 0x65, 0x8b,
-  0x0b, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xc9, 0x95, 0xae, 0x2f,
-  0x09, 0xf9, 0x65, 0x8b, 0x0b, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0xc9, 0x95, 0xae, 0x2f, 0x09, 0xf9, 0x65, 0x8b, 0x0b, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0xc9, 0x95, 0xae, 0x2f, 0x09, 0xf9, 0x65, 0x8b,
-  0x0b, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xc9, 0x95, 0xae, 0x2f,
-  0x09, 0xf9, 0x65, 0x8b, 0x0b, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0xbe, 0xa6, 0xa0, 0x11, 0x3e, 0xd2, 0x70, 0x8b, 0x20, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0xfd, 0x02, 0x9d, 0xdc, 0x92, 0x54, 0x7d, 0x8b,
-  0x0c, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xf1, 0x0f, 0x23, 0xdd,
-  0xce, 0x9c, 0x9a, 0x8b, 0x17, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x7d, 0xa1, 0x78, 0x60, 0x36, 0x35, 0xc2, 0x8b, 0x09, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x7d, 0xa1, 0x78, 0x60, 0x36, 0x35, 0xc2, 0x8b,
-  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x94, 0x86, 0x50, 0x1d,
-  0x21, 0xb2, 0xe0, 0x8b, 0x2a, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0xae, 0xc2, 0x04, 0x58, 0xb5, 0x87, 0x46, 0x8c, 0x27, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0xae, 0xc2, 0x04, 0x58, 0xb5, 0x87, 0x46, 0x8c,
-  0x26, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0xae, 0xc2, 0x04, 0x58,
-  0xb5, 0x87, 0x46, 0x8c, 0x21, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0xae, 0xc2, 0x04, 0x58, 0xb5, 0x87, 0x46, 0x8c, 0x1d, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0xae, 0xc2, 0x04, 0x58, 0xb5, 0x87, 0x46, 0x8c,
-  0x13, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x6a, 0x39, 0xda, 0x4f,
-  0xbb, 0x1f, 0x65, 0x8c, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x44, 0x6d, 0xbf, 0xed, 0x5f, 0xf9, 0x70, 0x8c, 0x20, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0x78, 0x1e, 0x0d, 0x72, 0x7f, 0x83, 0x73, 0x8c,
-  0x14, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xf4, 0xa8, 0xf2, 0xe3,
-  0x17, 0x8f, 0x73, 0x8c, 0x15, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0xf4, 0xa8, 0xf2, 0xe3, 0x17, 0x8f, 0x73, 0x8c, 0x12, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0xde, 0x12, 0xf2, 0x9e, 0xfd, 0x3d, 0xa2, 0x8c,
-  0x2f, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x27, 0x75, 0x05, 0xda,
-  0x67, 0xd1, 0xab, 0x8c, 0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x59, 0x09, 0x3d, 0xff, 0x71, 0x58, 0xef, 0x8c, 0x16, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0xbd, 0x93, 0x5e, 0xea, 0x01, 0xe3, 0x10, 0x8d,
-  0x01, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x77, 0xb7, 0x7e, 0x0d,
-  0x87, 0x26, 0x16, 0x8d, 0x1e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0xd8, 0x8f, 0x17, 0xae, 0xb2, 0x4a, 0x4a, 0x8d, 0x1e, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0xbe, 0x4b, 0xde, 0x86, 0xa2, 0x0f, 0x52, 0x8d,
-  0x1d, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x9a, 0xd4, 0x34, 0x88,
-  0x10, 0x27, 0x52, 0x8d, 0x3b, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0x8e, 0x2f, 0x39, 0x5a, 0x8f, 0x95, 0x7c, 0x8d, 0x46, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x8e, 0x2f, 0x39, 0x5a, 0x8f, 0x95, 0x7c, 0x8d,
-  0x4f, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x8e, 0x2f, 0x39, 0x5a,
-  0x8f, 0x95, 0x7c, 0x8d, 0x46, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
-  0x8e, 0x2f, 0x39, 0x5a, 0x8f, 0x95, 0x7c, 0x8d, 0x46, 0x00, 0x00, 0x00,
-  0x42, 0x00, 0x00, 0x00, 0x8e, 0x2f, 0x39, 0x5a, 0x8f, 0x95, 0x7c, 0x8d,
-  0x33, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x8e, 0x2f, 0x39, 0x5a,
-  0x8f, 0x95, 0x7c, 0x8d, 0x46, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x8e, 0x2f, 0x39, 0x5a, 0x8f, 0x95, 0x7c, 0x8d, 0x3a, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x8e, 0x2f, 0x39, 0x5a, 0x8f, 0x95, 0x7c, 0x8d,
-  0x4f, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x8e, 0x2f, 0x39, 0x5a,
-  0x8f, 0x95, 0x7c, 0x8d, 0x46, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0x46, 0x0c, 0xae, 0x0f, 0x4e, 0xee, 0x80, 0x8d, 0x27, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0x46, 0x0c, 0xae, 0x0f, 0x4e, 0xee, 0x80, 0x8d,
-  0x3a, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x46, 0x0c, 0xae, 0x0f,
-  0x4e, 0xee, 0x80, 0x8d, 0x2f, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0xfd, 0x34, 0xb5, 0x9f, 0x7c, 0x84, 0x82, 0x8d, 0x09, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x9f, 0xd4, 0xa0, 0x86, 0x3a, 0x6d, 0x97, 0x8d,
-  0x1e, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x9f, 0xd4, 0xa0, 0x86,
-  0x3a, 0x6d, 0x97, 0x8d, 0x44, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00,
-  0x48, 0x7a, 0x03, 0x44, 0xac, 0x50, 0xac, 0x8d, 0x0a, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xff, 0x91, 0x40, 0x7a, 0xc1, 0x8d,
-  0x32, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0xd8, 0xdf, 0xd2, 0xdb,
-  0x77, 0xab, 0xe0, 0x8d, 0x16, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0xcf, 0xaf, 0x0b, 0x1b, 0xf0, 0x60, 0xea, 0x8d, 0x14, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0x91, 0x39, 0x3e, 0x66, 0xa0, 0x6e, 0xfe, 0x8d,
-  0x3d, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xd8, 0xb1, 0x8e, 0x42,
-  0x22, 0x45, 0x02, 0x8e, 0x26, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0xb3, 0x83, 0x3f, 0x5c, 0xf7, 0x11, 0x1b, 0x8e, 0x33, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x11, 0x18, 0xd0, 0x2d, 0x59, 0x6b, 0x21, 0x8e,
-  0x47, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x10, 0x3b, 0x95, 0x9f,
-  0xd7, 0xfe, 0x22, 0x8e, 0x25, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0xb5, 0xc7, 0x15, 0x76, 0xdf, 0xcd, 0x56, 0x8e, 0x44, 0x00, 0x00, 0x00,
-  0x46, 0x00, 0x00, 0x00, 0x94, 0xc1, 0xee, 0xc3, 0xbe, 0x63, 0x67, 0x8e,
-  0x44, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0xfd, 0x64, 0x8f, 0x6c,
-  0x33, 0x1d, 0x71, 0x8e, 0x46, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0xfd, 0x64, 0x8f, 0x6c, 0x33, 0x1d, 0x71, 0x8e, 0x45, 0x00, 0x00, 0x00,
-  0x0f, 0x00, 0x00, 0x00, 0xfd, 0x64, 0x8f, 0x6c, 0x33, 0x1d, 0x71, 0x8e,
-  0x46, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xa5, 0x95, 0xf3, 0x10,
-  0x7d, 0x59, 0x99, 0x8e, 0x1d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0xeb, 0x41, 0x3d, 0x71, 0x5a, 0x9b, 0x9e, 0x8e, 0x3a, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0xd2, 0x86, 0xe6, 0x8e, 0x0e, 0x6a, 0xc5, 0x8e,
-  0x26, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x13, 0x0a, 0xd8, 0x82,
-  0x43, 0xe3, 0xf3, 0x8e, 0x14, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0x13, 0x0a, 0xd8, 0x82, 0x43, 0xe3, 0xf3, 0x8e, 0x1f, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0xbf, 0xd3, 0x7b, 0x77, 0xdf, 0xd5, 0xf7, 0x8e,
-  0x26, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x30, 0xa2, 0xdf, 0x2d,
-  0xff, 0xd8, 0x1e, 0x8f, 0x2a, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x58, 0xfb, 0x5a, 0x0b, 0x02, 0x48, 0x30, 0x8f, 0x34, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0xd1, 0x48, 0xce, 0x05, 0xaf, 0x8f, 0x3d, 0x8f,
-  0x44, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xad, 0x8d, 0xaa, 0x0d,
-  0x44, 0x3b, 0x52, 0x8f, 0x1f, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0xe7, 0x10, 0x28, 0xba, 0x45, 0x83, 0x6b, 0x8f, 0x1d, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x1a, 0x0a, 0x47, 0xe9, 0x9f, 0x3e, 0x82, 0x8f,
-  0x41, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x9b, 0x67, 0x79, 0x88,
-  0x64, 0xd0, 0x87, 0x8f, 0x32, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
-  0x9b, 0x67, 0x79, 0x88, 0x64, 0xd0, 0x87, 0x8f, 0x3b, 0x00, 0x00, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0x26, 0xe9, 0xd8, 0xf2, 0x72, 0xcd, 0x93, 0x8f,
-  0x46, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x5f, 0xe9, 0x79, 0x0f,
-  0xa9, 0x89, 0xdb, 0x8f, 0x50, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-  0x23, 0x03, 0x0b, 0xd0, 0x69, 0xfc, 0xe1, 0x8f, 0x29, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0x23, 0x03, 0x0b, 0xd0, 0x69, 0xfc, 0xe1, 0x8f,
-  0x33, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xf6, 0xd4, 0x69, 0x49,
-  0xb4, 0x9e, 0x1c, 0x90, 0x2f, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0xe0, 0x16, 0xf0, 0x6b, 0x20, 0x8b, 0x39, 0x90, 0x41, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0xa3, 0x13, 0x17, 0x39, 0x19, 0x2b, 0x40, 0x90,
-  0x2f, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xb9, 0xd7, 0xbe, 0xf8,
-  0x6b, 0x52, 0x41, 0x90, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0xb9, 0xd7, 0xbe, 0xf8, 0x6b, 0x52, 0x41, 0x90, 0x03, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0x07, 0x9b, 0x68, 0xab, 0x0e, 0xf6, 0x5a, 0x90,
-  0x4d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x8c, 0xce, 0xff, 0xbc,
-  0x25, 0x74, 0x5b, 0x90, 0x3c, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0x02, 0xb5, 0x9e, 0x91, 0x61, 0xf8, 0x9c, 0x90, 0x16, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0xf5, 0xb1, 0x81, 0xb0, 0xb6, 0x25, 0xad, 0x90,
-  0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x5e, 0x3f, 0xd3, 0xa4,
-  0xd0, 0xe9, 0xb3, 0x90, 0x1e, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0xac, 0x09, 0x69, 0xea, 0xc8, 0x84, 0xee, 0x90, 0x16, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0xac, 0x09, 0x69, 0xea, 0xc8, 0x84, 0xee, 0x90,
-  0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xac, 0x09, 0x69, 0xea,
-  0xc8, 0x84, 0xee, 0x90, 0x16, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x12, 0xde, 0x5d, 0x29, 0x5f, 0x26, 0x36, 0x91, 0x14, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0xda, 0x75, 0xb4, 0x36, 0x4f, 0xcc, 0x5c, 0x91,
-  0x03, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0xda, 0x75, 0xb4, 0x36,
-  0x4f, 0xcc, 0x5c, 0x91, 0x1b, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0xda, 0x75, 0xb4, 0x36, 0x4f, 0xcc, 0x5c, 0x91, 0x02, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0xda, 0x75, 0xb4, 0x36, 0x4f, 0xcc, 0x5c, 0x91,
-  0x1b, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x66, 0x3e, 0x2f, 0x4c,
-  0x00, 0x05, 0x66, 0x91, 0x1e, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0x11, 0x76, 0x85, 0xa2, 0x07, 0x50, 0x72, 0x91, 0x21, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x8f, 0xdd, 0x28, 0x3b, 0x0d, 0x61, 0x78, 0x91,
-  0x14, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xb5, 0x3a, 0x38, 0x57,
-  0x7b, 0xac, 0x86, 0x91, 0x3c, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
-  0x12, 0xcb, 0xf5, 0x94, 0x7e, 0xc6, 0x89, 0x91, 0x32, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x0d, 0xc3, 0x4d, 0x24, 0x2f, 0x19, 0x8a, 0x91,
-  0x3b, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x12, 0xf4, 0x08, 0x29,
-  0x21, 0x90, 0xea, 0x91, 0x16, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x3b, 0xee, 0x50, 0x5d, 0xf4, 0x24, 0x11, 0x92, 0x4e, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x20, 0x09, 0xa3, 0x6c, 0x71, 0x2c, 0x36, 0x92,
-  0x33, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x87, 0x1c, 0x2f, 0x01,
-  0x76, 0x09, 0x37, 0x92, 0x22, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0xf4, 0xb3, 0xd4, 0x07, 0xd9, 0x99, 0x86, 0x92, 0x50, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0xed, 0x18, 0x01, 0x91, 0x65, 0x45, 0x9e, 0x92,
-  0x14, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x1c, 0xc1, 0x32, 0x52,
-  0x1b, 0x3c, 0xab, 0x92, 0x21, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0xb6, 0x0c, 0xd2, 0x70, 0x8b, 0x54, 0xb1, 0x92, 0x16, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0xee, 0x19, 0xd5, 0xea, 0xd9, 0x73, 0xcf, 0x92,
-  0x45, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x6d, 0x7d, 0xcc, 0xb9,
-  0x84, 0x3f, 0xe3, 0x92, 0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x87, 0x38, 0x94, 0x1f, 0x69, 0x47, 0x08, 0x93, 0x20, 0x00, 0x00, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x23, 0x3a, 0x08, 0x6c, 0x0e, 0xd5, 0x13, 0x93,
-  0x3d, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xcf, 0x91, 0x56, 0xeb,
-  0x38, 0x49, 0x1f, 0x93, 0x21, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
-  0xcf, 0x91, 0x56, 0xeb, 0x38, 0x49, 0x1f, 0x93, 0x30, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0xa8, 0x14, 0x08, 0x38, 0x91, 0x5f, 0x45, 0x93,
-  0x27, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x89, 0xad, 0x72, 0xf7,
-  0x7e, 0xea, 0x93, 0x93, 0x0b, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x98, 0x71, 0xd1, 0xfc, 0x51, 0x3f, 0x9d, 0x93, 0x2b, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0x12, 0x3d, 0xb6, 0x27, 0x2b, 0x6c, 0xbe, 0x93,
-  0x14, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x8c, 0x6d, 0xa6, 0x0f,
-  0x79, 0x51, 0xdc, 0x93, 0x33, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0xab, 0xa6, 0xf0, 0x41, 0x1d, 0xed, 0xe5, 0x93, 0x28, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x1b, 0x69, 0xa0, 0x5f, 0xbd, 0xff, 0xe6, 0x93,
-  0x32, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x1b, 0x69, 0xa0, 0x5f,
-  0xbd, 0xff, 0xe6, 0x93, 0x20, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0x1c, 0xfd, 0xf7, 0x9c, 0x1c, 0x95, 0x2a, 0x94, 0x21, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x1c, 0x7a, 0x57, 0x21, 0x7e, 0xcb, 0x2d, 0x94,
-  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x8b, 0x76, 0x30, 0x6f,
-  0x8e, 0x89, 0x3f, 0x94, 0x1d, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0xb5, 0x4a, 0xd3, 0x7f, 0x19, 0x2d, 0x41, 0x94, 0x02, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0x09, 0xb7, 0x5d, 0x10, 0x8b, 0x7a, 0x4e, 0x94,
-  0x15, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0xce, 0x8d, 0xd8, 0x4e,
-  0xba, 0xfb, 0x73, 0x94, 0x2a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0xa7, 0xfd, 0xb3, 0xba, 0xd5, 0x05, 0x9d, 0x94, 0x3c, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x00, 0x37, 0x75, 0x47, 0x25, 0x44, 0xb1, 0x94,
-  0x14, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x37, 0x75, 0x47,
-  0x25, 0x44, 0xb1, 0x94, 0x16, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0xc2, 0xbd, 0x1e, 0x71, 0x8c, 0x2a, 0xb9, 0x94, 0x16, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0x60, 0x1d, 0xa5, 0x09, 0x62, 0x90, 0xc8, 0x94,
-  0x18, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0xae, 0xfc, 0xc9, 0xdb,
-  0xf2, 0xeb, 0xd1, 0x94, 0x15, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
-  0xae, 0xfc, 0xc9, 0xdb, 0xf2, 0xeb, 0xd1, 0x94, 0x1e, 0x00, 0x00, 0x00,
-  0x22, 0x00, 0x00, 0x00, 0xfb, 0x1f, 0x01, 0xb4, 0x99, 0xd5, 0xfd, 0x94,
-  0x2f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x84, 0x89, 0xe4, 0xcc,
-  0x60, 0xcf, 0x1e, 0x95, 0x44, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0x84, 0x89, 0xe4, 0xcc, 0x60, 0xcf, 0x1e, 0x95, 0x1f, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0x02, 0xd7, 0xd6, 0x71, 0x18, 0x7b, 0x60, 0x95,
-  0x3c, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0xc3, 0x0b, 0x6f, 0x52,
-  0x12, 0x1c, 0x8e, 0x95, 0x3c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x7e, 0x6e, 0xe7, 0xff, 0x08, 0xd6, 0xb3, 0x95, 0x01, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x6f, 0xf8, 0x0b, 0x9e, 0x1d, 0xcf, 0xe8, 0x95,
-  0x1f, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x5b, 0x97, 0x2c, 0x3f,
-  0x81, 0xcd, 0x00, 0x96, 0x27, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0x35, 0x33, 0x98, 0x04, 0x04, 0xbf, 0x58, 0x96, 0x1d, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x64, 0x29, 0xd7, 0xbb, 0x6e, 0xdf, 0x68, 0x96,
-  0x1c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1e, 0x69, 0x00, 0xc9,
-  0xec, 0x65, 0x7c, 0x96, 0x30, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x1e, 0x69, 0x00, 0xc9, 0xec, 0x65, 0x7c, 0x96, 0x15, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x1e, 0x69, 0x00, 0xc9, 0xec, 0x65, 0x7c, 0x96,
-  0x1f, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x1f, 0xff, 0x88, 0x6b,
-  0x51, 0x94, 0x7e, 0x96, 0x30, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0x61, 0xf3, 0x04, 0x76, 0x6f, 0xe2, 0x80, 0x96, 0x1e, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0xc6, 0xae, 0x74, 0x16, 0x01, 0x8d, 0x8b, 0x96,
-  0x3e, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x53, 0x15, 0x2d, 0xba,
-  0xec, 0x93, 0x90, 0x96, 0x45, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x3d, 0x55, 0x30, 0x9f, 0x2e, 0xa3, 0xab, 0x96, 0x29, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0xdd, 0x08, 0xe5, 0xf7, 0x7f, 0x4d, 0xb1, 0x96,
-  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xcc, 0x00, 0xca, 0x77,
-  0x2c, 0x17, 0xeb, 0x96, 0x4d, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0x64, 0x56, 0x16, 0x65, 0xc2, 0x2a, 0xf9, 0x96, 0x02, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x62, 0xbd, 0xe6, 0x26, 0xdf, 0x3a, 0x1e, 0x97,
-  0x44, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x27, 0x71, 0xb4, 0xde,
-  0x6f, 0xb1, 0x1e, 0x97, 0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0xc2, 0xf8, 0x9c, 0x2f, 0x4e, 0x4d, 0x37, 0x97, 0x0a, 0x00, 0x00, 0x00,
-  0x0b, 0x00, 0x00, 0x00, 0xb0, 0x0f, 0x0d, 0x59, 0x44, 0x39, 0x94, 0x97,
-  0x02, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x29, 0xd3, 0x66, 0x0a,
-  0x25, 0x9c, 0x9f, 0x97, 0x16, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0x52, 0x84, 0x2b, 0xc0, 0xbd, 0x04, 0xaa, 0x97, 0x25, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x52, 0x84, 0x2b, 0xc0, 0xbd, 0x04, 0xaa, 0x97,
-  0x25, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x52, 0x84, 0x2b, 0xc0,
-  0xbd, 0x04, 0xaa, 0x97, 0x29, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0xe8, 0x00, 0x33, 0x7d, 0x83, 0x9b, 0xd3, 0x97, 0x3a, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x33, 0x7d, 0x83, 0x9b, 0xd3, 0x97,
-  0x34, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x33, 0x7d,
-  0x83, 0x9b, 0xd3, 0x97, 0x2a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0xe8, 0x00, 0x33, 0x7d, 0x83, 0x9b, 0xd3, 0x97, 0x30, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x90, 0x28, 0x90, 0x46, 0x77, 0x7c, 0x22, 0x98,
-  0x4f, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x71, 0xfa, 0x45, 0x68,
-  0xc4, 0x8e, 0x34, 0x98, 0x0a, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x57, 0x6c, 0x8a, 0x88, 0x2c, 0xa9, 0x35, 0x98, 0x31, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x33, 0xa3, 0xe1, 0x3b, 0x83, 0x89, 0x4c, 0x98,
-  0x33, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x11, 0xa6, 0x42, 0x29,
-  0x85, 0x5c, 0x8d, 0x98, 0x4d, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
-  0x7e, 0x2c, 0xb4, 0x5c, 0xd0, 0x09, 0xa2, 0x98, 0x47, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x71, 0x04, 0x08, 0xe0, 0x54, 0x69, 0xe3, 0x98,
-  0x3b, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x73, 0x0a, 0x18, 0x02,
-  0xa7, 0xab, 0xe4, 0x98, 0x09, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0x73, 0x0a, 0x18, 0x02, 0xa7, 0xab, 0xe4, 0x98, 0x09, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x73, 0x0a, 0x18, 0x02, 0xa7, 0xab, 0xe4, 0x98,
-  0x09, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x73, 0x0a, 0x18, 0x02,
-  0xa7, 0xab, 0xe4, 0x98, 0x09, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x5f, 0xbe, 0x89, 0x3a, 0x14, 0xfb, 0xee, 0x98, 0x0b, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0xe5, 0x74, 0x74, 0x9b, 0x36, 0x20, 0xf1, 0x98,
-  0x15, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x88, 0x9a, 0x42, 0x68,
-  0x59, 0x9d, 0xfc, 0x98, 0x1c, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0x49, 0xe2, 0x10, 0x3d, 0x3a, 0x3c, 0x05, 0x99, 0x00, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0xae, 0x88, 0x7a, 0xa9, 0xd0, 0x94, 0x17, 0x99,
-  0x26, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x9d, 0xf2,
-  0x37, 0x43, 0x1e, 0x99, 0x0b, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0x32, 0xa3, 0x25, 0xbe, 0xc9, 0xa6, 0x27, 0x99, 0x00, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x0a, 0x08, 0x0c, 0x6a, 0x1b, 0xa0, 0x39, 0x99,
-  0x27, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0xd4, 0x24, 0x8c, 0xa2,
-  0x8c, 0xfc, 0x3d, 0x99, 0x34, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
-  0x95, 0x58, 0xb7, 0x82, 0x1f, 0x2a, 0x77, 0x99, 0x30, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0xe2, 0xc4, 0x77, 0xa0, 0x0a, 0xa4, 0x7a, 0x99,
-  0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x2b, 0xca, 0x48, 0x08,
-  0x00, 0x63, 0x9b, 0x99, 0x4e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0xe8, 0xbd, 0x6e, 0x81, 0x6f, 0x9e, 0xa1, 0x99, 0x33, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0xd1, 0x45, 0xa1, 0x4c, 0xb0, 0x29, 0xa4, 0x99,
-  0x14, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x39, 0x90,
-  0x12, 0x21, 0xe9, 0x99, 0x29, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0xbc, 0xdb, 0x8c, 0x36, 0x3e, 0x71, 0xe9, 0x99, 0x1e, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0xbc, 0xdb, 0x8c, 0x36, 0x3e, 0x71, 0xe9, 0x99,
-  0x32, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x66, 0x52, 0x27, 0x64,
-  0x57, 0x95, 0xeb, 0x99, 0x47, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0xa5, 0x13, 0x27, 0xb8, 0x69, 0x11, 0x1b, 0x9a, 0x2b, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x6b, 0x7d, 0x39, 0x72, 0xc8, 0xf0, 0x1f, 0x9a,
-  0x3b, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x6b, 0x7d, 0x39, 0x72,
-  0xc8, 0xf0, 0x1f, 0x9a, 0x2b, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0x6b, 0x7d, 0x39, 0x72, 0xc8, 0xf0, 0x1f, 0x9a, 0x3b, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0x3b, 0x01, 0x9b, 0xce, 0x0b, 0x79, 0x2e, 0x9a,
-  0x34, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x73, 0x33, 0xdf, 0xbd,
-  0x4a, 0x7d, 0x39, 0x9a, 0x50, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0xc4, 0x96, 0x19, 0xad, 0xab, 0xd7, 0x51, 0x9a, 0x44, 0x00, 0x00, 0x00,
-  0x42, 0x00, 0x00, 0x00, 0xcf, 0x3b, 0xa9, 0xcf, 0x55, 0xa7, 0x67, 0x9a,
-  0x1d, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0xe9, 0xb9, 0x4f, 0x5a,
-  0xdb, 0x79, 0x6f, 0x9a, 0x1f, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
-  0xe9, 0xb9, 0x4f, 0x5a, 0xdb, 0x79, 0x6f, 0x9a, 0x16, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0xe9, 0xb9, 0x4f, 0x5a, 0xdb, 0x79, 0x6f, 0x9a,
-  0x20, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0xf5, 0x98, 0x12, 0x05,
-  0x11, 0x8a, 0xbc, 0x9a, 0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x89, 0x93, 0xd0, 0xf7, 0xfa, 0x0d, 0xc5, 0x9a, 0x3c, 0x00, 0x00, 0x00,
-  0x3b, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x9a, 0x1d, 0x1f, 0x0c, 0x9b,
-  0x0c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xdc, 0x7a, 0x2a, 0x77,
-  0x96, 0x95, 0x17, 0x9b, 0x30, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x9a, 0x5b, 0x9e, 0x6d, 0xf2, 0x75, 0x5b, 0x9b, 0x46, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0xc4, 0xe0, 0x62, 0x34, 0xcb, 0x49, 0xd8, 0x9b,
-  0x1e, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x39, 0x95, 0xd9, 0xfe,
-  0x68, 0xca, 0xee, 0x9b, 0x29, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0x75, 0x05, 0xa3, 0x68, 0x8a, 0x20, 0xf3, 0x9b, 0x0c, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x97, 0x15, 0x51, 0x13, 0x4a, 0xfb, 0xf6, 0x9b,
-  0x16, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3d, 0x7e, 0x89, 0x8f,
-  0x2c, 0xe6, 0x01, 0x9c, 0x2a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x77, 0x50, 0x78, 0xa3, 0x24, 0x80, 0x06, 0x9c, 0x3b, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0x3b, 0x17, 0xab, 0x0b, 0x9c, 0x22, 0x14, 0x9c,
-  0x20, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x3b, 0x17, 0xab, 0x0b,
-  0x9c, 0x22, 0x14, 0x9c, 0x44, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
-  0xeb, 0xee, 0x96, 0x5e, 0x17, 0xa5, 0x1d, 0x9c, 0x45, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x67, 0xbb, 0x8d, 0x04, 0xf6, 0xd9, 0x1e, 0x9c,
-  0x35, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x29, 0xbc, 0x96, 0x80,
-  0xcd, 0xd7, 0x21, 0x9c, 0x1d, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x29, 0xbc, 0x96, 0x80, 0xcd, 0xd7, 0x21, 0x9c, 0x15, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x29, 0xbc, 0x96, 0x80, 0xcd, 0xd7, 0x21, 0x9c,
-  0x27, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x1c, 0xf1, 0x4c, 0xce,
-  0x3f, 0x71, 0x32, 0x9c, 0x34, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0xf4, 0x8e, 0xbd, 0x0d, 0xe5, 0xb2, 0x43, 0x9c, 0x27, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0x55, 0xdb, 0x97, 0x04, 0x9c, 0x5d, 0x5a, 0x9c,
-  0x16, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x97, 0x03,
-  0x2e, 0x06, 0x82, 0x9c, 0x3c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0xb9, 0x21, 0x03, 0x5e, 0x7b, 0x0c, 0x85, 0x9c, 0x1d, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0x8e, 0x32, 0x71, 0x4f, 0x1f, 0xb0, 0x8b, 0x9c,
-  0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x8e, 0x32, 0x71, 0x4f,
-  0x1f, 0xb0, 0x8b, 0x9c, 0x12, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x8e, 0x32, 0x71, 0x4f, 0x1f, 0xb0, 0x8b, 0x9c, 0x0a, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x8e, 0x32, 0x71, 0x4f, 0x1f, 0xb0, 0x8b, 0x9c,
-  0x1c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x8e, 0x32, 0x71, 0x4f,
-  0x1f, 0xb0, 0x8b, 0x9c, 0x16, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x8e, 0x32, 0x71, 0x4f, 0x1f, 0xb0, 0x8b, 0x9c, 0x12, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x93, 0xe3, 0xcf, 0xb6, 0x8b, 0x94, 0xab, 0x9c,
-  0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x92, 0x1b, 0xfb, 0x91,
-  0x6b, 0xd8, 0xb3, 0x9c, 0x32, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
-  0x92, 0x1b, 0xfb, 0x91, 0x6b, 0xd8, 0xb3, 0x9c, 0x2a, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x92, 0x1b, 0xfb, 0x91, 0x6b, 0xd8, 0xb3, 0x9c,
-  0x3a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x92, 0x1b, 0xfb, 0x91,
-  0x6b, 0xd8, 0xb3, 0x9c, 0x34, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x92, 0x1b, 0xfb, 0x91, 0x6b, 0xd8, 0xb3, 0x9c, 0x32, 0x00, 0x00, 0x00,
-  0x2e, 0x00, 0x00, 0x00, 0x14, 0xe3, 0x99, 0x7a, 0x76, 0x18, 0xc4, 0x9c,
-  0x0a, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xaf, 0xb6, 0x3c, 0x48,
-  0x29, 0x8b, 0xcf, 0x9c, 0x15, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0x83, 0x27, 0x93, 0x02, 0x2a, 0x04, 0xfa, 0x9c, 0x34, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0xb9, 0x69, 0x7c, 0x8d, 0x5b, 0x7e, 0x0c, 0x9d,
-  0x1e, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xb9, 0x69, 0x7c, 0x8d,
-  0x5b, 0x7e, 0x0c, 0x9d, 0x46, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0xbb, 0xcb, 0xb2, 0xae, 0x07, 0x9f, 0x18, 0x9d, 0x46, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0xbb, 0xcb, 0xb2, 0xae, 0x07, 0x9f, 0x18, 0x9d,
-  0x2a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xbe, 0xe5, 0xdb, 0xa0,
-  0xe2, 0xad, 0x2d, 0x9d, 0x47, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0xb5, 0xe0, 0x12, 0xa5, 0x43, 0xb2, 0x31, 0x9d, 0x4e, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0xb5, 0xe0, 0x12, 0xa5, 0x43, 0xb2, 0x31, 0x9d,
-  0x46, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x0d, 0xf6, 0xb6, 0x57,
-  0xde, 0xa5, 0x8b, 0x9d, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x0d, 0xf6, 0xb6, 0x57, 0xde, 0xa5, 0x8b, 0x9d, 0x31, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x3f, 0x15, 0x49, 0x06, 0xd9, 0xc5, 0x90, 0x9d,
-  0x32, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xa2, 0xb3, 0x09, 0xe7,
-  0x27, 0x1a, 0xb0, 0x9d, 0x3d, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00,
-  0x78, 0xa3, 0x33, 0x87, 0x2f, 0x0f, 0xbe, 0x9d, 0x29, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0xf4, 0x61, 0x14, 0xc3, 0xa1, 0x09, 0xe5, 0x9d,
-  0x3c, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0xb4, 0xe8, 0x30, 0xaf,
-  0x79, 0x28, 0xe6, 0x9d, 0x0d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x02, 0x08, 0x20, 0x19, 0x8f, 0x74, 0xe6, 0x9d, 0x01, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0xd0, 0xea, 0xf6, 0x42, 0x75, 0x32, 0xe7, 0x9d,
-  0x09, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xd0, 0xea, 0xf6, 0x42,
-  0x75, 0x32, 0xe7, 0x9d, 0x02, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
-  0x5e, 0xc9, 0xe5, 0x42, 0x0d, 0x0a, 0xf5, 0x9d, 0x3e, 0x00, 0x00, 0x00,
-  0x4e, 0x00, 0x00, 0x00, 0xdc, 0x38, 0xa6, 0xda, 0xe7, 0xbd, 0x2a, 0x9e,
-  0x16, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0xdc, 0x38, 0xa6, 0xda,
-  0xe7, 0xbd, 0x2a, 0x9e, 0x3b, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
-  0xdc, 0x38, 0xa6, 0xda, 0xe7, 0xbd, 0x2a, 0x9e, 0x31, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0x83, 0x4b, 0x5c, 0x54, 0x2c, 0xb8, 0x56, 0x9e,
-  0x2a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x32, 0xcd, 0x43, 0x39,
-  0xc9, 0x05, 0x5a, 0x9e, 0x1e, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0xce, 0x72, 0x49, 0x9c, 0xf0, 0xb5, 0x86, 0x9e, 0x00, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x9e, 0x82, 0x72, 0x0b, 0x1a, 0x45, 0x93, 0x9e,
-  0x3d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x45, 0x5a, 0xce, 0x4b,
-  0x32, 0x45, 0xc6, 0x9e, 0x34, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x86, 0x01, 0x55, 0x04, 0x39, 0x88, 0xeb, 0x9e, 0x0a, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x96, 0x97, 0xdb, 0xee, 0x25, 0xc7, 0xf8, 0x9e,
-  0x1e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x67, 0x19, 0x17, 0x40,
-  0x25, 0x0a, 0x0f, 0x9f, 0x34, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x81, 0x4e, 0x26, 0xb4, 0x86, 0xac, 0x16, 0x9f, 0x0a, 0x00, 0x00, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x51, 0x81, 0xee, 0x41, 0x67, 0xe5, 0x20, 0x9f,
-  0x13, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x53, 0xa0, 0x07, 0x55,
-  0x2e, 0x9d, 0x29, 0x9f, 0x1e, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0xa4, 0xa4, 0x3d, 0x35, 0xb9, 0xe4, 0x31, 0x9f, 0x33, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x87, 0x48, 0xd4, 0xbc, 0x49, 0xd7, 0x34, 0x9f,
-  0x3c, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x20, 0x9d, 0x30, 0x39,
-  0xb1, 0x96, 0x37, 0x9f, 0x4f, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
-  0xac, 0xd5, 0xe7, 0x1e, 0xed, 0xd9, 0x3d, 0x9f, 0x2a, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0xac, 0xd5, 0xe7, 0x1e, 0xed, 0xd9, 0x3d, 0x9f,
-  0x1d, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x69, 0xee, 0x1c, 0xa5,
-  0xe2, 0x3f, 0xc9, 0x9f, 0x29, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x30, 0x01, 0x8f, 0x35, 0x16, 0x71, 0xd5, 0x9f, 0x13, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0xd7, 0xdb, 0x46, 0x4e, 0xfb, 0x84, 0xed, 0x9f,
-  0x33, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0xd7, 0xdb, 0x46, 0x4e,
-  0xfb, 0x84, 0xed, 0x9f, 0x26, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x40, 0x01, 0x0f, 0x1c, 0x7f, 0x42, 0x05, 0xa0, 0x14, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0x3a, 0xc2, 0x07, 0xf6, 0x46, 0x40, 0x44, 0xa0,
-  0x1b, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x0d, 0x50, 0x36, 0x61,
-  0x69, 0xa2, 0x5f, 0xa0, 0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0xbd, 0x8e, 0x9a, 0x33, 0x46, 0x1c, 0xa9, 0xa0, 0x34, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x41, 0x59, 0x1e, 0x95, 0x03, 0x9e, 0xc2, 0xa0,
-  0x33, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xe3, 0x78, 0x5a, 0x1a,
-  0x2e, 0xc3, 0xcf, 0xa0, 0x3c, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-  0xb0, 0x9b, 0x78, 0x7e, 0x73, 0xa8, 0xd8, 0xa0, 0x14, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0xb0, 0x9b, 0x78, 0x7e, 0x73, 0xa8, 0xd8, 0xa0,
-  0x27, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xb0, 0x9b, 0x78, 0x7e,
-  0x73, 0xa8, 0xd8, 0xa0, 0x31, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
-  0x8d, 0x76, 0x52, 0xd6, 0x09, 0x6a, 0xe5, 0xa0, 0x3a, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0xc6, 0x74, 0xdf, 0x53, 0xd6, 0x62, 0xef, 0xa0,
-  0x1c, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x5c, 0x58, 0x9b, 0x76,
-  0x11, 0x8a, 0xfa, 0xa0, 0x46, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0xb0, 0x23, 0x98, 0x9b, 0x3b, 0xd6, 0xfc, 0xa0, 0x0b, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0x6d, 0xcb, 0x4d, 0xad, 0x58, 0x8a, 0x00, 0xa1,
-  0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x05, 0x24, 0xe9, 0x1a,
-  0x29, 0x99, 0x10, 0xa1, 0x3a, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x9f, 0x7a, 0xcb, 0x1f, 0x5d, 0xaa, 0x40, 0xa1, 0x3d, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0x49, 0x70, 0xc3, 0x7d, 0xce, 0x61, 0x43, 0xa1,
-  0x28, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x7b, 0xcf, 0xd2, 0x1a,
-  0x3b, 0x5c, 0x4f, 0xa1, 0x26, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0xcf, 0x0b, 0xf0, 0xdb, 0x06, 0x72, 0x5b, 0xa1, 0x2b, 0x00, 0x00, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0xd6, 0xb8, 0x78, 0x7f, 0x4c, 0x5a, 0x74, 0xa1,
-  0x27, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x0a, 0x16, 0x89, 0x36,
-  0x69, 0xf7, 0xcd, 0xa1, 0x1c, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0x1c, 0x1a, 0x76, 0x87, 0x2a, 0x74, 0xff, 0xa1, 0x33, 0x00, 0x00, 0x00,
-  0x3b, 0x00, 0x00, 0x00, 0x1c, 0x1a, 0x76, 0x87, 0x2a, 0x74, 0xff, 0xa1,
-  0x46, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x1c, 0x1a, 0x76, 0x87,
-  0x2a, 0x74, 0xff, 0xa1, 0x3a, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0x1c, 0x1a, 0x76, 0x87, 0x2a, 0x74, 0xff, 0xa1, 0x31, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x1c, 0x1a, 0x76, 0x87, 0x2a, 0x74, 0xff, 0xa1,
-  0x3c, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0xc0, 0x0f, 0x89, 0x3d,
-  0x4e, 0xcd, 0x38, 0xa2, 0x46, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x2a, 0x46, 0x12, 0xca, 0x3f, 0x2e, 0x4e, 0xa2, 0x09, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0xc1, 0xa9, 0x91, 0x66, 0xe0, 0x71, 0x82, 0xa2,
-  0x21, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x09, 0x9a, 0x93, 0xdc,
-  0xa7, 0x3e, 0xa4, 0xa2, 0x27, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-  0xe5, 0xe6, 0x66, 0x42, 0xc3, 0x14, 0xad, 0xa2, 0x2b, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0xa1, 0x47, 0xfa, 0x34, 0xa9, 0x98, 0xbd, 0xa2,
-  0x0b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x2c, 0xd7, 0x2c, 0x58,
-  0x24, 0x40, 0xbe, 0xa2, 0x31, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00,
-  0x65, 0x1c, 0x2b, 0x18, 0x8e, 0xed, 0xcb, 0xa2, 0x2f, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0xff, 0xfd, 0x0f, 0x5f, 0x22, 0xb0, 0x43, 0xa3,
-  0x3c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xc2, 0x6a, 0xf0, 0x7e,
-  0x01, 0xf9, 0x4d, 0xa3, 0x20, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0xc2, 0x6a, 0xf0, 0x7e, 0x01, 0xf9, 0x4d, 0xa3, 0x20, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0xc0, 0x0b, 0xa5, 0x4e, 0x46, 0x98, 0x61, 0xa3,
-  0x34, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0b, 0x76, 0x37, 0xe7,
-  0x85, 0x31, 0x79, 0xa3, 0x13, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x66, 0xea, 0xfb, 0x9c, 0xd0, 0xa5, 0xa0, 0xa3, 0x28, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0xb4, 0xb1, 0x2e, 0x64, 0x88, 0x97, 0xac, 0xa3,
-  0x30, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0xb4, 0xb1, 0x2e, 0x64,
-  0x88, 0x97, 0xac, 0xa3, 0x1e, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0xd4, 0xbd, 0xf3, 0x44, 0x84, 0x31, 0xba, 0xa3, 0x13, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x61, 0x73, 0xf4, 0xe9, 0x8e, 0x45, 0xed, 0xa3,
-  0x45, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x42, 0x7d, 0x47, 0x76,
-  0x44, 0x12, 0x1b, 0xa4, 0x0b, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0xe4, 0xa3, 0x6e, 0xf4, 0x7f, 0x09, 0x2f, 0xa4, 0x0c, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0xf7, 0x50, 0x9c, 0x50, 0x75, 0x2a, 0x2f, 0xa4,
-  0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x43, 0xf6, 0x1f, 0x4b,
-  0xb5, 0xf4, 0x35, 0xa4, 0x33, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0xd9, 0xca, 0xec, 0x7c, 0x13, 0xb0, 0x48, 0xa4, 0x0c, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0xbc, 0x8d, 0x9e, 0x75, 0x5a, 0x5a, 0x52, 0xa4,
-  0x27, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xc0, 0xaf, 0xde, 0x68,
-  0xd0, 0x97, 0x58, 0xa4, 0x26, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0xc8, 0x42, 0xb0, 0x43, 0x47, 0x23, 0x5a, 0xa4, 0x03, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0x7c, 0x13, 0x97, 0x5a, 0x44, 0x74, 0xcb, 0xa4,
-  0x4d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x24, 0xd2, 0xef, 0x83,
-  0x1d, 0xf4, 0xcd, 0xa4, 0x16, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0xd5, 0xd8, 0x3f, 0xb0, 0xc5, 0xce, 0xda, 0xa4, 0x3a, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0xba, 0x3b, 0xce, 0x11, 0x22, 0xde, 0x0c, 0xa5,
-  0x20, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x05, 0xee, 0xf3, 0xa0,
-  0x41, 0x89, 0x16, 0xa5, 0x28, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0x6a, 0xdf, 0xd1, 0xdf, 0xf0, 0x32, 0x83, 0xa5, 0x34, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0xb4, 0x85, 0xdd, 0x8d, 0xfb, 0x20, 0x8d, 0xa5,
-  0x19, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x24, 0x74, 0xdf, 0x67,
-  0x88, 0x22, 0xa7, 0xa5, 0x16, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0xdf, 0x1e, 0xdc, 0xce, 0x69, 0x7a, 0xa7, 0xa5, 0x03, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0xdf, 0x1e, 0xdc, 0xce, 0x69, 0x7a, 0xa7, 0xa5,
-  0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xdf, 0x1e, 0xdc, 0xce,
-  0x69, 0x7a, 0xa7, 0xa5, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0xdf, 0x1e, 0xdc, 0xce, 0x69, 0x7a, 0xa7, 0xa5, 0x1b, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0xdf, 0x1e, 0xdc, 0xce, 0x69, 0x7a, 0xa7, 0xa5,
-  0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xdf, 0x1e, 0xdc, 0xce,
-  0x69, 0x7a, 0xa7, 0xa5, 0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0xdf, 0x1e, 0xdc, 0xce, 0x69, 0x7a, 0xa7, 0xa5, 0x03, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0xdf, 0x1e, 0xdc, 0xce, 0x69, 0x7a, 0xa7, 0xa5,
-  0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xdf, 0x1e, 0xdc, 0xce,
-  0x69, 0x7a, 0xa7, 0xa5, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0xdf, 0x1e, 0xdc, 0xce, 0x69, 0x7a, 0xa7, 0xa5, 0x1b, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0xdf, 0x1e, 0xdc, 0xce, 0x69, 0x7a, 0xa7, 0xa5,
-  0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xdf, 0x1e, 0xdc, 0xce,
-  0x69, 0x7a, 0xa7, 0xa5, 0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0xdf, 0x1e, 0xdc, 0xce, 0x69, 0x7a, 0xa7, 0xa5, 0x03, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0xdf, 0x1e, 0xdc, 0xce, 0x69, 0x7a, 0xa7, 0xa5,
-  0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xdf, 0x1e, 0xdc, 0xce,
-  0x69, 0x7a, 0xa7, 0xa5, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0xdf, 0x1e, 0xdc, 0xce, 0x69, 0x7a, 0xa7, 0xa5, 0x1b, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0xdf, 0x1e, 0xdc, 0xce, 0x69, 0x7a, 0xa7, 0xa5,
-  0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xdf, 0x1e, 0xdc, 0xce,
-  0x69, 0x7a, 0xa7, 0xa5, 0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0xdf, 0x1e, 0xdc, 0xce, 0x69, 0x7a, 0xa7, 0xa5, 0x03, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0xdf, 0x1e, 0xdc, 0xce, 0x69, 0x7a, 0xa7, 0xa5,
-  0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xdf, 0x1e, 0xdc, 0xce,
-  0x69, 0x7a, 0xa7, 0xa5, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0xdf, 0x1e, 0xdc, 0xce, 0x69, 0x7a, 0xa7, 0xa5, 0x1b, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0xdf, 0x1e, 0xdc, 0xce, 0x69, 0x7a, 0xa7, 0xa5,
-  0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xdf, 0x1e, 0xdc, 0xce,
-  0x69, 0x7a, 0xa7, 0xa5, 0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0xdf, 0x1e, 0xdc, 0xce, 0x69, 0x7a, 0xa7, 0xa5, 0x03, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0xdf, 0x1e, 0xdc, 0xce, 0x69, 0x7a, 0xa7, 0xa5,
-  0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x31, 0xa1, 0x42, 0xed,
-  0x30, 0x96, 0xa8, 0xa5, 0x33, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0x23, 0x5c, 0x83, 0x34, 0x36, 0x0a, 0xdd, 0xa5, 0x13, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0xf6, 0x54, 0xa5, 0xf4, 0xa8, 0x44, 0xdf, 0xa5,
-  0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x25, 0x61, 0x28, 0x22,
-  0x91, 0x4e, 0xf2, 0xa5, 0x26, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0x47, 0xa4, 0xab, 0x49, 0xee, 0xb4, 0x3e, 0xa6, 0x2a, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0xdb, 0x60, 0x75, 0x93, 0xf4, 0x84, 0x48, 0xa6,
-  0x3c, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x7c, 0xbc, 0x73, 0x4c,
-  0x77, 0x28, 0x4b, 0xa6, 0x33, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x7c, 0xbc, 0x73, 0x4c, 0x77, 0x28, 0x4b, 0xa6, 0x33, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0xe9, 0x04, 0xee, 0x34, 0xa3, 0x64, 0x59, 0xa6,
-  0x3c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xff, 0x14, 0xef, 0x06,
-  0x8c, 0xda, 0x7a, 0xa6, 0x28, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-  0xe2, 0x55, 0x63, 0x1b, 0x7d, 0x69, 0xb5, 0xa6, 0x25, 0x00, 0x00, 0x00,
-  0x2e, 0x00, 0x00, 0x00, 0xf5, 0x0d, 0x28, 0x74, 0x69, 0xea, 0xec, 0xa6,
-  0x44, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x5d, 0x41, 0xcd, 0xad,
-  0xc9, 0x79, 0xf0, 0xa6, 0x2f, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x3a, 0xfa, 0xa9, 0x23, 0x8a, 0xef, 0xf9, 0xa6, 0x26, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0xd9, 0x4c, 0x26, 0x5b, 0x69, 0x3c, 0x07, 0xa7,
-  0x14, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xd9, 0x4c, 0x26, 0x5b,
-  0x69, 0x3c, 0x07, 0xa7, 0x2f, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0xce, 0xb6, 0xcb, 0xf9, 0x4f, 0xf0, 0x25, 0xa7, 0x44, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x36, 0xc7, 0xc3, 0xe9, 0x5d, 0x14, 0xa4, 0xa7,
-  0x29, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x7f, 0x5e, 0x43, 0x48,
-  0xbc, 0xc3, 0xaf, 0xa7, 0x43, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
-  0x7f, 0x5e, 0x43, 0x48, 0xbc, 0xc3, 0xaf, 0xa7, 0x3c, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x7b, 0x56, 0xbf, 0x19, 0x3a, 0x41, 0xc9, 0xa7,
-  0x28, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x44, 0x32, 0xfe, 0x64,
-  0x77, 0x39, 0x5e, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-  0x9e, 0x49, 0x35, 0xb3, 0x36, 0x8c, 0x65, 0xa8, 0x03, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x9e, 0x49, 0x35, 0xb3, 0x36, 0x8c, 0x65, 0xa8,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x9e, 0x49, 0x35, 0xb3,
-  0x36, 0x8c, 0x65, 0xa8, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0xe6, 0x77, 0x8b, 0x7b, 0x39, 0x89, 0x7c, 0xa8, 0x31, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0xa0, 0x3e, 0xe0, 0x55, 0x6e, 0xb5, 0x89, 0xa8,
-  0x32, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xee, 0xd8, 0x2c, 0xba,
-  0xa6, 0x12, 0x93, 0xa8, 0x14, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0x74, 0x02, 0x22, 0xc4, 0x1d, 0xae, 0xcc, 0xa8, 0x29, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x55, 0xac, 0x69, 0x10, 0x27, 0xe6, 0xe8, 0xa8,
-  0x46, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xaf, 0xe3, 0x5d, 0x94,
-  0xd5, 0x6d, 0xfb, 0xa8, 0x4e, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0xf4, 0x4c, 0x30, 0xf8, 0x83, 0xb6, 0x05, 0xa9, 0x0b, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0xa3, 0xa0, 0xda, 0xf4, 0x95, 0xb8, 0x13, 0xa9,
-  0x3b, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0xa3, 0xa0, 0xda, 0xf4,
-  0x95, 0xb8, 0x13, 0xa9, 0x33, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x9c, 0x62, 0x16, 0xd3, 0x91, 0x38, 0x1f, 0xa9, 0x02, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0x9c, 0x62, 0x16, 0xd3, 0x91, 0x38, 0x1f, 0xa9,
-  0x1c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x9c, 0x62, 0x16, 0xd3,
-  0x91, 0x38, 0x1f, 0xa9, 0x02, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
-  0x9c, 0x62, 0x16, 0xd3, 0x91, 0x38, 0x1f, 0xa9, 0x1c, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x9c, 0x62, 0x16, 0xd3, 0x91, 0x38, 0x1f, 0xa9,
-  0x02, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x9c, 0x62, 0x16, 0xd3,
-  0x91, 0x38, 0x1f, 0xa9, 0x02, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
-  0x5e, 0x56, 0xfa, 0xc7, 0xca, 0x93, 0x32, 0xa9, 0x3b, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0xf8, 0x9d, 0x8b, 0xad, 0x42, 0x6f, 0x53, 0xa9,
-  0x34, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0xa6, 0x25, 0x1f, 0x39,
-  0x0d, 0xae, 0x5a, 0xa9, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0xa6, 0x25, 0x1f, 0x39, 0x0d, 0xae, 0x5a, 0xa9, 0x03, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0xa6, 0x25, 0x1f, 0x39, 0x0d, 0xae, 0x5a, 0xa9,
-  0x1d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xa6, 0x25, 0x1f, 0x39,
-  0x0d, 0xae, 0x5a, 0xa9, 0x1d, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0x7f, 0xf6, 0x28, 0x70, 0xb7, 0xfa, 0x84, 0xa9, 0x00, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x7f, 0xf6, 0x28, 0x70, 0xb7, 0xfa, 0x84, 0xa9,
-  0x03, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x2a, 0x2c, 0xcf, 0xc1,
-  0x3a, 0x51, 0x98, 0xa9, 0x32, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0xf7, 0xc6, 0x7c, 0x1a, 0xc2, 0x3a, 0x99, 0xa9, 0x01, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x59, 0x2c, 0x0e, 0x68, 0x90, 0xb2, 0xa0, 0xa9,
-  0x02, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x8f, 0x51, 0x83, 0xef,
-  0x86, 0xe7, 0xaa, 0xa9, 0x3b, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0x05, 0x17, 0xcb, 0x83, 0x5d, 0x23, 0xcc, 0xa9, 0x2a, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0x13, 0xff, 0x8c, 0x42, 0xae, 0xe7, 0xed, 0xa9,
-  0x2f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xd7, 0x80, 0x93, 0x46,
-  0x0c, 0x1f, 0xf2, 0xa9, 0x47, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x0d, 0x2f, 0x4b, 0x3d, 0xef, 0xe6, 0xf3, 0xa9, 0x4e, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0xa5, 0x25, 0x32, 0xa0, 0x26, 0x85, 0xf4, 0xa9,
-  0x12, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x72, 0xe3, 0xca, 0x3d,
-  0x82, 0x4e, 0xf5, 0xa9, 0x34, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0xeb, 0x87, 0x78, 0x46, 0xdb, 0x99, 0x0b, 0xaa, 0x26, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0xeb, 0x87, 0x78, 0x46, 0xdb, 0x99, 0x0b, 0xaa,
-  0x16, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x01, 0xf3, 0x08, 0xbd,
-  0x8f, 0x9e, 0x0b, 0xaa, 0x0b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0xdf, 0xfc, 0xa6, 0xdc, 0xff, 0xf2, 0x12, 0xaa, 0x13, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x0b, 0x27, 0xff, 0x93, 0xaa, 0x36, 0x2c, 0xaa,
-  0x42, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0xa0, 0xce, 0x52, 0xb5,
-  0x4e, 0x5d, 0x34, 0xaa, 0x33, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0x54, 0xc5, 0x36, 0x28, 0xb4, 0x13, 0x4a, 0xaa, 0x02, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x14, 0xb3, 0xd0, 0x7f, 0x16, 0x9a, 0x53, 0xaa,
-  0x15, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x14, 0xb3, 0xd0, 0x7f,
-  0x16, 0x9a, 0x53, 0xaa, 0x2f, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x14, 0xb3, 0xd0, 0x7f, 0x16, 0x9a, 0x53, 0xaa, 0x25, 0x00, 0x00, 0x00,
-  0x2e, 0x00, 0x00, 0x00, 0x14, 0xb3, 0xd0, 0x7f, 0x16, 0x9a, 0x53, 0xaa,
-  0x38, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x14, 0xb3, 0xd0, 0x7f,
-  0x16, 0x9a, 0x53, 0xaa, 0x15, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0x37, 0xcd, 0x05, 0xba, 0xc7, 0x4d, 0x5b, 0xaa, 0x0a, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0xc9, 0x19, 0xe6, 0xd7, 0x7a, 0xdb, 0x63, 0xaa,
-  0x21, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x9f, 0xe9, 0xda, 0xc5,
-  0xa8, 0x9b, 0x72, 0xaa, 0x46, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x9f, 0xe9, 0xda, 0xc5, 0xa8, 0x9b, 0x72, 0xaa, 0x33, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x9f, 0xe9, 0xda, 0xc5, 0xa8, 0x9b, 0x72, 0xaa,
-  0x46, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x9f, 0xe9, 0xda, 0xc5,
-  0xa8, 0x9b, 0x72, 0xaa, 0x34, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0x9f, 0xe9, 0xda, 0xc5, 0xa8, 0x9b, 0x72, 0xaa, 0x33, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x9f, 0xe9, 0xda, 0xc5, 0xa8, 0x9b, 0x72, 0xaa,
-  0x46, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x0c, 0x3e, 0x6e, 0xd2,
-  0xde, 0x33, 0x75, 0xaa, 0x27, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-  0x06, 0x8f, 0xd0, 0xc1, 0x5c, 0x31, 0xc7, 0xaa, 0x2f, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x63, 0xe7, 0xfb, 0xb9, 0x87, 0xe6, 0xcb, 0xaa,
-  0x14, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xab, 0x7c, 0x8d, 0x35,
-  0x0e, 0x7a, 0xf6, 0xaa, 0x3d, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x11, 0x1e, 0x3d, 0x3b, 0x61, 0x2a, 0x0d, 0xab, 0x1d, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x67, 0xaf, 0x24, 0xe3, 0x6f, 0xb8, 0x34, 0xab,
-  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xa3, 0x6d, 0x77, 0xaf,
-  0x57, 0xa5, 0x3a, 0xab, 0x3c, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0x55, 0x88, 0xeb, 0x83, 0xda, 0xf9, 0xb2, 0xab, 0x29, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0xcf, 0x17, 0x3a, 0x25, 0xfa, 0xf2, 0xb5, 0xab,
-  0x32, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xf7, 0x07, 0x0c, 0xbd,
-  0xc9, 0x77, 0xc4, 0xab, 0x33, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x50, 0x04, 0x52, 0x44, 0xfa, 0xe8, 0xf3, 0xab, 0x16, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0xb8, 0xfb, 0x77, 0x66, 0x0d, 0x1c, 0x1c, 0xac,
-  0x29, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x86, 0xd2, 0xc4, 0x16,
-  0x61, 0xae, 0x3e, 0xac, 0x1f, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x28, 0x30, 0x8f, 0x96, 0x14, 0xf8, 0x5a, 0xac, 0x25, 0x00, 0x00, 0x00,
-  0x37, 0x00, 0x00, 0x00, 0xc7, 0x1f, 0xa2, 0xd8, 0x5a, 0xfe, 0x87, 0xac,
-  0x33, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xe2, 0xd1, 0x24, 0x2f,
-  0x0c, 0x85, 0x98, 0xac, 0x31, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0xe2, 0xd1, 0x24, 0x2f, 0x0c, 0x85, 0x98, 0xac, 0x3a, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0xe2, 0xd1, 0x24, 0x2f, 0x0c, 0x85, 0x98, 0xac,
-  0x30, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xc7, 0x41, 0xd8, 0x21,
-  0xad, 0x21, 0xab, 0xac, 0x2f, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
-  0xf0, 0x0c, 0xbd, 0x65, 0xb0, 0x9f, 0xac, 0xac, 0x01, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x7d, 0x5c, 0x43, 0x37, 0xea, 0x09, 0xb0, 0xac,
-  0x16, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xd2, 0x16, 0x63, 0x7e,
-  0x05, 0x1d, 0xc2, 0xac, 0x0c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0xaa, 0xd5, 0x76, 0x4d, 0x65, 0xee, 0xf8, 0xac, 0x0a, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x38, 0x99, 0x15, 0x0c, 0x36, 0x70, 0x03, 0xad,
-  0x0a, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x38, 0x99, 0x15, 0x0c,
-  0x36, 0x70, 0x03, 0xad, 0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x74, 0x7b, 0x64, 0x9b, 0xd3, 0x92, 0x08, 0xad, 0x3c, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0x2c, 0x8a, 0x69, 0x6e, 0x15, 0xcc, 0x0d, 0xad,
-  0x2a, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x2c, 0x8a, 0x69, 0x6e,
-  0x15, 0xcc, 0x0d, 0xad, 0x33, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x2c, 0x8a, 0x69, 0x6e, 0x15, 0xcc, 0x0d, 0xad, 0x3a, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x91, 0x83, 0x20, 0x8a, 0x57, 0xc3, 0x56, 0xad,
-  0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x91, 0x83, 0x20, 0x8a,
-  0x57, 0xc3, 0x56, 0xad, 0x15, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0xe3, 0x38, 0x24, 0x45, 0x6f, 0xe8, 0x9c, 0xad, 0x3c, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x0d, 0x3b, 0x01, 0x78, 0x71, 0xf7, 0xeb, 0xad,
-  0x0b, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xfb, 0x93, 0x4d, 0xd0,
-  0xe8, 0xbc, 0x00, 0xae, 0x1d, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
-  0x27, 0x3c, 0x0d, 0x78, 0x77, 0x98, 0x1c, 0xae, 0x21, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x74, 0x45, 0xfd, 0x77, 0x43, 0x9d, 0x40, 0xae,
-  0x3c, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x74, 0x45, 0xfd, 0x77,
-  0x43, 0x9d, 0x40, 0xae, 0x16, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x74, 0x45, 0xfd, 0x77, 0x43, 0x9d, 0x40, 0xae, 0x3c, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0x1a, 0xdc, 0xb6, 0xb0, 0xbe, 0xa1, 0x4e, 0xae,
-  0x47, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0xf8, 0xab, 0xa5, 0x0e,
-  0x80, 0x3b, 0x5f, 0xae, 0x1d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x87, 0xb8, 0xb6, 0xd3, 0x76, 0xfb, 0x7e, 0xae, 0x1e, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x64, 0x8a, 0xc2, 0x77, 0xf9, 0x8c, 0x8c, 0xae,
-  0x27, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xff, 0x78, 0xad, 0xfd,
-  0xf4, 0x6c, 0xa0, 0xae, 0x32, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0xa4, 0x39, 0xdb, 0xf6, 0xf7, 0xad, 0xc9, 0xae, 0x0a, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x9c, 0xa9, 0x7b, 0x15, 0x5c, 0x71, 0xcd, 0xae,
-  0x3a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xf4, 0x16, 0xfd, 0xc5,
-  0x44, 0x80, 0x62, 0xaf, 0x31, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0xb5, 0x8f, 0xa8, 0xef, 0x8b, 0x53, 0x87, 0xaf, 0x3d, 0x00, 0x00, 0x00,
-  0x45, 0x00, 0x00, 0x00, 0xe7, 0xac, 0xf6, 0xdf, 0xa7, 0x5b, 0xb0, 0xaf,
-  0x3b, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xe7, 0xac, 0xf6, 0xdf,
-  0xa7, 0x5b, 0xb0, 0xaf, 0x32, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x3f, 0xe4, 0x51, 0xbd, 0x6b, 0x98, 0xb8, 0xaf, 0x3a, 0x00, 0x00, 0x00,
-  0x43, 0x00, 0x00, 0x00, 0x3f, 0xe4, 0x51, 0xbd, 0x6b, 0x98, 0xb8, 0xaf,
-  0x30, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0xe8, 0x16, 0x12, 0xc7,
-  0x63, 0xc7, 0xe9, 0xaf, 0x46, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0xa7, 0xc2, 0x71, 0x05, 0xfa, 0xb7, 0x03, 0xb0, 0x33, 0x00, 0x00, 0x00,
-  0x3b, 0x00, 0x00, 0x00, 0xa7, 0xc2, 0x71, 0x05, 0xfa, 0xb7, 0x03, 0xb0,
-  0x46, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x53, 0x98, 0x54, 0x45,
-  0xf6, 0xca, 0x07, 0xb0, 0x29, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0x26, 0x5c, 0xe9, 0xc2, 0xc4, 0x48, 0x08, 0xb0, 0x0b, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x2e, 0xec, 0x49, 0xd5, 0x0a, 0xb0,
-  0x33, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0xcd, 0x2b, 0x68, 0x41,
-  0xd8, 0x8d, 0x0b, 0xb0, 0x27, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-  0x53, 0xbc, 0x52, 0xd3, 0x89, 0xe3, 0x0e, 0xb0, 0x1d, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x3d, 0xee, 0x35, 0x20, 0x3d, 0x5f, 0x16, 0xb0,
-  0x15, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x82, 0xa2, 0x49, 0x19,
-  0x58, 0xab, 0x44, 0xb0, 0x44, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
-  0xb0, 0xd6, 0x1f, 0x51, 0x95, 0x8f, 0x6c, 0xb0, 0x14, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x33, 0xd6, 0x76, 0x2a, 0xb0, 0x18, 0x74, 0xb0,
-  0x35, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x53, 0xa9, 0xb2, 0x41,
-  0xbc, 0xa2, 0x92, 0xb0, 0x46, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
-  0x19, 0xa3, 0x58, 0x9f, 0x7b, 0x11, 0x9e, 0xb0, 0x26, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0x19, 0xa3, 0x58, 0x9f, 0x7b, 0x11, 0x9e, 0xb0,
-  0x1c, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xdc, 0x5c, 0xac, 0xf5,
-  0x78, 0x93, 0xa8, 0xb0, 0x46, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0xe8, 0xea, 0xec, 0xcf, 0x05, 0x64, 0xb6, 0xb0, 0x45, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x8d, 0xb9, 0x60, 0xc8, 0x10, 0xf2, 0x34, 0xb1,
-  0x2b, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0d, 0x19, 0x3b, 0x23,
-  0x5a, 0x52, 0x59, 0xb1, 0x33, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0xfd, 0x27, 0x8f, 0xb7, 0x38, 0x35, 0x85, 0xb1, 0x2f, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0xfd, 0x27, 0x8f, 0xb7, 0x38, 0x35, 0x85, 0xb1,
-  0x20, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x85, 0xb3, 0x0f, 0x32,
-  0x84, 0x5a, 0xbc, 0xb1, 0x44, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
-  0x04, 0xba, 0x5e, 0xd3, 0x39, 0x2b, 0xce, 0xb1, 0x34, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x13, 0xff, 0x3e, 0x18, 0x26, 0x80, 0xd6, 0xb1,
-  0x26, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x69, 0xe2, 0xcc, 0x72,
-  0x3b, 0xc3, 0xfd, 0xb1, 0x29, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x69, 0xe2, 0xcc, 0x72, 0x3b, 0xc3, 0xfd, 0xb1, 0x46, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x69, 0xe2, 0xcc, 0x72, 0x3b, 0xc3, 0xfd, 0xb1,
-  0x33, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x7a, 0x1c, 0x63, 0x22,
-  0x30, 0x9c, 0x08, 0xb2, 0x27, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0x22, 0xb5, 0xa8, 0x32, 0xac, 0x3e, 0x92, 0xb2, 0x3a, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x22, 0xb5, 0xa8, 0x32, 0xac, 0x3e, 0x92, 0xb2,
-  0x3e, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x22, 0xb5, 0xa8, 0x32,
-  0xac, 0x3e, 0x92, 0xb2, 0x3a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x49, 0xea, 0x35, 0x4f, 0xb9, 0xdf, 0x9c, 0xb2, 0x4d, 0x00, 0x00, 0x00,
-  0x3b, 0x00, 0x00, 0x00, 0xea, 0x3b, 0xce, 0x3d, 0x47, 0xc8, 0xa9, 0xb2,
-  0x31, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x75, 0x74, 0x47, 0x6f,
-  0x25, 0x22, 0xd4, 0xb2, 0x1c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x9b, 0xc7, 0xf4, 0x1c, 0xf6, 0x57, 0xfb, 0xb2, 0x35, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x9b, 0xc7, 0xf4, 0x1c, 0xf6, 0x57, 0xfb, 0xb2,
-  0x4d, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x9b, 0xc7, 0xf4, 0x1c,
-  0xf6, 0x57, 0xfb, 0xb2, 0x35, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0x9b, 0xc7, 0xf4, 0x1c, 0xf6, 0x57, 0xfb, 0xb2, 0x3d, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x9b, 0xc7, 0xf4, 0x1c, 0xf6, 0x57, 0xfb, 0xb2,
-  0x35, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x9b, 0xc7, 0xf4, 0x1c,
-  0xf6, 0x57, 0xfb, 0xb2, 0x4d, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0xc0, 0xcc, 0x4c, 0xde, 0xb1, 0xa3, 0x2a, 0xb3, 0x13, 0x00, 0x00, 0x00,
-  0x25, 0x00, 0x00, 0x00, 0xef, 0x86, 0xf2, 0x53, 0x0f, 0x0a, 0x32, 0xb3,
-  0x32, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x18, 0x93, 0x48, 0x6d,
-  0x96, 0xcc, 0x33, 0xb3, 0x09, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x84, 0xc5, 0xcd, 0x7b, 0x07, 0x49, 0x3b, 0xb3, 0x15, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x1f, 0x1d, 0xf9, 0x3f, 0x11, 0x30, 0x77, 0xb3,
-  0x18, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x37, 0x5d, 0x00, 0x12,
-  0x67, 0x03, 0x84, 0xb3, 0x1d, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0x37, 0x5d, 0x00, 0x12, 0x67, 0x03, 0x84, 0xb3, 0x30, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0x37, 0x5d, 0x00, 0x12, 0x67, 0x03, 0x84, 0xb3,
-  0x1d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x37, 0x5d, 0x00, 0x12,
-  0x67, 0x03, 0x84, 0xb3, 0x1f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x37, 0x5d, 0x00, 0x12, 0x67, 0x03, 0x84, 0xb3, 0x1e, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0xdc, 0xc6, 0xd4, 0x7c, 0x3a, 0x69, 0x8d, 0xb3,
-  0x3a, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xae, 0x7f, 0x74, 0x48,
-  0x90, 0x2f, 0x96, 0xb3, 0x1d, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x9b, 0xa6, 0xac, 0xd9, 0x19, 0xe0, 0xc6, 0xb3, 0x14, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x50, 0x85, 0x99, 0x8b, 0xbd, 0x15, 0xd9, 0xb3,
-  0x20, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x04, 0xf7, 0xa9, 0xd3,
-  0x3f, 0xa8, 0xf2, 0xb3, 0x26, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x61, 0x07, 0x20, 0xdc, 0x28, 0x52, 0x27, 0xb4, 0x22, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x72, 0x7b, 0x00, 0x14, 0x8a, 0x18, 0x30, 0xb4,
-  0x13, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0xa6, 0x11, 0xfe, 0xe7,
-  0x69, 0x89, 0x40, 0xb4, 0x15, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0xa3, 0x6e, 0x29, 0xcf, 0x53, 0xdb, 0x40, 0xb4, 0x4f, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0x37, 0x3a, 0xd8, 0x80, 0x41, 0x31, 0x4b, 0xb4,
-  0x4f, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x37, 0x3a, 0xd8, 0x80,
-  0x41, 0x31, 0x4b, 0xb4, 0x29, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x37, 0x3a, 0xd8, 0x80, 0x41, 0x31, 0x4b, 0xb4, 0x4f, 0x00, 0x00, 0x00,
-  0x2b, 0x00, 0x00, 0x00, 0x51, 0x6e, 0x5c, 0x07, 0xd5, 0x4a, 0x66, 0xb4,
-  0x44, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xf4, 0x15, 0x37, 0xec,
-  0x6e, 0x52, 0xb5, 0xb4, 0x3a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0xf4, 0x15, 0x37, 0xec, 0x6e, 0x52, 0xb5, 0xb4, 0x39, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0x32, 0xdf, 0x3f, 0x0b, 0xc8, 0x24, 0xc2, 0xb4,
-  0x16, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x32, 0xdf, 0x3f, 0x0b,
-  0xc8, 0x24, 0xc2, 0xb4, 0x16, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
-  0x35, 0x61, 0x53, 0xe0, 0xdb, 0x00, 0xc9, 0xb4, 0x3b, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xa2, 0x8a, 0xcf, 0x4c, 0x49, 0x0b, 0xca, 0xb4,
-  0x29, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x75, 0x63, 0x8c, 0x1c,
-  0x1a, 0xbf, 0xf7, 0xb4, 0x27, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x73, 0x5c, 0xeb, 0x32, 0xc4, 0x8a, 0x05, 0xb5, 0x25, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x19, 0xba, 0x9a, 0xf2, 0x20, 0x6c, 0x16, 0xb5,
-  0x26, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x28, 0x60, 0xb6, 0x90,
-  0x1a, 0xe4, 0x17, 0xb5, 0x2f, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0xe0, 0xde, 0xf9, 0x7e, 0x51, 0x41, 0x1c, 0xb5, 0x14, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0xac, 0x77, 0x66, 0x18, 0xa8, 0x2c, 0x2c, 0xb5,
-  0x15, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x7f, 0x1c, 0x84, 0x46,
-  0x46, 0x07, 0x31, 0xb5, 0x16, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x1c, 0xc9, 0x6a, 0x67, 0xfe, 0x3c, 0x49, 0xb5, 0x39, 0x00, 0x00, 0x00,
-  0x3d, 0x00, 0x00, 0x00, 0x92, 0x1d, 0x12, 0x13, 0x6a, 0xea, 0x79, 0xb5,
-  0x39, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x11, 0xda, 0xf4, 0x38,
-  0x61, 0x8c, 0x7a, 0xb5, 0x34, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
-  0xd3, 0x39, 0x28, 0xe4, 0xd6, 0x59, 0xd0, 0xb5, 0x29, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x8b, 0x68, 0x71, 0x51, 0x0b, 0x8e, 0xd1, 0xb5,
-  0x2b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x96, 0xd4, 0x94, 0xee,
-  0x92, 0x0a, 0xe9, 0xb5, 0x0b, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0x13, 0x6a, 0x8f, 0x5f, 0xb0, 0x57, 0xfa, 0xb5, 0x0a, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x65, 0xc5, 0x1f, 0xe5, 0xcc, 0x8d, 0x19, 0xb6,
-  0x34, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x6c, 0xb3, 0xe8, 0xb5,
-  0xd7, 0x35, 0x21, 0xb6, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x47, 0x3c, 0x8b, 0x67, 0xda, 0x6e, 0x27, 0xb6, 0x16, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x51, 0x26, 0xef, 0x05, 0xce, 0x2d, 0x2c, 0xb6,
-  0x44, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x51, 0x26, 0xef, 0x05,
-  0xce, 0x2d, 0x2c, 0xb6, 0x44, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0x22, 0xf9, 0xf8, 0x57, 0x75, 0x3b, 0x61, 0xb6, 0x3d, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x68, 0xd0, 0xfd, 0xa8, 0xf9, 0x39, 0x68, 0xb6,
-  0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2c, 0x8e, 0x62, 0xc0,
-  0x91, 0x75, 0x9d, 0xb6, 0x21, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
-  0x2c, 0x8e, 0x62, 0xc0, 0x91, 0x75, 0x9d, 0xb6, 0x21, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0x2a, 0x85, 0x53, 0x2a, 0xfa, 0x30, 0xc7, 0xb6,
-  0x3b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x2a, 0x85, 0x53, 0x2a,
-  0xfa, 0x30, 0xc7, 0xb6, 0x46, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0xda, 0xdc, 0xad, 0xe2, 0x96, 0xfd, 0xda, 0xb6, 0x26, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0x26, 0x49, 0x1b, 0x3c, 0x30, 0x59, 0xe0, 0xb6,
-  0x15, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x67, 0xf1, 0x30,
-  0x5d, 0x91, 0xeb, 0xb6, 0x0a, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x55, 0xbe, 0x72, 0x36, 0xdf, 0xf4, 0x09, 0xb7, 0x3d, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0xce, 0x7f, 0xed, 0x04, 0x6d, 0xcc, 0x10, 0xb7,
-  0x27, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xcf, 0x8a, 0x0e, 0xec,
-  0xcb, 0xd6, 0x72, 0xb7, 0x47, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0xb9, 0x37, 0x2f, 0x8c, 0x9d, 0x95, 0x77, 0xb7, 0x4f, 0x00, 0x00, 0x00,
-  0x46, 0x00, 0x00, 0x00, 0x53, 0x19, 0xd8, 0x5a, 0x12, 0xb0, 0x94, 0xb7,
-  0x1e, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x08, 0x68, 0x5e, 0x61,
-  0x3c, 0xf5, 0x9a, 0xb7, 0x3a, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0xb2, 0xeb, 0xca, 0x3a, 0x3c, 0x9f, 0xc7, 0xb7, 0x0b, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0xb2, 0xeb, 0xca, 0x3a, 0x3c, 0x9f, 0xc7, 0xb7,
-  0x1e, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0xbe, 0x5c, 0x4f, 0x78,
-  0x88, 0xcc, 0xce, 0xb7, 0x1e, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0xed, 0x1a, 0xe3, 0x2c, 0x79, 0x80, 0xff, 0xb7, 0x3a, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0xed, 0x1a, 0xe3, 0x2c, 0x79, 0x80, 0xff, 0xb7,
-  0x3e, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x33, 0x24, 0xf4, 0xe2,
-  0x10, 0xcf, 0x2c, 0xb8, 0x32, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x91, 0xad, 0x71, 0xab, 0x8f, 0xe9, 0x33, 0xb8, 0x1d, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0xcb, 0x6e, 0xd3, 0xac, 0xa6, 0xc6, 0x3e, 0xb8,
-  0x3c, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xe8, 0x4b, 0xf8, 0x71,
-  0x3c, 0xdf, 0x3f, 0xb8, 0x20, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x40, 0x5d, 0xd2, 0xd3, 0x01, 0xf4, 0x3f, 0xb8, 0x31, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0x40, 0x5d, 0xd2, 0xd3, 0x01, 0xf4, 0x3f, 0xb8,
-  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x5d, 0xd2, 0xd3,
-  0x01, 0xf4, 0x3f, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x40, 0x5d, 0xd2, 0xd3, 0x01, 0xf4, 0x3f, 0xb8, 0x15, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0xd0, 0x58, 0x11, 0x2b, 0x65, 0x47, 0x84, 0xb8,
-  0x1c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0c, 0x52, 0xa0, 0xa6,
-  0xc8, 0xcc, 0xc3, 0xb8, 0x21, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0x2a, 0xff, 0x93, 0x41, 0x80, 0xef, 0x09, 0xb9, 0x27, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0xc4, 0xc2, 0x51, 0xbb, 0x4e, 0x37, 0x0d, 0xb9,
-  0x18, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x7f, 0x56,
-  0x1f, 0x2b, 0x0f, 0xb9, 0x3d, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0x91, 0xcf, 0xfd, 0x88, 0xc2, 0xfb, 0x13, 0xb9, 0x13, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x86, 0x44, 0x75, 0x71, 0x2a, 0x5c, 0x56, 0xb9,
-  0x1d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x86, 0x44, 0x75, 0x71,
-  0x2a, 0x5c, 0x56, 0xb9, 0x17, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x83, 0x1c, 0x3a, 0x0a, 0xab, 0xd5, 0x57, 0xb9, 0x34, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0xc3, 0x85, 0x0a, 0x1c, 0x5c, 0xea, 0x76, 0xb9,
-  0x39, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0xf0, 0xf4, 0xff, 0x6c,
-  0xf1, 0xa9, 0xa0, 0xb9, 0x21, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x62, 0x45, 0x64, 0x48, 0x87, 0x83, 0xb6, 0xb9, 0x26, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x32, 0x68, 0x0b, 0xb6, 0xca, 0x1e, 0xba, 0xb9,
-  0x1c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x05, 0x4a, 0xbd, 0x93,
-  0xa2, 0x52, 0xba, 0xb9, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
-  0xed, 0xb9, 0xe8, 0x17, 0x2a, 0xca, 0xd5, 0xb9, 0x21, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0xa6, 0x8e, 0x85, 0x8b, 0x9c, 0x57, 0xe5, 0xb9,
-  0x45, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x4b, 0x6b, 0x3f, 0x6d,
-  0x35, 0xc6, 0xec, 0xb9, 0x14, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x17, 0x7b, 0xff, 0x76, 0xdc, 0x28, 0x07, 0xba, 0x20, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x21, 0xe7, 0xd4, 0x61, 0xcb, 0xec, 0x15, 0xba,
-  0x46, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x83, 0x89, 0xc2, 0x13,
-  0x86, 0x67, 0x4c, 0xba, 0x46, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0x35, 0x6d, 0x7c, 0x3d, 0xd3, 0xbb, 0x6d, 0xba, 0x44, 0x00, 0x00, 0x00,
-  0x3b, 0x00, 0x00, 0x00, 0x88, 0x24, 0x0c, 0x04, 0xcf, 0x60, 0x73, 0xba,
-  0x34, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x4a, 0xaf, 0x37, 0x58,
-  0x3d, 0x5a, 0x7a, 0xba, 0x32, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x3c, 0x29, 0x82, 0x2b, 0x6a, 0x34, 0xd3, 0xba, 0x29, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0xee, 0x4e, 0x5c, 0x7e, 0x5b, 0xea, 0xd3, 0xba,
-  0x15, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x90, 0x52, 0x72, 0x0a,
-  0x4e, 0x8d, 0xd9, 0xba, 0x29, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0xe3, 0x21, 0xc7, 0xb7, 0x49, 0xb8, 0x1d, 0xbb, 0x3c, 0x00, 0x00, 0x00,
-  0x3b, 0x00, 0x00, 0x00, 0x02, 0x9e, 0xa8, 0xaf, 0x1b, 0x88, 0x1e, 0xbb,
-  0x39, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x32, 0xb3, 0xc5, 0xc2,
-  0x53, 0xd2, 0x29, 0xbb, 0x0a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x5d, 0x30, 0x3f, 0x14, 0x37, 0xe8, 0x43, 0xbb, 0x2f, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0x5d, 0x30, 0x3f, 0x14, 0x37, 0xe8, 0x43, 0xbb,
-  0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xf7, 0x04, 0xf8, 0x12,
-  0xa9, 0xb5, 0x80, 0xbb, 0x01, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
-  0xf7, 0x04, 0xf8, 0x12, 0xa9, 0xb5, 0x80, 0xbb, 0x27, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x59, 0xe8, 0xc0, 0x6d, 0xf2, 0xf1, 0x88, 0xbb,
-  0x3a, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x83, 0x1f, 0x2f, 0x96,
-  0x4a, 0xba, 0x8b, 0xbb, 0x33, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x83, 0x1f, 0x2f, 0x96, 0x4a, 0xba, 0x8b, 0xbb, 0x2a, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x83, 0x1f, 0x2f, 0x96, 0x4a, 0xba, 0x8b, 0xbb,
-  0x29, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x83, 0x1f, 0x2f, 0x96,
-  0x4a, 0xba, 0x8b, 0xbb, 0x2f, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
-  0x83, 0x1f, 0x2f, 0x96, 0x4a, 0xba, 0x8b, 0xbb, 0x3d, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0x46, 0x25, 0xb0, 0x32, 0xb8, 0x5d, 0xd1, 0xbb,
-  0x27, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x3e, 0xb2, 0x4f, 0xc7,
-  0xfc, 0x80, 0xe2, 0xbb, 0x3b, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0xca, 0xc8, 0x6b, 0xb5, 0x86, 0x8e, 0xe7, 0xbb, 0x0c, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0xca, 0xc8, 0x6b, 0xb5, 0x86, 0x8e, 0xe7, 0xbb,
-  0x1c, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xca, 0xc8, 0x6b, 0xb5,
-  0x86, 0x8e, 0xe7, 0xbb, 0x0c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
-  0x2d, 0x52, 0x95, 0xd4, 0x22, 0x9d, 0xf7, 0xbb, 0x16, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x6d, 0xcd, 0xd7, 0x37, 0xda, 0x3d, 0x18, 0xbc,
-  0x39, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x6d, 0xcd, 0xd7, 0x37,
-  0xda, 0x3d, 0x18, 0xbc, 0x3d, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0x6d, 0xcd, 0xd7, 0x37, 0xda, 0x3d, 0x18, 0xbc, 0x3d, 0x00, 0x00, 0x00,
-  0x25, 0x00, 0x00, 0x00, 0x6d, 0xcd, 0xd7, 0x37, 0xda, 0x3d, 0x18, 0xbc,
-  0x33, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x8e, 0x7b, 0xbe, 0x59,
-  0xdf, 0xe6, 0x1c, 0xbc, 0x3a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0xe0, 0x31, 0x20, 0x36, 0x30, 0x70, 0x4e, 0xbc, 0x3c, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x14, 0x2a, 0x20, 0x62, 0xd8, 0xb7, 0x57, 0xbc,
-  0x45, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x37, 0x54, 0x6e, 0x18,
-  0x24, 0x8c, 0x5e, 0xbc, 0x38, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0x08, 0xd2, 0x39, 0x55, 0x73, 0x2c, 0x80, 0xbc, 0x02, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0xd0, 0xc3, 0xb1, 0x3c, 0xdd, 0x3a, 0xb4, 0xbc,
-  0x29, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0xda, 0x66, 0x53, 0x79,
-  0x83, 0x18, 0xb7, 0xbc, 0x14, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x6c, 0x47, 0x1c, 0x50, 0x23, 0x5a, 0xc2, 0xbc, 0x0c, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x8d, 0xcb, 0xf1, 0x84, 0x95, 0x91, 0xcc, 0xbc,
-  0x21, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xcc, 0x4a, 0xc1, 0x9b,
-  0xeb, 0xdd, 0x08, 0xbd, 0x28, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
-  0x95, 0xe1, 0xee, 0xd0, 0xcf, 0xc4, 0x18, 0xbd, 0x3a, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x58, 0x4e, 0x2b, 0x71, 0x99, 0x6f, 0x19, 0xbd,
-  0x3c, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x15, 0xab, 0xcf, 0x51,
-  0xb5, 0x3d, 0x1c, 0xbd, 0x33, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0xbb, 0x0c, 0x9c, 0xb8, 0x73, 0x33, 0x2e, 0xbd, 0x4e, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x52, 0xcc, 0x04, 0xcd, 0x2f, 0xb3, 0x69, 0xbd,
-  0x35, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x52, 0xcc, 0x04, 0xcd,
-  0x2f, 0xb3, 0x69, 0xbd, 0x3d, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0x52, 0xcc, 0x04, 0xcd, 0x2f, 0xb3, 0x69, 0xbd, 0x35, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x52, 0xcc, 0x04, 0xcd, 0x2f, 0xb3, 0x69, 0xbd,
-  0x3d, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x52, 0xcc, 0x04, 0xcd,
-  0x2f, 0xb3, 0x69, 0xbd, 0x4d, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x52, 0xcc, 0x04, 0xcd, 0x2f, 0xb3, 0x69, 0xbd, 0x35, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x52, 0xcc, 0x04, 0xcd, 0x2f, 0xb3, 0x69, 0xbd,
-  0x4d, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x52, 0xcc, 0x04, 0xcd,
-  0x2f, 0xb3, 0x69, 0xbd, 0x35, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0x52, 0xcc, 0x04, 0xcd, 0x2f, 0xb3, 0x69, 0xbd, 0x4d, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x52, 0xcc, 0x04, 0xcd, 0x2f, 0xb3, 0x69, 0xbd,
-  0x35, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x52, 0xcc, 0x04, 0xcd,
-  0x2f, 0xb3, 0x69, 0xbd, 0x3e, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x52, 0xcc, 0x04, 0xcd, 0x2f, 0xb3, 0x69, 0xbd, 0x35, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x52, 0xcc, 0x04, 0xcd, 0x2f, 0xb3, 0x69, 0xbd,
-  0x3d, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x52, 0xcc, 0x04, 0xcd,
-  0x2f, 0xb3, 0x69, 0xbd, 0x4d, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x52, 0xcc, 0x04, 0xcd, 0x2f, 0xb3, 0x69, 0xbd, 0x46, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x52, 0xcc, 0x04, 0xcd, 0x2f, 0xb3, 0x69, 0xbd,
-  0x35, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x52, 0xcc, 0x04, 0xcd,
-  0x2f, 0xb3, 0x69, 0xbd, 0x3d, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0x52, 0xcc, 0x04, 0xcd, 0x2f, 0xb3, 0x69, 0xbd, 0x35, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x52, 0xcc, 0x04, 0xcd, 0x2f, 0xb3, 0x69, 0xbd,
-  0x4d, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x52, 0xcc, 0x04, 0xcd,
-  0x2f, 0xb3, 0x69, 0xbd, 0x35, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0x52, 0xcc, 0x04, 0xcd, 0x2f, 0xb3, 0x69, 0xbd, 0x4d, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x52, 0xcc, 0x04, 0xcd, 0x2f, 0xb3, 0x69, 0xbd,
-  0x35, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x52, 0xcc, 0x04, 0xcd,
-  0x2f, 0xb3, 0x69, 0xbd, 0x4d, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x52, 0xcc, 0x04, 0xcd, 0x2f, 0xb3, 0x69, 0xbd, 0x3d, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x52, 0xcc, 0x04, 0xcd, 0x2f, 0xb3, 0x69, 0xbd,
-  0x4d, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x52, 0xcc, 0x04, 0xcd,
-  0x2f, 0xb3, 0x69, 0xbd, 0x35, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0x52, 0xcc, 0x04, 0xcd, 0x2f, 0xb3, 0x69, 0xbd, 0x3d, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x52, 0xcc, 0x04, 0xcd, 0x2f, 0xb3, 0x69, 0xbd,
-  0x35, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x4d, 0x48, 0x43, 0x01,
-  0xe6, 0xc8, 0x6d, 0xbd, 0x20, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x2a, 0x6b, 0x45, 0x9f, 0xec, 0xa8, 0x78, 0xbd, 0x4e, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x2a, 0x6b, 0x45, 0x9f, 0xec, 0xa8, 0x78, 0xbd,
-  0x3d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x2a, 0x6b, 0x45, 0x9f,
-  0xec, 0xa8, 0x78, 0xbd, 0x4e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0x2a, 0x6b, 0x45, 0x9f, 0xec, 0xa8, 0x78, 0xbd, 0x3e, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x1c, 0xe4, 0xa8, 0x33, 0x3c, 0x68, 0x84, 0xbd,
-  0x3e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0xa7, 0x08, 0xac, 0x8b,
-  0xe6, 0x87, 0xbb, 0xbd, 0x3b, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x2d, 0x85, 0xc8, 0xeb, 0xe6, 0xcc, 0x11, 0xbe, 0x14, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x9f, 0xda, 0x57, 0x2d, 0x25, 0x04, 0x2b, 0xbe,
-  0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x65, 0x3b, 0x42, 0xae,
-  0x91, 0xa9, 0x56, 0xbe, 0x13, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0x11, 0x52, 0x58, 0xb8, 0xdd, 0x99, 0x58, 0xbe, 0x46, 0x00, 0x00, 0x00,
-  0x45, 0x00, 0x00, 0x00, 0xa1, 0x3c, 0x5c, 0x8e, 0x2f, 0x72, 0x81, 0xbe,
-  0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x71, 0x61, 0xac, 0x8e,
-  0xc9, 0x88, 0x86, 0xbe, 0x28, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x4d, 0xcc, 0x0a, 0xe6, 0xbd, 0x68, 0x87, 0xbe, 0x0b, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0xc3, 0x9f, 0x3e, 0x63, 0x0c, 0x24, 0xae, 0xbe,
-  0x33, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x6c, 0x09, 0x51, 0x5f,
-  0x70, 0x65, 0xb1, 0xbe, 0x4d, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0x6c, 0x09, 0x51, 0x5f, 0x70, 0x65, 0xb1, 0xbe, 0x4d, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0x6c, 0x09, 0x51, 0x5f, 0x70, 0x65, 0xb1, 0xbe,
-  0x4d, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x1b, 0xe0, 0x60, 0xfe,
-  0xac, 0x1c, 0xcc, 0xbe, 0x3d, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0xac, 0x97, 0xd0, 0x79, 0x47, 0x71, 0xdd, 0xbe, 0x22, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0xac, 0x97, 0xd0, 0x79, 0x47, 0x71, 0xdd, 0xbe,
-  0x33, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x33, 0x13, 0x81, 0xd3,
-  0xac, 0x83, 0xee, 0xbe, 0x17, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0x46, 0x87, 0x9e, 0xc6, 0xf9, 0xdc, 0x11, 0xbf, 0x1b, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x51, 0x98, 0x0c, 0xe5, 0x4f, 0x8d, 0x31, 0xbf,
-  0x3d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x51, 0x98, 0x0c, 0xe5,
-  0x4f, 0x8d, 0x31, 0xbf, 0x3d, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0x51, 0x98, 0x0c, 0xe5, 0x4f, 0x8d, 0x31, 0xbf, 0x3d, 0x00, 0x00, 0x00,
-  0x3b, 0x00, 0x00, 0x00, 0x51, 0x98, 0x0c, 0xe5, 0x4f, 0x8d, 0x31, 0xbf,
-  0x3d, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x51, 0x98, 0x0c, 0xe5,
-  0x4f, 0x8d, 0x31, 0xbf, 0x3d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-  0x51, 0x98, 0x0c, 0xe5, 0x4f, 0x8d, 0x31, 0xbf, 0x3d, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0x51, 0x98, 0x0c, 0xe5, 0x4f, 0x8d, 0x31, 0xbf,
-  0x3d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0xd3, 0xfe, 0x54, 0x1f,
-  0xcd, 0x5c, 0x38, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
-  0xd3, 0xfe, 0x54, 0x1f, 0xcd, 0x5c, 0x38, 0xbf, 0x16, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0xd3, 0xfe, 0x54, 0x1f, 0xcd, 0x5c, 0x38, 0xbf,
-  0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0xd3, 0xfe, 0x54, 0x1f,
-  0xcd, 0x5c, 0x38, 0xbf, 0x16, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0xd3, 0xfe, 0x54, 0x1f, 0xcd, 0x5c, 0x38, 0xbf, 0x00, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0x3e, 0x8a, 0xb4, 0xcc, 0x7e, 0x8c, 0x4b, 0xbf,
-  0x26, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3e, 0x8a, 0xb4, 0xcc,
-  0x7e, 0x8c, 0x4b, 0xbf, 0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x0f, 0x24, 0x2b, 0xaa, 0x98, 0x4f, 0x58, 0xbf, 0x39, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0xa1, 0xa2, 0x7f, 0xd3, 0x66, 0x31, 0x6b, 0xbf,
-  0x25, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xa1, 0xa2, 0x7f, 0xd3,
-  0x66, 0x31, 0x6b, 0xbf, 0x1d, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x32, 0x0f, 0x01, 0x72, 0x73, 0x2c, 0x85, 0xbf, 0x34, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0xbd, 0x6a, 0x46, 0x69, 0x6b, 0xea, 0x8b, 0xbf,
-  0x2e, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x92, 0x91, 0x7e, 0xbc,
-  0x78, 0xd8, 0x8e, 0xbf, 0x29, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0x93, 0x7f, 0x9e, 0xc1, 0xcb, 0x88, 0x99, 0xbf, 0x0b, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x9f, 0x9e, 0x33, 0x45, 0x0f, 0x2c, 0x9d, 0xbf,
-  0x4f, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0xcc, 0x97, 0x40, 0x02,
-  0xc8, 0xd4, 0xae, 0xbf, 0x45, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00,
-  0xcc, 0x97, 0x40, 0x02, 0xc8, 0xd4, 0xae, 0xbf, 0x45, 0x00, 0x00, 0x00,
-  0x46, 0x00, 0x00, 0x00, 0xec, 0x05, 0xf0, 0x60, 0x55, 0x55, 0xb2, 0xbf,
-  0x1d, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0xec, 0x05, 0xf0, 0x60,
-  0x55, 0x55, 0xb2, 0xbf, 0x1d, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0xec, 0x05, 0xf0, 0x60, 0x55, 0x55, 0xb2, 0xbf, 0x1d, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0xec, 0x05, 0xf0, 0x60, 0x55, 0x55, 0xb2, 0xbf,
-  0x1c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xec, 0x05, 0xf0, 0x60,
-  0x55, 0x55, 0xb2, 0xbf, 0x1d, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
-  0xec, 0x05, 0xf0, 0x60, 0x55, 0x55, 0xb2, 0xbf, 0x1d, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0xec, 0x05, 0xf0, 0x60, 0x55, 0x55, 0xb2, 0xbf,
-  0x1d, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0xec, 0x05, 0xf0, 0x60,
-  0x55, 0x55, 0xb2, 0xbf, 0x1d, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0xbb, 0x31, 0x12, 0xee, 0xb3, 0x07, 0x06, 0xc0, 0x3e, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0x1f, 0x3b, 0xd8, 0x3a, 0x6b, 0xdf, 0x1e, 0xc0,
-  0x45, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xa7, 0x56, 0xc5, 0xef,
-  0x7b, 0xa6, 0x23, 0xc0, 0x14, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0xd9, 0xce, 0x63, 0x00, 0x31, 0x9b, 0x6e, 0xc0, 0x27, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0xc3, 0x74, 0x4c, 0x0c, 0xc8, 0xc2, 0x74, 0xc0,
-  0x3c, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x7f, 0xd1, 0xa2, 0xaa,
-  0xb1, 0xdc, 0xc5, 0xc0, 0x34, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x5b, 0xd0, 0x21, 0xe6, 0x6d, 0x94, 0xe3, 0xc0, 0x09, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0xb3, 0x49, 0x26, 0xfe, 0xe9, 0x5f, 0xec, 0xc0,
-  0x20, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xb3, 0x49, 0x26, 0xfe,
-  0xe9, 0x5f, 0xec, 0xc0, 0x2b, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x3f, 0xc0, 0xcd, 0x8a, 0xf0, 0x02, 0x21, 0xc1, 0x33, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0xd9, 0x04, 0x72, 0x4e, 0x75, 0x99, 0x2b, 0xc1,
-  0x17, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x21, 0x51, 0xdf, 0x1b,
-  0xc6, 0x1e, 0x3a, 0xc1, 0x29, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0xe2, 0xe3, 0x63, 0x3b, 0x61, 0xde, 0x3e, 0xc1, 0x31, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x5d, 0x68, 0x44, 0x6c, 0x12, 0xb8, 0x47, 0xc1,
-  0x17, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x38, 0xf9, 0x0d, 0x55,
-  0xc3, 0xbb, 0x5e, 0xc1, 0x1d, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00,
-  0x38, 0xf9, 0x0d, 0x55, 0xc3, 0xbb, 0x5e, 0xc1, 0x27, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0x9d, 0xfa, 0x44, 0x9a, 0x24, 0x8d, 0x8d, 0xc1,
-  0x2a, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x9d, 0xfa, 0x44, 0x9a,
-  0x24, 0x8d, 0x8d, 0xc1, 0x34, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
-  0x9d, 0xfa, 0x44, 0x9a, 0x24, 0x8d, 0x8d, 0xc1, 0x3a, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x01, 0x18, 0x33, 0xf0, 0x52, 0xda, 0xb3, 0xc1,
-  0x30, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x1b, 0x67, 0x4e, 0x5e,
-  0x64, 0xfa, 0xbb, 0xc1, 0x2a, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x1b, 0x67, 0x4e, 0x5e, 0x64, 0xfa, 0xbb, 0xc1, 0x3c, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0x14, 0xf3, 0xf4, 0x7c, 0xc1, 0xf6, 0xc9, 0xc1,
-  0x30, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x14, 0xf3, 0xf4, 0x7c,
-  0xc1, 0xf6, 0xc9, 0xc1, 0x0c, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
-  0xdf, 0xe3, 0xe2, 0x95, 0xe4, 0xa6, 0x26, 0xc2, 0x3b, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0x88, 0x5f, 0xfc, 0x9a, 0x74, 0x79, 0x33, 0xc2,
-  0x26, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x3a, 0xa9, 0xc4, 0x5e,
-  0x9c, 0x6e, 0x59, 0xc2, 0x44, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0xb3, 0x43, 0x3e, 0x6e, 0x68, 0xbd, 0x67, 0xc2, 0x33, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0xb3, 0x43, 0x3e, 0x6e, 0x68, 0xbd, 0x67, 0xc2,
-  0x29, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x51, 0x2f,
-  0x79, 0xae, 0x6c, 0xc2, 0x3d, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0x2c, 0xa9, 0xe5, 0x42, 0xbb, 0xd0, 0x73, 0xc2, 0x0b, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x0f, 0xdf, 0x6e, 0x71, 0x8c, 0x3a, 0x7c, 0xc2,
-  0x16, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x8e, 0x7f, 0xdd, 0xb4,
-  0x7d, 0x53, 0x93, 0xc2, 0x13, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
-  0xc2, 0x8c, 0xf4, 0xaa, 0x30, 0xff, 0xdd, 0xc2, 0x1c, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0xde, 0x96, 0x24, 0x9d, 0x88, 0x0b, 0x4a, 0xc3,
-  0x33, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0xb1, 0x2b, 0xeb, 0x3b,
-  0xda, 0x2f, 0x5e, 0xc3, 0x15, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-  0x32, 0x10, 0xb6, 0x20, 0x1a, 0xfe, 0x6c, 0xc3, 0x26, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x32, 0x10, 0xb6, 0x20, 0x1a, 0xfe, 0x6c, 0xc3,
-  0x30, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x32, 0x10, 0xb6, 0x20,
-  0x1a, 0xfe, 0x6c, 0xc3, 0x26, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0x5d, 0x19, 0xd8, 0x46, 0x92, 0x49, 0xd4, 0xc3, 0x2a, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0x2c, 0xdb, 0x66, 0xe5, 0x73, 0xf1, 0xdd, 0xc3,
-  0x25, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x2c, 0xdb, 0x66, 0xe5,
-  0x73, 0xf1, 0xdd, 0xc3, 0x0b, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0xff, 0xfb, 0x10, 0x5e, 0x6b, 0x22, 0xeb, 0xc3, 0x4e, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x04, 0xd2, 0x3c, 0x7e, 0x22, 0x56, 0xf1, 0xc3,
-  0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x9e, 0x6b, 0xee, 0x1d,
-  0x03, 0xf6, 0xfb, 0xc3, 0x30, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
-  0x6b, 0x62, 0xaa, 0x00, 0xb5, 0x58, 0x24, 0xc4, 0x31, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x1e, 0xc5, 0xca, 0xb5, 0xa9, 0x52, 0x4f, 0xc4,
-  0x13, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x01, 0x01, 0xf7, 0x0f,
-  0x64, 0x90, 0x95, 0xc4, 0x0c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0xf0, 0xf5, 0xb1, 0x87, 0x8a, 0x11, 0x9a, 0xc4, 0x2f, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x1f, 0x83, 0xec, 0xd2, 0x85, 0xd7, 0xc1, 0xc4,
-  0x3b, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x5f, 0x8e, 0xa9, 0xfc,
-  0x11, 0xa2, 0xce, 0xc4, 0x26, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x41, 0x01, 0x7c, 0x70, 0xe2, 0x7b, 0xdb, 0xc4, 0x31, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x0c, 0x14, 0x15, 0x42, 0x51, 0x24, 0xe4, 0xc4,
-  0x34, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x43, 0xd0, 0x84, 0x59,
-  0xc1, 0x5b, 0xea, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x43, 0xd0, 0x84, 0x59, 0xc1, 0x5b, 0xea, 0xc4, 0x26, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x43, 0xd0, 0x84, 0x59, 0xc1, 0x5b, 0xea, 0xc4,
-  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x43, 0xd0, 0x84, 0x59,
-  0xc1, 0x5b, 0xea, 0xc4, 0x28, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x43, 0xd0, 0x84, 0x59, 0xc1, 0x5b, 0xea, 0xc4, 0x26, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x43, 0xd0, 0x84, 0x59, 0xc1, 0x5b, 0xea, 0xc4,
-  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x90, 0x4d, 0x9d, 0x85,
-  0x0c, 0xd9, 0xf0, 0xc4, 0x3a, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x2a, 0x5f, 0x7d, 0x1f, 0x18, 0xaa, 0xf9, 0xc4, 0x3e, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x2e, 0x8b, 0xf4, 0x3f, 0xec, 0x0e, 0x0c, 0xc5,
-  0x38, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x7f, 0x84, 0x88, 0x37,
-  0xb7, 0x12, 0x13, 0xc5, 0x47, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
-  0xeb, 0xf2, 0x1c, 0x57, 0x65, 0x80, 0x36, 0xc5, 0x0b, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x94, 0x14, 0x15, 0x09, 0x21, 0xf6, 0x4b, 0xc5,
-  0x15, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x3d, 0xd8, 0xb1, 0x12,
-  0x65, 0x7d, 0x61, 0xc5, 0x45, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
-  0x6a, 0xa2, 0x6c, 0xc8, 0xda, 0xff, 0x75, 0xc5, 0x1c, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0xf9, 0x73, 0x9c, 0xe4, 0x0c, 0xd2, 0x7b, 0xc5,
-  0x45, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0xe5, 0xb3, 0xb2, 0x20,
-  0x57, 0x9a, 0x86, 0xc5, 0x3c, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
-  0xe5, 0xb3, 0xb2, 0x20, 0x57, 0x9a, 0x86, 0xc5, 0x2a, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x02, 0xbf, 0x60, 0x7b, 0x84, 0xf5, 0xc4, 0xc5,
-  0x02, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x75, 0x08, 0x72, 0xde,
-  0x06, 0x58, 0xc7, 0xc5, 0x2f, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x50, 0x19, 0xc5, 0x44, 0xae, 0x5f, 0xd8, 0xc5, 0x3c, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0x50, 0x19, 0xc5, 0x44, 0xae, 0x5f, 0xd8, 0xc5,
-  0x34, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1c, 0x43, 0x35, 0xed,
-  0x74, 0x90, 0xd8, 0xc5, 0x27, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-  0x80, 0x46, 0x00, 0x1f, 0xce, 0x69, 0xe4, 0xc5, 0x2a, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x59, 0xc9, 0x4e, 0x85, 0x84, 0x9f, 0xf3, 0xc5,
-  0x3c, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xd4, 0x85, 0x4a, 0xae,
-  0x94, 0x47, 0xfd, 0xc5, 0x46, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x27, 0x02, 0x2c, 0xb9, 0xfb, 0xcd, 0x04, 0xc6, 0x46, 0x00, 0x00, 0x00,
-  0x3d, 0x00, 0x00, 0x00, 0xa8, 0xc9, 0x61, 0x0d, 0xca, 0x86, 0x29, 0xc6,
-  0x2a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x55, 0xa5, 0x27, 0x44,
-  0x47, 0x8e, 0x2b, 0xc6, 0x30, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0x03, 0x11, 0x34, 0x33, 0x09, 0xc5, 0x62, 0xc6, 0x1c, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x4d, 0xbc, 0x11, 0xfc, 0x85, 0x75, 0x77, 0xc6,
-  0x2a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x4d, 0xbc, 0x11, 0xfc,
-  0x85, 0x75, 0x77, 0xc6, 0x3e, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x4d, 0xbc, 0x11, 0xfc, 0x85, 0x75, 0x77, 0xc6, 0x46, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x4d, 0xbc, 0x11, 0xfc, 0x85, 0x75, 0x77, 0xc6,
-  0x3e, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x4d, 0xbc, 0x11, 0xfc,
-  0x85, 0x75, 0x77, 0xc6, 0x3a, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x4d, 0xbc, 0x11, 0xfc, 0x85, 0x75, 0x77, 0xc6, 0x3e, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x38, 0x1b, 0x4e, 0xc5, 0xe5, 0x72, 0x8b, 0xc6,
-  0x22, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0xd9, 0x6c, 0xfd, 0x07,
-  0x2d, 0x6c, 0x9f, 0xc6, 0x1b, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0x31, 0x09, 0xaf, 0xa4, 0xcf, 0x53, 0xd7, 0xc6, 0x1f, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x01, 0x3b, 0xd3, 0xa5, 0x61, 0x4c, 0xdb, 0xc6,
-  0x25, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0xf6, 0xc1, 0x71, 0xde,
-  0x4f, 0xab, 0x09, 0xc7, 0x35, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0xd4, 0x9b, 0x52, 0x8f, 0xd0, 0x30, 0x0f, 0xc7, 0x3a, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0xd4, 0x9b, 0x52, 0x8f, 0xd0, 0x30, 0x0f, 0xc7,
-  0x2b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0xd4, 0x9b, 0x52, 0x8f,
-  0xd0, 0x30, 0x0f, 0xc7, 0x28, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x51, 0x0b, 0xd5, 0x0d, 0xd5, 0xf0, 0x36, 0xc7, 0x01, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x16, 0x18, 0x78, 0x37, 0x88, 0x5c, 0x3a, 0xc7,
-  0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x16, 0x18, 0x78, 0x37,
-  0x88, 0x5c, 0x3a, 0xc7, 0x33, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00,
-  0xd0, 0x45, 0xa7, 0xae, 0xfc, 0xc7, 0x4e, 0xc7, 0x03, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0xd0, 0x45, 0xa7, 0xae, 0xfc, 0xc7, 0x4e, 0xc7,
-  0x03, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x83, 0xed, 0x37, 0xb6,
-  0xd2, 0x89, 0xd1, 0xc7, 0x1f, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x43, 0xd3, 0x0a, 0xf9, 0x16, 0x25, 0xdc, 0xc7, 0x4e, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x43, 0xd3, 0x0a, 0xf9, 0x16, 0x25, 0xdc, 0xc7,
-  0x3e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x43, 0xd3, 0x0a, 0xf9,
-  0x16, 0x25, 0xdc, 0xc7, 0x4e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0x43, 0xd3, 0x0a, 0xf9, 0x16, 0x25, 0xdc, 0xc7, 0x3e, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x43, 0xd3, 0x0a, 0xf9, 0x16, 0x25, 0xdc, 0xc7,
-  0x4e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x43, 0xd3, 0x0a, 0xf9,
-  0x16, 0x25, 0xdc, 0xc7, 0x3e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0x43, 0xd3, 0x0a, 0xf9, 0x16, 0x25, 0xdc, 0xc7, 0x4e, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x66, 0x89, 0x28, 0x8e, 0xc7, 0x66, 0xfc, 0xc7,
-  0x3a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x78, 0x00, 0xf5, 0x2b,
-  0x91, 0x41, 0x14, 0xc8, 0x1c, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0xaf, 0xcb, 0xac, 0xe3, 0xbc, 0x2c, 0x17, 0xc8, 0x47, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0xc1, 0x84, 0x22, 0xa1, 0x5d, 0xf5, 0x18, 0xc8,
-  0x46, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x75, 0xa2, 0xcf, 0xf8,
-  0xd9, 0x40, 0x20, 0xc8, 0x26, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x72, 0x4b, 0x96, 0x75, 0x54, 0xf5, 0x4c, 0xc8, 0x3b, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x7f, 0x25, 0x58, 0x78, 0x89, 0xac, 0x61, 0xc8,
-  0x47, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x7f, 0x25, 0x58, 0x78,
-  0x89, 0xac, 0x61, 0xc8, 0x0c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0xaf, 0x55, 0x66, 0x98, 0xcf, 0x96, 0xb6, 0xc8, 0x0b, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0xc9, 0x08, 0xad, 0xd3, 0xac, 0x82, 0xd4, 0xc8,
-  0x12, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x58, 0x20, 0x8c, 0xee,
-  0x3f, 0xc2, 0x3e, 0xc9, 0x45, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
-  0xa1, 0x49, 0x26, 0x4e, 0x45, 0x17, 0x45, 0xc9, 0x21, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x17, 0x30, 0xcc, 0xaa, 0x7e, 0xbd, 0x62, 0xc9,
-  0x1c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x51, 0x38, 0xf1, 0x10,
-  0x19, 0xf0, 0x75, 0xc9, 0x4f, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0xce, 0x79, 0x1b, 0x08, 0x40, 0xaf, 0x7e, 0xc9, 0x3c, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0xb7, 0xda, 0x51, 0xd1, 0xe8, 0x67, 0xb0, 0xc9,
-  0x33, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x09, 0x5c, 0x0e, 0x80,
-  0xf9, 0xf9, 0xbb, 0xc9, 0x25, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
-  0xa6, 0x22, 0x7b, 0x65, 0x80, 0x77, 0xd1, 0xc9, 0x16, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x8e, 0x69, 0xd7, 0xd2, 0x9c, 0xdc, 0xd1, 0xc9,
-  0x45, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0xd8, 0xb4, 0x66, 0xe7,
-  0xaf, 0x34, 0x01, 0xca, 0x15, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0x84, 0x84, 0xc8, 0xfd, 0x17, 0x6b, 0x05, 0xca, 0x21, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0xed, 0x25, 0x82, 0x22, 0x66, 0xd9, 0x07, 0xca,
-  0x1c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x82, 0x81, 0x57, 0xc3,
-  0x18, 0xba, 0x13, 0xca, 0x3e, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
-  0x04, 0x93, 0x92, 0x11, 0x91, 0x07, 0x1e, 0xca, 0x50, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x04, 0x93, 0x92, 0x11, 0x91, 0x07, 0x1e, 0xca,
-  0x3a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x04, 0x93, 0x92, 0x11,
-  0x91, 0x07, 0x1e, 0xca, 0x50, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0x04, 0x93, 0x92, 0x11, 0x91, 0x07, 0x1e, 0xca, 0x3a, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0xdc, 0x5b, 0xc5, 0x0e, 0xc9, 0x97, 0x2e, 0xca,
-  0x4d, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x4c, 0x22, 0x99, 0x0e,
-  0xdb, 0x31, 0x44, 0xca, 0x2a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0xe0, 0x30, 0x60, 0x6f, 0x53, 0x6d, 0x76, 0xca, 0x34, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x85, 0x43, 0x8d, 0x6f, 0x82, 0x21, 0x8a, 0xca,
-  0x4e, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x28, 0x1f, 0x87, 0x61,
-  0xde, 0x6d, 0x93, 0xca, 0x09, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0xda, 0x3f, 0xb3, 0x5a, 0x84, 0xd8, 0x9b, 0xca, 0x33, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0xa8, 0xd8, 0x61, 0x95, 0x9b, 0xd1, 0x9d, 0xca,
-  0x35, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xe6, 0x4f, 0xec, 0xe4,
-  0x2f, 0x2e, 0x06, 0xcb, 0x4f, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
-  0x6d, 0xfc, 0x45, 0xdf, 0x3c, 0xab, 0x07, 0xcb, 0x1f, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x55, 0x22, 0xfa, 0xc7, 0x8b, 0x33, 0x15, 0xcb,
-  0x0c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x8c, 0x46, 0x44, 0x0e,
-  0x3a, 0xff, 0x30, 0xcb, 0x33, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x16, 0xd1, 0xab, 0x41, 0x1d, 0x8b, 0x6e, 0xcb, 0x3a, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xa4, 0x39, 0x0c, 0x62, 0x97, 0xcb,
-  0x0a, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0xde, 0x87, 0x62,
-  0xcc, 0x6d, 0x99, 0xcb, 0x3a, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x92, 0x10, 0x57, 0x2a, 0x77, 0x9e, 0xa0, 0xcb, 0x12, 0x00, 0x00, 0x00,
-  0x1b, 0x00, 0x00, 0x00, 0x95, 0x28, 0xe4, 0xf8, 0xfe, 0x3e, 0xa6, 0xcb,
-  0x26, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x2e, 0x5a, 0x9a, 0xa5,
-  0x7c, 0x84, 0xdd, 0xcb, 0x2b, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0xbb, 0xc1, 0xc9, 0x3c, 0xd8, 0x1c, 0x0e, 0xcc, 0x1c, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x90, 0x92, 0x63, 0x5a, 0xe1, 0xbc, 0x15, 0xcc,
-  0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x94, 0x26, 0xd9, 0x72,
-  0x13, 0x84, 0x43, 0xcc, 0x4f, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-  0x26, 0x2e, 0x80, 0xa7, 0xc2, 0x46, 0x81, 0xcc, 0x14, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0xe4, 0x1d, 0x11, 0xf3, 0xb3, 0xbc, 0x87, 0xcc,
-  0x34, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x47, 0x23, 0xa2, 0xe5,
-  0x8c, 0x45, 0x8d, 0xcc, 0x27, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00,
-  0xb2, 0x0d, 0x56, 0xa3, 0x55, 0xa2, 0x8e, 0xcc, 0x1f, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0xb2, 0x0d, 0x56, 0xa3, 0x55, 0xa2, 0x8e, 0xcc,
-  0x09, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xb2, 0x0d, 0x56, 0xa3,
-  0x55, 0xa2, 0x8e, 0xcc, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0xb2, 0x0d, 0x56, 0xa3, 0x55, 0xa2, 0x8e, 0xcc, 0x1f, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x21, 0x74, 0xea, 0xa2, 0x7c, 0x5b, 0x94, 0xcc,
-  0x4e, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x0b, 0x43, 0xbe, 0xf4,
-  0xaf, 0xc5, 0xb6, 0xcc, 0x1f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0xcb, 0x61, 0x96, 0x83, 0xbc, 0x94, 0xf1, 0xcc, 0x13, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0x4d, 0x4e, 0xbe, 0xc9, 0x36, 0x98, 0xff, 0xcc,
-  0x45, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x4d, 0x4e, 0xbe, 0xc9,
-  0x36, 0x98, 0xff, 0xcc, 0x3b, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0xc3, 0x68, 0xb2, 0x25, 0x3a, 0x78, 0x30, 0xcd, 0x25, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0xc3, 0x68, 0xb2, 0x25, 0x3a, 0x78, 0x30, 0xcd,
-  0x28, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x11, 0x1a, 0xb7, 0xbc,
-  0xe9, 0xb8, 0x34, 0xcd, 0x33, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00,
-  0xcc, 0x2f, 0x02, 0x3c, 0xfc, 0xc4, 0x5a, 0xcd, 0x14, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0x2e, 0xaf, 0xe9, 0x81, 0x67, 0x61, 0x5e, 0xcd,
-  0x29, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x60, 0x4d, 0x7a, 0xd1,
-  0x91, 0x73, 0x87, 0xcd, 0x2f, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x60, 0x4d, 0x7a, 0xd1, 0x91, 0x73, 0x87, 0xcd, 0x15, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x60, 0x4d, 0x7a, 0xd1, 0x91, 0x73, 0x87, 0xcd,
-  0x31, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x60, 0x4d, 0x7a, 0xd1,
-  0x91, 0x73, 0x87, 0xcd, 0x14, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0xa3, 0xbd, 0xcb, 0xc2, 0x3c, 0xfd, 0x9a, 0xcd, 0x2b, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0xb0, 0x13, 0x36, 0x88, 0x9b, 0x29, 0xbb, 0xcd,
-  0x1e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xb0, 0x13, 0x36, 0x88,
-  0x9b, 0x29, 0xbb, 0xcd, 0x17, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0xb0, 0x13, 0x36, 0x88, 0x9b, 0x29, 0xbb, 0xcd, 0x0b, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x0c, 0xbc, 0x42, 0xde, 0x0b, 0xf5, 0xe0, 0xcd,
-  0x1d, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x54, 0x34, 0x12, 0xd1,
-  0x45, 0xee, 0xf0, 0xcd, 0x1d, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x66, 0x0d, 0x63, 0x6a, 0xa6, 0xe9, 0x02, 0xce, 0x3c, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x5f, 0x14, 0xcd, 0x95, 0x95, 0x0c, 0x23, 0xce,
-  0x26, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x5f, 0x14, 0xcd, 0x95,
-  0x95, 0x0c, 0x23, 0xce, 0x16, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x5f, 0x14, 0xcd, 0x95, 0x95, 0x0c, 0x23, 0xce, 0x1c, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x5f, 0x14, 0xcd, 0x95, 0x95, 0x0c, 0x23, 0xce,
-  0x20, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x9c, 0x4a, 0xd7, 0xb4,
-  0x76, 0xf0, 0x55, 0xce, 0x32, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x25, 0x6f, 0x27, 0x52, 0x4d, 0x38, 0x5f, 0xce, 0x28, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0x4e, 0x3d, 0x8d, 0x38, 0x15, 0xe3, 0x7e, 0xce,
-  0x12, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0a, 0xe4, 0x89, 0x33,
-  0x9c, 0x77, 0xa5, 0xce, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0xcd, 0x17, 0x59, 0x39, 0xaa, 0x1b, 0xc6, 0xce, 0x16, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0xb8, 0x04, 0x97, 0x82, 0x6d, 0xbd, 0xd0, 0xce,
-  0x25, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x29, 0x74, 0xfa, 0x38,
-  0x17, 0x9e, 0x0c, 0xcf, 0x27, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0xe6, 0xc7, 0xcc, 0x03, 0x2c, 0x07, 0x18, 0xcf, 0x29, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x14, 0x24, 0xbb, 0x7b, 0xa6, 0xf2, 0x49, 0xcf,
-  0x1c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x26, 0x7d, 0x51, 0x18,
-  0xa6, 0x9b, 0x56, 0xcf, 0x0b, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0x33, 0x53, 0xfa, 0x50, 0x4c, 0x60, 0x59, 0xcf, 0x30, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x33, 0x53, 0xfa, 0x50, 0x4c, 0x60, 0x59, 0xcf,
-  0x30, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x6b, 0x33, 0xb1, 0x06,
-  0x85, 0xf8, 0x62, 0xcf, 0x27, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x78, 0x40, 0x77, 0xbf, 0xc3, 0xcc, 0xbd, 0xcf, 0x20, 0x00, 0x00, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0xc5, 0x1d, 0xe2, 0x91, 0x80, 0xd0, 0xbd, 0xcf,
-  0x16, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xc5, 0x1d, 0xe2, 0x91,
-  0x80, 0xd0, 0xbd, 0xcf, 0x1d, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x0d, 0x96, 0xbc, 0x52, 0xf1, 0xde, 0xc2, 0xcf, 0x14, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0xfe, 0xb7, 0xf1, 0x68, 0x09, 0x31, 0xd7, 0xcf,
-  0x4f, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x33, 0x0c, 0xc3, 0x23,
-  0xec, 0xcb, 0xdb, 0xcf, 0x46, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
-  0xa1, 0x9d, 0x96, 0x0d, 0x0c, 0xcf, 0xdb, 0xcf, 0x46, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0xdc, 0x1a, 0xe5, 0xfd, 0x1b, 0x9e, 0xee, 0xcf,
-  0x3d, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x29, 0x3e, 0xe5, 0x47,
-  0xfe, 0x8a, 0xf6, 0xcf, 0x1c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0xdb, 0xc0, 0xe7, 0xaa, 0xc9, 0x2b, 0xfb, 0xcf, 0x13, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0xdb, 0xc0, 0xe7, 0xaa, 0xc9, 0x2b, 0xfb, 0xcf,
-  0x13, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0xdb, 0xc0, 0xe7, 0xaa,
-  0xc9, 0x2b, 0xfb, 0xcf, 0x13, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0xdb, 0xc0, 0xe7, 0xaa, 0xc9, 0x2b, 0xfb, 0xcf, 0x13, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0xac, 0xd9, 0xc9, 0x06, 0x47, 0x82, 0x02, 0xd0,
-  0x14, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x31, 0x11, 0x38, 0xfb,
-  0xdf, 0xb3, 0x2a, 0xd0, 0x28, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0xd7, 0xc6, 0xfc, 0xb0, 0xa9, 0x2e, 0x2b, 0xd0, 0x29, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x21, 0x82, 0x4b, 0xad, 0x6f, 0xde, 0x2c, 0xd0,
-  0x42, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0xce, 0x10, 0x95, 0x62,
-  0xc2, 0x91, 0x54, 0xd0, 0x1f, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x1c, 0xd9, 0x84, 0x46, 0x1d, 0x3e, 0x55, 0xd0, 0x16, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x22, 0x19, 0x74, 0xe0, 0xfa, 0xe5, 0xd9, 0xd0,
-  0x35, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x22, 0x19, 0x74, 0xe0,
-  0xfa, 0xe5, 0xd9, 0xd0, 0x4d, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x22, 0x19, 0x74, 0xe0, 0xfa, 0xe5, 0xd9, 0xd0, 0x35, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x22, 0x19, 0x74, 0xe0, 0xfa, 0xe5, 0xd9, 0xd0,
-  0x4d, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x22, 0x19, 0x74, 0xe0,
-  0xfa, 0xe5, 0xd9, 0xd0, 0x35, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0x22, 0x19, 0x74, 0xe0, 0xfa, 0xe5, 0xd9, 0xd0, 0x4d, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x22, 0x19, 0x74, 0xe0, 0xfa, 0xe5, 0xd9, 0xd0,
-  0x35, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x22, 0x19, 0x74, 0xe0,
-  0xfa, 0xe5, 0xd9, 0xd0, 0x4d, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x22, 0x19, 0x74, 0xe0, 0xfa, 0xe5, 0xd9, 0xd0, 0x35, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x22, 0x19, 0x74, 0xe0, 0xfa, 0xe5, 0xd9, 0xd0,
-  0x4d, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x22, 0x19, 0x74, 0xe0,
-  0xfa, 0xe5, 0xd9, 0xd0, 0x35, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0x22, 0x19, 0x74, 0xe0, 0xfa, 0xe5, 0xd9, 0xd0, 0x4d, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x22, 0x19, 0x74, 0xe0, 0xfa, 0xe5, 0xd9, 0xd0,
-  0x35, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x22, 0x19, 0x74, 0xe0,
-  0xfa, 0xe5, 0xd9, 0xd0, 0x4d, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x22, 0x19, 0x74, 0xe0, 0xfa, 0xe5, 0xd9, 0xd0, 0x35, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x22, 0x19, 0x74, 0xe0, 0xfa, 0xe5, 0xd9, 0xd0,
-  0x4d, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x22, 0x19, 0x74, 0xe0,
-  0xfa, 0xe5, 0xd9, 0xd0, 0x35, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0x22, 0x19, 0x74, 0xe0, 0xfa, 0xe5, 0xd9, 0xd0, 0x4d, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x22, 0x19, 0x74, 0xe0, 0xfa, 0xe5, 0xd9, 0xd0,
-  0x35, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x22, 0x19, 0x74, 0xe0,
-  0xfa, 0xe5, 0xd9, 0xd0, 0x4d, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x22, 0x19, 0x74, 0xe0, 0xfa, 0xe5, 0xd9, 0xd0, 0x35, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x22, 0x19, 0x74, 0xe0, 0xfa, 0xe5, 0xd9, 0xd0,
-  0x4d, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x22, 0x19, 0x74, 0xe0,
-  0xfa, 0xe5, 0xd9, 0xd0, 0x35, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0x22, 0x19, 0x74, 0xe0, 0xfa, 0xe5, 0xd9, 0xd0, 0x4d, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x22, 0x19, 0x74, 0xe0, 0xfa, 0xe5, 0xd9, 0xd0,
-  0x35, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xe7, 0x94, 0x4e, 0xce,
-  0x84, 0x5e, 0xf5, 0xd0, 0x31, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0xe7, 0x94, 0x4e, 0xce, 0x84, 0x5e, 0xf5, 0xd0, 0x4e, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0xe7, 0x94, 0x4e, 0xce, 0x84, 0x5e, 0xf5, 0xd0,
-  0x31, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xe7, 0x94, 0x4e, 0xce,
-  0x84, 0x5e, 0xf5, 0xd0, 0x47, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
-  0x3b, 0x09, 0x08, 0x42, 0x8c, 0xc6, 0x0a, 0xd1, 0x45, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x66, 0xdf, 0xbd, 0xc3, 0x96, 0x1b, 0x0e, 0xd1,
-  0x0c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xa2, 0x73, 0xbd, 0x28,
-  0xc3, 0x6a, 0x11, 0xd1, 0x15, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x75, 0x11, 0xd3, 0xde, 0x2a, 0x04, 0x14, 0xd1, 0x4e, 0x00, 0x00, 0x00,
-  0x4d, 0x00, 0x00, 0x00, 0x31, 0x71, 0x82, 0x24, 0xaa, 0x5f, 0x21, 0xd1,
-  0x3e, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x31, 0x71, 0x82, 0x24,
-  0xaa, 0x5f, 0x21, 0xd1, 0x3e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00,
-  0x31, 0x71, 0x82, 0x24, 0xaa, 0x5f, 0x21, 0xd1, 0x34, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x31, 0x71, 0x82, 0x24, 0xaa, 0x5f, 0x21, 0xd1,
-  0x3e, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x31, 0x71, 0x82, 0x24,
-  0xaa, 0x5f, 0x21, 0xd1, 0x3a, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x31, 0x71, 0x82, 0x24, 0xaa, 0x5f, 0x21, 0xd1, 0x46, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x31, 0x71, 0x82, 0x24, 0xaa, 0x5f, 0x21, 0xd1,
-  0x3e, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xb7, 0x8a, 0x7e, 0x8f,
-  0xe7, 0xcb, 0x35, 0xd1, 0x3d, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0x2b, 0xe3, 0xb1, 0x6f, 0x3d, 0x48, 0x5d, 0xd1, 0x13, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0x59, 0xdc, 0xef, 0xff, 0x2c, 0xa7, 0x68, 0xd1,
-  0x16, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x55, 0x70, 0x1f, 0x23,
-  0xa0, 0x21, 0x73, 0xd1, 0x02, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
-  0x4c, 0xf8, 0xb1, 0x91, 0x5d, 0x57, 0x80, 0xd1, 0x13, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0xb1, 0x08, 0xdc, 0x60, 0xbd, 0xbf, 0xcf, 0xd1,
-  0x47, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x08, 0xf8, 0xbd, 0x2d,
-  0xda, 0xab, 0xd7, 0xd1, 0x28, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x85, 0xa6, 0x07, 0x49, 0x01, 0xd4, 0xf8, 0xd1, 0x1d, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0xa4, 0x91, 0xa3, 0x50, 0x58, 0x87, 0x10, 0xd2,
-  0x45, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xa8, 0xa3, 0xf4, 0x0c,
-  0x38, 0x0c, 0x1d, 0xd2, 0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0xa9, 0x12, 0x63, 0xce, 0xb4, 0x72, 0x20, 0xd2, 0x3b, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0x89, 0xc3, 0xd5, 0xb8, 0xc8, 0x45, 0x3f, 0xd2,
-  0x32, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x29, 0xdd, 0x78,
-  0x36, 0x80, 0x44, 0xd2, 0x32, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0xea, 0x33, 0x80, 0xb4, 0xea, 0x36, 0x45, 0xd2, 0x27, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x25, 0x0a, 0xb9, 0x96, 0xdd, 0x18, 0x53, 0xd2,
-  0x47, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x02, 0x07, 0x4f, 0x99,
-  0x10, 0x4f, 0x5d, 0xd2, 0x09, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0xc6, 0xc9, 0x6f, 0x01, 0x55, 0x5c, 0x60, 0xd2, 0x01, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0xa3, 0xe3, 0x8b, 0xad, 0xea, 0x63, 0x76, 0xd2,
-  0x41, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0c, 0x16, 0xd3, 0x7a,
-  0xb4, 0xf4, 0x82, 0xd2, 0x0c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x27, 0x64, 0x6c, 0x5a, 0xf6, 0xfe, 0x95, 0xd2, 0x3d, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0x29, 0x2f, 0x91, 0xc8, 0xb6, 0x63, 0x9d, 0xd2,
-  0x2a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xe9, 0xb6, 0x6b, 0xaa,
-  0x9f, 0x87, 0xcd, 0xd2, 0x33, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x21, 0x8c, 0x44, 0x3e, 0x15, 0x26, 0xd2, 0xd2, 0x33, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x21, 0x8c, 0x44, 0x3e, 0x15, 0x26, 0xd2, 0xd2,
-  0x15, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xb1, 0x40, 0xa8, 0xe2,
-  0x6a, 0xa6, 0xd8, 0xd2, 0x1d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
-  0xb1, 0x40, 0xa8, 0xe2, 0x6a, 0xa6, 0xd8, 0xd2, 0x2f, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0xe6, 0x83, 0x14, 0xd9, 0x13, 0x26, 0xdd, 0xd2,
-  0x21, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x15, 0x99, 0xe2, 0x21,
-  0x53, 0x7f, 0xe1, 0xd2, 0x16, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x98, 0x5d, 0xc5, 0x35, 0x76, 0xd3, 0xe1, 0xd2, 0x0a, 0x00, 0x00, 0x00,
-  0x0b, 0x00, 0x00, 0x00, 0xcd, 0x24, 0xcc, 0x99, 0x43, 0x83, 0xfb, 0xd2,
-  0x33, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x66, 0x93, 0xcf, 0x59,
-  0x82, 0x17, 0x06, 0xd3, 0x26, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0xfa, 0x93, 0x7e, 0xed, 0x94, 0x2d, 0x34, 0xd3, 0x38, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0xf2, 0x2c, 0x26, 0xe5, 0xc2, 0x4b, 0x3c, 0xd3,
-  0x3b, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x7a, 0xe3, 0xb7, 0x04,
-  0x3f, 0xba, 0x3f, 0xd3, 0x3e, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-  0x71, 0x80, 0x12, 0xd7, 0x90, 0x98, 0x68, 0xd3, 0x13, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x24, 0x7c, 0x38, 0xa3, 0x28, 0x63, 0x75, 0xd3,
-  0x0e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x75, 0x00, 0xb2, 0x7b,
-  0x67, 0x97, 0x92, 0xd3, 0x45, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
-  0x51, 0xc0, 0x81, 0xcd, 0x17, 0x6d, 0x9d, 0xd3, 0x0a, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0xb0, 0x2a, 0xb3, 0x91, 0x22, 0xcf, 0x9f, 0xd3,
-  0x14, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xa9, 0x6b, 0x0e, 0x64,
-  0x97, 0x94, 0xab, 0xd3, 0x1d, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0x3f, 0x1d, 0x17, 0x81, 0xee, 0x71, 0xbc, 0xd3, 0x1d, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x3f, 0x1d, 0x17, 0x81, 0xee, 0x71, 0xbc, 0xd3,
-  0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x3f, 0x1d, 0x17, 0x81,
-  0xee, 0x71, 0xbc, 0xd3, 0x1c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x3f, 0x1d, 0x17, 0x81, 0xee, 0x71, 0xbc, 0xd3, 0x01, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x15, 0x49, 0x76, 0xb5, 0x6d, 0xa9, 0xc0, 0xd3,
-  0x45, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x85, 0xea, 0xa6, 0x55,
-  0xa2, 0xa6, 0xc5, 0xd3, 0x45, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
-  0x73, 0x10, 0x3f, 0x49, 0x65, 0xb3, 0xc8, 0xd3, 0x3a, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0x7e, 0x65, 0x62, 0x82, 0x71, 0x7b, 0xe3, 0xd3,
-  0x45, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x7e, 0x65, 0x62, 0x82,
-  0x71, 0x7b, 0xe3, 0xd3, 0x45, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
-  0xbf, 0x94, 0x33, 0xe0, 0x40, 0xe8, 0xeb, 0xd3, 0x0c, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0xbf, 0x94, 0x33, 0xe0, 0x40, 0xe8, 0xeb, 0xd3,
-  0x31, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x3e, 0x63, 0x73, 0x8c,
-  0xcb, 0x4a, 0xf1, 0xd3, 0x4d, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0xdd, 0x35, 0xdb, 0xa8, 0x51, 0x32, 0x2b, 0xd4, 0x0a, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0xff, 0x4f, 0xb8, 0x63, 0x8f, 0xb1, 0x39, 0xd4,
-  0x21, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x68, 0xc2, 0x0f, 0xc7,
-  0xd7, 0x88, 0x4a, 0xd4, 0x4d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-  0x8f, 0xd8, 0x5a, 0x54, 0x74, 0x4b, 0x6c, 0xd4, 0x33, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x1d, 0xce, 0x8e, 0xb5, 0x7e, 0xce, 0x8c, 0xd4,
-  0x3d, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0xf2, 0x54, 0x86, 0xe4,
-  0xab, 0x97, 0x9f, 0xd4, 0x29, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0xbd, 0x02, 0xa2, 0x30, 0xd0, 0x50, 0xc0, 0xd4, 0x02, 0x00, 0x00, 0x00,
-  0x0b, 0x00, 0x00, 0x00, 0x2b, 0x3d, 0xa6, 0x8e, 0xc0, 0x75, 0x18, 0xd5,
-  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x01, 0x72, 0x82, 0x99,
-  0xe0, 0x03, 0x57, 0xd5, 0x03, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0xf4, 0x91, 0x63, 0x52, 0x84, 0x83, 0x82, 0xd5, 0x2f, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0xf4, 0x91, 0x63, 0x52, 0x84, 0x83, 0x82, 0xd5,
-  0x2f, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x15, 0xfa, 0xc0, 0xe7,
-  0x59, 0xe8, 0x85, 0xd5, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0x00, 0x88, 0xf4, 0xbc, 0x18, 0x23, 0xa2, 0xd5, 0x15, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x00, 0x88, 0xf4, 0xbc, 0x18, 0x23, 0xa2, 0xd5,
-  0x1c, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x88, 0xf4, 0xbc,
-  0x18, 0x23, 0xa2, 0xd5, 0x15, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0x25, 0xd5, 0xa9, 0x90, 0x96, 0x5b, 0xa7, 0xd5, 0x45, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0xca, 0xd4, 0x53, 0xfd, 0x80, 0x51, 0xb7, 0xd5,
-  0x33, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xca, 0xd4, 0x53, 0xfd,
-  0x80, 0x51, 0xb7, 0xd5, 0x30, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x9a, 0x4b, 0xa2, 0xfb, 0xc7, 0x89, 0xd1, 0xd5, 0x27, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x50, 0x20, 0x97, 0xeb, 0x00, 0x45, 0xe2, 0xd5,
-  0x27, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x70, 0x44, 0xf4, 0x7d,
-  0xbe, 0xc2, 0x1a, 0xd6, 0x3c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x9b, 0x61, 0xe4, 0x74, 0x7f, 0xf6, 0x31, 0xd6, 0x21, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0xe6, 0xfa, 0x0d, 0x15, 0x68, 0x29, 0x4b, 0xd6,
-  0x12, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x58, 0xcc, 0x91, 0x3d,
-  0x90, 0x35, 0x4d, 0xd6, 0x3a, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x58, 0xcc, 0x91, 0x3d, 0x90, 0x35, 0x4d, 0xd6, 0x3c, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0x94, 0x99, 0xe7, 0xe2, 0xe6, 0xfb, 0x6d, 0xd6,
-  0x2f, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0xb9, 0xe1, 0x55, 0xa2,
-  0xd2, 0xcb, 0x79, 0xd6, 0x46, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0xed, 0x58, 0x33, 0x1e, 0x04, 0xb2, 0x95, 0xd6, 0x14, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0xf4, 0x4f, 0x05, 0xf4, 0xa0, 0xa8, 0x9b, 0xd6,
-  0x1c, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x84, 0xf0, 0x5c, 0x8b,
-  0x39, 0x58, 0xb0, 0xd6, 0x33, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0x5d, 0x39, 0x08, 0x4b, 0x30, 0x4a, 0xb2, 0xd6, 0x13, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x34, 0x0d, 0x83, 0x20, 0x8f, 0x51, 0x1c, 0xd7,
-  0x1d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x85, 0x97, 0xa2, 0x62,
-  0xc8, 0x17, 0x6f, 0xd7, 0x45, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0xc9, 0x79, 0xca, 0x36, 0xf0, 0xb5, 0x73, 0xd7, 0x0a, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0xc9, 0x79, 0xca, 0x36, 0xf0, 0xb5, 0x73, 0xd7,
-  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xc9, 0x79, 0xca, 0x36,
-  0xf0, 0xb5, 0x73, 0xd7, 0x16, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0xc9, 0x79, 0xca, 0x36, 0xf0, 0xb5, 0x73, 0xd7, 0x1d, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0xc9, 0x79, 0xca, 0x36, 0xf0, 0xb5, 0x73, 0xd7,
-  0x0a, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xc9, 0x79, 0xca, 0x36,
-  0xf0, 0xb5, 0x73, 0xd7, 0x01, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0xc9, 0x79, 0xca, 0x36, 0xf0, 0xb5, 0x73, 0xd7, 0x0a, 0x00, 0x00, 0x00,
-  0x2e, 0x00, 0x00, 0x00, 0xc9, 0x79, 0xca, 0x36, 0xf0, 0xb5, 0x73, 0xd7,
-  0x0a, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xc9, 0x79, 0xca, 0x36,
-  0xf0, 0xb5, 0x73, 0xd7, 0x0a, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0xc9, 0x79, 0xca, 0x36, 0xf0, 0xb5, 0x73, 0xd7, 0x0a, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x8a, 0x8f, 0x20, 0x62, 0xa8, 0xc8, 0xad, 0xd7,
-  0x50, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xb5, 0xd0, 0x5a, 0x67,
-  0x1f, 0x6b, 0xca, 0xd7, 0x1d, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0xf1, 0xc5, 0x1e, 0xcd, 0x0e, 0xb3, 0xca, 0xd7, 0x30, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0xbe, 0x75, 0x19, 0xa5, 0x82, 0x1c, 0xdd, 0xd7,
-  0x33, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1d, 0xdf, 0x26, 0xbb,
-  0x85, 0x44, 0xfc, 0xd7, 0x3d, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0xaa, 0x75, 0x1b, 0x43, 0x95, 0x85, 0x02, 0xd8, 0x4f, 0x00, 0x00, 0x00,
-  0x4e, 0x00, 0x00, 0x00, 0x0b, 0xed, 0xda, 0x69, 0x13, 0x85, 0x1a, 0xd8,
-  0x15, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xe5, 0xfc, 0xb3, 0x1d,
-  0x7a, 0x12, 0x66, 0xd8, 0x19, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0xa5, 0x94, 0x72, 0x59, 0xb8, 0x10, 0x77, 0xd8, 0x12, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x83, 0xc5, 0x7b, 0x45, 0x9f, 0x81, 0xf1, 0xd8,
-  0x1d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xe1, 0xf1, 0xc5, 0xcc,
-  0xee, 0xdf, 0xfb, 0xd8, 0x13, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0xe1, 0xf1, 0xc5, 0xcc, 0xee, 0xdf, 0xfb, 0xd8, 0x1c, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0xe1, 0xf1, 0xc5, 0xcc, 0xee, 0xdf, 0xfb, 0xd8,
-  0x46, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x79, 0x0b, 0x17, 0x17,
-  0x53, 0x59, 0x50, 0xd9, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x6f, 0xfe, 0x58, 0xb9, 0x48, 0xbe, 0x6e, 0xd9, 0x27, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0x1f, 0x0e, 0xc5, 0xb2, 0x9d, 0xac, 0x71, 0xd9,
-  0x46, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x1c, 0x34, 0x88, 0xb7,
-  0x5a, 0xb7, 0x87, 0xd9, 0x31, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
-  0xef, 0x1c, 0x1d, 0x7d, 0x28, 0xe9, 0x90, 0xd9, 0x2f, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0x39, 0x3e, 0x5b, 0x76, 0xcf, 0x33, 0x94, 0xd9,
-  0x3c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x79, 0x7a, 0xc3, 0x91,
-  0x36, 0xa1, 0x9b, 0xd9, 0x3e, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
-  0x79, 0x7a, 0xc3, 0x91, 0x36, 0xa1, 0x9b, 0xd9, 0x3b, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0xdf, 0x92, 0xac, 0xe3, 0xd3, 0xae, 0xb5, 0xd9,
-  0x2a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xa3, 0xd0, 0x2b, 0x6c,
-  0x3a, 0xbe, 0x72, 0xda, 0x28, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0xb6, 0x15, 0xad, 0x26, 0x01, 0x74, 0x81, 0xda, 0x16, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0xb6, 0x15, 0xad, 0x26, 0x01, 0x74, 0x81, 0xda,
-  0x25, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xb6, 0x15, 0xad, 0x26,
-  0x01, 0x74, 0x81, 0xda, 0x28, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-  0x11, 0x4c, 0xec, 0xc5, 0x0e, 0xae, 0x8f, 0xda, 0x15, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0xad, 0xbc, 0x6a, 0xa8, 0xda, 0xaf, 0xd9, 0xda,
-  0x1d, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x04, 0x66, 0x95, 0xee,
-  0xcf, 0x9b, 0xee, 0xda, 0x46, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x04, 0x66, 0x95, 0xee, 0xcf, 0x9b, 0xee, 0xda, 0x29, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x04, 0x66, 0x95, 0xee, 0xcf, 0x9b, 0xee, 0xda,
-  0x3e, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x89, 0x2e, 0xcd, 0x9b,
-  0x06, 0xab, 0xef, 0xda, 0x33, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0xf6, 0xee, 0x3d, 0xaa, 0x5c, 0x90, 0x27, 0xdb, 0x39, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0xf6, 0xee, 0x3d, 0xaa, 0x5c, 0x90, 0x27, 0xdb,
-  0x14, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x19, 0xb9, 0x0e, 0x00,
-  0x8b, 0x69, 0x3a, 0xdb, 0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0xb3, 0x9f, 0xb0, 0x69, 0xb2, 0x74, 0x3a, 0xdb, 0x1d, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0xbf, 0x73, 0x8e, 0x9f, 0x7f, 0xfe, 0x56, 0xdb,
-  0x3a, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x74, 0xc8, 0x62, 0x7d,
-  0x6b, 0xf4, 0x6c, 0xdb, 0x1d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
-  0x61, 0x02, 0x0a, 0x6f, 0x20, 0xb7, 0x7b, 0xdb, 0x46, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0xc5, 0x24, 0xbe, 0x60, 0xf4, 0xdd, 0xaa, 0xdb,
-  0x34, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x2e, 0x81, 0xbf, 0x53,
-  0x49, 0x13, 0xbe, 0xdb, 0x21, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
-  0x85, 0xfb, 0xda, 0xe7, 0x02, 0x5a, 0x03, 0xdc, 0x3b, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0x0d, 0xd7, 0x5c, 0xfe, 0xec, 0x79, 0x1d, 0xdc,
-  0x16, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xcb, 0x55, 0xeb, 0xf1,
-  0xeb, 0x6d, 0x31, 0xdc, 0x20, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0xa5, 0xd6, 0x3d, 0x91, 0xa1, 0x56, 0x4a, 0xdc, 0x4e, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0xea, 0xde, 0xbd, 0x0a, 0x1b, 0xcd, 0x5f, 0xdc,
-  0x1c, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xe2, 0x24, 0xf3, 0x48,
-  0xdb, 0x61, 0x60, 0xdc, 0x0c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x49, 0x91, 0x65, 0xb4, 0xe7, 0xc8, 0xbd, 0xdc, 0x3e, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0x49, 0x91, 0x65, 0xb4, 0xe7, 0xc8, 0xbd, 0xdc,
-  0x50, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xe1, 0x4e, 0x4d, 0x8b,
-  0x19, 0xbb, 0xdc, 0xdc, 0x3c, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-  0x41, 0x64, 0xaf, 0xc1, 0xdf, 0x53, 0xf3, 0xdc, 0x14, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0xd6, 0xf4, 0x20, 0x75, 0xe0, 0x1a, 0x0d, 0xdd,
-  0x27, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0xd6, 0xf4, 0x20, 0x75,
-  0xe0, 0x1a, 0x0d, 0xdd, 0x01, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
-  0xe4, 0x6b, 0x1d, 0xa1, 0x54, 0xef, 0x11, 0xdd, 0x46, 0x00, 0x00, 0x00,
-  0x3d, 0x00, 0x00, 0x00, 0x9c, 0x7f, 0xf8, 0xf6, 0xdd, 0x51, 0x4e, 0xdd,
-  0x30, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x89, 0x23, 0xaa, 0x59,
-  0x1b, 0x80, 0x72, 0xdd, 0x44, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-  0x14, 0xe0, 0x49, 0x2d, 0x68, 0xd7, 0xcc, 0xdd, 0x33, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0xc7, 0x92, 0xed, 0xbf, 0xeb, 0x6a, 0xdb, 0xdd,
-  0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xb6, 0x33, 0xf3, 0xe8,
-  0x35, 0xa7, 0xde, 0xdd, 0x1b, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0xb6, 0x33, 0xf3, 0xe8, 0x35, 0xa7, 0xde, 0xdd, 0x16, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0xb6, 0x33, 0xf3, 0xe8, 0x35, 0xa7, 0xde, 0xdd,
-  0x1b, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x76, 0x95, 0xf5,
-  0x4e, 0x9e, 0x10, 0xde, 0x3a, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x02, 0x76, 0x95, 0xf5, 0x4e, 0x9e, 0x10, 0xde, 0x22, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x3d, 0x34, 0xd9, 0x42, 0x36, 0xce, 0x13, 0xde,
-  0x45, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x75, 0xf9, 0xf8, 0x14,
-  0xa4, 0xdf, 0x2a, 0xde, 0x16, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x5c, 0x57, 0x18, 0xba, 0x69, 0x02, 0x8f, 0xde, 0x1c, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x13, 0x7c, 0xc2, 0x89, 0xa8, 0xbd, 0x9a, 0xde,
-  0x14, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x19, 0xbe, 0x3d, 0xc6,
-  0xd5, 0xea, 0xae, 0xde, 0x0c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0xf0, 0xa8, 0xdf, 0x1e, 0x62, 0xe8, 0xbc, 0xde, 0x28, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x27, 0xb8, 0x5e, 0x2e, 0xa9, 0xe5, 0xdf, 0xde,
-  0x35, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xff, 0xe3, 0x12, 0x36,
-  0xd1, 0xab, 0x03, 0xdf, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x87, 0x28, 0xcf, 0x8f, 0xc5, 0x38, 0x11, 0xdf, 0x18, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x90, 0xee, 0x59, 0xfc, 0xd6, 0xcc, 0x16, 0xdf,
-  0x44, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x8b, 0xa0, 0x24, 0x3a,
-  0xf6, 0x41, 0x24, 0xdf, 0x45, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0xd9, 0xd6, 0x26, 0x81, 0x79, 0x4a, 0x24, 0xdf, 0x3b, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0xd3, 0x9e, 0x12, 0xd7, 0x7a, 0xd9, 0x4f, 0xdf,
-  0x3a, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x92, 0x6b, 0xd2, 0x54,
-  0x35, 0xf4, 0x62, 0xdf, 0x39, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0x92, 0x6b, 0xd2, 0x54, 0x35, 0xf4, 0x62, 0xdf, 0x39, 0x00, 0x00, 0x00,
-  0x25, 0x00, 0x00, 0x00, 0x86, 0xac, 0xc5, 0x99, 0x69, 0xf5, 0x72, 0xdf,
-  0x27, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x13, 0xb7, 0xc2, 0x8a,
-  0xa9, 0x8b, 0x7f, 0xdf, 0x1d, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0xf1, 0x71, 0x7b, 0x76, 0x9b, 0x3f, 0x89, 0xdf, 0x32, 0x00, 0x00, 0x00,
-  0x2e, 0x00, 0x00, 0x00, 0xd6, 0xe4, 0x5b, 0xd3, 0x2a, 0xca, 0x93, 0xdf,
-  0x1c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xb5, 0x48, 0xaf, 0x68,
-  0x91, 0x95, 0x97, 0xdf, 0x30, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x8f, 0x9e, 0x6a, 0xca, 0x45, 0x0e, 0xa0, 0xdf, 0x20, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0xcd, 0x11, 0xc3, 0xfd, 0xa5, 0x75, 0xa1, 0xdf,
-  0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xcd, 0x11, 0xc3, 0xfd,
-  0xa5, 0x75, 0xa1, 0xdf, 0x46, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00,
-  0xa5, 0x3e, 0xa8, 0x5c, 0xba, 0xc2, 0xac, 0xdf, 0x46, 0x00, 0x00, 0x00,
-  0x45, 0x00, 0x00, 0x00, 0xf4, 0x05, 0x5e, 0xb6, 0x9a, 0xf2, 0xb4, 0xdf,
-  0x17, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0xb9, 0x3a, 0x9e, 0xfa,
-  0x0b, 0x36, 0xc5, 0xdf, 0x20, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x2a, 0x42, 0x78, 0x0c, 0x1e, 0xbb, 0xdc, 0xdf, 0x45, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0xa7, 0x86, 0x7b, 0xae, 0x1d, 0x02, 0xed, 0xdf,
-  0x46, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xa7, 0x86, 0x7b, 0xae,
-  0x1d, 0x02, 0xed, 0xdf, 0x46, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x8c, 0x9d, 0x12, 0xff, 0xdb, 0xcd, 0x12, 0xe0, 0x31, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0x83, 0x8c, 0x2d, 0x55, 0x11, 0x5e, 0x1a, 0xe0,
-  0x14, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x3b, 0x66, 0x49, 0x94,
-  0x7e, 0xff, 0x39, 0xe0, 0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x65, 0x8c, 0xa1, 0x6f, 0x8a, 0xd8, 0x46, 0xe0, 0x14, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0x06, 0x92, 0x0c, 0x28, 0xd8, 0x1b, 0x4d, 0xe0,
-  0x3c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xe9, 0x1c, 0xa6, 0x30,
-  0xea, 0x6c, 0x64, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x21, 0x4f, 0x7b, 0x97, 0xd7, 0x18, 0xb4, 0xe0, 0x39, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x74, 0xdc, 0x48, 0x9f, 0x62, 0x4d, 0xd0, 0xe0,
-  0x3c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x96, 0xda, 0xac, 0xa0,
-  0xac, 0x35, 0xdf, 0xe0, 0x31, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
-  0x96, 0xda, 0xac, 0xa0, 0xac, 0x35, 0xdf, 0xe0, 0x1e, 0x00, 0x00, 0x00,
-  0x42, 0x00, 0x00, 0x00, 0x96, 0xda, 0xac, 0xa0, 0xac, 0x35, 0xdf, 0xe0,
-  0x15, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x10, 0x6f, 0x5e, 0x0e,
-  0xb6, 0x5c, 0xdf, 0xe0, 0x46, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0x10, 0x6f, 0x5e, 0x0e, 0xb6, 0x5c, 0xdf, 0xe0, 0x4e, 0x00, 0x00, 0x00,
-  0x4d, 0x00, 0x00, 0x00, 0xdd, 0x86, 0x11, 0x1d, 0x0f, 0xa0, 0xf0, 0xe0,
-  0x33, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x14, 0x07, 0xec, 0x58,
-  0xa4, 0xbe, 0xf8, 0xe0, 0x20, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0x13, 0x16, 0xaa, 0x73, 0x78, 0x4f, 0x00, 0xe1, 0x2f, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x6e, 0x69, 0xdb, 0x19, 0xe0, 0x19, 0x9f, 0xe1,
-  0x12, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1d, 0xa6, 0x03, 0xd8,
-  0xd6, 0x3e, 0xb0, 0xe1, 0x46, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0x91, 0x72, 0x55, 0x4d, 0xbe, 0x8d, 0xc2, 0xe1, 0x32, 0x00, 0x00, 0x00,
-  0x2e, 0x00, 0x00, 0x00, 0xab, 0xa8, 0xb6, 0xe1, 0xb5, 0xd7, 0xce, 0xe1,
-  0x3b, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x3d, 0xde, 0x2f, 0x3f,
-  0xec, 0xcd, 0xfb, 0xe1, 0x3e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00,
-  0x45, 0xb1, 0x63, 0x4c, 0xbd, 0x66, 0x38, 0xe2, 0x45, 0x00, 0x00, 0x00,
-  0x3d, 0x00, 0x00, 0x00, 0xb5, 0x5a, 0x22, 0x83, 0x2b, 0x11, 0x5d, 0xe2,
-  0x20, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x7c, 0x27, 0x6c, 0x0c,
-  0xeb, 0xe8, 0x87, 0xe2, 0x44, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
-  0xbc, 0x79, 0xb2, 0xb7, 0xff, 0x54, 0x91, 0xe2, 0x45, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0xc7, 0x8c, 0xbf, 0xe3, 0xf3, 0xdf, 0xa1, 0xe2,
-  0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0xc8, 0x64, 0x83, 0xba,
-  0xbc, 0xb8, 0xb6, 0xe2, 0x18, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0xf8, 0x5b, 0x85, 0xbd, 0x29, 0xbc, 0xf7, 0xe2, 0x4d, 0x00, 0x00, 0x00,
-  0x3b, 0x00, 0x00, 0x00, 0x0c, 0xcb, 0x22, 0x3d, 0xf6, 0x67, 0x42, 0xe3,
-  0x0a, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xe9, 0xca, 0x4c, 0x4a,
-  0x24, 0x6f, 0x61, 0xe3, 0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x75, 0x04, 0x89, 0xd9, 0xc0, 0x4c, 0x64, 0xe3, 0x3b, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0x75, 0x04, 0x89, 0xd9, 0xc0, 0x4c, 0x64, 0xe3,
-  0x3c, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x75, 0x04, 0x89, 0xd9,
-  0xc0, 0x4c, 0x64, 0xe3, 0x3b, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
-  0x8a, 0x69, 0x69, 0x45, 0xd3, 0x1e, 0x6d, 0xe3, 0x09, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x46, 0xbc, 0xd4, 0x37, 0xa3, 0xe2, 0x79, 0xe3,
-  0x50, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x6f, 0xbe, 0xa6, 0xd5,
-  0x39, 0x15, 0x7e, 0xe3, 0x1c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x2c, 0xbb, 0x0f, 0x7b, 0x94, 0xc5, 0x8d, 0xe3, 0x03, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0xbb, 0x2a, 0x27, 0x60, 0xcf, 0x1c, 0x9d, 0xe3,
-  0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0xa4, 0x5f, 0xd8, 0xfa,
-  0xf9, 0x15, 0xee, 0xe3, 0x12, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0xee, 0xcb, 0xf7, 0x5d, 0x88, 0x80, 0x19, 0xe4, 0x2a, 0x00, 0x00, 0x00,
-  0x2b, 0x00, 0x00, 0x00, 0x9b, 0x5b, 0xa0, 0x3b, 0xca, 0x1e, 0x5b, 0xe4,
-  0x21, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xc6, 0x78, 0xab, 0x8e,
-  0x94, 0x3c, 0x6f, 0xe4, 0x45, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0xf3, 0xc3, 0xa8, 0x06, 0x2b, 0x42, 0x75, 0xe4, 0x0a, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0xc5, 0xe0, 0x91, 0xd2, 0xfc, 0xc3, 0x84, 0xe4,
-  0x0a, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x8b, 0xda, 0x2d, 0x41,
-  0xe2, 0x3e, 0xae, 0xe4, 0x29, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0x94, 0x0d, 0x4d, 0x0e, 0x94, 0xfe, 0xca, 0xe4, 0x31, 0x00, 0x00, 0x00,
-  0x45, 0x00, 0x00, 0x00, 0x78, 0x21, 0x2f, 0x58, 0xaa, 0xd0, 0xe5, 0xe4,
-  0x1e, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x20, 0x20, 0xce, 0x21,
-  0xfa, 0x6a, 0x0b, 0xe5, 0x27, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0xd5, 0x25, 0xb5, 0x09, 0x76, 0x99, 0x5e, 0xe5, 0x45, 0x00, 0x00, 0x00,
-  0x41, 0x00, 0x00, 0x00, 0x93, 0x8e, 0xf6, 0xc0, 0xb0, 0x23, 0x85, 0xe5,
-  0x3d, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x14, 0x1c, 0x47, 0x2e,
-  0x63, 0xda, 0x86, 0xe5, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0x64, 0xff, 0x9f, 0x61, 0xb8, 0x01, 0x9a, 0xe5, 0x28, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x64, 0xff, 0x9f, 0x61, 0xb8, 0x01, 0x9a, 0xe5,
-  0x28, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x80, 0x59, 0x74, 0xcb,
-  0x3b, 0x1c, 0xd8, 0xe5, 0x12, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
-  0x80, 0x59, 0x74, 0xcb, 0x3b, 0x1c, 0xd8, 0xe5, 0x13, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x80, 0x59, 0x74, 0xcb, 0x3b, 0x1c, 0xd8, 0xe5,
-  0x02, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0xdf, 0x46, 0x15, 0x75,
-  0xe8, 0xfa, 0xe6, 0xe5, 0x3d, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0xc1, 0xaa, 0x51, 0x15, 0xe8, 0xea, 0xfe, 0xe5, 0x17, 0x00, 0x00, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0xc1, 0xaa, 0x51, 0x15, 0xe8, 0xea, 0xfe, 0xe5,
-  0x29, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xc7, 0x0f, 0x88, 0x28,
-  0xff, 0x75, 0x00, 0xe6, 0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x2f, 0x1b, 0x28, 0x74, 0xbd, 0x5c, 0x07, 0xe6, 0x46, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x9a, 0x70, 0x6a, 0xdc, 0xa0, 0x6b, 0x29, 0xe6,
-  0x0d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x31, 0x53, 0x53, 0x91,
-  0x5f, 0x60, 0x40, 0xe6, 0x26, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0xfc, 0xa3, 0x04, 0x84, 0x18, 0xe4, 0x57, 0xe6, 0x2f, 0x00, 0x00, 0x00,
-  0x43, 0x00, 0x00, 0x00, 0x90, 0xb0, 0xec, 0x03, 0x88, 0xdc, 0x91, 0xe6,
-  0x3e, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3d, 0xba, 0x35, 0x54,
-  0x24, 0xf2, 0xb6, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x13, 0xca, 0x2c, 0x25, 0xb5, 0xbd, 0xba, 0xe6, 0x21, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0xae, 0x36, 0xaf, 0xcf, 0x4f, 0xb7, 0xc3, 0xe6,
-  0x30, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x89, 0x9c, 0x66, 0x9e,
-  0x52, 0x47, 0xdd, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0xb9, 0x1a, 0x00, 0xdc, 0xec, 0x20, 0xff, 0xe6, 0x3c, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0xf5, 0x2a, 0x0c, 0xaf, 0x91, 0xb0, 0x0b, 0xe7,
-  0x14, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x61, 0xd1, 0xda, 0x5a,
-  0xfa, 0x42, 0x10, 0xe7, 0x3a, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x18, 0x06, 0x09, 0x8b, 0x24, 0x06, 0x16, 0xe7, 0x32, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0xae, 0x93, 0x79, 0x1e, 0xdf, 0x3b, 0x34, 0xe7,
-  0x1f, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xae, 0x93, 0x79, 0x1e,
-  0xdf, 0x3b, 0x34, 0xe7, 0x0a, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
-  0xe4, 0x54, 0xac, 0x1b, 0xe2, 0x57, 0x58, 0xe7, 0x45, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0xd1, 0x73, 0x86, 0x20, 0xb8, 0x2c, 0xac, 0xe7,
-  0x3d, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x4f, 0xad, 0x78, 0xaa,
-  0x45, 0xe3, 0xdc, 0xe7, 0x34, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0xf1, 0xaf, 0xac, 0xaa, 0xf4, 0x35, 0x11, 0xe8, 0x1b, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0x70, 0x9a, 0x40, 0xe5, 0x2c, 0xc3, 0x25, 0xe8,
-  0x4f, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0xa8, 0x78, 0xdf, 0x4e,
-  0x81, 0x37, 0x2e, 0xe8, 0x45, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
-  0x8d, 0x47, 0x58, 0x99, 0x51, 0x64, 0x2e, 0xe8, 0x13, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x34, 0xce, 0x0c, 0xcc, 0xb2, 0x33, 0x4b, 0xe8,
-  0x2b, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x34, 0xce, 0x0c, 0xcc,
-  0xb2, 0x33, 0x4b, 0xe8, 0x45, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0xd5, 0x5e, 0x42, 0xc6, 0xec, 0x89, 0x60, 0xe8, 0x18, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0xd5, 0x5e, 0x42, 0xc6, 0xec, 0x89, 0x60, 0xe8,
-  0x25, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x7d, 0xce, 0x05, 0x29,
-  0x55, 0x54, 0x69, 0xe8, 0x47, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
-  0x7d, 0xce, 0x05, 0x29, 0x55, 0x54, 0x69, 0xe8, 0x4e, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0xca, 0x2d, 0x44, 0xe4, 0x4f, 0x2c, 0x6d, 0xe8,
-  0x20, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xc2, 0xfd, 0x95, 0xdb,
-  0xe3, 0xac, 0x6f, 0xe8, 0x15, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0xd1, 0x0d, 0xf9, 0x5a, 0xfd, 0xe2, 0x84, 0xe8, 0x13, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x79, 0x31, 0xc7, 0x57, 0x30, 0xdd, 0x89, 0xe8,
-  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x33, 0x93, 0x58, 0x96,
-  0x99, 0xe0, 0x94, 0xe8, 0x26, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x15, 0x66, 0xae, 0x02, 0x5a, 0xe3, 0xb8, 0xe8, 0x1b, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0xb7, 0xaa, 0x89, 0x35, 0xa2, 0xc5, 0xe1, 0xe8,
-  0x1e, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x86, 0xd0, 0x1f, 0x19,
-  0xb0, 0x26, 0xf1, 0xe8, 0x0a, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0xc3, 0xda, 0x5d, 0xcf, 0x2f, 0x8d, 0xfa, 0xe8, 0x3a, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x95, 0xfb, 0x44, 0x79, 0x9d, 0x6c, 0xfb, 0xe8,
-  0x46, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x34, 0xe0, 0x74, 0x19,
-  0x86, 0xde, 0x08, 0xe9, 0x3a, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-  0x34, 0xe0, 0x74, 0x19, 0x86, 0xde, 0x08, 0xe9, 0x3a, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0xce, 0xc3, 0x46, 0x5a, 0xfa, 0xd3, 0x34, 0xe9,
-  0x1c, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x7d, 0xaa, 0x38, 0xeb,
-  0xd2, 0x26, 0x3c, 0xe9, 0x2f, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x39, 0xc5, 0x1e, 0x29, 0x93, 0xdd, 0x45, 0xe9, 0x3b, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0xdc, 0x5d, 0x75, 0xe9, 0x60, 0x07, 0x54, 0xe9,
-  0x29, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x48, 0xe2, 0x56, 0xb3,
-  0x7e, 0xc1, 0x5d, 0xe9, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x48, 0xe2, 0x56, 0xb3, 0x7e, 0xc1, 0x5d, 0xe9, 0x3b, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0x48, 0xe2, 0x56, 0xb3, 0x7e, 0xc1, 0x5d, 0xe9,
-  0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x48, 0xe2, 0x56, 0xb3,
-  0x7e, 0xc1, 0x5d, 0xe9, 0x3b, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x48, 0xe2, 0x56, 0xb3, 0x7e, 0xc1, 0x5d, 0xe9, 0x2b, 0x00, 0x00, 0x00,
-  0x22, 0x00, 0x00, 0x00, 0x79, 0xd6, 0xa5, 0x38, 0x68, 0x57, 0x86, 0xe9,
-  0x45, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x62, 0x11, 0x90, 0x54,
-  0x95, 0x93, 0x8e, 0xe9, 0x33, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0x29, 0x1e, 0xd9, 0x5a, 0x8c, 0x3b, 0xd2, 0xe9, 0x27, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0x76, 0x32, 0xd4, 0x27, 0x57, 0xa7, 0xd4, 0xe9,
-  0x4f, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0xf4, 0xb1, 0x01, 0x3f,
-  0x73, 0x4c, 0x02, 0xea, 0x3c, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0xf4, 0xb1, 0x01, 0x3f, 0x73, 0x4c, 0x02, 0xea, 0x33, 0x00, 0x00, 0x00,
-  0x41, 0x00, 0x00, 0x00, 0xd8, 0xb5, 0xfb, 0x1d, 0x0f, 0x9d, 0x1b, 0xea,
-  0x4f, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x6f, 0x1d, 0xf6, 0x0e,
-  0xfd, 0xab, 0x56, 0xea, 0x0c, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
-  0x64, 0x4c, 0x5b, 0x34, 0xc0, 0x3b, 0x5e, 0xea, 0x45, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0x03, 0x09, 0x6d, 0xfa, 0x15, 0xdb, 0xa5, 0xea,
-  0x16, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x06, 0x71, 0xc8, 0x74,
-  0x1e, 0xd9, 0xb6, 0xea, 0x45, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x7c, 0x55, 0xca, 0x56, 0xb5, 0x48, 0xb8, 0xea, 0x34, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x16, 0x0e, 0x0a, 0xce, 0x90, 0xe6, 0xcc, 0xea,
-  0x1d, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x9a, 0x18, 0x07, 0x94,
-  0xc4, 0x5a, 0xde, 0xea, 0x3d, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0xb0, 0x96, 0xa3, 0x50, 0xa3, 0xb0, 0xdf, 0xea, 0x35, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0xd0, 0x6f, 0xf1, 0x9e, 0x91, 0xdf, 0xe5, 0xea,
-  0x13, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x14, 0x07, 0xe5, 0xbc,
-  0xdf, 0x6a, 0xe6, 0xea, 0x0b, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0xd0, 0x80, 0x0c, 0x42, 0xa5, 0xbe, 0x00, 0xeb, 0x1b, 0x00, 0x00, 0x00,
-  0x43, 0x00, 0x00, 0x00, 0x3b, 0xef, 0x91, 0xfc, 0x3c, 0xe2, 0x2d, 0xeb,
-  0x0a, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x3b, 0xef, 0x91, 0xfc,
-  0x3c, 0xe2, 0x2d, 0xeb, 0x0a, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x3b, 0xef, 0x91, 0xfc, 0x3c, 0xe2, 0x2d, 0xeb, 0x0a, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x3b, 0xef, 0x91, 0xfc, 0x3c, 0xe2, 0x2d, 0xeb,
-  0x0a, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x3b, 0xef, 0x91, 0xfc,
-  0x3c, 0xe2, 0x2d, 0xeb, 0x0a, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x3b, 0xef, 0x91, 0xfc, 0x3c, 0xe2, 0x2d, 0xeb, 0x0a, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x3b, 0xef, 0x91, 0xfc, 0x3c, 0xe2, 0x2d, 0xeb,
-  0x0a, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x3b, 0xef, 0x91, 0xfc,
-  0x3c, 0xe2, 0x2d, 0xeb, 0x0a, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x3b, 0xef, 0x91, 0xfc, 0x3c, 0xe2, 0x2d, 0xeb, 0x0a, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x0b, 0xeb, 0x2a, 0xe6, 0x3a, 0xb2, 0x45, 0xeb,
-  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0xc2, 0x87, 0x25, 0x76,
-  0x3c, 0x9b, 0x65, 0xeb, 0x03, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
-  0xe0, 0xe1, 0x55, 0xd5, 0x49, 0x2e, 0x6d, 0xeb, 0x0a, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0xe0, 0xe1, 0x55, 0xd5, 0x49, 0x2e, 0x6d, 0xeb,
-  0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2d, 0xc7, 0xfa, 0x13,
-  0x06, 0x08, 0x7d, 0xeb, 0x21, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
-  0xb3, 0x75, 0x89, 0x4b, 0x99, 0x95, 0x92, 0xeb, 0x3d, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0xb3, 0x75, 0x89, 0x4b, 0x99, 0x95, 0x92, 0xeb,
-  0x3d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0xb3, 0x75, 0x89, 0x4b,
-  0x99, 0x95, 0x92, 0xeb, 0x3d, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0x6b, 0x8a, 0x53, 0x3a, 0x4a, 0x8c, 0x94, 0xeb, 0x2a, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x6b, 0x8a, 0x53, 0x3a, 0x4a, 0x8c, 0x94, 0xeb,
-  0x31, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0xde, 0xeb, 0x9b, 0x9a,
-  0x84, 0xd2, 0xa5, 0xeb, 0x45, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00,
-  0xd9, 0xfe, 0x18, 0x34, 0x07, 0xa9, 0xae, 0xeb, 0x42, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0xc5, 0xef, 0x62, 0x9e, 0xeb, 0x2d, 0xb9, 0xeb,
-  0x0b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xc2, 0xe9, 0xf7, 0x54,
-  0x9b, 0x82, 0xba, 0xeb, 0x45, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
-  0x40, 0x25, 0x88, 0x17, 0xa4, 0x34, 0xbd, 0xeb, 0x3b, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0xdb, 0xb2, 0x81, 0x51, 0x56, 0x30, 0xbf, 0xeb,
-  0x50, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xd1, 0x46, 0xd8, 0x63,
-  0x16, 0xea, 0xc3, 0xeb, 0x3c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0xc3, 0xb9, 0x76, 0x11, 0x6c, 0xd1, 0xd5, 0xeb, 0x14, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0xec, 0x07, 0x5e, 0xfc, 0xec, 0xeb,
-  0x21, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x50, 0x50, 0x80, 0x94,
-  0x1f, 0xa8, 0x16, 0xec, 0x46, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0xfe, 0x48, 0x6e, 0x73, 0xab, 0x5a, 0x2b, 0xec, 0x0a, 0x00, 0x00, 0x00,
-  0x2e, 0x00, 0x00, 0x00, 0x22, 0x88, 0x11, 0x78, 0x73, 0xc9, 0x74, 0xec,
-  0x29, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x48, 0x5e, 0x99, 0x02,
-  0x03, 0xd7, 0x78, 0xec, 0x26, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-  0x18, 0x59, 0x47, 0x88, 0x22, 0x4a, 0x7f, 0xec, 0x4f, 0x00, 0x00, 0x00,
-  0x46, 0x00, 0x00, 0x00, 0x18, 0x59, 0x47, 0x88, 0x22, 0x4a, 0x7f, 0xec,
-  0x33, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x18, 0x59, 0x47, 0x88,
-  0x22, 0x4a, 0x7f, 0xec, 0x3e, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
-  0x18, 0x59, 0x47, 0x88, 0x22, 0x4a, 0x7f, 0xec, 0x34, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x18, 0x59, 0x47, 0x88, 0x22, 0x4a, 0x7f, 0xec,
-  0x4f, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x18, 0x59, 0x47, 0x88,
-  0x22, 0x4a, 0x7f, 0xec, 0x3e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00,
-  0x18, 0x59, 0x47, 0x88, 0x22, 0x4a, 0x7f, 0xec, 0x3a, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x0a, 0x26, 0x9b, 0x86, 0xfe, 0x9d, 0xa0, 0xec,
-  0x26, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xdd, 0x17, 0x5f, 0x33,
-  0x23, 0xc0, 0xc0, 0xec, 0x3e, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-  0x56, 0x71, 0x08, 0x76, 0xc2, 0xdd, 0x24, 0xed, 0x01, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0xc5, 0xe2, 0x0f, 0x4b, 0x39, 0x53, 0x31, 0xed,
-  0x2f, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x51, 0xdd, 0x6d, 0x06,
-  0xdc, 0x05, 0x48, 0xed, 0x27, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0xb1, 0x09, 0xb3, 0x5d, 0xd1, 0xeb, 0x54, 0xed, 0x0b, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0xb4, 0xfa, 0x9c, 0xc2, 0xf1, 0xd3, 0x61, 0xed,
-  0x14, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x36, 0xfb, 0xc6, 0x3b,
-  0x7e, 0xd2, 0x77, 0xed, 0x34, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
-  0xc3, 0x69, 0xc6, 0x3d, 0x0f, 0x50, 0x8f, 0xed, 0x3d, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0x65, 0xb1, 0xf2, 0x22, 0xf1, 0x40, 0xc0, 0xed,
-  0x44, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0b, 0xe4, 0x72, 0xf3,
-  0x85, 0x75, 0xd2, 0xed, 0x13, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0xf6, 0x43, 0xa8, 0x1e, 0xe6, 0xcc, 0xf1, 0xed, 0x29, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x47, 0xbc, 0x3d, 0x4a, 0xe7, 0x69, 0x06, 0xee,
-  0x14, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x47, 0xbc, 0x3d, 0x4a,
-  0xe7, 0x69, 0x06, 0xee, 0x15, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x47, 0xbc, 0x3d, 0x4a, 0xe7, 0x69, 0x06, 0xee, 0x14, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0x47, 0xbc, 0x3d, 0x4a, 0xe7, 0x69, 0x06, 0xee,
-  0x15, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x04, 0x38, 0x5f, 0x7b,
-  0x97, 0x9d, 0x0c, 0xee, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0x8c, 0xb0, 0x89, 0xd6, 0x46, 0x62, 0x3b, 0xee, 0x14, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x49, 0x7b, 0x37, 0x33, 0xc7, 0xeb, 0xa8, 0xee,
-  0x20, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xdb, 0x4e, 0xa2, 0x60,
-  0xb8, 0xac, 0xaa, 0xee, 0x39, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
-  0xdb, 0x4e, 0xa2, 0x60, 0xb8, 0xac, 0xaa, 0xee, 0x27, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x6b, 0x3f, 0xdd, 0x6a, 0xf4, 0xad, 0xb3, 0xee,
-  0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x19, 0xf0, 0x62, 0x48,
-  0x77, 0xd4, 0xbb, 0xee, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
-  0xaf, 0x2f, 0x26, 0x8f, 0x2e, 0xcb, 0xbc, 0xee, 0x13, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0x0d, 0xd5, 0xd5, 0x21, 0x30, 0x9d, 0xda, 0xee,
-  0x0b, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x60, 0x37, 0x67, 0x72,
-  0x00, 0xc0, 0xe1, 0xee, 0x4f, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
-  0x08, 0xe2, 0xc7, 0xbf, 0xc5, 0xd4, 0xe6, 0xee, 0x3e, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x13, 0x0a, 0x50, 0x1e, 0x9f, 0xcb, 0xff, 0xee,
-  0x1c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xa1, 0xa9, 0x46, 0xbe,
-  0xcc, 0x1a, 0x03, 0xef, 0x4e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0xa1, 0xa9, 0x46, 0xbe, 0xcc, 0x1a, 0x03, 0xef, 0x34, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0xa1, 0xa9, 0x46, 0xbe, 0xcc, 0x1a, 0x03, 0xef,
-  0x4e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0xa1, 0xa9, 0x46, 0xbe,
-  0xcc, 0x1a, 0x03, 0xef, 0x4e, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-  0xa1, 0xa9, 0x46, 0xbe, 0xcc, 0x1a, 0x03, 0xef, 0x34, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0xa1, 0xa9, 0x46, 0xbe, 0xcc, 0x1a, 0x03, 0xef,
-  0x4e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x28, 0x2a, 0x99, 0xeb,
-  0x9f, 0x00, 0x33, 0xef, 0x32, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-  0xac, 0xbc, 0xa4, 0xf3, 0xf9, 0xae, 0x72, 0xef, 0x01, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x4d, 0x04, 0xf5, 0xa9, 0xc9, 0x0f, 0x79, 0xef,
-  0x33, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x4d, 0x04, 0xf5, 0xa9,
-  0xc9, 0x0f, 0x79, 0xef, 0x28, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x4d, 0x04, 0xf5, 0xa9, 0xc9, 0x0f, 0x79, 0xef, 0x33, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0xc5, 0x7b, 0x6d, 0x0b, 0x3c, 0xcc, 0xc4, 0xef,
-  0x3e, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xa4, 0xe6, 0x76, 0xde,
-  0xd1, 0x1a, 0xd7, 0xef, 0x4d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-  0xa4, 0xe6, 0x76, 0xde, 0xd1, 0x1a, 0xd7, 0xef, 0x50, 0x00, 0x00, 0x00,
-  0x4c, 0x00, 0x00, 0x00, 0xa4, 0xe6, 0x76, 0xde, 0xd1, 0x1a, 0xd7, 0xef,
-  0x4d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x44, 0x4a, 0x23, 0x7d,
-  0x6f, 0x12, 0xff, 0xef, 0x46, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0x8d, 0x68, 0x97, 0x26, 0x06, 0x02, 0x06, 0xf0, 0x2f, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x8a, 0x0e, 0xc0, 0x52, 0x19, 0x4a, 0x17, 0xf0,
-  0x27, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x12, 0x4b, 0x17, 0x00,
-  0x99, 0x75, 0x1e, 0xf0, 0x4f, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
-  0x00, 0x0f, 0xfa, 0x5e, 0x19, 0x46, 0x25, 0xf0, 0x3c, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0x68, 0xaf, 0x5e, 0xbb, 0x7e, 0xa0, 0x38, 0xf0,
-  0x13, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x3a, 0x0d, 0x0f, 0xe2,
-  0x60, 0xa5, 0x58, 0xf0, 0x44, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x5f, 0xdf, 0x18, 0x0b, 0x06, 0x86, 0x66, 0xf0, 0x1c, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x5f, 0xdf, 0x18, 0x0b, 0x06, 0x86, 0x66, 0xf0,
-  0x27, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x36, 0x5f, 0x69, 0x41,
-  0x93, 0x66, 0x97, 0xf0, 0x4e, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-  0xf4, 0xbf, 0xa6, 0x6d, 0x32, 0x34, 0xa8, 0xf0, 0x1b, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0xd4, 0xfa, 0x1d, 0x90, 0xa4, 0x7a, 0xc5, 0xf0,
-  0x39, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0xd8, 0x5d, 0xf0, 0x42,
-  0xc0, 0xc4, 0x19, 0xf1, 0x1f, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
-  0xd8, 0x5d, 0xf0, 0x42, 0xc0, 0xc4, 0x19, 0xf1, 0x1f, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0xd8, 0x5d, 0xf0, 0x42, 0xc0, 0xc4, 0x19, 0xf1,
-  0x1f, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0xd8, 0x5d, 0xf0, 0x42,
-  0xc0, 0xc4, 0x19, 0xf1, 0x1f, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x05, 0x66, 0x3b, 0xf9, 0x31, 0x94, 0x35, 0xf1, 0x1d, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x05, 0x66, 0x3b, 0xf9, 0x31, 0x94, 0x35, 0xf1,
-  0x2e, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0xa3, 0xab, 0xff, 0x7d,
-  0xb0, 0x93, 0x3a, 0xf1, 0x1e, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
-  0x16, 0x0c, 0xa2, 0xff, 0xcd, 0xee, 0x53, 0xf1, 0x43, 0x00, 0x00, 0x00,
-  0x42, 0x00, 0x00, 0x00, 0x66, 0x17, 0x89, 0x34, 0xdc, 0x4f, 0x55, 0xf1,
-  0x1f, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x82, 0xff, 0xcc, 0x20,
-  0xdf, 0x48, 0x6a, 0xf1, 0x33, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x5b, 0x74, 0x66, 0x7c, 0x82, 0x03, 0x8a, 0xf1, 0x47, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x45, 0xe1, 0xce, 0xbd, 0x8b, 0x9b, 0x9d, 0xf1,
-  0x1d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x8f, 0x5e, 0x5d, 0x29,
-  0x2c, 0x1f, 0xa3, 0xf1, 0x3c, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-  0x9f, 0x09, 0x0b, 0xe7, 0xe5, 0x6f, 0xab, 0xf1, 0x33, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0xbf, 0x01, 0x64, 0x2c, 0x3c, 0x62, 0xb1, 0xf1,
-  0x4f, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x7e, 0xce, 0x1c, 0xcb,
-  0x79, 0x00, 0xb5, 0xf1, 0x3c, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x72, 0x5e, 0x14, 0xbd, 0xf1, 0xa6, 0xe6, 0xf1, 0x00, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0xec, 0x49, 0x8a, 0x64, 0xb6, 0xcb, 0xe7, 0xf1,
-  0x2a, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0xec, 0x49, 0x8a, 0x64,
-  0xb6, 0xcb, 0xe7, 0xf1, 0x27, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0xec, 0x49, 0x8a, 0x64, 0xb6, 0xcb, 0xe7, 0xf1, 0x29, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0xec, 0x49, 0x8a, 0x64, 0xb6, 0xcb, 0xe7, 0xf1,
-  0x3c, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x4b, 0x1f, 0x76, 0x99,
-  0xf4, 0x86, 0x0e, 0xf2, 0x16, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0x4b, 0x1f, 0x76, 0x99, 0xf4, 0x86, 0x0e, 0xf2, 0x0c, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x53, 0xb7, 0xc1, 0x85, 0x5d, 0x3a, 0x11, 0xf2,
-  0x0b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x5d, 0x12, 0xfb, 0xbd,
-  0x96, 0xc4, 0x22, 0xf2, 0x14, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x60, 0xbc, 0xbe, 0x90, 0x85, 0x66, 0x40, 0xf2, 0x1e, 0x00, 0x00, 0x00,
-  0x42, 0x00, 0x00, 0x00, 0x60, 0xbc, 0xbe, 0x90, 0x85, 0x66, 0x40, 0xf2,
-  0x32, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x9f, 0x1c, 0xcf, 0xde,
-  0xac, 0x16, 0x70, 0xf2, 0x32, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x55, 0x40, 0xac, 0xd0, 0x35, 0xee, 0x9c, 0xf2, 0x20, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x55, 0x40, 0xac, 0xd0, 0x35, 0xee, 0x9c, 0xf2,
-  0x31, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x55, 0x40, 0xac, 0xd0,
-  0x35, 0xee, 0x9c, 0xf2, 0x33, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00,
-  0x55, 0x40, 0xac, 0xd0, 0x35, 0xee, 0x9c, 0xf2, 0x32, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x55, 0x40, 0xac, 0xd0, 0x35, 0xee, 0x9c, 0xf2,
-  0x33, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0xab, 0x30, 0x21, 0x19,
-  0x10, 0xa3, 0xa2, 0xf2, 0x0a, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x50, 0xd1, 0x85, 0x10, 0xb7, 0x50, 0xe8, 0xf2, 0x45, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x8e, 0xcd, 0x7a, 0x8b, 0x3b, 0x90, 0x10, 0xf3,
-  0x02, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x9f, 0x72, 0xf3, 0x86,
-  0x29, 0x22, 0x14, 0xf3, 0x16, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0xe0, 0xad, 0xe7, 0x4c, 0x61, 0x02, 0x1a, 0xf3, 0x14, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x4c, 0xad, 0xaa, 0x2f, 0xeb, 0xd1, 0x21, 0xf3,
-  0x4e, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x95, 0xcf, 0xcb, 0x5c,
-  0xb9, 0x3c, 0x22, 0xf3, 0x2f, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0x95, 0xcf, 0xcb, 0x5c, 0xb9, 0x3c, 0x22, 0xf3, 0x14, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x9b, 0x8a, 0x5d, 0x89, 0x21, 0x23, 0x49, 0xf3,
-  0x4d, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0xe2, 0x11, 0xea, 0x7e,
-  0xe3, 0xd8, 0x5a, 0xf3, 0x0a, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x66, 0x8b, 0xe2, 0xd9, 0x2d, 0xef, 0x5f, 0xf3, 0x30, 0x00, 0x00, 0x00,
-  0x46, 0x00, 0x00, 0x00, 0x41, 0x17, 0x44, 0xe2, 0x54, 0x21, 0x60, 0xf3,
-  0x46, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x63, 0xab, 0x34, 0xca,
-  0x43, 0x7e, 0x7e, 0xf3, 0x09, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0x80, 0x76, 0xea, 0x26, 0x53, 0xed, 0x9c, 0xf3, 0x2f, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x80, 0x76, 0xea, 0x26, 0x53, 0xed, 0x9c, 0xf3,
-  0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xf6, 0x52, 0x9e, 0xb1,
-  0xea, 0xba, 0x10, 0xf4, 0x50, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0xe4, 0x45, 0x14, 0x5d, 0x7d, 0x2f, 0x15, 0xf4, 0x01, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x07, 0x11, 0x2f, 0x08, 0xc2, 0x31, 0x2b, 0xf4,
-  0x2a, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0xca, 0x02, 0x17, 0x1b,
-  0x6f, 0x8d, 0x47, 0xf4, 0x02, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
-  0x8e, 0xf9, 0x4a, 0x0e, 0xf6, 0xa9, 0x48, 0xf4, 0x09, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0x1c, 0xc8, 0xdd, 0x64, 0x8b, 0x1d, 0x54, 0xf4,
-  0x3e, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x31, 0x5c, 0xc8, 0x27,
-  0x3f, 0x39, 0x69, 0xf4, 0x14, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0xfe, 0x1b, 0x0a, 0x67, 0x01, 0x77, 0x88, 0xf4, 0x02, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0xa0, 0x46, 0xb6, 0xd4, 0xf0, 0xe2, 0x9b, 0xf4,
-  0x3a, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0xd5, 0xf9, 0xaf, 0x09,
-  0x3f, 0x76, 0xb0, 0xf4, 0x3a, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0xd5, 0xf9, 0xaf, 0x09, 0x3f, 0x76, 0xb0, 0xf4, 0x20, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0xd5, 0xf9, 0xaf, 0x09, 0x3f, 0x76, 0xb0, 0xf4,
-  0x3a, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xd5, 0xf9, 0xaf, 0x09,
-  0x3f, 0x76, 0xb0, 0xf4, 0x20, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0xd5, 0xf9, 0xaf, 0x09, 0x3f, 0x76, 0xb0, 0xf4, 0x3a, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0xd5, 0xf9, 0xaf, 0x09, 0x3f, 0x76, 0xb0, 0xf4,
-  0x20, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xd5, 0xf9, 0xaf, 0x09,
-  0x3f, 0x76, 0xb0, 0xf4, 0x33, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
-  0xd5, 0xf9, 0xaf, 0x09, 0x3f, 0x76, 0xb0, 0xf4, 0x20, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x7d, 0x33, 0x23, 0xd5, 0xf2, 0xd6, 0xb2, 0xf4,
-  0x4f, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0xf1, 0x44, 0x15, 0xf4,
-  0xee, 0x55, 0xe5, 0xf4, 0x21, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0xf1, 0x44, 0x15, 0xf4, 0xee, 0x55, 0xe5, 0xf4, 0x28, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x79, 0x50, 0x36, 0xc8, 0xdc, 0xda, 0xfb, 0xf4,
-  0x45, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0xa9, 0x1d, 0x4b, 0x67,
-  0x6a, 0xb0, 0x00, 0xf5, 0x3a, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x02, 0xd3, 0x5a, 0xf9, 0x99, 0xca, 0x03, 0xf5, 0x30, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0xf4, 0xe6, 0x03, 0x10, 0xb5, 0xcf, 0x14, 0xf5,
-  0x33, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xca, 0x22, 0xfa, 0x19,
-  0x04, 0x02, 0x18, 0xf5, 0x15, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x7f, 0xf9, 0x4b, 0xce, 0x33, 0x89, 0x20, 0xf5, 0x25, 0x00, 0x00, 0x00,
-  0x37, 0x00, 0x00, 0x00, 0xf4, 0x06, 0x7b, 0xe4, 0x61, 0xe2, 0x47, 0xf5,
-  0x0b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xa3, 0xe5, 0x9a, 0xc5,
-  0x7c, 0x21, 0x4e, 0xf5, 0x27, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-  0x36, 0x28, 0x89, 0x3e, 0x3f, 0xea, 0x4e, 0xf5, 0x12, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x80, 0xe0, 0x37, 0x47, 0x99, 0xfa, 0x86, 0xf5,
-  0x33, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x93, 0x07, 0x2d, 0x78,
-  0x46, 0x9f, 0x0b, 0xf6, 0x16, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x71, 0x48, 0x6b, 0x77, 0xcd, 0x18, 0x42, 0xf6, 0x1f, 0x00, 0x00, 0x00,
-  0x47, 0x00, 0x00, 0x00, 0x4e, 0x7b, 0xd8, 0xa8, 0x10, 0xc0, 0x4b, 0xf6,
-  0x27, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xce, 0x1c, 0x9c, 0x5c,
-  0xea, 0x05, 0x53, 0xf6, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x97, 0x1e, 0x0c, 0xcc, 0x4f, 0xc0, 0x93, 0xf6, 0x0c, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x9b, 0x6b, 0x4a, 0x37, 0x4f, 0x6b, 0xaa, 0xf6,
-  0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x66, 0x06, 0x40, 0xf1,
-  0x8d, 0xb9, 0xc5, 0xf6, 0x34, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x85, 0xe0, 0xd4, 0x7b, 0x87, 0x28, 0xe5, 0xf6, 0x3a, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0x4e, 0xad, 0x86, 0x22, 0x91, 0x89, 0xeb, 0xf6,
-  0x0c, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xe6, 0xf3, 0xef, 0x98,
-  0x9f, 0x05, 0x1a, 0xf7, 0x4d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-  0x2a, 0xd0, 0x56, 0x48, 0x13, 0x47, 0x1c, 0xf7, 0x1d, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0xac, 0x84, 0x19, 0x92, 0xca, 0x80, 0x21, 0xf7,
-  0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x46, 0xf4, 0x52, 0xc1,
-  0xa3, 0xde, 0x59, 0xf7, 0x44, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
-  0x46, 0xf4, 0x52, 0xc1, 0xa3, 0xde, 0x59, 0xf7, 0x34, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0x42, 0xb3, 0xb3, 0xfe, 0x4a, 0xe6, 0x5b, 0xf7,
-  0x29, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xe9, 0xa8, 0x5a, 0x52,
-  0x03, 0x21, 0x73, 0xf7, 0x15, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-  0xe9, 0xa8, 0x5a, 0x52, 0x03, 0x21, 0x73, 0xf7, 0x1d, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x1f, 0xdc, 0x51, 0x92, 0xac, 0x1c, 0x74, 0xf7,
-  0x16, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x75, 0x01, 0xe2, 0x57,
-  0x34, 0xc5, 0x8f, 0xf7, 0x34, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x75, 0x01, 0xe2, 0x57, 0x34, 0xc5, 0x8f, 0xf7, 0x3a, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x75, 0x01, 0xe2, 0x57, 0x34, 0xc5, 0x8f, 0xf7,
-  0x2e, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x95, 0xdb, 0x4e, 0xa1,
-  0x53, 0xfc, 0x9d, 0xf7, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0x37, 0x84, 0xe6, 0xa0, 0x8f, 0x0b, 0xe6, 0xf7, 0x0a, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0xae, 0x50, 0x14, 0xc4, 0x5f, 0xda, 0x18, 0xf8,
-  0x02, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x0f, 0x41, 0xd4, 0xe7,
-  0x21, 0x70, 0x3f, 0xf8, 0x26, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-  0x11, 0x38, 0x45, 0x19, 0x63, 0x28, 0x43, 0xf8, 0x15, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x61, 0x5b, 0x55, 0x2b, 0xa4, 0xbf, 0x5a, 0xf8,
-  0x33, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x13, 0x07, 0x43, 0xcf,
-  0x33, 0xd1, 0x6c, 0xf8, 0x2b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0x13, 0x07, 0x43, 0xcf, 0x33, 0xd1, 0x6c, 0xf8, 0x28, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x09, 0xb1, 0x41, 0xc9, 0xd8, 0xc5, 0x8c, 0xf8,
-  0x45, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x6d, 0x48, 0xdf, 0xd1,
-  0xcc, 0x29, 0xa5, 0xf8, 0x1d, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0x6d, 0x48, 0xdf, 0xd1, 0xcc, 0x29, 0xa5, 0xf8, 0x0a, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x03, 0x3c, 0x5a, 0x10, 0xaa, 0xde, 0xad, 0xf8,
-  0x1c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x3c, 0x88, 0x39, 0x2d,
-  0x73, 0xf7, 0xe2, 0xf8, 0x2a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x6d, 0xce, 0x22, 0x67, 0x08, 0xdb, 0xfc, 0xf8, 0x3c, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0x6d, 0xce, 0x22, 0x67, 0x08, 0xdb, 0xfc, 0xf8,
-  0x47, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x57, 0x59, 0x21, 0xa8,
-  0xfc, 0x1a, 0x14, 0xf9, 0x3c, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
-  0xce, 0x16, 0x41, 0x40, 0x68, 0x3f, 0x31, 0xf9, 0x3e, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0x6e, 0x7b, 0xd4, 0x80, 0x47, 0xb2, 0x3a, 0xf9,
-  0x32, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x5b, 0x65, 0x10, 0xef,
-  0x7c, 0x0c, 0x64, 0xf9, 0x3d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-  0x61, 0x18, 0x5d, 0xf4, 0x9c, 0xab, 0x6c, 0xf9, 0x1d, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x3e, 0xbf, 0x9b, 0x92, 0xdc, 0x2c, 0x75, 0xf9,
-  0x46, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0xf8, 0x66, 0x16, 0x3f,
-  0x11, 0x5a, 0x7f, 0xf9, 0x4d, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
-  0xaa, 0x26, 0x10, 0x4e, 0xb0, 0x35, 0x93, 0xf9, 0x3d, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0xc7, 0x9a, 0x13, 0x69, 0x46, 0x01, 0xb2, 0xf9,
-  0x1d, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x6a, 0xf8, 0x41, 0xf5,
-  0x49, 0x4e, 0xb4, 0xf9, 0x1c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x89, 0x51, 0xbb, 0xca, 0x9a, 0x8e, 0xc6, 0xf9, 0x0a, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x89, 0x51, 0xbb, 0xca, 0x9a, 0x8e, 0xc6, 0xf9,
-  0x27, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x89, 0x51, 0xbb, 0xca,
-  0x9a, 0x8e, 0xc6, 0xf9, 0x0a, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x89, 0x51, 0xbb, 0xca, 0x9a, 0x8e, 0xc6, 0xf9, 0x12, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0xb1, 0x3e, 0x0f, 0xda, 0xdc, 0x52, 0xca, 0xf9,
-  0x33, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x7f, 0x6c, 0xcf, 0xd0,
-  0x86, 0xf6, 0xd7, 0xf9, 0x44, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
-  0xdb, 0xe0, 0x45, 0xe3, 0x4b, 0x1a, 0x1e, 0xfa, 0x2a, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x3c, 0x73, 0xac, 0xb2, 0x49, 0xbb, 0x58, 0xfa,
-  0x15, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x3c, 0x73, 0xac, 0xb2,
-  0x49, 0xbb, 0x58, 0xfa, 0x1e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x7c, 0xfa, 0x88, 0xde, 0x91, 0x9a, 0x5b, 0xfa, 0x1e, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0xc7, 0x3e, 0x4f, 0x35, 0x1a, 0x57, 0x82, 0xfa,
-  0x32, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x44, 0x4b, 0x17, 0x0f,
-  0xb7, 0xd0, 0x94, 0xfa, 0x44, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0xc0, 0x43, 0x09, 0xbd, 0x17, 0x0b, 0xb5, 0xfa, 0x50, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0xc0, 0x43, 0x09, 0xbd, 0x17, 0x0b, 0xb5, 0xfa,
-  0x35, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x03, 0x9c, 0xb1, 0x90,
-  0x04, 0xe0, 0x0c, 0xfb, 0x3a, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0xd6, 0xd2, 0x43, 0x7f, 0x7f, 0xa8, 0x1b, 0xfb, 0x4f, 0x00, 0x00, 0x00,
-  0x3b, 0x00, 0x00, 0x00, 0xd6, 0xd2, 0x43, 0x7f, 0x7f, 0xa8, 0x1b, 0xfb,
-  0x2a, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x86, 0xd3, 0x22, 0x0c,
-  0x83, 0x84, 0x42, 0xfb, 0x29, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0xb0, 0x65, 0x16, 0x35, 0xd1, 0xaa, 0x47, 0xfb, 0x2a, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x9e, 0x88, 0x77, 0x99, 0xf3, 0x5c, 0x6d, 0xfb,
-  0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x09, 0xd5, 0x29, 0xf1,
-  0x5a, 0x7d, 0x71, 0xfb, 0x1d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x09, 0xd5, 0x29, 0xf1, 0x5a, 0x7d, 0x71, 0xfb, 0x13, 0x00, 0x00, 0x00,
-  0x29, 0x00, 0x00, 0x00, 0x09, 0xd5, 0x29, 0xf1, 0x5a, 0x7d, 0x71, 0xfb,
-  0x17, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x09, 0xd5, 0x29, 0xf1,
-  0x5a, 0x7d, 0x71, 0xfb, 0x13, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
-  0xe4, 0xfc, 0x55, 0xf1, 0x5a, 0x49, 0x74, 0xfb, 0x33, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x26, 0xee, 0x6e, 0x95, 0x99, 0xa0, 0xcb, 0xfb,
-  0x33, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0xa1, 0x7f, 0x33, 0xe6,
-  0x75, 0x16, 0xcd, 0xfb, 0x16, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0x7d, 0xf6, 0x73, 0x5d, 0x62, 0x3c, 0xd0, 0xfb, 0x01, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x4d, 0x3b, 0x2f, 0x15, 0x1f, 0x08, 0xf1, 0xfb,
-  0x31, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x17, 0x21, 0xeb, 0x73,
-  0x6c, 0x80, 0x09, 0xfc, 0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x17, 0x21, 0xeb, 0x73, 0x6c, 0x80, 0x09, 0xfc, 0x26, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x17, 0x21, 0xeb, 0x73, 0x6c, 0x80, 0x09, 0xfc,
-  0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x17, 0x21, 0xeb, 0x73,
-  0x6c, 0x80, 0x09, 0xfc, 0x16, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x17, 0x21, 0xeb, 0x73, 0x6c, 0x80, 0x09, 0xfc, 0x0a, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x17, 0x21, 0xeb, 0x73, 0x6c, 0x80, 0x09, 0xfc,
-  0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xe6, 0xda, 0x82, 0x24,
-  0x94, 0x52, 0x47, 0xfc, 0x46, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-  0xce, 0xb4, 0xd8, 0x07, 0xf9, 0xdc, 0x54, 0xfc, 0x02, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0xce, 0xb4, 0xd8, 0x07, 0xf9, 0xdc, 0x54, 0xfc,
-  0x12, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0xce, 0xb4, 0xd8, 0x07,
-  0xf9, 0xdc, 0x54, 0xfc, 0x02, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
-  0xce, 0xb4, 0xd8, 0x07, 0xf9, 0xdc, 0x54, 0xfc, 0x12, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0xce, 0xb4, 0xd8, 0x07, 0xf9, 0xdc, 0x54, 0xfc,
-  0x02, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0xce, 0xb4, 0xd8, 0x07,
-  0xf9, 0xdc, 0x54, 0xfc, 0x12, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
-  0x0d, 0x66, 0x8c, 0x66, 0x80, 0xde, 0x82, 0xfc, 0x2a, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0x70, 0x5b, 0x25, 0x95, 0x43, 0x9e, 0x9b, 0xfc,
-  0x1d, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0xe8, 0x2d, 0x92, 0x89,
-  0x0d, 0x5c, 0xbe, 0xfc, 0x0c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
-  0xe8, 0x2d, 0x92, 0x89, 0x0d, 0x5c, 0xbe, 0xfc, 0x32, 0x00, 0x00, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x52, 0xe9, 0x36, 0xf6, 0x5f, 0xba, 0xf8, 0xfc,
-  0x44, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0xc9, 0xb6, 0x08, 0xdf,
-  0xa3, 0x6a, 0xf9, 0xfc, 0x37, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0x66, 0x49, 0x21, 0xdb, 0x4c, 0x7f, 0xff, 0xfc, 0x46, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x7f, 0x33, 0xbf, 0x35, 0x56, 0xde, 0x5a, 0xfd,
-  0x3c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x8d, 0xa2, 0xbe, 0xdb,
-  0x57, 0xcc, 0x61, 0xfd, 0x29, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0x8d, 0xa2, 0xbe, 0xdb, 0x57, 0xcc, 0x61, 0xfd, 0x44, 0x00, 0x00, 0x00,
-  0x43, 0x00, 0x00, 0x00, 0x8d, 0xa2, 0xbe, 0xdb, 0x57, 0xcc, 0x61, 0xfd,
-  0x34, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x8d, 0xa2, 0xbe, 0xdb,
-  0x57, 0xcc, 0x61, 0xfd, 0x29, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0x8d, 0xa2, 0xbe, 0xdb, 0x57, 0xcc, 0x61, 0xfd, 0x34, 0x00, 0x00, 0x00,
-  0x2b, 0x00, 0x00, 0x00, 0x88, 0x81, 0x29, 0xf4, 0x71, 0x8e, 0x63, 0xfd,
-  0x32, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x7e, 0xe7, 0x30, 0x23,
-  0x2d, 0x2c, 0x71, 0xfd, 0x34, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0xda, 0x73, 0x40, 0x5e, 0xd6, 0xdb, 0x73, 0xfd, 0x00, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0x2a, 0xf9, 0xfe, 0xec, 0xd3, 0xf6, 0x74, 0xfd,
-  0x4d, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x80, 0xf3, 0xab, 0x5c,
-  0xcb, 0xe8, 0x93, 0xfd, 0x34, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x80, 0xf3, 0xab, 0x5c, 0xcb, 0xe8, 0x93, 0xfd, 0x21, 0x00, 0x00, 0x00,
-  0x0b, 0x00, 0x00, 0x00, 0x90, 0xb5, 0xf6, 0x65, 0x39, 0xac, 0xd8, 0xfd,
-  0x0f, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x36, 0xdd, 0xab, 0x47,
-  0xc7, 0x2d, 0xd9, 0xfd, 0x32, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x7f, 0xe1, 0xea, 0xc8, 0x5e, 0xdb, 0x1d, 0xfe, 0x0b, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0xd2, 0x4c, 0xbe, 0x71, 0x2d, 0xf2, 0x4a, 0xfe,
-  0x38, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x7d, 0xc7, 0xd7, 0x30,
-  0x06, 0xb9, 0x51, 0xfe, 0x4d, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-  0x45, 0xc6, 0xf6, 0x1a, 0x23, 0xde, 0x55, 0xfe, 0x39, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x7f, 0x80, 0xb5, 0xaf, 0x16, 0x10, 0x61, 0xfe,
-  0x0b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x36, 0x57, 0xc1, 0xe7,
-  0x25, 0x3a, 0x7b, 0xfe, 0x16, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-  0x12, 0x72, 0x79, 0x55, 0x04, 0x17, 0x81, 0xfe, 0x4e, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0xf4, 0xa8, 0xaa, 0x79, 0x3d, 0xa0, 0x96, 0xfe,
-  0x45, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf8, 0xd3, 0x28, 0x42,
-  0x03, 0x0d, 0x98, 0xfe, 0x1c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x00, 0x5e, 0x71, 0x8f, 0xca, 0xc5, 0xbd, 0xfe, 0x21, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x17, 0x55, 0xe1, 0x3b, 0x54, 0xa3, 0xe1, 0xfe,
-  0x31, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x49, 0x4e, 0x97, 0x81,
-  0x57, 0xe6, 0xe6, 0xfe, 0x3e, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0xdc, 0xf9, 0x5a, 0xf2, 0x0a, 0xc9, 0x28, 0xff, 0x2a, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0xf2, 0xb3, 0x55, 0x15, 0x5e, 0xbb, 0x45, 0xff,
-  0x27, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0xf2, 0xb3, 0x55, 0x15,
-  0x5e, 0xbb, 0x45, 0xff, 0x1d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x8a, 0x48, 0xce, 0xa8, 0x4d, 0x84, 0x4b, 0xff, 0x33, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0xe4, 0x84, 0x2e, 0xb4, 0x3b, 0x52, 0xa4, 0xff,
-  0x33, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x0c, 0x53, 0x14, 0xda,
-  0xa6, 0x1c, 0xa5, 0xff, 0x38, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0x6e, 0xb7, 0x66, 0xe0, 0x71, 0x00, 0xac, 0xff, 0x20, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x6f, 0xb4, 0x58, 0x86, 0x76, 0x50, 0xcc, 0xff,
-  0x1d, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0xc9, 0x7e, 0x48, 0x48,
-  0x0a, 0xbe, 0xf8, 0xff, 0x03, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0x48, 0x3f, 0xc8, 0x84, 0x91, 0xe1, 0xfb, 0xff, 0x3b, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0x48, 0x3f, 0xc8, 0x84, 0x91, 0xe1, 0xfb, 0xff,
-  0x33, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x48, 0x3f, 0xc8, 0x84,
-  0x91, 0xe1, 0xfb, 0xff, 0x29, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0x48, 0x3f, 0xc8, 0x84, 0x91, 0xe1, 0xfb, 0xff, 0x3b, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00
+#pragma once
+
+#include <game.hpp>
+
+// 由 bookmaker 生成，按 hash 排序，同一局面可能有多个着法
+constexpr BookEntry BOOK[] = {
+    {0x000ec8eb301b5d12ULL, 42, 24},
+    {0x001046236ebdfad0ULL, 21, 23},
+    {0x0011c1dc0320a295ULL, 69, 51},
+    {0x00126ba9d5a78482ULL, 59, 50},
+    {0x007d5b8b866b2bb3ULL, 21, 23},
+    {0x00b34a0962941a7aULL, 12, 14},
+    {0x0137e06c75399c16ULL, 32, 14},
+    {0x015387a7aa989a94ULL, 40, 78},
+    {0x015a11b472ecad87ULL, 61, 41},
+    {0x015a9928aea062f5ULL, 41, 19},
+    {0x0186c87c72c10347ULL, 30, 48},
+    {0x018d1a679fa6e9b7ULL, 68, 32},
+    {0x019931c719e3ef35ULL, 51, 49},
+    {0x019a68f31860a499ULL, 20, 22},
+    {0x01a8aa045a2294b2ULL, 61, 57},
+    {0x01c0d631800cc970ULL, 33, 47},
+    {0x01c4cb3027715b58ULL, 71, 33},
+    {0x01df9160e9d092a0ULL, 1, 2},
+    {0x022d1bccb30abe93ULL, 69, 68},
+    {0x022d1bccb30abe93ULL, 42, 40},
+    {0x022e94d5122b162fULL, 71, 49},
+    {0x022e94d5122b162fULL, 70, 12},
+    {0x023324e49975efa5ULL, 2, 56},
+    {0x023846cfec4c3879ULL, 70, 68},
+    {0x023a9fd524ddc31fULL, 0, 20},
+    {0x023a9fd524ddc31fULL, 28, 30},
+    {0x023a9fd524ddc31fULL, 0, 20},
+    {0x023a9fd524ddc31fULL, 18, 20},
+    {0x023a9fd524ddc31fULL, 0, 20},
+    {0x023a9fd524ddc31fULL, 27, 47},
+    {0x023a9fd524ddc31fULL, 0, 20},
+    {0x025563091383498dULL, 29, 31},
+    {0x027d7ebe24b31c58ULL, 47, 65},
+    {0x02913aa644258930ULL, 22, 30},
+    {0x0292d2bad660dd3fULL, 10, 48},
+    {0x0295b2ed4ce443d6ULL, 42, 40},
+    {0x02b149ac45664a8dULL, 18, 19},
+    {0x02e4800e6daebeccULL, 78, 42},
+    {0x030bbb41ded113edULL, 69, 49},
+    {0x031b6ffef5f6018bULL, 19, 21},
+    {0x03227f8c4b517c52ULL, 41, 39},
+    {0x03227f8c4b517c52ULL, 52, 32},
+    {0x032286371933ec7aULL, 51, 33},
+    {0x033a96dc074330f9ULL, 10, 32},
+    {0x03793fced0c9eb80ULL, 14, 32},
+    {0x03ee4c5a1e072647ULL, 10, 30},
+    {0x041ae5d7fc0a7ad7ULL, 11, 33},
+    {0x04252e857f21418eULL, 22, 40},
+    {0x04290897fa1a528dULL, 80, 24},
+    {0x04290897fa1a528dULL, 33, 29},
+    {0x04290897fa1a528dULL, 80, 24},
+    {0x04708ec021bd4db7ULL, 32, 28},
+    {0x0488aa11ea52bb9bULL, 48, 39},
+    {0x04979179da7fa4a2ULL, 31, 29},
+    {0x04ad6c9e404037cbULL, 80, 58},
+    {0x04ad6c9e404037cbULL, 77, 41},
+    {0x04adc6efffa43a83ULL, 29, 38},
+    {0x04f62aff83c28e4cULL, 12, 20},
+    {0x04f62aff83c28e4cULL, 39, 57},
+    {0x04fb99e39e11c29fULL, 59, 57},
+    {0x04fb99e39e11c29fULL, 33, 32},
+    {0x05097e0ba8ee230aULL, 52, 43},
+    {0x05097e0ba8ee230aULL, 32, 28},
+    {0x05597a953cafbb53ULL, 21, 61},
+    {0x055a0e73efdd4a0eULL, 69, 68},
+    {0x056ab5e78036fcfeULL, 31, 29},
+    {0x059e7713604cb900ULL, 21, 30},
+    {0x05aded799a17be30ULL, 39, 41},
+    {0x05e79165581b298cULL, 31, 9},
+    {0x05f1729546aad082ULL, 78, 42},
+    {0x05ff86c43cfcba05ULL, 57, 58},
+    {0x060d92a3798ce646ULL, 60, 56},
+    {0x0635f5f51a3d9fe4ULL, 12, 32},
+    {0x06544678028fd59aULL, 19, 37},
+    {0x0654eefa1225636aULL, 41, 23},
+    {0x065f8d5ef3eb04aeULL, 21, 79},
+    {0x0671bff396343bfeULL, 67, 66},
+    {0x0671bff396343bfeULL, 28, 30},
+    {0x069192e46a68ba14ULL, 68, 60},
+    {0x069192e46a68ba14ULL, 9, 10},
+    {0x06bb6baee46e8d19ULL, 59, 39},
+    {0x06fc88a80a6ed88bULL, 29, 31},
+    {0x071c62e9ed126ca5ULL, 2, 24},
+    {0x072e631023ca04a6ULL, 12, 30},
+    {0x0739c00647ef0ff7ULL, 18, 10},
+    {0x0739c00647ef0ff7ULL, 1, 10},
+    {0x0739c00647ef0ff7ULL, 29, 33},
+    {0x0739c00647ef0ff7ULL, 28, 30},
+    {0x0739c00647ef0ff7ULL, 1, 10},
+    {0x0739c00647ef0ff7ULL, 22, 31},
+    {0x0739c00647ef0ff7ULL, 18, 19},
+    {0x073f0b45be6611a1ULL, 29, 31},
+    {0x076f98909120a778ULL, 39, 41},
+    {0x07724cc8e603b3cdULL, 21, 23},
+    {0x07ac26f959974208ULL, 51, 49},
+    {0x07c58cd747027c92ULL, 78, 60},
+    {0x081079bbe2ebc115ULL, 53, 13},
+    {0x0819b0dd67e033a0ULL, 61, 43},
+    {0x082b6d10bc969f4aULL, 60, 59},
+    {0x083637dc74c63347ULL, 33, 32},
+    {0x0864e3b728705c0bULL, 59, 50},
+    {0x0882e61c444cb374ULL, 20, 29},
+    {0x088daa4272663cf2ULL, 51, 60},
+    {0x0893fd9423cfda15ULL, 46, 37},
+    {0x08b3ab72fbf6fc77ULL, 42, 41},
+    {0x08be7bacc24a1627ULL, 28, 30},
+    {0x08be7bacc24a1627ULL, 27, 47},
+    {0x08be7bacc24a1627ULL, 28, 30},
+    {0x08f5554516d27bf9ULL, 48, 66},
+    {0x0915da97d8ac28f9ULL, 59, 50},
+    {0x0936eb57eb130a14ULL, 49, 47},
+    {0x0971be374d82d94fULL, 61, 60},
+    {0x0988462891ac7e8aULL, 18, 20},
+    {0x0989352073ae6a97ULL, 70, 52},
+    {0x0989352073ae6a97ULL, 61, 41},
+    {0x0989352073ae6a97ULL, 61, 57},
+    {0x09906999203bd15dULL, 52, 51},
+    {0x09906999203bd15dULL, 59, 57},
+    {0x09ae41a0490e191eULL, 28, 30},
+    {0x09b4e9930462ce8bULL, 20, 21},
+    {0x09c635c69303e825ULL, 38, 24},
+    {0x09cbaa1fd266b206ULL, 43, 61},
+    {0x09ce6d517f725699ULL, 68, 66},
+    {0x09efa431ed5592acULL, 23, 21},
+    {0x09f32e7e3d5c9b23ULL, 12, 48},
+    {0x0a19bcb25829a00fULL, 30, 34},
+    {0x0a203c3a5b1668f9ULL, 59, 58},
+    {0x0a26bfe90dc1ddb3ULL, 9, 47},
+    {0x0a6f93e5f7f35c60ULL, 60, 58},
+    {0x0a774f902225d1edULL, 70, 48},
+    {0x0aaede80e049be65ULL, 70, 48},
+    {0x0ab68dff760f856aULL, 10, 2},
+    {0x0ae897e4806c56a2ULL, 29, 47},
+    {0x0af5aab3d9b724ecULL, 52, 68},
+    {0x0b1a500b70d0b5c5ULL, 24, 18},
+    {0x0b1a500b70d0b5c5ULL, 21, 37},
+    {0x0b1a500b70d0b5c5ULL, 59, 58},
+    {0x0b1cdece1439444bULL, 1, 19},
+    {0x0b274b76b9e59af5ULL, 60, 59},
+    {0x0b274b76b9e59af5ULL, 23, 22},
+    {0x0b794e815f110c2eULL, 1, 10},
+    {0x0bc423e2d4d2a57cULL, 58, 40},
+    {0x0bf3bee7eef4f1efULL, 1, 2},
+    {0x0c0e1ea793e345e3ULL, 38, 56},
+    {0x0c12522e89950763ULL, 29, 49},
+    {0x0c340ebca2f1c2c4ULL, 11, 31},
+    {0x0c3aba97c369d41eULL, 62, 70},
+    {0x0c857cd1900ed052ULL, 29, 47},
+    {0x0c9af6b0f1bae5beULL, 29, 31},
+    {0x0ca5206a17cfcd4eULL, 50, 49},
+    {0x0cbaab6e7eb3c450ULL, 38, 47},
+    {0x0cbaab6e7eb3c450ULL, 3, 21},
+    {0x0cbaab6e7eb3c450ULL, 38, 47},
+    {0x0ccb1f5b3351d15dULL, 52, 50},
+    {0x0ccb1f5b3351d15dULL, 53, 33},
+    {0x0ccb1f5b3351d15dULL, 52, 50},
+    {0x0cecea039fc6419bULL, 31, 32},
+    {0x0cf8a05b6abd4294ULL, 50, 46},
+    {0x0d0f96c50dfc21cbULL, 57, 39},
+    {0x0d140cf17dfed16aULL, 9, 29},
+    {0x0d22c1ada3288a20ULL, 11, 15},
+    {0x0d2635bcc5ffdafdULL, 70, 30},
+    {0x0d2eabb3df7ba9f1ULL, 13, 31},
+    {0x0d6a8c435a48862eULL, 20, 21},
+    {0x0d6a8c435a48862eULL, 20, 29},
+    {0x0d75c70e959538d7ULL, 39, 40},
+    {0x0d7922abd75f886fULL, 49, 29},
+    {0x0d7b0fad98d6d435ULL, 19, 39},
+    {0x0dc7cfd85843c678ULL, 51, 50},
+    {0x0dc995bd61474964ULL, 77, 68},
+    {0x0dcde4a213657e94ULL, 38, 47},
+    {0x0dcde4a213657e94ULL, 29, 47},
+    {0x0dcde4a213657e94ULL, 38, 47},
+    {0x0dcde4a213657e94ULL, 22, 40},
+    {0x0dcde4a213657e94ULL, 38, 47},
+    {0x0de2c6f132ddffd6ULL, 78, 42},
+    {0x0de50be24054ef99ULL, 60, 51},
+    {0x0e202749790c7041ULL, 33, 32},
+    {0x0e2ed19d7e36cfd3ULL, 25, 24},
+    {0x0e35a365ab5880efULL, 29, 49},
+    {0x0e928eda7c9f4924ULL, 58, 40},
+    {0x0ed108d1c5be3e98ULL, 71, 51},
+    {0x0ed108d1c5be3e98ULL, 78, 42},
+    {0x0ee79d9867cf3adfULL, 78, 42},
+    {0x0ef3ca0ef4378317ULL, 77, 68},
+    {0x0f20d2998a86fb4aULL, 24, 25},
+    {0x0f2e8a8ca8173055ULL, 50, 70},
+    {0x0f2e8a8ca8173055ULL, 10, 12},
+    {0x0f4f96e7e2f5d08dULL, 42, 24},
+    {0x0f8901cff1df5940ULL, 18, 20},
+    {0x0f904d93ffd505edULL, 41, 33},
+    {0x0f904d93ffd505edULL, 79, 43},
+    {0x0f904d93ffd505edULL, 41, 33},
+    {0x0f904d93ffd505edULL, 79, 43},
+    {0x0f904d93ffd505edULL, 41, 33},
+    {0x0f9ffa921b89412cULL, 32, 12},
+    {0x0fb612666dd3b651ULL, 22, 23},
+    {0x1009c77309909023ULL, 11, 20},
+    {0x1047801b411dbf43ULL, 79, 70},
+    {0x10486a12449c5c5fULL, 29, 38},
+    {0x10547a400a0da747ULL, 62, 53},
+    {0x10795503be3c6e56ULL, 28, 20},
+    {0x109994ec6a4f5101ULL, 1, 2},
+    {0x10aeca28d806a7eaULL, 19, 39},
+    {0x10ba42cca28fce55ULL, 33, 24},
+    {0x10ee080feab30bfcULL, 21, 39},
+    {0x10ffabe14707b113ULL, 0, 38},
+    {0x10ffabe14707b113ULL, 27, 31},
+    {0x10ffabe14707b113ULL, 0, 38},
+    {0x111143a0bce6f6bbULL, 30, 32},
+    {0x111a5f7a70557f0fULL, 59, 41},
+    {0x1129f6b104e46efdULL, 2, 56},
+    {0x11504ece6dd081c5ULL, 3, 39},
+    {0x11504ece6dd081c5ULL, 3, 23},
+    {0x1196e20733d14008ULL, 79, 57},
+    {0x11bc158258791825ULL, 69, 68},
+    {0x11cbd5feb981022bULL, 40, 60},
+    {0x11e0abc2aaba7c57ULL, 28, 48},
+    {0x11ee8ea5273b1f99ULL, 14, 12},
+    {0x11f6b9d25c88846bULL, 42, 56},
+    {0x124f0ed29a5fd8f6ULL, 69, 33},
+    {0x125e877d253635b6ULL, 57, 48},
+    {0x125e877d253635b6ULL, 51, 50},
+    {0x126cfcf8112caac3ULL, 29, 47},
+    {0x126e449fb6c9da93ULL, 48, 66},
+    {0x12ca48c434d73de6ULL, 61, 41},
+    {0x12ca48c434d73de6ULL, 61, 59},
+    {0x12ca48c434d73de6ULL, 61, 41},
+    {0x12db01baee1a5438ULL, 29, 38},
+    {0x12e55d4d4858f7b2ULL, 80, 60},
+    {0x12ff6894c554f005ULL, 57, 39},
+    {0x12ff6894c554f005ULL, 50, 48},
+    {0x12ff6894c554f005ULL, 69, 67},
+    {0x131f17b91ecc0fa4ULL, 47, 49},
+    {0x131f17b91ecc0fa4ULL, 40, 49},
+    {0x13377434df415927ULL, 78, 69},
+    {0x139b8b8d623fb844ULL, 29, 30},
+    {0x13ae80ba066e76fdULL, 39, 41},
+    {0x13af12979c168cf1ULL, 51, 43},
+    {0x13bc2c2047ba580dULL, 69, 49},
+    {0x13cda6796420557fULL, 0, 38},
+    {0x13d95f976d593a77ULL, 52, 32},
+    {0x13e05e7d40b848b1ULL, 60, 52},
+    {0x13f52ccf218d26c7ULL, 48, 57},
+    {0x1406ea09e5caf8d9ULL, 68, 50},
+    {0x140d6eff1bdae738ULL, 61, 41},
+    {0x14108335b1363938ULL, 69, 31},
+    {0x142fddc7778f3506ULL, 50, 68},
+    {0x14318e3efc29e49dULL, 31, 23},
+    {0x145b1e28e99c583aULL, 50, 48},
+    {0x145ded6884f2fd49ULL, 18, 38},
+    {0x1468195ff5429a32ULL, 70, 48},
+    {0x146877134a52a50aULL, 29, 51},
+    {0x14a7fe380a8b98f7ULL, 29, 49},
+    {0x14a7fe380a8b98f7ULL, 29, 67},
+    {0x14a7fe380a8b98f7ULL, 29, 49},
+    {0x14a7fe380a8b98f7ULL, 29, 67},
+    {0x14b2e91e63d73894ULL, 20, 29},
+    {0x14c9f3c32f27e404ULL, 60, 58},
+    {0x14d10d4433db1726ULL, 69, 33},
+    {0x14fd67a971cdecc2ULL, 2, 56},
+    {0x1511bedecb0caac9ULL, 51, 49},
+    {0x1511bedecb0caac9ULL, 43, 23},
+    {0x151410c4dc6a84aaULL, 20, 22},
+    {0x151410c4dc6a84aaULL, 38, 56},
+    {0x1533b1fe5ddaf120ULL, 50, 30},
+    {0x1533b1fe5ddaf120ULL, 69, 51},
+    {0x153d452d819c605cULL, 23, 59},
+    {0x154bf6bae8413929ULL, 11, 10},
+    {0x154bf6bae8413929ULL, 11, 19},
+    {0x155233f5d1dc612aULL, 19, 39},
+    {0x157bb8b4d1a80446ULL, 59, 57},
+    {0x157bb8b4d1a80446ULL, 60, 51},
+    {0x157bb8b4d1a80446ULL, 31, 13},
+    {0x157bb8b4d1a80446ULL, 33, 32},
+    {0x159b690d99cd3ad3ULL, 60, 51},
+    {0x159c97f36bf96034ULL, 38, 40},
+    {0x15a82f6880cd68d5ULL, 2, 38},
+    {0x15d7fa37911b4d0fULL, 60, 59},
+    {0x160c3adfa5739f6eULL, 70, 34},
+    {0x1624ec8c798e21c2ULL, 33, 42},
+    {0x1624ec8c798e21c2ULL, 12, 20},
+    {0x163c9a729ae5f9bfULL, 2, 38},
+    {0x16526383b8b26667ULL, 30, 38},
+    {0x1654660a6f33c2eeULL, 18, 2},
+    {0x166fe35f65c5b5a4ULL, 79, 61},
+    {0x16c686efcbf4f040ULL, 19, 21},
+    {0x16c686efcbf4f040ULL, 19, 39},
+    {0x16c686efcbf4f040ULL, 19, 21},
+    {0x16c686efcbf4f040ULL, 19, 39},
+    {0x16c686efcbf4f040ULL, 19, 21},
+    {0x16c686efcbf4f040ULL, 19, 39},
+    {0x16c686efcbf4f040ULL, 19, 21},
+    {0x16c686efcbf4f040ULL, 19, 39},
+    {0x16c686efcbf4f040ULL, 19, 21},
+    {0x16c686efcbf4f040ULL, 19, 39},
+    {0x16c686efcbf4f040ULL, 19, 21},
+    {0x16d6d6a09d734302ULL, 42, 33},
+    {0x16d6d6a09d734302ULL, 77, 59},
+    {0x16d6d6a09d734302ULL, 42, 33},
+    {0x16df2d33a081c43aULL, 11, 20},
+    {0x16ec1ea2b36f3e99ULL, 29, 38},
+    {0x16ec5c36c9a28462ULL, 10, 30},
+    {0x16f902cdf505b994ULL, 18, 19},
+    {0x171f6016a22320d7ULL, 39, 41},
+    {0x174f4cfe2fdce526ULL, 11, 20},
+    {0x1750389008eb10e0ULL, 1, 21},
+    {0x176f3761b621efa8ULL, 51, 31},
+    {0x17928d42313fd39dULL, 51, 43},
+    {0x17bc82ce69fece18ULL, 77, 59},
+    {0x17c6ecac16374c3bULL, 68, 60},
+    {0x17cac55d773c6f79ULL, 29, 30},
+    {0x17cea7d23439ac2cULL, 29, 31},
+    {0x17dce5227a5ea0bbULL, 0, 22},
+    {0x17dea919005f8a0bULL, 39, 19},
+    {0x17e90c9d635bc37dULL, 21, 41},
+    {0x17e999d4d6ace8f9ULL, 80, 60},
+    {0x17f76bba9c0e2ef1ULL, 51, 50},
+    {0x17febf86d53cd46aULL, 30, 50},
+    {0x17ff635643e8430fULL, 42, 41},
+    {0x18195de2b24e061cULL, 47, 39},
+    {0x183118be73899afdULL, 48, 66},
+    {0x1838af8059988a98ULL, 29, 33},
+    {0x1838af8059988a98ULL, 48, 57},
+    {0x184fea75c32ff6ebULL, 51, 33},
+    {0x18501ec73af859c1ULL, 11, 33},
+    {0x188b3e47751807f2ULL, 10, 30},
+    {0x18a70724b9b1d296ULL, 40, 22},
+    {0x18a87e2e08e0e218ULL, 1, 2},
+    {0x18b046d27e8a04f7ULL, 59, 57},
+    {0x18ba5da3e65f67d9ULL, 19, 20},
+    {0x18d330e230acc28aULL, 29, 51},
+    {0x18dd4edebd4c54a7ULL, 20, 22},
+    {0x18fa04432ce50545ULL, 33, 13},
+    {0x19101861cab5447bULL, 22, 31},
+    {0x192797704a493544ULL, 10, 32},
+    {0x193e60789e032844ULL, 69, 33},
+    {0x194ce8e2115a6c24ULL, 47, 11},
+    {0x196e24016ac96c3cULL, 10, 30},
+    {0x196e24016ac96c3cULL, 10, 12},
+    {0x1992e885014412efULL, 68, 48},
+    {0x19b82408dde9f801ULL, 69, 60},
+    {0x1a0dc5c72123309fULL, 58, 56},
+    {0x1a2316631a2f4745ULL, 58, 57},
+    {0x1a3113dae50e32c3ULL, 27, 47},
+    {0x1a343a6dc56a3105ULL, 20, 56},
+    {0x1a3c5ab7eb114e05ULL, 52, 48},
+    {0x1a3fba64ceb5f5d4ULL, 60, 24},
+    {0x1a51cbe1fb26cfa9ULL, 49, 50},
+    {0x1a51cbe1fb26cfa9ULL, 49, 58},
+    {0x1a5ce9b23303c58eULL, 41, 40},
+    {0x1a5f46e7e03090caULL, 47, 48},
+    {0x1a6eff696a6656ecULL, 50, 30},
+    {0x1a8e73195eb33e17ULL, 20, 11},
+    {0x1a9dbe169c3842eaULL, 33, 24},
+    {0x1abfdb85c7d3453eULL, 0, 22},
+    {0x1ac5c1921f7962eeULL, 28, 30},
+    {0x1b1d09eaa77e1054ULL, 21, 41},
+    {0x1b2647a81c359f51ULL, 39, 57},
+    {0x1b80d978776e0019ULL, 10, 32},
+    {0x1b872c7f977a2163ULL, 79, 57},
+    {0x1bd04d2758ec51aeULL, 15, 24},
+    {0x1bdf71fe951a3935ULL, 38, 24},
+    {0x1c2f4cb7fc6188cbULL, 9, 29},
+    {0x1c567700ce140232ULL, 59, 50},
+    {0x1c5aa6e7f1b30cb7ULL, 71, 51},
+    {0x1c771a8829aaa906ULL, 69, 60},
+    {0x1c899dc0d1e50d25ULL, 41, 23},
+    {0x1c899dc0d1e50d25ULL, 68, 60},
+    {0x1ce6b0f6c73ba2a9ULL, 70, 62},
+    {0x1ceac5230f0bc1edULL, 58, 40},
+    {0x1d3087eb6298e126ULL, 37, 55},
+    {0x1d37ffa7f6488f1dULL, 58, 49},
+    {0x1d4330343d6a162cULL, 29, 30},
+    {0x1d46406a97da937bULL, 19, 23},
+    {0x1d4dfe232676e3ebULL, 61, 41},
+    {0x1d5cabe32cf0ef5aULL, 39, 41},
+    {0x1d626f4361606627ULL, 30, 12},
+    {0x1d7430f5c7208e60ULL, 78, 42},
+    {0x1d84608b87f5cb91ULL, 41, 39},
+    {0x1d8c905f13831d53ULL, 67, 68},
+    {0x1d914ed8e866f9b9ULL, 32, 10},
+    {0x1ddcd5bdba09f505ULL, 52, 50},
+    {0x1ddcd5bdba09f505ULL, 13, 14},
+    {0x1de58a1df429c2beULL, 10, 50},
+    {0x1ded0738aa62b269ULL, 0, 20},
+    {0x1df110c23df5a54bULL, 11, 29},
+    {0x1e1e729b0907ed8aULL, 58, 49},
+    {0x1e1e729b0907ed8aULL, 42, 33},
+    {0x1e40b7c713aebabcULL, 18, 20},
+    {0x1e45248fb22e7862ULL, 21, 23},
+    {0x1e45248fb22e7862ULL, 20, 29},
+    {0x1e45248fb22e7862ULL, 21, 25},
+    {0x1e645494bf693d75ULL, 61, 59},
+    {0x1e6ff36358496e2cULL, 61, 59},
+    {0x1e8725e8da5b59f6ULL, 3, 21},
+    {0x1e8e1a071644198fULL, 68, 34},
+    {0x1ec3bbb8cdf8a4b6ULL, 62, 61},
+    {0x1ed4dc3f87c5fb83ULL, 79, 71},
+    {0x1ed4dc3f87c5fb83ULL, 59, 51},
+    {0x1f1ded40ef99893eULL, 13, 15},
+    {0x1f8c9f10308ad6b8ULL, 69, 33},
+    {0x1fa1199c49a1b15fULL, 37, 39},
+    {0x1faf9047ccbb9335ULL, 11, 47},
+    {0x1fcea5b51b630591ULL, 48, 66},
+    {0x1fd07a36cd2b3a9eULL, 32, 28},
+    {0x1fe7e191fe76cb4fULL, 2, 38},
+    {0x2008d005f2d63875ULL, 33, 41},
+    {0x201c6c126103afbcULL, 58, 57},
+    {0x201c6c126103afbcULL, 68, 59},
+    {0x20266d8b474b6fe0ULL, 32, 34},
+    {0x2046aed30a413bd1ULL, 20, 12},
+    {0x20533f27c23c06d1ULL, 57, 48},
+    {0x20ac8c5e60df3caeULL, 19, 23},
+    {0x20c34ac751a58d1aULL, 30, 34},
+    {0x20dc4df88a10e113ULL, 32, 30},
+    {0x20e3c9c2a10ced64ULL, 20, 29},
+    {0x20f1ce09425ed7adULL, 51, 33},
+    {0x2120091f591cb360ULL, 2, 22},
+    {0x2121c0f40ef216f1ULL, 30, 48},
+    {0x218d189a34a3a9c8ULL, 21, 23},
+    {0x21c9e8c7219ee682ULL, 29, 31},
+    {0x21c9e8c7219ee682ULL, 29, 33},
+    {0x21d29ad98f577d9eULL, 30, 48},
+    {0x21f83922bbfcef2bULL, 11, 12},
+    {0x220032dd32b9967fULL, 58, 40},
+    {0x220d4ee8013076a8ULL, 66, 68},
+    {0x2231c2908554bf96ULL, 70, 50},
+    {0x2231c2908554bf96ULL, 70, 34},
+    {0x2231c2908554bf96ULL, 69, 49},
+    {0x2236bb0f86fb8bafULL, 59, 41},
+    {0x2280f160e50ebefdULL, 3, 12},
+    {0x2280f160e50ebefdULL, 27, 28},
+    {0x2280f160e50ebefdULL, 19, 28},
+    {0x2280f160e50ebefdULL, 3, 12},
+    {0x2290f4f4c5749765ULL, 0, 22},
+    {0x22af0dc897db9f2bULL, 42, 38},
+    {0x22bcc462eb3c9a1dULL, 28, 34},
+    {0x22bcc462eb3c9a1dULL, 38, 56},
+    {0x22bcc462eb3c9a1dULL, 22, 30},
+    {0x22f003048d579c97ULL, 38, 58},
+    {0x22fdd379838eb43aULL, 70, 69},
+    {0x230b2e6eb898a508ULL, 32, 14},
+    {0x2317007a4cae30a4ULL, 29, 31},
+    {0x2355e5fb2d31ea46ULL, 38, 40},
+    {0x23975a5c70578c27ULL, 37, 61},
+    {0x23a6ad6004f1ec13ULL, 11, 12},
+    {0x23bbd1e933ca1162ULL, 11, 2},
+    {0x23d1a812037dc939ULL, 19, 23},
+    {0x23d2c1f3586b5ec3ULL, 22, 31},
+    {0x23d49563d3ba1966ULL, 41, 39},
+    {0x23d50c8e947e993aULL, 62, 24},
+    {0x23d84204fa0d25efULL, 79, 41},
+    {0x23e4dc7e1df5e058ULL, 46, 47},
+    {0x23e4dc7e1df5e058ULL, 22, 31},
+    {0x23e8f256a245820bULL, 39, 41},
+    {0x23f900a5399d174aULL, 9, 47},
+    {0x23fc302d96ae7534ULL, 79, 78},
+    {0x240720e7d2119aa9ULL, 23, 41},
+    {0x240720e7d2119aa9ULL, 22, 40},
+    {0x2411020b58d62764ULL, 41, 59},
+    {0x242e7060b3b5c60dULL, 1, 37},
+    {0x24405327845ea049ULL, 62, 60},
+    {0x244a933e515a1c9bULL, 70, 61},
+    {0x244f166a46ac1757ULL, 66, 68},
+    {0x246561b8318ecf9eULL, 62, 70},
+    {0x2468974a02b2335aULL, 20, 38},
+    {0x2468974a02b2335aULL, 29, 15},
+    {0x248eaf8b5f626494ULL, 59, 55},
+    {0x249f3239e401973fULL, 28, 48},
+    {0x249f3239e401973fULL, 47, 69},
+    {0x24c5b43ff70e2ea6ULL, 47, 67},
+    {0x24cdf7f87fe4b26eULL, 0, 22},
+    {0x24ef26f94930fdb0ULL, 59, 55},
+    {0x250dd1dc671718bcULL, 51, 50},
+    {0x250dd1dc671718bcULL, 47, 13},
+    {0x252da78d65d22d7fULL, 51, 42},
+    {0x25476ecb059fa4a3ULL, 50, 32},
+    {0x255ca9813a46359fULL, 30, 28},
+    {0x255ca9813a46359fULL, 60, 58},
+    {0x255ee78f17d1d6bdULL, 22, 23},
+    {0x256dd9ec07232da0ULL, 41, 21},
+    {0x2571709c2d9cb271ULL, 24, 33},
+    {0x2571709c2d9cb271ULL, 29, 21},
+    {0x25ab6b33aa2e6184ULL, 79, 57},
+    {0x25ba062b177a66dbULL, 38, 47},
+    {0x25bc5e5290e284d9ULL, 31, 51},
+    {0x25e38aec9c127fefULL, 58, 40},
+    {0x260234d5f37dc0b1ULL, 58, 50},
+    {0x2630bf4a97e9f782ULL, 62, 70},
+    {0x26492fd8ecbb3a7aULL, 70, 61},
+    {0x267ac2eea986a683ULL, 0, 22},
+    {0x2698e740822eff60ULL, 22, 60},
+    {0x269e3c82fe75307eULL, 80, 58},
+    {0x26bf41a14436e6b8ULL, 29, 38},
+    {0x26e7a678c8344f5aULL, 38, 47},
+    {0x270d7dd05cdd52a6ULL, 77, 59},
+    {0x27130bb071400d53ULL, 39, 48},
+    {0x2724ae6e8bfb8a6dULL, 22, 42},
+    {0x273c40910a27c99aULL, 24, 32},
+    {0x273f5309a85b1031ULL, 56, 47},
+    {0x273f5309a85b1031ULL, 43, 59},
+    {0x275111c0b77ec7b0ULL, 21, 23},
+    {0x27715bd9361a173cULL, 11, 65},
+    {0x2775dfcc657dd4d6ULL, 13, 14},
+    {0x277e5e8a25b6426aULL, 1, 2},
+    {0x27a2ffbe7ded9602ULL, 42, 40},
+    {0x27ba42bcc8e510a8ULL, 50, 46},
+    {0x27d207ce7d1db5c1ULL, 78, 58},
+    {0x2800bc0ab79e3dd8ULL, 42, 24},
+    {0x282e18d846fd0d26ULL, 30, 32},
+    {0x285d64f0820e8428ULL, 69, 67},
+    {0x285d64f0820e8428ULL, 59, 57},
+    {0x287691628ad72437ULL, 21, 39},
+    {0x2880d39d6f76e684ULL, 60, 24},
+    {0x288549dc81e37c20ULL, 41, 61},
+    {0x2886665d64120255ULL, 60, 58},
+    {0x289e4c029dbf16daULL, 21, 57},
+    {0x28a4c4752968c93fULL, 12, 32},
+    {0x28ba807db6e19da5ULL, 41, 23},
+    {0x28cc4d36f0fd6567ULL, 19, 21},
+    {0x28cc8192e8167fe7ULL, 58, 49},
+    {0x28d60956f60cd924ULL, 60, 40},
+    {0x28d94ad1c52fd4d1ULL, 60, 59},
+    {0x28d94ad1c52fd4d1ULL, 60, 51},
+    {0x290ab694b0169aedULL, 3, 12},
+    {0x290d373d3a5aeb48ULL, 42, 38},
+    {0x299db05a454b4cf7ULL, 51, 50},
+    {0x299db05a454b4cf7ULL, 68, 52},
+    {0x299db05a454b4cf7ULL, 51, 52},
+    {0x29bc5a0eafe54fc6ULL, 10, 2},
+    {0x29d0ec2c9b842c6dULL, 48, 39},
+    {0x29e500bc63a32a3bULL, 80, 42},
+    {0x29ebc45e10387ee2ULL, 42, 33},
+    {0x2a1546d0a5905446ULL, 49, 13},
+    {0x2a3b872592eb63b4ULL, 21, 57},
+    {0x2a3b872592eb63b4ULL, 42, 50},
+    {0x2a6122ed2d875a18ULL, 68, 66},
+    {0x2a95d5383820e522ULL, 9, 29},
+    {0x2abb1540d5912a5fULL, 77, 57},
+    {0x2abb8f7b4968922bULL, 11, 31},
+    {0x2aceb7d6cc0e001aULL, 39, 40},
+    {0x2aefbfc94ad28b2bULL, 77, 59},
+    {0x2af3275a9eee45f4ULL, 59, 57},
+    {0x2af56a2f848ef1c2ULL, 33, 24},
+    {0x2b07f7d482d7d427ULL, 33, 24},
+    {0x2b07f7d482d7d427ULL, 22, 20},
+    {0x2b07f7d482d7d427ULL, 41, 23},
+    {0x2b150b962e878cc8ULL, 48, 52},
+    {0x2b1819feb2afddb6ULL, 19, 23},
+    {0x2b352ce37d08a8c4ULL, 69, 51},
+    {0x2b61e143c0836c95ULL, 12, 14},
+    {0x2b90f01efe623adeULL, 22, 31},
+    {0x2b9800f7bf897f0eULL, 1, 21},
+    {0x2b997257af92d311ULL, 47, 29},
+    {0x2bb74e1d9170faa5ULL, 24, 33},
+    {0x2bb7c13e62f0744dULL, 11, 20},
+    {0x2bb8483a3b7b265cULL, 20, 56},
+    {0x2bc8d5fa4097e7e6ULL, 3, 12},
+    {0x2be5f4882195f8cdULL, 2, 20},
+    {0x2be620cf2aa8b652ULL, 10, 32},
+    {0x2bfd0c82a163da3dULL, 59, 60},
+    {0x2bfd0c82a163da3dULL, 29, 38},
+    {0x2c052134da579e7cULL, 57, 49},
+    {0x2c24bce43a68702fULL, 51, 31},
+    {0x2c3200ad6a5e1c39ULL, 71, 51},
+    {0x2c6582e7d379e062ULL, 3, 39},
+    {0x2c6ec8a322ffb421ULL, 40, 2},
+    {0x2cd1ac4f97c14e2cULL, 29, 30},
+    {0x2ceab58df76652a0ULL, 59, 57},
+    {0x2cedb266f07c24e9ULL, 49, 51},
+    {0x2cfbe3f7334d4bdfULL, 33, 51},
+    {0x2cfbe3f7334d4bdfULL, 48, 68},
+    {0x2d1215b934feb534ULL, 53, 51},
+    {0x2d208facc8a411eaULL, 11, 29},
+    {0x2d33b6e68942282fULL, 9, 13},
+    {0x2d41fce6bb6ed775ULL, 51, 47},
+    {0x2d4b730c4b7805a2ULL, 0, 40},
+    {0x2d4eb7eff9fe6035ULL, 58, 40},
+    {0x2d5451b7de773156ULL, 27, 29},
+    {0x2d5a1e0590623a61ULL, 69, 60},
+    {0x2d76d229113c7105ULL, 55, 39},
+    {0x2d76d229113c7105ULL, 23, 39},
+    {0x2d7fed3d9be67fddULL, 49, 51},
+    {0x2d8999a9ba4a879eULL, 61, 41},
+    {0x2da00e205efcb4d2ULL, 53, 33},
+    {0x2da14eafdee729a2ULL, 43, 42},
+    {0x2dc3682cb9a31e6aULL, 3, 21},
+    {0x2e1628b4a1c9142eULL, 70, 32},
+    {0x2e2e90a3c56588f2ULL, 19, 57},
+    {0x2e2ec27162c3f5feULL, 70, 50},
+    {0x2e2ec27162c3f5feULL, 70, 32},
+    {0x2e2ec27162c3f5feULL, 70, 50},
+    {0x2e2ec27162c3f5feULL, 70, 32},
+    {0x2e2ec27162c3f5feULL, 70, 50},
+    {0x2e2ec27162c3f5feULL, 70, 32},
+    {0x2e2ec27162c3f5feULL, 70, 50},
+    {0x2e2ec27162c3f5feULL, 70, 32},
+    {0x2e2ec27162c3f5feULL, 70, 50},
+    {0x2e2ec27162c3f5feULL, 70, 32},
+    {0x2e5ed6082332ca31ULL, 23, 41},
+    {0x2e77f772bc201503ULL, 79, 78},
+    {0x2e8b92e643682b39ULL, 51, 31},
+    {0x2f02b10404a97174ULL, 38, 58},
+    {0x2f03655243267f8cULL, 78, 42},
+    {0x2f42dd63c57f5337ULL, 42, 24},
+    {0x2f76d00683abc560ULL, 11, 12},
+    {0x2f772baa97c373edULL, 33, 24},
+    {0x2fa8b422e294bf7aULL, 42, 24},
+    {0x2fc6f06e12545ec9ULL, 20, 56},
+    {0x2fcf20a03569fb9aULL, 40, 20},
+    {0x2fd8712582d7f794ULL, 38, 40},
+    {0x2fdd7a890a55025fULL, 19, 39},
+    {0x2fdf7fc993450ae1ULL, 0, 20},
+    {0x2fe1f60262b6dae7ULL, 47, 69},
+    {0x2ff2361320f6c05eULL, 32, 30},
+    {0x2ff4d81741fd87d5ULL, 22, 20},
+    {0x3001abdfa46f48f7ULL, 58, 56},
+    {0x3003d4b2e06327c0ULL, 52, 48},
+    {0x303f0c2cd5c07c37ULL, 10, 28},
+    {0x3054994e7f7cf80aULL, 77, 41},
+    {0x3054994e7f7cf80aULL, 51, 50},
+    {0x3054994e7f7cf80aULL, 77, 59},
+    {0x3054994e7f7cf80aULL, 51, 59},
+    {0x3070c5fc91dcd5beULL, 40, 58},
+    {0x3085e05762f4be47ULL, 58, 62},
+    {0x308eab503fda5e76ULL, 32, 14},
+    {0x30a1b3cd8e703ea3ULL, 70, 14},
+    {0x30a1b3cd8e703ea3ULL, 49, 31},
+    {0x30ca8ca0bae971a9ULL, 70, 48},
+    {0x30fb3547b20c1289ULL, 21, 23},
+    {0x310010529c8a0470ULL, 60, 58},
+    {0x31139aa72fcc4833ULL, 3, 21},
+    {0x3136cc5b1c93f974ULL, 62, 61},
+    {0x31462d395b641e00ULL, 79, 70},
+    {0x31462d395b641e00ULL, 51, 31},
+    {0x31462d395b641e00ULL, 79, 70},
+    {0x31462d395b641e00ULL, 52, 68},
+    {0x31462d395b641e00ULL, 79, 70},
+    {0x31619463b7c6c4faULL, 47, 51},
+    {0x31702b521ec68526ULL, 52, 50},
+    {0x319cb39dcc7f2572ULL, 59, 57},
+    {0x319cb39dcc7f2572ULL, 49, 27},
+    {0x319cb39dcc7f2572ULL, 32, 23},
+    {0x319dcec3851d34f9ULL, 23, 19},
+    {0x31a29d6ebfd3106aULL, 0, 22},
+    {0x31a29d6ebfd3106aULL, 18, 22},
+    {0x31b2d519658dc27bULL, 57, 21},
+    {0x31bd43bbdf3bcdf7ULL, 71, 51},
+    {0x31c344b28aa61598ULL, 60, 51},
+    {0x321925d206bde923ULL, 3, 21},
+    {0x322c8b748df35190ULL, 41, 23},
+    {0x32715bf41bdbfcfbULL, 28, 52},
+    {0x3280b5ad883c5f84ULL, 39, 57},
+    {0x32855e29eed3be4fULL, 68, 50},
+    {0x32872fbd35e4d959ULL, 29, 30},
+    {0x329edc1e3f1cc150ULL, 71, 49},
+    {0x32d2496c63b1d382ULL, 1, 2},
+    {0x32debda9ebb1a131ULL, 31, 49},
+    {0x32e8bd610744dee2ULL, 12, 30},
+    {0x32fce0b2fb50ef65ULL, 49, 31},
+    {0x32fce0b2fb50ef65ULL, 49, 13},
+    {0x32fce0b2fb50ef65ULL, 49, 31},
+    {0x32fce0b2fb50ef65ULL, 49, 13},
+    {0x3319eb175d7d5bcdULL, 56, 48},
+    {0x331acefc7a61e917ULL, 20, 22},
+    {0x33350ea0b761fca2ULL, 29, 38},
+    {0x333f64377f34059fULL, 22, 40},
+    {0x333f64377f34059fULL, 18, 10},
+    {0x336396e655487cffULL, 20, 56},
+    {0x3371389fb2e1c24fULL, 22, 24},
+    {0x3377629b10c3582eULL, 58, 49},
+    {0x33794d407455062fULL, 78, 42},
+    {0x337dfb08defcdd0eULL, 61, 57},
+    {0x33921208a03ff309ULL, 50, 30},
+    {0x339dda1c4b8dd652ULL, 47, 51},
+    {0x33a4dd1d59417144ULL, 70, 52},
+    {0x33a94b02a918715eULL, 62, 60},
+    {0x33aa73d456d322f1ULL, 78, 70},
+    {0x33d7f864f5848411ULL, 20, 21},
+    {0x33f03674efeffb99ULL, 18, 19},
+    {0x340839d679af3235ULL, 41, 39},
+    {0x3419bb161022069cULL, 59, 57},
+    {0x344205eaf29af8d4ULL, 40, 31},
+    {0x346d0edd7bf4a6e6ULL, 62, 70},
+    {0x348eba6c4e3a9022ULL, 22, 31},
+    {0x349cf24630fefa32ULL, 60, 40},
+    {0x34abac5402365c35ULL, 29, 38},
+    {0x34abd7b7260d4102ULL, 58, 38},
+    {0x34abd7b7260d4102ULL, 58, 40},
+    {0x34abd7b7260d4102ULL, 58, 38},
+    {0x34bf7a429f6d4661ULL, 33, 47},
+    {0x34bf7a429f6d4661ULL, 68, 34},
+    {0x34ccd41673acbbcbULL, 33, 34},
+    {0x34e586bc234644b7ULL, 77, 59},
+    {0x34e800cf10159c8cULL, 33, 13},
+    {0x34ef99936a776401ULL, 23, 32},
+    {0x34f62a3c2aa629ebULL, 58, 57},
+    {0x34f630ffcfc87e70ULL, 50, 32},
+    {0x3501b261d5743a8fULL, 56, 47},
+    {0x356c6a3d9de46599ULL, 70, 69},
+    {0x35791ff967e6db09ULL, 19, 39},
+    {0x359d8926f34ef12fULL, 23, 32},
+    {0x35fe2167bcf84ba3ULL, 30, 70},
+    {0x35fe2167bcf84ba3ULL, 9, 29},
+    {0x35fe2167bcf84ba3ULL, 30, 50},
+    {0x35fe2167bcf84ba3ULL, 31, 49},
+    {0x361824ceb59d0e31ULL, 51, 49},
+    {0x362402c052e46c08ULL, 58, 67},
+    {0x362ea5f5a8c7bc00ULL, 61, 60},
+    {0x363534b2bb6c4c4fULL, 78, 60},
+    {0x3659f8aee0b80b27ULL, 70, 50},
+    {0x36716f450842ceeaULL, 20, 56},
+    {0x367d5e0e5466b1a6ULL, 79, 59},
+    {0x368fa97d3a2b4abaULL, 11, 49},
+    {0x368fa97d3a2b4abaULL, 11, 65},
+    {0x36909e8e83af4618ULL, 23, 19},
+    {0x3691befc4027f07fULL, 21, 23},
+    {0x3691befc4027f07fULL, 11, 13},
+    {0x369480e5d2411520ULL, 41, 23},
+    {0x36a76221756affdcULL, 33, 32},
+    {0x36b64dc6a2d7c6a7ULL, 0, 22},
+    {0x36d8871874554674ULL, 78, 60},
+    {0x36dde66d09b43f4fULL, 38, 78},
+    {0x370403f735010a1fULL, 22, 42},
+    {0x370ba1888249829aULL, 10, 19},
+    {0x37202da9f19dcbc2ULL, 37, 46},
+    {0x37208e7828284370ULL, 19, 21},
+    {0x37208e7828284370ULL, 19, 39},
+    {0x37383c23239ec641ULL, 58, 67},
+    {0x37383c23239ec641ULL, 22, 40},
+    {0x37400df734b50a78ULL, 31, 11},
+    {0x376a5ebf499620f6ULL, 33, 29},
+    {0x37848a966d525906ULL, 29, 31},
+    {0x379a06088d855d24ULL, 28, 48},
+    {0x379a06088d855d24ULL, 0, 22},
+    {0x379a06088d855d24ULL, 28, 48},
+    {0x379a06088d855d24ULL, 0, 22},
+    {0x379a06088d855d24ULL, 28, 48},
+    {0x379a06088d855d24ULL, 0, 22},
+    {0x379a06088d855d24ULL, 28, 48},
+    {0x37a1c55400505790ULL, 9, 31},
+    {0x37cc3fcd199533faULL, 52, 10},
+    {0x37f03726c4ca3307ULL, 38, 24},
+    {0x37f03726c4ca3307ULL, 1, 21},
+    {0x382ad973ac29059eULL, 23, 24},
+    {0x386885bd5921ab7fULL, 20, 22},
+    {0x388b7208c8df13e7ULL, 58, 49},
+    {0x3891d7ce6850db08ULL, 70, 48},
+    {0x3896273ac835a0a3ULL, 31, 11},
+    {0x38a15293b2c63a52ULL, 52, 51},
+    {0x38bd8573abdcc558ULL, 12, 48},
+    {0x38c6279194dc0e98ULL, 59, 57},
+    {0x38cba98fbdce4e49ULL, 0, 22},
+    {0x392a8135a21b349dULL, 30, 50},
+    {0x393036f7bdf233bcULL, 41, 1},
+    {0x394826af5630d311ULL, 29, 49},
+    {0x394826af5630d311ULL, 29, 33},
+    {0x394826af5630d311ULL, 22, 23},
+    {0x394826af5630d311ULL, 22, 24},
+    {0x3949fb6adab6d603ULL, 78, 42},
+    {0x395896f60976985dULL, 31, 22},
+    {0x395896f60976985dULL, 31, 30},
+    {0x397336d9290fa83bULL, 51, 31},
+    {0x397336d9290fa83bULL, 51, 13},
+    {0x39bc175b1abe4ceaULL, 69, 49},
+    {0x39d071b470561545ULL, 59, 41},
+    {0x39f1daf046a78480ULL, 80, 58},
+    {0x3a0652127934717bULL, 32, 14},
+    {0x3a0652127934717bULL, 49, 31},
+    {0x3a29a5bc8221c128ULL, 20, 22},
+    {0x3a55f912255d432bULL, 79, 70},
+    {0x3a8b3b896760645aULL, 30, 32},
+    {0x3acbdc5e1a575af7ULL, 69, 60},
+    {0x3b018ca2267d877cULL, 42, 22},
+    {0x3b0eca9d96340d5bULL, 32, 14},
+    {0x3b148a268d4a216aULL, 23, 31},
+    {0x3b1f499375099877ULL, 61, 41},
+    {0x3b42ce99b8f01e9fULL, 49, 50},
+    {0x3b45558f16edafc2ULL, 42, 56},
+    {0x3b93742783323548ULL, 70, 48},
+    {0x3ba722d8a5879131ULL, 42, 33},
+    {0x3ba89a8b5599a08bULL, 27, 31},
+    {0x3bc418f5b40e5214ULL, 40, 78},
+    {0x3bd3a8880c98bf20ULL, 22, 40},
+    {0x3bdedeba2a64dc1aULL, 61, 41},
+    {0x3c185e8a897e399fULL, 51, 42},
+    {0x3c3b6de3338bd066ULL, 3, 21},
+    {0x3c621aa6821af4c3ULL, 40, 42},
+    {0x3c8883bd6115c5dfULL, 60, 51},
+    {0x3cd3c77f10ab444eULL, 20, 21},
+    {0x3cd7db8e93e8710eULL, 22, 18},
+    {0x3cdff94ac6de3c15ULL, 11, 13},
+    {0x3ce37e8d903af349ULL, 62, 60},
+    {0x3d1510f7d07d1de7ULL, 3, 21},
+    {0x3d1e62d17bac5541ULL, 28, 32},
+    {0x3d92298457867082ULL, 80, 58},
+    {0x3da9922704f28479ULL, 60, 59},
+    {0x3dc486ac9ae85cfaULL, 42, 56},
+    {0x3def67db480c87e9ULL, 21, 39},
+    {0x3e2ef0e35c9359bfULL, 2, 20},
+    {0x3e404df9e1015604ULL, 70, 48},
+    {0x3e405e0af0de5e78ULL, 30, 34},
+    {0x3e40a1183d86c742ULL, 41, 1},
+    {0x3e5d948afeccc000ULL, 61, 52},
+    {0x3e7019f7cf0143feULL, 41, 32},
+    {0x3e787fc2a932c3e1ULL, 79, 59},
+    {0x3e7f2af3176f9a08ULL, 28, 32},
+    {0x3e8c58f5e5e9c48bULL, 3, 21},
+    {0x3ead95b1ec77062dULL, 50, 52},
+    {0x3ed437f56a8ee833ULL, 78, 24},
+    {0x3ed6dcca6fb5b81aULL, 48, 66},
+    {0x3ed6ede0b259cc7bULL, 42, 40},
+    {0x3eed13e90ac671b2ULL, 29, 38},
+    {0x3ef6862bf0a564afULL, 48, 50},
+    {0x3efcc474958c3899ULL, 50, 46},
+    {0x3f0ce81ae839c072ULL, 20, 40},
+    {0x3f333ebedd27d020ULL, 21, 23},
+    {0x3f413072a0c9dea9ULL, 52, 30},
+    {0x3f682b312f5ef8d2ULL, 42, 33},
+    {0x3f7e96cc0a4747e2ULL, 28, 29},
+    {0x3fd192c75df702d3ULL, 33, 13},
+    {0x406a50fc5c947c91ULL, 40, 38},
+    {0x406bf4c669a9f4d2ULL, 68, 50},
+    {0x407d84225bcc73a3ULL, 10, 30},
+    {0x408dfd48c1d62ccfULL, 40, 41},
+    {0x40901f11f4896cacULL, 80, 58},
+    {0x40901f11f4896cacULL, 52, 32},
+    {0x40901f11f4896cacULL, 80, 58},
+    {0x40901f11f4896cacULL, 52, 32},
+    {0x40901f11f4896cacULL, 80, 58},
+    {0x40901f11f4896cacULL, 52, 32},
+    {0x40901f11f4896cacULL, 80, 58},
+    {0x40901f11f4896cacULL, 52, 32},
+    {0x40901f11f4896cacULL, 80, 58},
+    {0x40901f11f4896cacULL, 52, 32},
+    {0x4092d22f286c677fULL, 60, 52},
+    {0x40c9f2c375cad798ULL, 20, 40},
+    {0x40d7a2510ed473d9ULL, 60, 58},
+    {0x40dc85910cc1465cULL, 47, 39},
+    {0x414b234e160c6f66ULL, 51, 47},
+    {0x415e28e89ccc826aULL, 37, 38},
+    {0x415ee4c257d7732eULL, 1, 39},
+    {0x41650272300563d6ULL, 21, 23},
+    {0x4169286e5fc5c1fcULL, 40, 2},
+    {0x417a79592ffcb472ULL, 21, 30},
+    {0x41829e8ffa7afa4dULL, 77, 41},
+    {0x41829e8ffa7afa4dULL, 77, 57},
+    {0x4186c30b347e1a90ULL, 62, 70},
+    {0x418b9b78ae3257b9ULL, 68, 50},
+    {0x418c2ec5dde7d5fcULL, 57, 39},
+    {0x418c2ec5dde7d5fcULL, 68, 67},
+    {0x41b2f1f107a4b581ULL, 58, 57},
+    {0x41d330fd9907732fULL, 38, 47},
+    {0x41d330fd9907732fULL, 31, 33},
+    {0x41de53aa009f80beULL, 47, 67},
+    {0x41e47c32f28a4a30ULL, 70, 32},
+    {0x41ff8817c1662142ULL, 47, 67},
+    {0x42156653f24e6edaULL, 49, 51},
+    {0x427d28da1142ad10ULL, 79, 70},
+    {0x4298c992f5a36b01ULL, 60, 52},
+    {0x4298c992f5a36b01ULL, 10, 19},
+    {0x42a7e674e7332050ULL, 48, 39},
+    {0x42cfc04f5ee3230eULL, 52, 60},
+    {0x42d71697bfce9f2aULL, 43, 25},
+    {0x42f12f21413ca229ULL, 58, 57},
+    {0x42f8967663b96019ULL, 43, 42},
+    {0x4306a4b9b40d76e4ULL, 60, 51},
+    {0x432b3de049f7caf3ULL, 47, 46},
+    {0x438cd8b6e9b116eeULL, 62, 70},
+    {0x43a9829b7538312cULL, 59, 23},
+    {0x4419665c73202100ULL, 21, 30},
+    {0x442278811d59f38bULL, 39, 19},
+    {0x4465c193f3cd42c5ULL, 70, 68},
+    {0x4469d7c4387e9bcaULL, 11, 31},
+    {0x44aa5d15622e609fULL, 41, 40},
+    {0x44d9c61c05ef6190ULL, 14, 13},
+    {0x4502e273a203aaa4ULL, 55, 37},
+    {0x45049789a0163181ULL, 39, 79},
+    {0x45342b8726a1b690ULL, 47, 46},
+    {0x45342b8726a1b690ULL, 32, 48},
+    {0x453c17ee5becf656ULL, 13, 14},
+    {0x453c17ee5becf656ULL, 20, 38},
+    {0x453d4893c5e67f55ULL, 51, 33},
+    {0x453d4893c5e67f55ULL, 60, 59},
+    {0x455c4bb16b865896ULL, 69, 60},
+    {0x456bc1604e4488a0ULL, 12, 14},
+    {0x457a1f5f95568c49ULL, 21, 39},
+    {0x459df5f7b20648e2ULL, 40, 60},
+    {0x45df087fc0743054ULL, 60, 24},
+    {0x45e8c4660f2d428aULL, 31, 29},
+    {0x4604da48dd06c3f4ULL, 42, 56},
+    {0x46241b7e21ca5d59ULL, 38, 40},
+    {0x464c21563bf6a9d7ULL, 41, 19},
+    {0x46613cc8480815fbULL, 67, 68},
+    {0x468cb70cae39ea28ULL, 10, 11},
+    {0x469ffa64b35ffb80ULL, 69, 49},
+    {0x46a6554072a129b7ULL, 41, 39},
+    {0x46ab4faef67df78dULL, 31, 13},
+    {0x46ab4faef67df78dULL, 59, 57},
+    {0x46ab4faef67df78dULL, 50, 14},
+    {0x46ec325a39cad82fULL, 0, 22},
+    {0x46eef63d66470200ULL, 55, 39},
+    {0x46f6ba81f0eb7539ULL, 48, 66},
+    {0x46f92ba064b2257cULL, 51, 33},
+    {0x47106e24c7a7f405ULL, 41, 23},
+    {0x47136c5e1ccfd9d7ULL, 79, 59},
+    {0x471731d9f6606acbULL, 37, 21},
+    {0x473d6d31f65de10eULL, 31, 33},
+    {0x475d554f2efe6805ULL, 22, 31},
+    {0x476b3fd6dcb82f57ULL, 38, 40},
+    {0x4784f2bd36ff8548ULL, 18, 38},
+    {0x4784f2bd36ff8548ULL, 2, 38},
+    {0x4784f2bd36ff8548ULL, 18, 38},
+    {0x4784f2bd36ff8548ULL, 2, 38},
+    {0x4784f2bd36ff8548ULL, 18, 38},
+    {0x4784f2bd36ff8548ULL, 2, 38},
+    {0x4784f2bd36ff8548ULL, 18, 38},
+    {0x4784f2bd36ff8548ULL, 2, 38},
+    {0x4784f2bd36ff8548ULL, 18, 38},
+    {0x4784f2bd36ff8548ULL, 2, 38},
+    {0x4784f2bd36ff8548ULL, 18, 38},
+    {0x4784f2bd36ff8548ULL, 2, 38},
+    {0x4784f2bd36ff8548ULL, 18, 38},
+    {0x4784f2bd36ff8548ULL, 2, 38},
+    {0x4784f2bd36ff8548ULL, 18, 38},
+    {0x4784f2bd36ff8548ULL, 2, 38},
+    {0x47a36dee90503701ULL, 47, 48},
+    {0x47e1ed2804c61e6dULL, 22, 23},
+    {0x4801b2aeb6735ab8ULL, 21, 30},
+    {0x482bee342f0ac2c4ULL, 20, 42},
+    {0x4846f53d6cf389a0ULL, 12, 48},
+    {0x4846f53d6cf389a0ULL, 12, 30},
+    {0x484d86654a95d061ULL, 58, 38},
+    {0x48506b23184fe9a7ULL, 51, 33},
+    {0x486e3ccb5185bee1ULL, 21, 23},
+    {0x4894caad8b0b6992ULL, 30, 12},
+    {0x48a2be2806a27888ULL, 69, 68},
+    {0x48e1df9d4b038a68ULL, 12, 30},
+    {0x48e2028735d89f5fULL, 80, 58},
+    {0x48ff9adb353a489bULL, 70, 32},
+    {0x48ff9adb353a489bULL, 51, 47},
+    {0x48ff9adb353a489bULL, 70, 32},
+    {0x4906117d4684ffd1ULL, 12, 46},
+    {0x490d972d499346b7ULL, 50, 32},
+    {0x49823c7091aff22fULL, 42, 24},
+    {0x499e5c8c6c8dd426ULL, 47, 67},
+    {0x49c7874324cbe237ULL, 59, 23},
+    {0x49d3136e7fe14f8dULL, 61, 59},
+    {0x49f19ace61555cacULL, 69, 60},
+    {0x4a29e11be6206bafULL, 51, 50},
+    {0x4a530fa8d137e041ULL, 60, 51},
+    {0x4a553791e3ba8bb2ULL, 59, 41},
+    {0x4a575c6e84bb1afaULL, 12, 30},
+    {0x4a6c9a48cb361e38ULL, 29, 51},
+    {0x4a86087c838fa78fULL, 11, 47},
+    {0x4a8a423e7a1cc303ULL, 40, 78},
+    {0x4a8c3d536dd208baULL, 57, 41},
+    {0x4a8c3d536dd208baULL, 25, 41},
+    {0x4a91b0e0f7e57905ULL, 71, 70},
+    {0x4ac01263c3575ce9ULL, 58, 40},
+    {0x4ac01263c3575ce9ULL, 22, 13},
+    {0x4adc0dcda324ae80ULL, 39, 57},
+    {0x4adc0dcda324ae80ULL, 28, 37},
+    {0x4adc0dcda324ae80ULL, 39, 57},
+    {0x4adc0dcda324ae80ULL, 12, 13},
+    {0x4adc0dcda324ae80ULL, 39, 57},
+    {0x4adc0dcda324ae80ULL, 28, 37},
+    {0x4adde07cef41f0b7ULL, 51, 50},
+    {0x4ae180bb8aeac9dfULL, 11, 13},
+    {0x4b092d594afddd64ULL, 41, 23},
+    {0x4b1f83b8e9283fd7ULL, 47, 38},
+    {0x4b249e1a4bf2f9bfULL, 32, 23},
+    {0x4b249e1a4bf2f9bfULL, 51, 47},
+    {0x4b278a8496bd4facULL, 18, 10},
+    {0x4b5023293e7b416dULL, 11, 12},
+    {0x4b795a696c59def7ULL, 22, 31},
+    {0x4b795a696c59def7ULL, 48, 49},
+    {0x4b795a696c59def7ULL, 22, 31},
+    {0x4b795a696c59def7ULL, 48, 49},
+    {0x4b795a696c59def7ULL, 22, 31},
+    {0x4b795a696c59def7ULL, 48, 49},
+    {0x4b795a696c59def7ULL, 29, 67},
+    {0x4b795a696c59def7ULL, 48, 49},
+    {0x4bb18ce7548aa156ULL, 53, 52},
+    {0x4bed8e45e2c5e538ULL, 42, 22},
+    {0x4c0f0a5a113eb9ecULL, 33, 69},
+    {0x4c52cf60993db0d4ULL, 52, 60},
+    {0x4c8eff7cb7306134ULL, 18, 24},
+    {0x4c9826ad39450140ULL, 41, 23},
+    {0x4c9826ad39450140ULL, 69, 33},
+    {0x4d10665840444a87ULL, 69, 49},
+    {0x4d10665840444a87ULL, 69, 51},
+    {0x4d10665840444a87ULL, 69, 49},
+    {0x4d10665840444a87ULL, 69, 51},
+    {0x4d10665840444a87ULL, 69, 49},
+    {0x4d10665840444a87ULL, 69, 51},
+    {0x4d10665840444a87ULL, 69, 49},
+    {0x4d2f948a901d49e7ULL, 14, 13},
+    {0x4d7b373587cb99dbULL, 60, 59},
+    {0x4da2e428ac907411ULL, 22, 40},
+    {0x4dc81b0056d6bb87ULL, 19, 23},
+    {0x4dfa086c469a428dULL, 21, 30},
+    {0x4e001c3df4d8dcd3ULL, 52, 14},
+    {0x4e395ef7723254baULL, 29, 28},
+    {0x4e4470143465913eULL, 32, 50},
+    {0x4e4a03b88dd77914ULL, 56, 62},
+    {0x4e4a03b88dd77914ULL, 59, 43},
+    {0x4e4a03b88dd77914ULL, 21, 22},
+    {0x4e82beb3dfd27c16ULL, 21, 23},
+    {0x4e863c2bac383bbfULL, 20, 21},
+    {0x4e8c697af80bfee5ULL, 10, 11},
+    {0x4e8c697af80bfee5ULL, 52, 60},
+    {0x4e8c697af80bfee5ULL, 61, 60},
+    {0x4e9af6773d76c148ULL, 21, 57},
+    {0x4ec3d7c50300ac13ULL, 58, 60},
+    {0x4eced807739ae820ULL, 10, 32},
+    {0x4ed4b36b8cf94008ULL, 33, 13},
+    {0x4ef46f04d394e9d0ULL, 22, 13},
+    {0x4ef46f04d394e9d0ULL, 32, 14},
+    {0x4efd4b8dd7af4a80ULL, 48, 66},
+    {0x4f0260038cbfe046ULL, 51, 67},
+    {0x4f0dc54f1431e4aeULL, 51, 42},
+    {0x4f23ca18a1db1288ULL, 39, 57},
+    {0x4f23ca18a1db1288ULL, 11, 47},
+    {0x4f30a7b5c87e6b8dULL, 77, 43},
+    {0x4f30a7b5c87e6b8dULL, 53, 61},
+    {0x4f30a7b5c87e6b8dULL, 77, 43},
+    {0x4f30a7b5c87e6b8dULL, 53, 51},
+    {0x4f30a7b5c87e6b8dULL, 77, 43},
+    {0x4f30a7b5c87e6b8dULL, 53, 51},
+    {0x4f30a7b5c87e6b8dULL, 78, 60},
+    {0x4f30a7b5c87e6b8dULL, 77, 43},
+    {0x4f34bdd539de36eaULL, 59, 19},
+    {0x4f451570881be4d6ULL, 11, 47},
+    {0x4f5597a78453584eULL, 30, 22},
+    {0x4f71ece22083c260ULL, 66, 48},
+    {0x4f8e8453cefd907dULL, 66, 67},
+    {0x4f9ce7dfbe803fe9ULL, 61, 41},
+    {0x4ff9784ba33726d5ULL, 31, 32},
+    {0x5006cfb173572a25ULL, 2, 24},
+    {0x5013f59fc2db0617ULL, 12, 70},
+    {0x501559b0972ae583ULL, 22, 23},
+    {0x505c7d006a3ae819ULL, 29, 30},
+    {0x5060f2b5f4b70d4cULL, 21, 25},
+    {0x5060f2b5f4b70d4cULL, 21, 23},
+    {0x5060f2b5f4b70d4cULL, 37, 38},
+    {0x5060f2b5f4b70d4cULL, 21, 25},
+    {0x5088a004b741b642ULL, 70, 50},
+    {0x509c779093a789e4ULL, 39, 57},
+    {0x50a11bdde46496c8ULL, 11, 29},
+    {0x50a52f971ebdb103ULL, 41, 61},
+    {0x50c85ddbdb9c5351ULL, 62, 58},
+    {0x50d0bbaf59e9dddcULL, 40, 62},
+    {0x50dd3f4cc7fbb24dULL, 22, 58},
+    {0x50f84e6a8b631c58ULL, 68, 48},
+    {0x5100db192f623e8cULL, 41, 23},
+    {0x51061a8ed555b187ULL, 61, 43},
+    {0x5110735ee61c5114ULL, 80, 60},
+    {0x5110735ee61c5114ULL, 52, 50},
+    {0x5110735ee61c5114ULL, 80, 60},
+    {0x5110735ee61c5114ULL, 53, 33},
+    {0x5110735ee61c5114ULL, 62, 60},
+    {0x5110735ee61c5114ULL, 80, 60},
+    {0x5126e813f756bee7ULL, 52, 50},
+    {0x512eeb33bf0560d9ULL, 80, 42},
+    {0x51481d577d0c44b3ULL, 53, 49},
+    {0x514a99122034e194ULL, 67, 58},
+    {0x51575c26bab4abeaULL, 2, 22},
+    {0x5157bb5254e05977ULL, 32, 30},
+    {0x5170dbf7d08a970bULL, 38, 40},
+    {0x517591b87b0d90d3ULL, 12, 21},
+    {0x5179220841114df3ULL, 59, 39},
+    {0x5198f62cfae4c891ULL, 80, 58},
+    {0x51a9a1b3feba5a6eULL, 56, 57},
+    {0x51c04688eea9f5e0ULL, 42, 24},
+    {0x51c04688eea9f5e0ULL, 33, 31},
+    {0x51c41d4a67fe0d99ULL, 42, 33},
+    {0x51c41d4a67fe0d99ULL, 40, 31},
+    {0x51c41d4a67fe0d99ULL, 80, 58},
+    {0x51c41d4a67fe0d99ULL, 42, 33},
+    {0x51c41d4a67fe0d99ULL, 80, 58},
+    {0x51dfa013610572c8ULL, 39, 61},
+    {0x51e29edaa058bae5ULL, 19, 41},
+    {0x51fb544115e13b77ULL, 79, 70},
+    {0x51ffcf26eab62233ULL, 31, 11},
+    {0x52281e4fc869612fULL, 3, 12},
+    {0x5240b179d08f39d1ULL, 10, 46},
+    {0x5245c6ceeb91db19ULL, 69, 15},
+    {0x5265c40bcce1ffffULL, 1, 10},
+    {0x52af404711a98da2ULL, 80, 58},
+    {0x52c4959390560032ULL, 42, 40},
+    {0x52ead8d24ae20c95ULL, 28, 30},
+    {0x52edb1c3874fb672ULL, 59, 57},
+    {0x531fe69191198726ULL, 42, 2},
+    {0x532174ca3d4c789fULL, 1, 2},
+    {0x535ce8c1c1b4c23bULL, 62, 58},
+    {0x5360568e84e88e9dULL, 46, 48},
+    {0x53706f95e03db56eULL, 32, 23},
+    {0x53a6f45c90a5cbc4ULL, 2, 38},
+    {0x53c66da1c723d812ULL, 41, 21},
+    {0x53d78e2ce594b880ULL, 18, 20},
+    {0x53d8ab70e12caa7bULL, 43, 23},
+    {0x53db3f99e3e85c97ULL, 79, 78},
+    {0x53e2a5819ea6e0a3ULL, 32, 14},
+    {0x53e3b0cf0e576aabULL, 42, 44},
+    {0x53e61ed5193144c8ULL, 51, 49},
+    {0x53ef0c5e3dfa10f8ULL, 22, 31},
+    {0x54037d5a15345c9cULL, 29, 33},
+    {0x540a11a964f40756ULL, 32, 10},
+    {0x5411a7bdf88ad476ULL, 43, 34},
+    {0x542006db014bbd8dULL, 38, 37},
+    {0x54251aeabfb1ddc1ULL, 28, 66},
+    {0x547ba083a7640365ULL, 51, 31},
+    {0x547ba083a7640365ULL, 51, 29},
+    {0x547ba083a7640365ULL, 52, 66},
+    {0x547ba083a7640365ULL, 51, 29},
+    {0x547ba083a7640365ULL, 51, 31},
+    {0x547ba083a7640365ULL, 51, 13},
+    {0x547ba083a7640365ULL, 52, 66},
+    {0x547ba083a7640365ULL, 51, 29},
+    {0x547ba083a7640365ULL, 51, 13},
+    {0x547ba083a7640365ULL, 51, 29},
+    {0x547ffb5e3ba17de9ULL, 11, 10},
+    {0x547ffb5e3ba17de9ULL, 51, 59},
+    {0x548914bfa563f4a4ULL, 24, 33},
+    {0x54ae69680fdfaa80ULL, 78, 69},
+    {0x54b181ac83e2fe40ULL, 58, 49},
+    {0x54cdac516329f12dULL, 37, 23},
+    {0x54cdac516329f12dULL, 48, 52},
+    {0x54d9a70fb9c648eeULL, 57, 56},
+    {0x54ef19a604beb4c8ULL, 49, 69},
+    {0x55014cce3753f0d6ULL, 58, 22},
+    {0x55165a2e2d12f027ULL, 29, 15},
+    {0x552e8f4cba88debbULL, 40, 20},
+    {0x552e8f4cba88debbULL, 40, 38},
+    {0x553928fb7e82476bULL, 70, 50},
+    {0x553da817c0caddd2ULL, 2, 20},
+    {0x553da817c0caddd2ULL, 9, 47},
+    {0x5541e6c36c886496ULL, 12, 13},
+    {0x556313dd39426ed0ULL, 48, 66},
+    {0x5563b17a2780798cULL, 11, 12},
+    {0x557493d4bd6baa07ULL, 78, 60},
+    {0x557493d4bd6baa07ULL, 53, 51},
+    {0x557493d4bd6baa07ULL, 77, 43},
+    {0x55b9aae0843f3e9fULL, 48, 12},
+    {0x55c48da2a31ee6f9ULL, 42, 33},
+    {0x55e0b396204ee113ULL, 47, 39},
+    {0x561da77e424939ecULL, 48, 50},
+    {0x562d96c53b79e806ULL, 20, 21},
+    {0x565369e621907795ULL, 68, 48},
+    {0x56d17959429f8a68ULL, 70, 48},
+    {0x570b57851ca53e07ULL, 78, 42},
+    {0x570e8930a45c6428ULL, 1, 10},
+    {0x5727faacb132111fULL, 58, 56},
+    {0x572d23ba679b3249ULL, 78, 58},
+    {0x572e84282c0f7685ULL, 27, 31},
+    {0x5756948f84818c56ULL, 21, 23},
+    {0x576e7edd997193d2ULL, 58, 49},
+    {0x578502ff04ef128aULL, 22, 23},
+    {0x57a7a527199117faULL, 29, 30},
+    {0x57e78538fb122822ULL, 47, 48},
+    {0x57e78538fb122822ULL, 21, 23},
+    {0x57e94e9e535e859cULL, 53, 49},
+    {0x58254dfaaf17c687ULL, 60, 56},
+    {0x582e8daf3e89ff7bULL, 39, 47},
+    {0x582e8daf3e89ff7bULL, 1, 37},
+    {0x582e8daf3e89ff7bULL, 39, 47},
+    {0x582e8daf3e89ff7bULL, 1, 37},
+    {0x586fa11c5eaced2dULL, 47, 56},
+    {0x5872530372ba4173ULL, 51, 50},
+    {0x5882d4da8905299dULL, 29, 38},
+    {0x588a89711591e208ULL, 33, 51},
+    {0x588a89711591e208ULL, 10, 11},
+    {0x58b34d645814a12eULL, 53, 52},
+    {0x58bbe59c2ecab110ULL, 11, 20},
+    {0x58cd8f497e46bb4cULL, 38, 30},
+    {0x58cd8f497e46bb4cULL, 59, 23},
+    {0x58e2aca592853738ULL, 29, 65},
+    {0x58e910d690ee26edULL, 18, 10},
+    {0x58ee87d4f687445fULL, 22, 40},
+    {0x58f5a2f466479e70ULL, 32, 14},
+    {0x58f5fc2e0994b5c9ULL, 20, 22},
+    {0x590bda8c6ff9dc26ULL, 9, 31},
+    {0x590bda8c6ff9dc26ULL, 10, 68},
+    {0x590ed765f212d711ULL, 51, 50},
+    {0x591e855ac0c4f42eULL, 11, 47},
+    {0x59264bcc4d2e9354ULL, 59, 57},
+    {0x5946b28cf309db71ULL, 13, 22},
+    {0x5959f618feec56f8ULL, 20, 29},
+    {0x59b0f8260fa90157ULL, 30, 34},
+    {0x59b0f8260fa90157ULL, 38, 40},
+    {0x59b0f8260fa90157ULL, 30, 34},
+    {0x59b0f8260fa90157ULL, 22, 40},
+    {0x59b0f8260fa90157ULL, 30, 34},
+    {0x59b0f8260fa90157ULL, 28, 48},
+    {0x59ccab64d66eac6aULL, 80, 58},
+    {0x59dc12fc4522609fULL, 0, 20},
+    {0x5a099edc56b7e3b1ULL, 56, 57},
+    {0x5a0bb1ab839a5486ULL, 28, 29},
+    {0x5a0c9d962eda0947ULL, 39, 59},
+    {0x5a0ed4f275757bd2ULL, 53, 33},
+    {0x5a14f67d0310f629ULL, 71, 47},
+    {0x5a14f67d0310f629ULL, 71, 31},
+    {0x5a14f67d0310f629ULL, 71, 47},
+    {0x5a14f67d0310f629ULL, 71, 33},
+    {0x5a14f67d0310f629ULL, 71, 13},
+    {0x5a1636860bbc73b7ULL, 19, 21},
+    {0x5a18407fd54aecdeULL, 19, 39},
+    {0x5a2c7d7c0c07a747ULL, 41, 23},
+    {0x5a4a139db9a62478ULL, 20, 21},
+    {0x5a879322a527f0cbULL, 80, 60},
+    {0x5ad0614bf26fd4efULL, 32, 14},
+    {0x5ad13dd30a18f79aULL, 19, 39},
+    {0x5ad3494175dc4429ULL, 12, 14},
+    {0x5afc9847653cc1f3ULL, 0, 20},
+    {0x5b0eaecf9d5bb9dfULL, 49, 47},
+    {0x5b18c307b55f2679ULL, 39, 57},
+    {0x5b25227557985b00ULL, 56, 55},
+    {0x5b3e3b668d8542e4ULL, 11, 29},
+    {0x5b6268d1c5441f3bULL, 40, 2},
+    {0x5b9b033453499d52ULL, 49, 57},
+    {0x5b9ee852a473c859ULL, 24, 25},
+    {0x5bb27ca809f50214ULL, 50, 28},
+    {0x5bcd08db791664d6ULL, 27, 28},
+    {0x5bddd73f7ce8ed40ULL, 20, 56},
+    {0x5bf59cef34b4792cULL, 23, 41},
+    {0x5c131c3f30057690ULL, 11, 47},
+    {0x5c18e2f7d68b1a1dULL, 68, 10},
+    {0x5c24cde7424650f8ULL, 20, 21},
+    {0x5c24cde7424650f8ULL, 29, 47},
+    {0x5c2ce548e10ff002ULL, 27, 28},
+    {0x5c527d8db8d356a8ULL, 67, 49},
+    {0x5c5675a64ba95218ULL, 59, 19},
+    {0x5c66645971b273e9ULL, 31, 33},
+    {0x5c66645971b273e9ULL, 22, 24},
+    {0x5c66645971b273e9ULL, 20, 21},
+    {0x5c66645971b273e9ULL, 29, 21},
+    {0x5c66645971b273e9ULL, 10, 19},
+    {0x5c67c6fabddc528bULL, 53, 67},
+    {0x5cc5443b5ae64442ULL, 51, 31},
+    {0x5d0aa36b98ba9e63ULL, 71, 49},
+    {0x5d215c3ad8c23255ULL, 38, 40},
+    {0x5d3c34c9a53f2b9bULL, 60, 24},
+    {0x5d4aa05a7ce18f4aULL, 62, 60},
+    {0x5d51d7aac906798fULL, 78, 56},
+    {0x5d58bbd9b21b6840ULL, 41, 39},
+    {0x5d7a78f1130b4c29ULL, 29, 31},
+    {0x5d7e2c35e1118dfbULL, 51, 49},
+    {0x5db87a8208ddf90cULL, 38, 42},
+    {0x5dd2164fd8c5af03ULL, 79, 70},
+    {0x5dda0619bde6cdabULL, 3, 39},
+    {0x5de0f29977a3838fULL, 57, 61},
+    {0x5de18d29e80b3ff3ULL, 0, 22},
+    {0x5de5a2758c3117f8ULL, 58, 57},
+    {0x5e02e450bb5f2122ULL, 58, 57},
+    {0x5e05585353ceab35ULL, 13, 12},
+    {0x5e059692deb3491aULL, 43, 34},
+    {0x5e13284eb05f6838ULL, 58, 60},
+    {0x5e17ea5ccc04c93eULL, 27, 47},
+    {0x5e2348b4cf56ca69ULL, 15, 31},
+    {0x5e7fa1b060ad4863ULL, 49, 31},
+    {0x5e9bfcdc329a2cd6ULL, 69, 33},
+    {0x5efed420e8738e17ULL, 53, 51},
+    {0x5f15004bcb56c2fdULL, 20, 56},
+    {0x5f29b43e928b0d69ULL, 48, 52},
+    {0x5f29b43e928b0d69ULL, 28, 37},
+    {0x5f2cb64eb1667cf0ULL, 21, 61},
+    {0x5f2cb64eb1667cf0ULL, 10, 32},
+    {0x5f4c70027b57ff0cULL, 70, 32},
+    {0x5f6a1bdf8370c6d1ULL, 20, 29},
+    {0x5fa061796524251fULL, 50, 32},
+    {0x5faf3a5d86ba17faULL, 51, 15},
+    {0x5fb32979400beb75ULL, 42, 38},
+    {0x5fb3c3685edb8327ULL, 19, 39},
+    {0x5fb961dc3c4d3b19ULL, 41, 21},
+    {0x5fb9dbc47b193faaULL, 61, 57},
+    {0x5fc3dbcbab8fd679ULL, 25, 41},
+    {0x5fc6ffe8b52d880fULL, 59, 50},
+    {0x5fe483c982de80d9ULL, 28, 30},
+    {0x600c73486de7bc48ULL, 30, 50},
+    {0x601fba47ae96f515ULL, 47, 29},
+    {0x601fba47ae96f515ULL, 70, 69},
+    {0x6039a19f9c94c8eaULL, 69, 68},
+    {0x6039a19f9c94c8eaULL, 33, 49},
+    {0x6076e1797ee41588ULL, 39, 61},
+    {0x608121136bbced9cULL, 3, 12},
+    {0x6096526e0832d65eULL, 31, 33},
+    {0x6096526e0832d65eULL, 60, 52},
+    {0x609f75e0c4055c86ULL, 68, 34},
+    {0x60c5a160de963693ULL, 48, 66},
+    {0x60d9db78917da5bbULL, 39, 59},
+    {0x60e3ad7d86d6c872ULL, 19, 11},
+    {0x60f73251f469dd0bULL, 70, 50},
+    {0x60fb0c73458ec307ULL, 32, 14},
+    {0x6129e0c8d11642a9ULL, 60, 24},
+    {0x613aacf0116165b7ULL, 52, 14},
+    {0x613dc078b0a489d8ULL, 67, 66},
+    {0x6154967e824fc8ceULL, 31, 69},
+    {0x61698996e12f585fULL, 1, 21},
+    {0x617a3dbbfb029c8aULL, 29, 47},
+    {0x6182434a1420abb1ULL, 62, 70},
+    {0x618d77a592611fa1ULL, 29, 51},
+    {0x6193bc87afc2e0ecULL, 29, 37},
+    {0x61a0ce58e6301630ULL, 30, 66},
+    {0x61aaceff7ec3c55bULL, 58, 49},
+    {0x61aaceff7ec3c55bULL, 51, 31},
+    {0x61b184d7126715e9ULL, 21, 23},
+    {0x61c0eaf427d488a0ULL, 58, 56},
+    {0x61c85409c4c509b9ULL, 3, 21},
+    {0x61e42ef720f4285cULL, 10, 30},
+    {0x61f3d15cce337ef3ULL, 77, 59},
+    {0x6203354327da1e09ULL, 10, 12},
+    {0x62412875e218517fULL, 69, 68},
+    {0x625a1a8ad1fc0e95ULL, 9, 31},
+    {0x626c76701383715aULL, 1, 2},
+    {0x628c20182e7619feULL, 69, 60},
+    {0x62c4f8ebba013d3eULL, 38, 39},
+    {0x62d396d69f902e0bULL, 20, 29},
+    {0x62e4afc3ad6108abULL, 29, 21},
+    {0x62e4afc3ad6108abULL, 69, 70},
+    {0x62e73b69321d605bULL, 59, 39},
+    {0x62fc163743e7d138ULL, 20, 21},
+    {0x62fc163743e7d138ULL, 20, 29},
+    {0x630196691c95e003ULL, 3, 43},
+    {0x630cc44447700c86ULL, 79, 70},
+    {0x6317f1a26ede5fb1ULL, 40, 20},
+    {0x6325db729d9f5551ULL, 51, 50},
+    {0x6352cc50f4e72203ULL, 33, 47},
+    {0x6352cc50f4e72203ULL, 60, 24},
+    {0x635333d281c44d91ULL, 40, 49},
+    {0x636ea5ec042dd616ULL, 60, 58},
+    {0x6384160cf20c0763ULL, 9, 29},
+    {0x638cfafe7446a2ffULL, 47, 49},
+    {0x639ef4c7b22755fbULL, 20, 22},
+    {0x63ccc763c736baf4ULL, 57, 48},
+    {0x64515ebb879cd4b2ULL, 20, 29},
+    {0x645ad60e00542f28ULL, 48, 66},
+    {0x648d3a442c979d90ULL, 18, 10},
+    {0x64931d27049e35c8ULL, 77, 37},
+    {0x64e72dd6e56d6763ULL, 59, 58},
+    {0x650f8ad3778350a2ULL, 28, 48},
+    {0x654b218d7551540bULL, 80, 42},
+    {0x655d77f1e2451f82ULL, 32, 30},
+    {0x655d77f1e2451f82ULL, 32, 28},
+    {0x655d77f1e2451f82ULL, 32, 12},
+    {0x65b49e85339aec15ULL, 39, 79},
+    {0x65bb4ec50e7778c1ULL, 77, 41},
+    {0x65bb4ec50e7778c1ULL, 77, 59},
+    {0x65c2262a3aa565c3ULL, 28, 48},
+    {0x65d54c8154c74e40ULL, 47, 33},
+    {0x65d54c8154c74e40ULL, 12, 46},
+    {0x6616ad1a386f461eULL, 69, 60},
+    {0x6616ad1a386f461eULL, 41, 23},
+    {0x6616ad1a386f461eULL, 49, 31},
+    {0x6616ad1a386f461eULL, 32, 31},
+    {0x6616ad1a386f461eULL, 69, 60},
+    {0x664668216fe7fb53ULL, 60, 58},
+    {0x667076b1b5df4659ULL, 60, 58},
+    {0x6692e35b2ea3c514ULL, 59, 50},
+    {0x66b788a05ac4dd02ULL, 60, 38},
+    {0x66bfadc2fa3b72c9ULL, 28, 30},
+    {0x66e3740c5030d2f2ULL, 59, 23},
+    {0x670c40ff1ebd71eaULL, 21, 23},
+    {0x6748696d4e1a5250ULL, 10, 48},
+    {0x674c16f31ba79190ULL, 50, 10},
+    {0x674c16f31ba79190ULL, 49, 31},
+    {0x674c16f31ba79190ULL, 50, 30},
+    {0x674c16f31ba79190ULL, 71, 51},
+    {0x678248bca816876aULL, 71, 33},
+    {0x679f03ae018d8655ULL, 41, 21},
+    {0x67a58a29de8c8cf4ULL, 29, 49},
+    {0x67a58a29de8c8cf4ULL, 10, 12},
+    {0x67a58a29de8c8cf4ULL, 10, 30},
+    {0x67a58a29de8c8cf4ULL, 29, 67},
+    {0x67a58a29de8c8cf4ULL, 10, 12},
+    {0x67a58a29de8c8cf4ULL, 28, 30},
+    {0x67da78e6e9b45806ULL, 29, 47},
+    {0x67db716017aecc35ULL, 20, 29},
+    {0x67f9614f439649fcULL, 1, 2},
+    {0x6863d6c96916cc5eULL, 9, 31},
+    {0x6897a6b94b7d2f03ULL, 31, 39},
+    {0x6897a6b94b7d2f03ULL, 21, 37},
+    {0x6897a6b94b7d2f03ULL, 58, 18},
+    {0x68dd0d37aad55a48ULL, 1, 39},
+    {0x6904ae869607a961ULL, 79, 43},
+    {0x69144a6cfca30827ULL, 53, 33},
+    {0x692a5379a1c247e3ULL, 43, 55},
+    {0x692a5379a1c247e3ULL, 43, 57},
+    {0x692a5379a1c247e3ULL, 43, 55},
+    {0x6946328fc4fcbd6dULL, 30, 34},
+    {0x697fedb4e5c85a46ULL, 59, 50},
+    {0x6994ae4036153bcbULL, 47, 67},
+    {0x69b86c45e00aa99aULL, 28, 50},
+    {0x69c25aeac3b2fab0ULL, 29, 38},
+    {0x69e8eea541f6b080ULL, 47, 31},
+    {0x6a021216cfe1c7f2ULL, 47, 38},
+    {0x6a22de4b4c628f77ULL, 18, 22},
+    {0x6a2d12c76dd75c0dULL, 70, 48},
+    {0x6a37275049a3492eULL, 71, 49},
+    {0x6a3e0e22ceb5333cULL, 30, 28},
+    {0x6a501674f4196817ULL, 68, 59},
+    {0x6a5a8cdccbefd68cULL, 31, 33},
+    {0x6a6317e118774408ULL, 2, 38},
+    {0x6a6db4f1066ed5c8ULL, 22, 31},
+    {0x6abd083a510439dbULL, 2, 38},
+    {0x6aee1a863b550862ULL, 79, 78},
+    {0x6af0002573de831aULL, 2, 10},
+    {0x6afe29980e622be2ULL, 70, 68},
+    {0x6b1fb83ae65f26e2ULL, 29, 31},
+    {0x6b35ec58c119fc3fULL, 60, 59},
+    {0x6b35ec58c119fc3fULL, 49, 29},
+    {0x6b35ec58c119fc3fULL, 60, 59},
+    {0x6b4b84fd02dfe21aULL, 38, 39},
+    {0x6b64eb3a886f744dULL, 60, 51},
+    {0x6b85857a3074ed7cULL, 37, 57},
+    {0x6b968a750590a806ULL, 10, 12},
+    {0x6bc719c2e84405d8ULL, 48, 28},
+    {0x6c230a0dd6eac07eULL, 30, 50},
+    {0x6c24f2198e4e9989ULL, 10, 48},
+    {0x6c24f2198e4e9989ULL, 29, 33},
+    {0x6c24f2198e4e9989ULL, 10, 48},
+    {0x6c374983fda61b6aULL, 59, 61},
+    {0x6c57c1c43000dbb3ULL, 40, 58},
+    {0x6c6d66d84ed609e5ULL, 60, 58},
+    {0x6c7526b4809e647eULL, 37, 25},
+    {0x6c7526b4809e647eULL, 37, 23},
+    {0x6ca775c7aceeb73bULL, 29, 28},
+    {0x6ca775c7aceeb73bULL, 29, 30},
+    {0x6ca775c7aceeb73bULL, 12, 28},
+    {0x6cac5bfa0397fa44ULL, 42, 24},
+    {0x6cac5bfa0397fa44ULL, 52, 51},
+    {0x6cac5bfa0397fa44ULL, 42, 24},
+    {0x6cc9f8f6fa29f85cULL, 1, 2},
+    {0x6ccc203e3496482aULL, 11, 12},
+    {0x6cdbcb825ef08f84ULL, 1, 39},
+    {0x6ce296d565579df7ULL, 21, 23},
+    {0x6cf7a2b2ec2b98c5ULL, 29, 47},
+    {0x6cf8e4895f0479ebULL, 58, 40},
+    {0x6cfefa60e7277eb3ULL, 22, 23},
+    {0x6d5d292e27912411ULL, 3, 21},
+    {0x6d68a4f07d801b79ULL, 79, 78},
+    {0x6d6a968aee79be66ULL, 10, 32},
+    {0x6d80b95ffc9a58dbULL, 70, 30},
+    {0x6d90c1c619e034baULL, 70, 69},
+    {0x6da197092e5077e5ULL, 27, 28},
+    {0x6dc11c7cb42516beULL, 18, 56},
+    {0x6dd733e66e251bc7ULL, 18, 10},
+    {0x6ddfff23bb85dae8ULL, 29, 31},
+    {0x6df79c7c0e45802cULL, 60, 51},
+    {0x6df79c7c0e45802cULL, 60, 59},
+    {0x6e068292fb3438fbULL, 20, 21},
+    {0x6e068292fb3438fbULL, 58, 60},
+    {0x6e068292fb3438fbULL, 20, 29},
+    {0x6e310432e270dfa4ULL, 20, 12},
+    {0x6e3c6e6e3b488a40ULL, 22, 24},
+    {0x6e794ab5f8de4175ULL, 21, 22},
+    {0x6e7a6ae1f8922397ULL, 1, 2},
+    {0x6e88e93bd8554fc4ULL, 31, 33},
+    {0x6e996d8ecb8d3b3cULL, 2, 20},
+    {0x6efd2f289cb6c7fbULL, 48, 39},
+    {0x6f05bb3e67dc1bbdULL, 58, 57},
+    {0x6f258ed17b858b16ULL, 21, 23},
+    {0x6f29343ed657e364ULL, 42, 22},
+    {0x6f317bb636fd5d6aULL, 28, 48},
+    {0x6f317bb636fd5d6aULL, 34, 52},
+    {0x6f317bb636fd5d6aULL, 22, 30},
+    {0x6f36befd817e0fd3ULL, 2, 20},
+    {0x6f36befd817e0fd3ULL, 27, 29},
+    {0x6f36befd817e0fd3ULL, 3, 37},
+    {0x6f36befd817e0fd3ULL, 27, 19},
+    {0x6f36befd817e0fd3ULL, 3, 37},
+    {0x6f36befd817e0fd3ULL, 27, 29},
+    {0x6f36befd817e0fd3ULL, 3, 37},
+    {0x6f3ee0789ba5264bULL, 19, 21},
+    {0x6f4533cd65a6663eULL, 10, 30},
+    {0x6f4533cd65a6663eULL, 10, 46},
+    {0x6f4533cd65a6663eULL, 11, 31},
+    {0x6f606e81ce63cd38ULL, 28, 52},
+    {0x6f790da395c88823ULL, 52, 50},
+    {0x6f97d3a5b4944429ULL, 38, 24},
+    {0x6f9815e14548db1cULL, 28, 48},
+    {0x6fad3c076f1c2d07ULL, 21, 39},
+    {0x6fc2ab326db64dd2ULL, 38, 47},
+    {0x6fdc773d1f469bfaULL, 32, 68},
+    {0x7001129b8f928baeULL, 24, 23},
+    {0x7002bfae18275681ULL, 14, 12},
+    {0x700301430470812bULL, 10, 32},
+    {0x7017cc4eceb00593ULL, 31, 22},
+    {0x7017cc4eceb00593ULL, 79, 70},
+    {0x7017cc4eceb00593ULL, 79, 78},
+    {0x7017cc4eceb00593ULL, 59, 41},
+    {0x70261e7ae58bf345ULL, 53, 52},
+    {0x702ff997343187ddULL, 47, 49},
+    {0x702ff997343187ddULL, 38, 56},
+    {0x70423fba758f6e53ULL, 51, 50},
+    {0x704b19eb9a1a6218ULL, 79, 59},
+    {0x70597f79a762f82bULL, 68, 60},
+    {0x70597f79a762f82bULL, 47, 38},
+    {0x706e748b959ef36dULL, 62, 61},
+    {0x7078ff099ade041fULL, 30, 52},
+    {0x708bb38e938902d6ULL, 38, 24},
+    {0x708fac85d171159eULL, 80, 60},
+    {0x70a85d776d97f52fULL, 47, 48},
+    {0x70aec52451102b1aULL, 32, 28},
+    {0x70aec52451102b1aULL, 42, 33},
+    {0x70cadde3ee8ae41bULL, 22, 31},
+    {0x70d245eb5ad1686dULL, 11, 31},
+    {0x70d823718c1a9c93ULL, 42, 24},
+    {0x70e02da4588d7cabULL, 48, 66},
+    {0x70fb0375e8367151ULL, 80, 40},
+    {0x7129249417397ca2ULL, 41, 23},
+    {0x71407ec059de62b4ULL, 78, 42},
+    {0x7143fb1e517b7466ULL, 9, 31},
+    {0x71441d75f4fbc520ULL, 32, 12},
+    {0x71926b4d327630f0ULL, 32, 10},
+    {0x719fd06192916c99ULL, 58, 49},
+    {0x71a1b9caf1e16c7dULL, 18, 22},
+    {0x71abebc0d560699eULL, 78, 58},
+    {0x71b6e429f9799ce4ULL, 69, 60},
+    {0x71c4c51842f3da86ULL, 51, 49},
+    {0x71d964f21898fa9dULL, 27, 47},
+    {0x71e868f33681f880ULL, 10, 19},
+    {0x7204a45b754d2bdeULL, 11, 20},
+    {0x7204a45b754d2bdeULL, 39, 57},
+    {0x7204a45b754d2bdeULL, 31, 49},
+    {0x7204a45b754d2bdeULL, 48, 49},
+    {0x7204a45b754d2bdeULL, 11, 20},
+    {0x724a3db27c8b2004ULL, 38, 36},
+    {0x727f4649a2e75a7fULL, 60, 51},
+    {0x729b66837bc52525ULL, 30, 66},
+    {0x72a0952bfb22db6bULL, 52, 50},
+    {0x72d1211eb6c0ce66ULL, 29, 31},
+    {0x72ed5782994139e7ULL, 48, 66},
+    {0x72ed5782994139e7ULL, 31, 49},
+    {0x73055ed1b615f88fULL, 58, 22},
+    {0x73390e3503ba87a7ULL, 11, 47},
+    {0x733dc195da403118ULL, 33, 32},
+    {0x7356d47981340e54ULL, 69, 29},
+    {0x7364a97005d8e588ULL, 62, 56},
+    {0x73781ac616df5159ULL, 39, 59},
+    {0x73977349ccd772deULL, 69, 33},
+    {0x73d2859e621b4e45ULL, 41, 21},
+    {0x73f4a3b18591f490ULL, 28, 20},
+    {0x73f8cd4d02f98494ULL, 56, 47},
+    {0x73f8cd4d02f98494ULL, 51, 59},
+    {0x73fe17e8fe7f01c4ULL, 61, 39},
+    {0x74119601f9fa0df2ULL, 38, 47},
+    {0x74119601f9fa0df2ULL, 39, 57},
+    {0x74119601f9fa0df2ULL, 20, 21},
+    {0x74119601f9fa0df2ULL, 41, 50},
+    {0x7418d64d845d6e1fULL, 33, 24},
+    {0x74271bec5b8d7ce2ULL, 52, 32},
+    {0x74693171909b61f3ULL, 10, 19},
+    {0x746abf1a90d892d7ULL, 28, 30},
+    {0x747207081ecdceb1ULL, 69, 68},
+    {0x7494842189cddce5ULL, 48, 28},
+    {0x7494842189cddce5ULL, 60, 42},
+    {0x7494842189cddce5ULL, 51, 65},
+    {0x749ad400336a7af0ULL, 33, 51},
+    {0x74a994cd37cf7ff6ULL, 29, 47},
+    {0x74a994cd37cf7ff6ULL, 10, 48},
+    {0x74a994cd37cf7ff6ULL, 39, 48},
+    {0x74b16ad5b6d894d8ULL, 78, 42},
+    {0x74b199690fe781b9ULL, 48, 70},
+    {0x74c70b4a972c7c59ULL, 20, 38},
+    {0x74c70b4a972c7c59ULL, 32, 52},
+    {0x74c70b4a972c7c59ULL, 29, 15},
+    {0x74ca252bfb489582ULL, 42, 33},
+    {0x74cded383eae2ca2ULL, 11, 31},
+    {0x74fdc5c01c13a49dULL, 80, 40},
+    {0x75028ba2c5c67ee2ULL, 79, 78},
+    {0x75120eb34ef19d2dULL, 33, 24},
+    {0x75120eb34ef19d2dULL, 60, 59},
+    {0x754ce042639c55e1ULL, 49, 9},
+    {0x75706012e4387019ULL, 43, 59},
+    {0x758391f82b687cc8ULL, 38, 58},
+    {0x758a27ecca3d8d26ULL, 61, 59},
+    {0x7590366061083153ULL, 70, 32},
+    {0x759b33bd57ba31ebULL, 39, 19},
+    {0x75a28f58e8f3e5afULL, 18, 19},
+    {0x75a459c1e93218b7ULL, 62, 61},
+    {0x75a9016c8e8ef846ULL, 29, 31},
+    {0x75abb3356bfe4619ULL, 10, 48},
+    {0x75cbf0939f6593d6ULL, 68, 50},
+    {0x75e9f4ecf739c893ULL, 21, 41},
+    {0x7614e41d7918c88eULL, 52, 51},
+    {0x7625285f7f9dfb26ULL, 10, 30},
+    {0x764cd80a713698aaULL, 23, 32},
+    {0x7657b246943a6d9aULL, 42, 40},
+    {0x765a82fad3c670f2ULL, 20, 22},
+    {0x765a82fad3c670f2ULL, 50, 52},
+    {0x766c618425325075ULL, 31, 33},
+    {0x766c618425325075ULL, 12, 14},
+    {0x769677cd06c7c46bULL, 10, 28},
+    {0x769677cd06c7c46bULL, 10, 12},
+    {0x769677cd06c7c46bULL, 11, 65},
+    {0x769aea2c3c16f060ULL, 42, 56},
+    {0x76acf148cd5ee473ULL, 50, 46},
+    {0x76b4b7f81148a468ULL, 9, 29},
+    {0x76b4b7f81148a468ULL, 20, 24},
+    {0x76c3e5adcc481e56ULL, 39, 59},
+    {0x76c8286229901652ULL, 51, 9},
+    {0x76cc3f7ac599fb66ULL, 40, 38},
+    {0x76e719ee33745922ULL, 58, 56},
+    {0x76ee30e9b1cfd47bULL, 11, 47},
+    {0x76efa4690d55d584ULL, 71, 49},
+    {0x773fd1e36ee50e7bULL, 59, 50},
+    {0x773fd1e36ee50e7bULL, 60, 51},
+    {0x773fd1e36ee50e7bULL, 59, 50},
+    {0x773fd1e36ee50e7bULL, 60, 51},
+    {0x77535b70467da3bdULL, 10, 32},
+    {0x78428a0a056ecd61ULL, 10, 18},
+    {0x7865cb08022f1680ULL, 58, 57},
+    {0x786a93625356d697ULL, 27, 28},
+    {0x786a93625356d697ULL, 19, 28},
+    {0x786a93625356d697ULL, 27, 28},
+    {0x786a93625356d697ULL, 19, 28},
+    {0x786a93625356d697ULL, 27, 28},
+    {0x786a93625356d697ULL, 3, 12},
+    {0x786a93625356d697ULL, 18, 20},
+    {0x786a93625356d697ULL, 27, 28},
+    {0x786a93625356d697ULL, 19, 28},
+    {0x786a93625356d697ULL, 27, 28},
+    {0x786a93625356d697ULL, 3, 12},
+    {0x786a93625356d697ULL, 27, 28},
+    {0x786a93625356d697ULL, 3, 12},
+    {0x786a93625356d697ULL, 19, 28},
+    {0x786a93625356d697ULL, 27, 28},
+    {0x786a93625356d697ULL, 19, 28},
+    {0x786a93625356d697ULL, 27, 28},
+    {0x786a93625356d697ULL, 10, 28},
+    {0x786a93625356d697ULL, 27, 28},
+    {0x786a93625356d697ULL, 3, 12},
+    {0x786a93625356d697ULL, 27, 28},
+    {0x786a93625356d697ULL, 19, 28},
+    {0x786a93625356d697ULL, 27, 28},
+    {0x786a93625356d697ULL, 3, 12},
+    {0x786a93625356d697ULL, 27, 28},
+    {0x786a93625356d697ULL, 3, 12},
+    {0x786a93625356d697ULL, 27, 28},
+    {0x786a93625356d697ULL, 3, 12},
+    {0x786a93625356d697ULL, 27, 28},
+    {0x7898990d3cf003deULL, 78, 56},
+    {0x78d700cea50227ecULL, 60, 51},
+    {0x78d700cea50227ecULL, 41, 23},
+    {0x78d700cea50227ecULL, 31, 13},
+    {0x78d70c181354915cULL, 48, 66},
+    {0x78f720290a797ad7ULL, 57, 39},
+    {0x78fd41eabf4e55aaULL, 48, 68},
+    {0x793d20f5fb6c98eeULL, 20, 22},
+    {0x793ece1288aa6bb1ULL, 77, 59},
+    {0x7944254be6009967ULL, 53, 51},
+    {0x7944254be6009967ULL, 58, 50},
+    {0x7944254be6009967ULL, 53, 51},
+    {0x795d7659deb2e7d9ULL, 32, 12},
+    {0x7976c773dc342c83ULL, 31, 51},
+    {0x79a00c31d8d720c7ULL, 39, 61},
+    {0x79a8710bd4533e70ULL, 11, 15},
+    {0x79c51d4be46f5c91ULL, 12, 32},
+    {0x79dec76291ca334aULL, 41, 23},
+    {0x7a08aa29fe1bb283ULL, 20, 29},
+    {0x7a2585f8068371b6ULL, 29, 33},
+    {0x7a2bfe3ea4f9486dULL, 18, 22},
+    {0x7a32ad027b5e8294ULL, 11, 29},
+    {0x7a378b2b82d1dc24ULL, 22, 20},
+    {0x7a381cf22ce16d55ULL, 32, 30},
+    {0x7a633e7038ecb194ULL, 22, 40},
+    {0x7a633e7038ecb194ULL, 22, 42},
+    {0x7a673e1ac2ec128fULL, 48, 30},
+    {0x7a8161dd50c063a9ULL, 70, 68},
+    {0x7a8161dd50c063a9ULL, 70, 50},
+    {0x7a8161dd50c063a9ULL, 70, 68},
+    {0x7a902958e7c3b457ULL, 20, 21},
+    {0x7aa2c4ef404b02c3ULL, 58, 38},
+    {0x7aae7aa0bfd66c1dULL, 70, 50},
+    {0x7af0225bdc94aa92ULL, 38, 39},
+    {0x7af1322154640d2aULL, 12, 48},
+    {0x7b185d582f55e3e2ULL, 52, 28},
+    {0x7b284645d63cc3c7ULL, 28, 29},
+    {0x7b2dbdf7943a99d5ULL, 9, 29},
+    {0x7b77afb7c3f07f10ULL, 31, 49},
+    {0x7b7f1467c732db4cULL, 59, 57},
+    {0x7bddfa1e6456a00dULL, 80, 60},
+    {0x7bf33c4125bdbb2dULL, 10, 32},
+    {0x7c0c0b52c82de2c5ULL, 19, 39},
+    {0x7c1c8beaf5ff5129ULL, 39, 57},
+    {0x7c378e07c2db958fULL, 61, 41},
+    {0x7c42482471be47aeULL, 11, 31},
+    {0x7c7debac2154d859ULL, 79, 78},
+    {0x7ca6d63301371190ULL, 50, 12},
+    {0x7cccf252ca84cda7ULL, 41, 40},
+    {0x7d0137befe52c0a1ULL, 21, 22},
+    {0x7d0b66bbbc67e7dbULL, 60, 68},
+    {0x7d41a7e100902a1dULL, 58, 56},
+    {0x7d41a7e100902a1dULL, 51, 31},
+    {0x7d41a7e100902a1dULL, 58, 57},
+    {0x7d41a7e100902a1dULL, 51, 47},
+    {0x7d8b2df5bf286026ULL, 69, 68},
+    {0x7d8ddaaf9e612c8bULL, 70, 69},
+    {0x7da3c7ac7ea35e75ULL, 28, 48},
+    {0x7dbe72795746ed54ULL, 49, 11},
+    {0x7dbf658426e2b404ULL, 40, 18},
+    {0x7de0d2b71265262dULL, 11, 13},
+    {0x7e8395e48caa1e32ULL, 79, 43},
+    {0x7e8395e48caa1e32ULL, 41, 33},
+    {0x7e8395e48caa1e32ULL, 79, 43},
+    {0x7eb98e92a8ef9908ULL, 30, 34},
+    {0x7ed7e43d3f389791ULL, 1, 23},
+    {0x7ee48fd86a812426ULL, 59, 57},
+    {0x7ef29ded2c896d24ULL, 70, 48},
+    {0x7ef484e1dc1832edULL, 38, 47},
+    {0x7f0b3414149f66c5ULL, 32, 41},
+    {0x7f169afae94d31adULL, 58, 38},
+    {0x7f2fbbd9e8783e48ULL, 58, 49},
+    {0x7f3f53b2cc61ac89ULL, 10, 30},
+    {0x7f9d6ec90d26453bULL, 29, 49},
+    {0x7f9d6ec90d26453bULL, 40, 49},
+    {0x7f9d6ec90d26453bULL, 29, 49},
+    {0x7fb097d73065ecf7ULL, 31, 67},
+    {0x7fb1ffd7cb777e3eULL, 48, 28},
+    {0x7fbd5b855b478e8bULL, 20, 29},
+    {0x7fbd5b855b478e8bULL, 28, 48},
+    {0x7fbd5b855b478e8bULL, 20, 29},
+    {0x7ffcf07f564fccb1ULL, 11, 12},
+    {0x8022af57b971181dULL, 21, 61},
+    {0x803e31bd7f549109ULL, 9, 31},
+    {0x8040a2b40c9a3201ULL, 80, 58},
+    {0x8057b531d678da5dULL, 29, 47},
+    {0x8061d0a7a35fed3bULL, 55, 56},
+    {0x807c733d34adf39cULL, 38, 24},
+    {0x80a4873720318486ULL, 80, 60},
+    {0x80cbb8805c4aea5eULL, 51, 49},
+    {0x80d05fbf60368066ULL, 51, 42},
+    {0x80db4a27197fb45dULL, 68, 50},
+    {0x813543896734ef9bULL, 38, 58},
+    {0x813deb5d9ab5708bULL, 20, 56},
+    {0x814a5e62dc0b176fULL, 47, 56},
+    {0x816b0c596ffe42a7ULL, 20, 40},
+    {0x819bb9cbc6336dc8ULL, 39, 57},
+    {0x81a05ff028eee737ULL, 2, 22},
+    {0x81a7f416826f8943ULL, 47, 56},
+    {0x81b09434e63b572aULL, 22, 31},
+    {0x81b0a748dba680a0ULL, 33, 42},
+    {0x81c1137d964495adULL, 52, 50},
+    {0x81c34fb0ed3cd14eULL, 71, 67},
+    {0x81c85d78cb7f0869ULL, 41, 21},
+    {0x81d628b72777dc21ULL, 1, 10},
+    {0x8202e0a05d27d8c9ULL, 10, 32},
+    {0x82214c30765befceULL, 80, 58},
+    {0x824018ac58ca704eULL, 59, 57},
+    {0x82772e061c0376caULL, 49, 31},
+    {0x8287d2f0a8ad9f8dULL, 62, 42},
+    {0x8287d2f0a8ad9f8dULL, 78, 42},
+    {0x8287d2f0a8ad9f8dULL, 62, 42},
+    {0x8287d2f0a8ad9f8dULL, 78, 42},
+    {0x8287d2f0a8ad9f8dULL, 62, 42},
+    {0x8287d2f0a8ad9f8dULL, 78, 42},
+    {0x8287d2f0a8ad9f8dULL, 62, 42},
+    {0x8287d2f0a8ad9f8dULL, 78, 42},
+    {0x8287d2f0a8ad9f8dULL, 62, 42},
+    {0x8287d2f0a8ad9f8dULL, 78, 42},
+    {0x8287d2f0a8ad9f8dULL, 62, 42},
+    {0x8287d2f0a8ad9f8dULL, 78, 42},
+    {0x8287d2f0a8ad9f8dULL, 62, 42},
+    {0x8287d2f0a8ad9f8dULL, 78, 42},
+    {0x8287d2f0a8ad9f8dULL, 62, 42},
+    {0x8287d2f0a8ad9f8dULL, 78, 42},
+    {0x8287d2f0a8ad9f8dULL, 62, 42},
+    {0x8287d2f0a8ad9f8dULL, 78, 42},
+    {0x828caa4095d48703ULL, 20, 24},
+    {0x82a67f4c72075af3ULL, 39, 23},
+    {0x82a67f4c72075af3ULL, 43, 41},
+    {0x82a67f4c72075af3ULL, 43, 57},
+    {0x82a74db0e176f4ccULL, 3, 21},
+    {0x82a9155aa7bcc720ULL, 48, 28},
+    {0x82a9444245fb5831ULL, 38, 56},
+    {0x82d5a40fb5c6ff11ULL, 60, 24},
+    {0x82dcd16ca9a267d1ULL, 59, 57},
+    {0x82e4ba3c4d066a2dULL, 61, 41},
+    {0x82f82878b082ca7cULL, 19, 23},
+    {0x83287a5511eadf48ULL, 41, 40},
+    {0x832a96c192edbb02ULL, 39, 61},
+    {0x8366c107695e176bULL, 78, 42},
+    {0x83697708cff5100dULL, 78, 24},
+    {0x83699c977d1f9e73ULL, 79, 61},
+    {0x8378ae5ec00d1210ULL, 22, 31},
+    {0x83970878ad6af9edULL, 27, 47},
+    {0x83b53d7bdc53f3e5ULL, 42, 41},
+    {0x83dc165c04c9ef9eULL, 70, 50},
+    {0x841217f6f3f16bf2ULL, 33, 31},
+    {0x841b1b1467e0fbc6ULL, 20, 24},
+    {0x8421236fc6acacefULL, 60, 59},
+    {0x842984aa41100319ULL, 52, 32},
+    {0x842c70ba84677ce6ULL, 52, 50},
+    {0x84313af80c754976ULL, 29, 33},
+    {0x845e99573b078d27ULL, 33, 67},
+    {0x845e99573b078d27ULL, 29, 30},
+    {0x8460d0eb86aafb5dULL, 51, 52},
+    {0x848696e31c909cefULL, 42, 22},
+    {0x84c53cac3cfd9fcdULL, 12, 28},
+    {0x84d239ffeb912853ULL, 39, 57},
+    {0x84e75c7f6cd850f5ULL, 10, 30},
+    {0x84fe437f530da6a5ULL, 56, 58},
+    {0x851e84c85e85e66fULL, 38, 40},
+    {0x85224f0347f29c53ULL, 51, 33},
+    {0x8537eae8a1e513efULL, 28, 29},
+    {0x85395c8d2ade6b4fULL, 2, 38},
+    {0x85395c8d2ade6b4fULL, 10, 11},
+    {0x8541bbbe8953b061ULL, 48, 66},
+    {0x85457d9a44b7afcaULL, 14, 12},
+    {0x85850d4233fe7296ULL, 60, 51},
+    {0x85a36215775ab6a8ULL, 60, 42},
+    {0x85bd38b2b53ba948ULL, 80, 60},
+    {0x85dd72537a74d2d7ULL, 79, 78},
+    {0x85ed07bed1e19e89ULL, 10, 32},
+    {0x8601251d3b4b273cULL, 38, 56},
+    {0x8624da9f17235f1bULL, 27, 28},
+    {0x8687f70a54374f18ULL, 60, 51},
+    {0x869c31f4ccda9001ULL, 60, 24},
+    {0x86caa2ecef194d3fULL, 11, 13},
+    {0x8708b4aafd11d737ULL, 69, 67},
+    {0x870fcd487fee4e77ULL, 68, 66},
+    {0x870fcd487fee4e77ULL, 49, 47},
+    {0x8712649b3afc6338ULL, 29, 31},
+    {0x876100a9025510efULL, 23, 43},
+    {0x876100a9025510efULL, 23, 41},
+    {0x876af7a9b349c132ULL, 11, 19},
+    {0x876af7a9b349c132ULL, 21, 30},
+    {0x878a7fe21806b5c6ULL, 11, 12},
+    {0x878a7fe21806b5c6ULL, 38, 40},
+    {0x87a757daf4123893ULL, 22, 24},
+    {0x87b969dcc0910212ULL, 9, 31},
+    {0x87c796e8684fa46fULL, 38, 40},
+    {0x87c796e8684fa46fULL, 20, 29},
+    {0x87cd85017b7c2042ULL, 70, 52},
+    {0x87e4c53f4ef3bbbeULL, 2, 20},
+    {0x87f777fc42c7e9a3ULL, 19, 39},
+    {0x87f777fc42c7e9a3ULL, 10, 28},
+    {0x87f777fc42c7e9a3ULL, 19, 23},
+    {0x8805d03549ad59adULL, 20, 40},
+    {0x882bf86c71ea14f3ULL, 49, 48},
+    {0x884b140a6b47a798ULL, 21, 30},
+    {0x889792e79a7269cfULL, 67, 65},
+    {0x88a005a3a2afcf05ULL, 51, 50},
+    {0x88e183cfb326cd63ULL, 51, 49},
+    {0x890b14d0c778b47cULL, 70, 50},
+    {0x891b0c47e6d93cdfULL, 37, 19},
+    {0x8979145ac9ce3bf7ULL, 49, 47},
+    {0x898155938b894375ULL, 79, 41},
+    {0x8987783ca27e976fULL, 51, 49},
+    {0x898b51c1cddae23aULL, 29, 31},
+    {0x898b51c1cddae23aULL, 32, 40},
+    {0x898c26bfccb894fcULL, 39, 21},
+    {0x899e0aa35248e53dULL, 10, 12},
+    {0x89b8e09fb9590adaULL, 48, 68},
+    {0x89b8e09fb9590adaULL, 48, 52},
+    {0x89b8e09fb9590adaULL, 48, 50},
+    {0x89d24266e9bf14c4ULL, 10, 48},
+    {0x89d434d52795c5dbULL, 48, 68},
+    {0x89e9eff472e8fc33ULL, 79, 70},
+    {0x89fe46759b854d7aULL, 79, 78},
+    {0x8a0320cfda1121d1ULL, 41, 21},
+    {0x8a1e18e5201d17a4ULL, 59, 50},
+    {0x8a1e757d4889a042ULL, 62, 60},
+    {0x8a51530cbb559bf7ULL, 29, 47},
+    {0x8a80c0f10e5c3091ULL, 12, 13},
+    {0x8a80c0f10e5c3091ULL, 23, 41},
+    {0x8a8fb53c2d32a77fULL, 23, 22},
+    {0x8a9cefbdf2778c5dULL, 60, 58},
+    {0x8aa1413658018ce4ULL, 61, 39},
+    {0x8aaa9680ba7652edULL, 71, 33},
+    {0x8aaa9680ba7652edULL, 78, 60},
+    {0x8aaa9680ba7652edULL, 71, 33},
+    {0x8abfd73acead5dd3ULL, 53, 33},
+    {0x8ae1bb10ec4b5365ULL, 80, 58},
+    {0x8af174c443be259cULL, 52, 50},
+    {0x8afe52d779d8ef09ULL, 18, 10},
+    {0x8b01229e4538931fULL, 50, 48},
+    {0x8b1538e567d6d510ULL, 48, 66},
+    {0x8b65f9092fae95c9ULL, 11, 31},
+    {0x8b65f9092fae95c9ULL, 11, 29},
+    {0x8b65f9092fae95c9ULL, 11, 31},
+    {0x8b65f9092fae95c9ULL, 11, 29},
+    {0x8b65f9092fae95c9ULL, 11, 31},
+    {0x8b65f9092fae95c9ULL, 11, 29},
+    {0x8b65f9092fae95c9ULL, 11, 31},
+    {0x8b70d23e11a0a6beULL, 32, 52},
+    {0x8b7d5492dc9d02fdULL, 12, 46},
+    {0x8b9a9ccedd230ff1ULL, 23, 57},
+    {0x8bc235366078a17dULL, 9, 13},
+    {0x8bc235366078a17dULL, 2, 20},
+    {0x8be0b2211d508694ULL, 42, 22},
+    {0x8c4687b55804c2aeULL, 39, 57},
+    {0x8c4687b55804c2aeULL, 38, 47},
+    {0x8c4687b55804c2aeULL, 33, 42},
+    {0x8c4687b55804c2aeULL, 29, 47},
+    {0x8c4687b55804c2aeULL, 19, 23},
+    {0x8c651fbb4fda396aULL, 2, 20},
+    {0x8c70f95fedbf6d44ULL, 32, 41},
+    {0x8c73837f720d1e78ULL, 20, 21},
+    {0x8c738f17e3f2a8f4ULL, 21, 22},
+    {0x8c738f17e3f2a8f4ULL, 18, 10},
+    {0x8ca23dfd9ef212deULL, 47, 56},
+    {0x8cabd167da057527ULL, 18, 20},
+    {0x8cef5871ff3d0959ULL, 22, 23},
+    {0x8d10e301ea5e93bdULL, 1, 19},
+    {0x8d1626870d7eb777ULL, 30, 32},
+    {0x8d4a4ab2ae178fd8ULL, 30, 32},
+    {0x8d520fa286de4bbeULL, 29, 47},
+    {0x8d5227108834d49aULL, 59, 41},
+    {0x8d7c958f5a392f8eULL, 70, 50},
+    {0x8d7c958f5a392f8eULL, 79, 77},
+    {0x8d7c958f5a392f8eULL, 70, 34},
+    {0x8d7c958f5a392f8eULL, 70, 66},
+    {0x8d7c958f5a392f8eULL, 51, 31},
+    {0x8d7c958f5a392f8eULL, 70, 68},
+    {0x8d7c958f5a392f8eULL, 58, 49},
+    {0x8d7c958f5a392f8eULL, 79, 61},
+    {0x8d7c958f5a392f8eULL, 70, 50},
+    {0x8d80ee4e0fae0c46ULL, 39, 57},
+    {0x8d80ee4e0fae0c46ULL, 58, 60},
+    {0x8d80ee4e0fae0c46ULL, 47, 56},
+    {0x8d82847c9fb534fdULL, 9, 47},
+    {0x8d976d3a86a0d49fULL, 30, 66},
+    {0x8d976d3a86a0d49fULL, 68, 69},
+    {0x8dac50ac44037a48ULL, 10, 48},
+    {0x8dc17a4091ff00d0ULL, 50, 68},
+    {0x8de0ab77dbd2dfd8ULL, 22, 23},
+    {0x8dea60f01b0bafcfULL, 20, 56},
+    {0x8dfe6ea0663e3991ULL, 61, 60},
+    {0x8e024522428eb1d8ULL, 38, 56},
+    {0x8e1b11f75c3f83b3ULL, 51, 33},
+    {0x8e216b592dd01811ULL, 71, 51},
+    {0x8e22fed79f953b10ULL, 37, 39},
+    {0x8e56cddf7615c7b5ULL, 68, 70},
+    {0x8e6763bec3eec194ULL, 68, 67},
+    {0x8e711d336c8f64fdULL, 70, 68},
+    {0x8e711d336c8f64fdULL, 69, 15},
+    {0x8e711d336c8f64fdULL, 70, 52},
+    {0x8e99597d10f395a5ULL, 29, 30},
+    {0x8e9e9b5a713d41ebULL, 58, 57},
+    {0x8ec56a0e8ee686d2ULL, 38, 58},
+    {0x8ef3e34382d80a13ULL, 20, 21},
+    {0x8ef3e34382d80a13ULL, 31, 51},
+    {0x8ef7d5df777bd3bfULL, 38, 56},
+    {0x8f1ed8ff2ddfa230ULL, 42, 22},
+    {0x8f3048020b5afb58ULL, 52, 32},
+    {0x8f3d8faf05ce48d1ULL, 68, 32},
+    {0x8f523b440daa8dadULL, 31, 33},
+    {0x8f6b8345ba2810e7ULL, 29, 47},
+    {0x8f823e9fe9470a1aULL, 65, 49},
+    {0x8f87d0648879679bULL, 50, 46},
+    {0x8f87d0648879679bULL, 59, 25},
+    {0x8f93cd72f2d8e926ULL, 70, 32},
+    {0x8fdb89a90f79e95fULL, 80, 58},
+    {0x8fe1fc69d00b0323ULL, 41, 39},
+    {0x8fe1fc69d00b0323ULL, 51, 15},
+    {0x901c9eb44969d4f6ULL, 47, 39},
+    {0x90398b206bf016e0ULL, 65, 47},
+    {0x90402b19391713a3ULL, 47, 49},
+    {0x9041526bf8bed7b9ULL, 3, 21},
+    {0x9041526bf8bed7b9ULL, 3, 39},
+    {0x905af60eab689b07ULL, 77, 59},
+    {0x905b7425bcffce8cULL, 60, 42},
+    {0x909cf861919eb502ULL, 22, 20},
+    {0x90ad25b6b081b1f5ULL, 10, 12},
+    {0x90b3e9d0a4d33f5eULL, 30, 48},
+    {0x90ee84c8ea6909acULL, 22, 40},
+    {0x90ee84c8ea6909acULL, 18, 20},
+    {0x90ee84c8ea6909acULL, 22, 40},
+    {0x9136265f295dde12ULL, 20, 56},
+    {0x915ccc4f36b475daULL, 3, 37},
+    {0x915ccc4f36b475daULL, 27, 29},
+    {0x915ccc4f36b475daULL, 2, 20},
+    {0x915ccc4f36b475daULL, 27, 29},
+    {0x916605004c2f3e66ULL, 30, 50},
+    {0x91725007a2857611ULL, 33, 13},
+    {0x9178610d3b28dd8fULL, 20, 40},
+    {0x9186ac7b57383ab5ULL, 60, 51},
+    {0x9189c67e94f5cb12ULL, 50, 12},
+    {0x918a192f244dc30dULL, 59, 50},
+    {0x91ea90212908f412ULL, 22, 24},
+    {0x921124f45d50ee3bULL, 78, 42},
+    {0x92362c716ca30920ULL, 51, 33},
+    {0x92370976012f1c87ULL, 34, 33},
+    {0x928699d907d4b3f4ULL, 80, 58},
+    {0x929e4565910118edULL, 20, 38},
+    {0x92ab3c1b5232c11cULL, 33, 42},
+    {0x92b1548b70d20cb6ULL, 22, 24},
+    {0x92cf73d9ead519eeULL, 69, 49},
+    {0x92e33f84b9cc7d6dULL, 10, 12},
+    {0x930847691f943887ULL, 32, 14},
+    {0x9313d50e6c083a23ULL, 61, 60},
+    {0x931f4938eb5691cfULL, 33, 34},
+    {0x931f4938eb5691cfULL, 48, 32},
+    {0x93455f91380814a8ULL, 39, 40},
+    {0x9393ea7ef772ad89ULL, 11, 31},
+    {0x939d3f51fcd17198ULL, 43, 57},
+    {0x93be6c2b27b63d12ULL, 20, 56},
+    {0x93dc51790fa66d8cULL, 51, 50},
+    {0x93e5ed1d41f0a6abULL, 40, 22},
+    {0x93e6ffbd5fa0691bULL, 50, 59},
+    {0x93e6ffbd5fa0691bULL, 32, 41},
+    {0x942a951c9cf7fd1cULL, 33, 31},
+    {0x942dcb7e21577a1cULL, 0, 22},
+    {0x943f898e6f30768bULL, 29, 31},
+    {0x94412d197fd34ab5ULL, 2, 38},
+    {0x944e7a8b105db709ULL, 21, 39},
+    {0x9473fbba4ed88dceULL, 42, 40},
+    {0x949d05d5bab3fda7ULL, 60, 40},
+    {0x94b1442547753700ULL, 20, 29},
+    {0x94b1442547753700ULL, 22, 31},
+    {0x94b92a8c711ebdc2ULL, 22, 58},
+    {0x94c8906209a51d60ULL, 24, 22},
+    {0x94d1ebf2dbc9fcaeULL, 21, 55},
+    {0x94d1ebf2dbc9fcaeULL, 30, 34},
+    {0x94fdd599b4011ffbULL, 47, 31},
+    {0x951ecf60cce48984ULL, 68, 50},
+    {0x951ecf60cce48984ULL, 31, 29},
+    {0x95607b1871d6d702ULL, 60, 69},
+    {0x958e1c12526f0bc3ULL, 60, 40},
+    {0x95b3d608ffe76e7eULL, 1, 2},
+    {0x95e8cf1d9e0bf86fULL, 31, 49},
+    {0x9600cd813f2c975bULL, 39, 41},
+    {0x9658bf0404983335ULL, 29, 30},
+    {0x9668df6ebbd72964ULL, 28, 20},
+    {0x967c65ecc900691eULL, 48, 57},
+    {0x967c65ecc900691eULL, 21, 23},
+    {0x967c65ecc900691eULL, 31, 53},
+    {0x967e94516b88ff1fULL, 48, 52},
+    {0x9680e26f7604f361ULL, 30, 68},
+    {0x968b8d011674aec6ULL, 62, 70},
+    {0x969093ecba2d1553ULL, 69, 33},
+    {0x96aba32e9f30553dULL, 41, 19},
+    {0x96b14d7ff7e508ddULL, 2, 20},
+    {0x96eb172c77ca00ccULL, 77, 41},
+    {0x96f92ac265165664ULL, 2, 22},
+    {0x971e3adf26e6bd62ULL, 68, 50},
+    {0x971eb16fdeb47127ULL, 10, 32},
+    {0x97374d4e2f9cf8c2ULL, 10, 11},
+    {0x97943944590d0fb0ULL, 2, 38},
+    {0x979f9c250a66d329ULL, 22, 42},
+    {0x97aa04bdc02b8452ULL, 37, 23},
+    {0x97aa04bdc02b8452ULL, 37, 39},
+    {0x97aa04bdc02b8452ULL, 41, 57},
+    {0x97d39b837d3300e8ULL, 58, 40},
+    {0x97d39b837d3300e8ULL, 52, 50},
+    {0x97d39b837d3300e8ULL, 42, 40},
+    {0x97d39b837d3300e8ULL, 48, 30},
+    {0x98227c7746902890ULL, 79, 41},
+    {0x98348ec46845fa71ULL, 10, 30},
+    {0x9835a92c888a6c57ULL, 49, 47},
+    {0x984c89833be1a333ULL, 51, 42},
+    {0x988d5c852942a611ULL, 77, 43},
+    {0x98a209d05cb42c7eULL, 71, 49},
+    {0x98e36954e0080471ULL, 59, 41},
+    {0x98e4aba702180a73ULL, 9, 47},
+    {0x98e4aba702180a73ULL, 9, 49},
+    {0x98e4aba702180a73ULL, 9, 67},
+    {0x98e4aba702180a73ULL, 9, 33},
+    {0x98eefb143a89be5fULL, 11, 20},
+    {0x98f120369b7474e5ULL, 21, 30},
+    {0x98fc9d5968429a88ULL, 28, 29},
+    {0x99053c3a3d10e249ULL, 0, 22},
+    {0x991794d0a97a88aeULL, 38, 56},
+    {0x991e4337f29de100ULL, 11, 29},
+    {0x9927a6c9be25a332ULL, 0, 20},
+    {0x9939a01b6a0c080aULL, 39, 59},
+    {0x993dfc8ca28c24d4ULL, 52, 51},
+    {0x99772a1f82b75895ULL, 48, 57},
+    {0x997aa40aa077c4e2ULL, 0, 20},
+    {0x999b63000848ca2bULL, 78, 42},
+    {0x99a19e6f816ebde8ULL, 51, 33},
+    {0x99a429b04ca145d1ULL, 20, 29},
+    {0x99e9211290398d48ULL, 41, 39},
+    {0x99e9713e368cdbbcULL, 30, 22},
+    {0x99e9713e368cdbbcULL, 50, 14},
+    {0x99eb955764275266ULL, 71, 49},
+    {0x9a1b1169b82713a5ULL, 43, 42},
+    {0x9a1ff0c872397d6bULL, 59, 55},
+    {0x9a1ff0c872397d6bULL, 43, 42},
+    {0x9a1ff0c872397d6bULL, 59, 57},
+    {0x9a2e790bce9b013bULL, 52, 51},
+    {0x9a397d4abddf3373ULL, 80, 60},
+    {0x9a51d7abad1996c4ULL, 68, 66},
+    {0x9a67a755cfa93bcfULL, 29, 71},
+    {0x9a6f79db5a4fb9e9ULL, 31, 51},
+    {0x9a6f79db5a4fb9e9ULL, 22, 40},
+    {0x9a6f79db5a4fb9e9ULL, 32, 68},
+    {0x9abc8a11051298f5ULL, 2, 24},
+    {0x9ac50dfaf7d09389ULL, 60, 59},
+    {0x9b0c1f1d9a00a400ULL, 12, 30},
+    {0x9b179596772a7adcULL, 48, 57},
+    {0x9b5b75f26d9e5b9aULL, 70, 48},
+    {0x9bd849cb3462e0c4ULL, 30, 34},
+    {0x9beeca68fed99539ULL, 41, 23},
+    {0x9bf3208a68a30575ULL, 12, 30},
+    {0x9bf6fb4a13511597ULL, 22, 40},
+    {0x9c01e62c8f897e3dULL, 42, 40},
+    {0x9c068024a3785077ULL, 59, 57},
+    {0x9c14229c0bab173bULL, 32, 23},
+    {0x9c14229c0bab173bULL, 68, 34},
+    {0x9c1da5175e96eeebULL, 69, 33},
+    {0x9c1ed9f6048dbb67ULL, 53, 52},
+    {0x9c21d7cd8096bc29ULL, 29, 31},
+    {0x9c21d7cd8096bc29ULL, 21, 23},
+    {0x9c21d7cd8096bc29ULL, 39, 57},
+    {0x9c32713fce4cf11cULL, 52, 60},
+    {0x9c43b2e50dbd8ef4ULL, 39, 57},
+    {0x9c5a5d9c0497db55ULL, 22, 40},
+    {0x9c82062e03979f00ULL, 60, 24},
+    {0x9c850c7b5e0321b9ULL, 29, 51},
+    {0x9c8bb01f4f71328eULL, 18, 20},
+    {0x9c8bb01f4f71328eULL, 18, 19},
+    {0x9c8bb01f4f71328eULL, 10, 30},
+    {0x9c8bb01f4f71328eULL, 28, 30},
+    {0x9c8bb01f4f71328eULL, 22, 31},
+    {0x9c8bb01f4f71328eULL, 18, 20},
+    {0x9cab948bb6cfe393ULL, 10, 11},
+    {0x9cb3d86b91fb1b92ULL, 50, 46},
+    {0x9cb3d86b91fb1b92ULL, 42, 40},
+    {0x9cb3d86b91fb1b92ULL, 58, 40},
+    {0x9cb3d86b91fb1b92ULL, 52, 32},
+    {0x9cb3d86b91fb1b92ULL, 50, 46},
+    {0x9cc418767a99e314ULL, 10, 30},
+    {0x9ccf8b29483cb6afULL, 21, 39},
+    {0x9cfa042a02932783ULL, 52, 50},
+    {0x9d0c7e5b8d7c69b9ULL, 30, 10},
+    {0x9d0c7e5b8d7c69b9ULL, 70, 68},
+    {0x9d189f07aeb2cbbbULL, 70, 48},
+    {0x9d189f07aeb2cbbbULL, 42, 40},
+    {0x9d2dade2a0dbe5beULL, 71, 33},
+    {0x9d31b243a512e0b5ULL, 78, 42},
+    {0x9d31b243a512e0b5ULL, 70, 69},
+    {0x9d8ba5de57b6f60dULL, 20, 28},
+    {0x9d8ba5de57b6f60dULL, 49, 47},
+    {0x9d90c5d90649153fULL, 50, 30},
+    {0x9db01a27e709b3a2ULL, 61, 69},
+    {0x9dbe0f2f8733a378ULL, 41, 23},
+    {0x9de509a1c31461f4ULL, 60, 51},
+    {0x9de62879af30e8b4ULL, 13, 12},
+    {0x9de6748f19200802ULL, 1, 21},
+    {0x9de7327542f6ead0ULL, 9, 29},
+    {0x9de7327542f6ead0ULL, 2, 38},
+    {0x9df50a0d42e5c95eULL, 62, 78},
+    {0x9e2abde7daa638dcULL, 22, 62},
+    {0x9e2abde7daa638dcULL, 59, 43},
+    {0x9e2abde7daa638dcULL, 49, 41},
+    {0x9e56b82c545c4b83ULL, 42, 40},
+    {0x9e5a05c93943cd32ULL, 30, 68},
+    {0x9e86b5f09c4972ceULL, 0, 22},
+    {0x9e93451a0b72829eULL, 61, 59},
+    {0x9ec645324bce5a45ULL, 52, 32},
+    {0x9eeb883904550186ULL, 10, 12},
+    {0x9ef8c725eedb9796ULL, 30, 32},
+    {0x9f0f0a2540171967ULL, 52, 32},
+    {0x9f16ac86b4264e81ULL, 10, 14},
+    {0x9f20e56741ee8151ULL, 19, 39},
+    {0x9f299d2e5507a053ULL, 30, 48},
+    {0x9f31e4b9353da4a4ULL, 51, 42},
+    {0x9f34d749bcd44887ULL, 60, 51},
+    {0x9f3796b139309d20ULL, 79, 78},
+    {0x9f3dd9ed1ee7d5acULL, 42, 60},
+    {0x9f3dd9ed1ee7d5acULL, 29, 47},
+    {0x9fc93fe2a51cee69ULL, 41, 32},
+    {0x9fd57116358f0130ULL, 19, 39},
+    {0x9fed84fb4e46dbd7ULL, 51, 33},
+    {0x9fed84fb4e46dbd7ULL, 38, 20},
+    {0xa005427f1c0f0140ULL, 20, 29},
+    {0xa0444046f607c23aULL, 27, 47},
+    {0xa05fa2696136500dULL, 28, 32},
+    {0xa0a91c46339a8ebdULL, 52, 50},
+    {0xa0c29e03951e5941ULL, 51, 15},
+    {0xa0cfc32e1a5a78e3ULL, 60, 58},
+    {0xa0d8a8737e789bb0ULL, 20, 29},
+    {0xa0d8a8737e789bb0ULL, 39, 57},
+    {0xa0d8a8737e789bb0ULL, 49, 67},
+    {0xa0e56a09d652768dULL, 58, 57},
+    {0xa0ef62d653df74c6ULL, 28, 37},
+    {0xa0fa8a11769b585cULL, 70, 68},
+    {0xa0fcd63b9b9823b0ULL, 11, 51},
+    {0xa1008a58ad4dcb6dULL, 3, 43},
+    {0xa11099291ae92405ULL, 58, 49},
+    {0xa140aa5d1fcb7a9fULL, 61, 57},
+    {0xa14361ce7dc37049ULL, 40, 39},
+    {0xa14f5c3b1ad2cf7bULL, 38, 56},
+    {0xa15b7206dbf00bcfULL, 43, 25},
+    {0xa1745a4c7f78b8d6ULL, 39, 59},
+    {0xa1cdf7693689160aULL, 28, 29},
+    {0xa1ff742a87761a1cULL, 51, 59},
+    {0xa1ff742a87761a1cULL, 70, 61},
+    {0xa1ff742a87761a1cULL, 58, 56},
+    {0xa1ff742a87761a1cULL, 49, 47},
+    {0xa1ff742a87761a1cULL, 60, 59},
+    {0xa238cd4e3d890fc0ULL, 70, 48},
+    {0xa24e2e3fca12462aULL, 9, 31},
+    {0xa28271e06691a9c1ULL, 33, 15},
+    {0xa2a43ea7dc939a09ULL, 39, 59},
+    {0xa2ad14c34266e6e5ULL, 43, 41},
+    {0xa2bd98a934fa47a1ULL, 11, 20},
+    {0xa2be4024582cd72cULL, 49, 69},
+    {0xa2cbed8e182b1c65ULL, 47, 48},
+    {0xa343b0225f0ffdffULL, 60, 40},
+    {0xa34df9017ef06ac2ULL, 32, 12},
+    {0xa34df9017ef06ac2ULL, 32, 30},
+    {0xa36198464ea50bc0ULL, 52, 32},
+    {0xa3793185e737760bULL, 19, 20},
+    {0xa3a0a5d09cfbea66ULL, 40, 42},
+    {0xa3ac9788642eb1b4ULL, 48, 39},
+    {0xa3ac9788642eb1b4ULL, 30, 21},
+    {0xa3ba318444f3bdd4ULL, 19, 21},
+    {0xa3ed458ee9f47361ULL, 69, 67},
+    {0xa41b124476477d42ULL, 11, 33},
+    {0xa42f097ff46ea3e4ULL, 12, 21},
+    {0xa42f2a75509c50f7ULL, 1, 23},
+    {0xa435f4b54b1ff643ULL, 51, 29},
+    {0xa448b0137ceccad9ULL, 12, 30},
+    {0xa4525a5a759e8dbcULL, 39, 57},
+    {0xa45897d068deafc0ULL, 38, 47},
+    {0xa45a234743b042c8ULL, 3, 39},
+    {0xa4cb74445a97137cULL, 77, 59},
+    {0xa4cdf41d83efd224ULL, 22, 31},
+    {0xa4dacec5b03fd8d5ULL, 58, 57},
+    {0xa50cde2211ce3bbaULL, 32, 30},
+    {0xa5168941a0f3ee05ULL, 40, 42},
+    {0xa58332f0dfd1df6aULL, 52, 51},
+    {0xa58d20fb8ddd85b4ULL, 25, 43},
+    {0xa5a7228867df7424ULL, 22, 24},
+    {0xa5a77a69cedc1edfULL, 3, 12},
+    {0xa5a77a69cedc1edfULL, 27, 28},
+    {0xa5a77a69cedc1edfULL, 3, 12},
+    {0xa5a77a69cedc1edfULL, 27, 28},
+    {0xa5a77a69cedc1edfULL, 3, 12},
+    {0xa5a77a69cedc1edfULL, 27, 28},
+    {0xa5a77a69cedc1edfULL, 3, 12},
+    {0xa5a77a69cedc1edfULL, 27, 28},
+    {0xa5a77a69cedc1edfULL, 3, 12},
+    {0xa5a77a69cedc1edfULL, 27, 28},
+    {0xa5a77a69cedc1edfULL, 3, 12},
+    {0xa5a77a69cedc1edfULL, 27, 28},
+    {0xa5a77a69cedc1edfULL, 3, 12},
+    {0xa5a77a69cedc1edfULL, 27, 28},
+    {0xa5a77a69cedc1edfULL, 3, 12},
+    {0xa5a77a69cedc1edfULL, 27, 28},
+    {0xa5a77a69cedc1edfULL, 3, 12},
+    {0xa5a77a69cedc1edfULL, 27, 28},
+    {0xa5a77a69cedc1edfULL, 3, 12},
+    {0xa5a77a69cedc1edfULL, 27, 28},
+    {0xa5a77a69cedc1edfULL, 3, 12},
+    {0xa5a77a69cedc1edfULL, 27, 28},
+    {0xa5a77a69cedc1edfULL, 3, 12},
+    {0xa5a77a69cedc1edfULL, 27, 28},
+    {0xa5a77a69cedc1edfULL, 3, 12},
+    {0xa5a77a69cedc1edfULL, 27, 28},
+    {0xa5a89630ed42a131ULL, 51, 47},
+    {0xa5dd0a3634835c23ULL, 19, 41},
+    {0xa5df44a8f4a554f6ULL, 11, 12},
+    {0xa5f24e9122286125ULL, 38, 56},
+    {0xa63eb4ee49aba447ULL, 42, 40},
+    {0xa64884f4937560dbULL, 60, 58},
+    {0xa64b28774c73bc7cULL, 51, 49},
+    {0xa64b28774c73bc7cULL, 51, 47},
+    {0xa65964a334ee04e9ULL, 60, 24},
+    {0xa67ada8c06ef14ffULL, 40, 58},
+    {0xa6b5697d1b6355e2ULL, 37, 46},
+    {0xa6ecea6974280df5ULL, 68, 48},
+    {0xa6f079c9adcd415dULL, 47, 48},
+    {0xa6f9ef8a23a9fa3aULL, 38, 47},
+    {0xa7073c695b264cd9ULL, 20, 56},
+    {0xa7073c695b264cd9ULL, 47, 33},
+    {0xa725f04ff9cbb6ceULL, 68, 48},
+    {0xa7a4145de9c3c736ULL, 41, 23},
+    {0xa7afc3bc48435e7fULL, 67, 66},
+    {0xa7afc3bc48435e7fULL, 60, 42},
+    {0xa7c9413a19bf567bULL, 40, 60},
+    {0xa85e397764fe3244ULL, 21, 25},
+    {0xa8658c36b335499eULL, 3, 21},
+    {0xa8658c36b335499eULL, 0, 4},
+    {0xa8658c36b335499eULL, 3, 21},
+    {0xa87c89397b8b77e6ULL, 49, 47},
+    {0xa889b56e55e03ea0ULL, 50, 14},
+    {0xa89312a6ba2cd8eeULL, 20, 29},
+    {0xa8ccae1dc4220274ULL, 41, 21},
+    {0xa8e8e6271069ac55ULL, 70, 32},
+    {0xa8fb6dd5945de3afULL, 78, 60},
+    {0xa905b683f8304cf4ULL, 11, 49},
+    {0xa913b895f4daa0a3ULL, 59, 55},
+    {0xa913b895f4daa0a3ULL, 51, 33},
+    {0xa91f3891d316629cULL, 2, 38},
+    {0xa91f3891d316629cULL, 28, 30},
+    {0xa91f3891d316629cULL, 2, 38},
+    {0xa91f3891d316629cULL, 28, 30},
+    {0xa91f3891d316629cULL, 2, 22},
+    {0xa91f3891d316629cULL, 2, 38},
+    {0xa93293cac7fa565eULL, 59, 57},
+    {0xa9536f42ad8b9df8ULL, 52, 51},
+    {0xa95aae0d391f25a6ULL, 3, 21},
+    {0xa95aae0d391f25a6ULL, 3, 39},
+    {0xa95aae0d391f25a6ULL, 29, 30},
+    {0xa95aae0d391f25a6ULL, 29, 21},
+    {0xa984fab77028f67fULL, 0, 22},
+    {0xa984fab77028f67fULL, 3, 39},
+    {0xa998513ac1cf2c2aULL, 50, 48},
+    {0xa9993ac21a7cc6f7ULL, 1, 10},
+    {0xa9a0b290680e2c59ULL, 2, 38},
+    {0xa9aae786ef83518fULL, 59, 41},
+    {0xa9cc235d83cb1705ULL, 42, 41},
+    {0xa9ede7ae428cff13ULL, 47, 11},
+    {0xa9f21f0c469380d7ULL, 71, 49},
+    {0xa9f3e6ef3d4b2f0dULL, 78, 56},
+    {0xa9f48526a03225a5ULL, 18, 10},
+    {0xa9f54e823dcae372ULL, 52, 50},
+    {0xaa0b99db467887ebULL, 38, 47},
+    {0xaa0b99db467887ebULL, 22, 31},
+    {0xaa0b9e8fbd08f301ULL, 11, 19},
+    {0xaa12f2ffdca6fcdfULL, 19, 28},
+    {0xaa2c36aa93ff270bULL, 66, 67},
+    {0xaa345d4eb552cea0ULL, 51, 50},
+    {0xaa4a13b42836c554ULL, 2, 22},
+    {0xaa539a167fd0b314ULL, 21, 23},
+    {0xaa539a167fd0b314ULL, 47, 48},
+    {0xaa539a167fd0b314ULL, 37, 46},
+    {0xaa539a167fd0b314ULL, 56, 48},
+    {0xaa539a167fd0b314ULL, 21, 23},
+    {0xaa5b4dc7ba05cd37ULL, 10, 48},
+    {0xaa63db7ad7e619c9ULL, 33, 69},
+    {0xaa729ba8c5dae99fULL, 70, 68},
+    {0xaa729ba8c5dae99fULL, 51, 13},
+    {0xaa729ba8c5dae99fULL, 70, 50},
+    {0xaa729ba8c5dae99fULL, 52, 50},
+    {0xaa729ba8c5dae99fULL, 51, 31},
+    {0xaa729ba8c5dae99fULL, 70, 68},
+    {0xaa7533ded26e3e0cULL, 39, 59},
+    {0xaac7315cc1d08f06ULL, 47, 33},
+    {0xaacbe687b9fbe763ULL, 20, 40},
+    {0xaaf67a0e358d7cabULL, 61, 57},
+    {0xab0d2a613b3d1e11ULL, 29, 49},
+    {0xab34b86fe324af67ULL, 2, 20},
+    {0xab3aa557af776da3ULL, 60, 56},
+    {0xabb2f9da83eb8855ULL, 41, 23},
+    {0xabb5f2fa253a17cfULL, 50, 10},
+    {0xabc477c9bd0c07f7ULL, 51, 49},
+    {0xabf3e8fa44520450ULL, 22, 20},
+    {0xac1c1c0d6677fbb8ULL, 41, 23},
+    {0xac3eae6116c4d286ULL, 31, 33},
+    {0xac5af814968f3028ULL, 37, 55},
+    {0xac87fe5ad8a21fc7ULL, 51, 49},
+    {0xac98850c2f24d1e2ULL, 49, 29},
+    {0xac98850c2f24d1e2ULL, 58, 40},
+    {0xac98850c2f24d1e2ULL, 48, 12},
+    {0xacab21ad21d841c7ULL, 47, 67},
+    {0xacac9fb065bd0cf0ULL, 1, 10},
+    {0xacb009ea37435c7dULL, 22, 40},
+    {0xacc21d057e6316d2ULL, 12, 48},
+    {0xacf8ee654d76d5aaULL, 10, 32},
+    {0xad0370360c159938ULL, 10, 48},
+    {0xad0370360c159938ULL, 10, 32},
+    {0xad0892d39b647b74ULL, 60, 51},
+    {0xad0dcc156e698a2cULL, 42, 33},
+    {0xad0dcc156e698a2cULL, 51, 33},
+    {0xad0dcc156e698a2cULL, 58, 40},
+    {0xad56c3578a208391ULL, 1, 9},
+    {0xad56c3578a208391ULL, 21, 29},
+    {0xad9ce86f452438e3ULL, 60, 40},
+    {0xadebf77178013b0dULL, 11, 29},
+    {0xae00bce8d04d93fbULL, 29, 38},
+    {0xae1c9877780d3c27ULL, 33, 31},
+    {0xae409d4377fd4574ULL, 60, 59},
+    {0xae409d4377fd4574ULL, 22, 20},
+    {0xae409d4377fd4574ULL, 60, 51},
+    {0xae4ea1beb0b6dc1aULL, 71, 51},
+    {0xae5f3b800ea5abf8ULL, 29, 30},
+    {0xae7efb76d3b6b887ULL, 30, 48},
+    {0xae8c8cf977c28a64ULL, 39, 57},
+    {0xaea06cf4fdad78ffULL, 50, 42},
+    {0xaec9adf7f6db39a4ULL, 10, 48},
+    {0xaecd715c157ba99cULL, 58, 40},
+    {0xaf628044c5fd16f4ULL, 49, 48},
+    {0xaf87538befa88fb5ULL, 61, 69},
+    {0xafb05ba7dff6ace7ULL, 59, 57},
+    {0xafb05ba7dff6ace7ULL, 50, 48},
+    {0xafb8986bbd51e43fULL, 58, 67},
+    {0xafb8986bbd51e43fULL, 48, 66},
+    {0xafe9c763c71216e8ULL, 70, 30},
+    {0xb003b7fa0571c2a7ULL, 51, 59},
+    {0xb003b7fa0571c2a7ULL, 70, 68},
+    {0xb007caf645549853ULL, 41, 39},
+    {0xb00848c4c2e95c26ULL, 11, 12},
+    {0xb00ad549ec2e00fcULL, 51, 50},
+    {0xb00b8dd841682bcdULL, 39, 59},
+    {0xb00ee389d352bc53ULL, 29, 31},
+    {0xb0165f3d2035ee3dULL, 21, 39},
+    {0xb044ab581949a282ULL, 68, 66},
+    {0xb06c8f95511fd6b0ULL, 20, 40},
+    {0xb07418b02a76d633ULL, 53, 33},
+    {0xb092a2bc41b2a953ULL, 70, 66},
+    {0xb09e117b9f58a319ULL, 38, 56},
+    {0xb09e117b9f58a319ULL, 28, 29},
+    {0xb0a89378f5ac5cdcULL, 70, 32},
+    {0xb0b66405cfeceae8ULL, 69, 60},
+    {0xb134f210c860b98dULL, 43, 25},
+    {0xb159525a233b190dULL, 51, 29},
+    {0xb1853538b78f27fdULL, 47, 29},
+    {0xb1853538b78f27fdULL, 32, 12},
+    {0xb1bc5a84320fb385ULL, 68, 66},
+    {0xb1ce2b39d35eba04ULL, 52, 32},
+    {0xb1d68026183eff13ULL, 38, 40},
+    {0xb1fdc33b72cce269ULL, 41, 32},
+    {0xb1fdc33b72cce269ULL, 70, 32},
+    {0xb1fdc33b72cce269ULL, 51, 33},
+    {0xb2089c3022631c7aULL, 39, 41},
+    {0xb2923eac32a8b522ULL, 58, 40},
+    {0xb2923eac32a8b522ULL, 62, 60},
+    {0xb2923eac32a8b522ULL, 58, 40},
+    {0xb29cdfb94f35ea49ULL, 77, 59},
+    {0xb2a9c8473dce3beaULL, 49, 31},
+    {0xb2d422256f477475ULL, 28, 48},
+    {0xb2fb57f61cf4c79bULL, 53, 52},
+    {0xb2fb57f61cf4c79bULL, 77, 68},
+    {0xb2fb57f61cf4c79bULL, 53, 52},
+    {0xb2fb57f61cf4c79bULL, 61, 52},
+    {0xb2fb57f61cf4c79bULL, 53, 52},
+    {0xb2fb57f61cf4c79bULL, 77, 68},
+    {0xb32aa3b1de4cccc0ULL, 19, 37},
+    {0xb3320a0f53f286efULL, 50, 30},
+    {0xb333cc966d489318ULL, 9, 10},
+    {0xb33b49077bcdc584ULL, 21, 22},
+    {0xb37730113ff91d1fULL, 24, 33},
+    {0xb384036712005d37ULL, 29, 47},
+    {0xb384036712005d37ULL, 48, 57},
+    {0xb384036712005d37ULL, 29, 15},
+    {0xb384036712005d37ULL, 31, 32},
+    {0xb384036712005d37ULL, 30, 32},
+    {0xb38d693a7cd4c6dcULL, 58, 49},
+    {0xb3962f9048747faeULL, 29, 31},
+    {0xb3c6e019d9aca69bULL, 20, 22},
+    {0xb3d915bd8b998550ULL, 32, 23},
+    {0xb3f2a83fd3a9f704ULL, 38, 40},
+    {0xb4275228dc200761ULL, 34, 32},
+    {0xb430188a14007b72ULL, 19, 39},
+    {0xb4408969e7fe11a6ULL, 21, 23},
+    {0xb440db53cf296ea3ULL, 79, 41},
+    {0xb44b314180d83a37ULL, 79, 43},
+    {0xb44b314180d83a37ULL, 41, 33},
+    {0xb44b314180d83a37ULL, 79, 43},
+    {0xb4664ad5075c6e51ULL, 68, 48},
+    {0xb4b5526eec3715f4ULL, 58, 40},
+    {0xb4b5526eec3715f4ULL, 57, 39},
+    {0xb4c224c80b3fdf32ULL, 22, 40},
+    {0xb4c224c80b3fdf32ULL, 22, 44},
+    {0xb4c900dbe0536135ULL, 59, 1},
+    {0xb4ca0b494ccf8aa2ULL, 41, 39},
+    {0xb4f7bf1a1c8c6375ULL, 39, 57},
+    {0xb5058ac432eb5c73ULL, 37, 23},
+    {0xb5166c20f29aba19ULL, 38, 40},
+    {0xb517e41a90b66028ULL, 47, 49},
+    {0xb51c41517ef9dee0ULL, 20, 22},
+    {0xb52c2ca8186677acULL, 21, 30},
+    {0xb531074646841c7fULL, 22, 31},
+    {0xb5493cfe676ac91cULL, 57, 61},
+    {0xb579ea6a13121d92ULL, 57, 39},
+    {0xb57a8c6138f4da11ULL, 52, 43},
+    {0xb5d059d6e42839d3ULL, 41, 21},
+    {0xb5d18e0b5171688bULL, 43, 19},
+    {0xb5e90a92ee94d496ULL, 11, 29},
+    {0xb5fa57b05f8f6a13ULL, 10, 48},
+    {0xb6198dcce51fc565ULL, 52, 50},
+    {0xb62135d7b5e8b36cULL, 12, 32},
+    {0xb6276eda678b3c47ULL, 22, 24},
+    {0xb62c2dce05ef2651ULL, 68, 32},
+    {0xb62c2dce05ef2651ULL, 68, 50},
+    {0xb6613b7557f8f922ULL, 61, 60},
+    {0xb66839f9a8fdd068ULL, 12, 32},
+    {0xb69d7591c0628e2cULL, 33, 11},
+    {0xb69d7591c0628e2cULL, 33, 29},
+    {0xb6c730fa2a53852aULL, 59, 19},
+    {0xb6c730fa2a53852aULL, 70, 48},
+    {0xb6dafd96e2addcdaULL, 38, 39},
+    {0xb6e059303c1b4926ULL, 21, 30},
+    {0xb6eb915d30f16702ULL, 10, 19},
+    {0xb709f4df3672be55ULL, 61, 41},
+    {0xb710cc6d04ed7fceULL, 39, 57},
+    {0xb772d6cbec0e8acfULL, 71, 49},
+    {0xb777959d8c2f37b9ULL, 79, 70},
+    {0xb794b0125ad81953ULL, 30, 52},
+    {0xb79af53c615e6808ULL, 58, 60},
+    {0xb7c79f3c3acaebb2ULL, 11, 29},
+    {0xb7c79f3c3acaebb2ULL, 30, 50},
+    {0xb7cecc88784f5cbeULL, 30, 31},
+    {0xb7ff80792ce31aedULL, 58, 40},
+    {0xb7ff80792ce31aedULL, 62, 70},
+    {0xb82ccf10e2f42433ULL, 50, 14},
+    {0xb833e98fab71ad91ULL, 29, 33},
+    {0xb83ec6a6acd36ecbULL, 60, 58},
+    {0xb83fdf3c71f84be8ULL, 32, 33},
+    {0xb83ff401d3d25d40ULL, 49, 58},
+    {0xb83ff401d3d25d40ULL, 1, 2},
+    {0xb83ff401d3d25d40ULL, 1, 10},
+    {0xb83ff401d3d25d40ULL, 21, 39},
+    {0xb88447652b1158d0ULL, 28, 30},
+    {0xb8c3ccc8a6a0520cULL, 33, 41},
+    {0xb909ef804193ff2aULL, 39, 57},
+    {0xb90d374ebb51c2c4ULL, 24, 33},
+    {0xb90f2b1f567ff800ULL, 61, 41},
+    {0xb913fbc288fdcf91ULL, 19, 23},
+    {0xb9565c2a71754486ULL, 29, 30},
+    {0xb9565c2a71754486ULL, 23, 32},
+    {0xb957d5ab0a3a1c83ULL, 52, 32},
+    {0xb976ea5c1c0a85c3ULL, 57, 59},
+    {0xb9a0a9f16cfff4f0ULL, 33, 31},
+    {0xb9b6838748644562ULL, 38, 30},
+    {0xb9ba1ecab60b6832ULL, 28, 48},
+    {0xb9ba52a293bd4a05ULL, 2, 11},
+    {0xb9d5ca2a17e8b9edULL, 33, 49},
+    {0xb9e5579c8b858ea6ULL, 69, 68},
+    {0xb9ecc6356d3f6b4bULL, 20, 40},
+    {0xba0728dc76ff7b17ULL, 32, 23},
+    {0xba15eccb61d4e721ULL, 70, 48},
+    {0xba4c678613c28983ULL, 70, 50},
+    {0xba6dbbd33d7c6d35ULL, 68, 59},
+    {0xba7360cf040c2488ULL, 52, 60},
+    {0xba7a5a3d5837af4aULL, 50, 28},
+    {0xbad3346a2b82293cULL, 41, 21},
+    {0xbad3ea5b7e5c4eeeULL, 21, 39},
+    {0xbad98d4e0a725290ULL, 41, 23},
+    {0xbb1db849b7c721e3ULL, 60, 59},
+    {0xbb1e881bafa89e02ULL, 57, 39},
+    {0xbb29d253c2c5b332ULL, 10, 28},
+    {0xbb43e837143f305dULL, 47, 51},
+    {0xbb43e837143f305dULL, 0, 56},
+    {0xbb80b5a912f804f7ULL, 1, 37},
+    {0xbb80b5a912f804f7ULL, 39, 47},
+    {0xbb88f1f26dc0e859ULL, 58, 56},
+    {0xbb8bba4a962f1f83ULL, 51, 33},
+    {0xbb8bba4a962f1f83ULL, 42, 33},
+    {0xbb8bba4a962f1f83ULL, 41, 23},
+    {0xbb8bba4a962f1f83ULL, 47, 38},
+    {0xbb8bba4a962f1f83ULL, 61, 57},
+    {0xbbd15db832b02546ULL, 39, 59},
+    {0xbbe280fcc74fb23eULL, 59, 41},
+    {0xbbe78e86b56bc8caULL, 12, 13},
+    {0xbbe78e86b56bc8caULL, 28, 29},
+    {0xbbe78e86b56bc8caULL, 12, 13},
+    {0xbbf79d22d495522dULL, 22, 60},
+    {0xbc183dda37d7cd6dULL, 57, 48},
+    {0xbc183dda37d7cd6dULL, 61, 39},
+    {0xbc183dda37d7cd6dULL, 61, 37},
+    {0xbc183dda37d7cd6dULL, 51, 50},
+    {0xbc1ce6df59be7b8eULL, 58, 40},
+    {0xbc4e7030362031e0ULL, 60, 24},
+    {0xbc57b7d862202a14ULL, 69, 67},
+    {0xbc5e8c24186e5437ULL, 56, 47},
+    {0xbc802c735539d208ULL, 2, 38},
+    {0xbcb43add3cb1c3d0ULL, 41, 23},
+    {0xbcb71883795366daULL, 20, 24},
+    {0xbcc25a23501c476cULL, 12, 32},
+    {0xbccc919584f1cb8dULL, 33, 31},
+    {0xbd08ddeb9bc14accULL, 40, 38},
+    {0xbd18c4cfd0eee195ULL, 58, 20},
+    {0xbd196f99712b4e58ULL, 60, 58},
+    {0xbd1c3db551cfab15ULL, 51, 49},
+    {0xbd2e3373b89c0cbbULL, 78, 24},
+    {0xbd69b32fcd04cc52ULL, 53, 52},
+    {0xbd69b32fcd04cc52ULL, 61, 52},
+    {0xbd69b32fcd04cc52ULL, 53, 52},
+    {0xbd69b32fcd04cc52ULL, 61, 52},
+    {0xbd69b32fcd04cc52ULL, 77, 68},
+    {0xbd69b32fcd04cc52ULL, 53, 52},
+    {0xbd69b32fcd04cc52ULL, 77, 68},
+    {0xbd69b32fcd04cc52ULL, 53, 52},
+    {0xbd69b32fcd04cc52ULL, 77, 68},
+    {0xbd69b32fcd04cc52ULL, 53, 52},
+    {0xbd69b32fcd04cc52ULL, 62, 60},
+    {0xbd69b32fcd04cc52ULL, 53, 52},
+    {0xbd69b32fcd04cc52ULL, 61, 52},
+    {0xbd69b32fcd04cc52ULL, 77, 68},
+    {0xbd69b32fcd04cc52ULL, 70, 52},
+    {0xbd69b32fcd04cc52ULL, 53, 52},
+    {0xbd69b32fcd04cc52ULL, 61, 52},
+    {0xbd69b32fcd04cc52ULL, 53, 52},
+    {0xbd69b32fcd04cc52ULL, 77, 68},
+    {0xbd69b32fcd04cc52ULL, 53, 52},
+    {0xbd69b32fcd04cc52ULL, 77, 68},
+    {0xbd69b32fcd04cc52ULL, 53, 52},
+    {0xbd69b32fcd04cc52ULL, 77, 68},
+    {0xbd69b32fcd04cc52ULL, 61, 52},
+    {0xbd69b32fcd04cc52ULL, 77, 68},
+    {0xbd69b32fcd04cc52ULL, 53, 52},
+    {0xbd69b32fcd04cc52ULL, 61, 52},
+    {0xbd69b32fcd04cc52ULL, 53, 52},
+    {0xbd6dc8e60143484dULL, 32, 14},
+    {0xbd78a8ec9f456b2aULL, 78, 42},
+    {0xbd78a8ec9f456b2aULL, 61, 59},
+    {0xbd78a8ec9f456b2aULL, 78, 42},
+    {0xbd78a8ec9f456b2aULL, 62, 42},
+    {0xbd84683c33a8e41cULL, 62, 42},
+    {0xbdbb87e68bac08a7ULL, 59, 57},
+    {0xbe11cce6ebc8852dULL, 20, 24},
+    {0xbe2b04252d57da9fULL, 18, 20},
+    {0xbe56a991ae423b65ULL, 19, 39},
+    {0xbe5899ddb8585211ULL, 70, 69},
+    {0xbe81722f8e5c3ca1ULL, 20, 28},
+    {0xbe8688c98eac6171ULL, 40, 20},
+    {0xbe8768bde60acc4dULL, 11, 47},
+    {0xbeae240c633e9fc3ULL, 51, 29},
+    {0xbeb165705f51096cULL, 77, 41},
+    {0xbeb165705f51096cULL, 77, 57},
+    {0xbeb165705f51096cULL, 77, 41},
+    {0xbecc1cacfe60e01bULL, 61, 41},
+    {0xbedd714779d097acULL, 34, 33},
+    {0xbedd714779d097acULL, 51, 31},
+    {0xbeee83acd3811333ULL, 23, 41},
+    {0xbf11dcf9c69e8746ULL, 27, 47},
+    {0xbf318d4fe50c9851ULL, 61, 59},
+    {0xbf318d4fe50c9851ULL, 61, 41},
+    {0xbf318d4fe50c9851ULL, 61, 59},
+    {0xbf318d4fe50c9851ULL, 61, 41},
+    {0xbf318d4fe50c9851ULL, 61, 59},
+    {0xbf318d4fe50c9851ULL, 61, 41},
+    {0xbf318d4fe50c9851ULL, 61, 59},
+    {0xbf385ccd1f54fed3ULL, 0, 38},
+    {0xbf385ccd1f54fed3ULL, 22, 40},
+    {0xbf385ccd1f54fed3ULL, 0, 38},
+    {0xbf385ccd1f54fed3ULL, 22, 40},
+    {0xbf385ccd1f54fed3ULL, 0, 38},
+    {0xbf4b8c7eccb48a3eULL, 38, 40},
+    {0xbf4b8c7eccb48a3eULL, 10, 32},
+    {0xbf584f98aa2b240fULL, 57, 48},
+    {0xbf6b3166d37fa2a1ULL, 37, 57},
+    {0xbf6b3166d37fa2a1ULL, 29, 31},
+    {0xbf852c7372010f32ULL, 52, 48},
+    {0xbf8bea6b69466abdULL, 46, 47},
+    {0xbf8ed878bc7e9192ULL, 41, 21},
+    {0xbf9988cbc19e7f93ULL, 11, 12},
+    {0xbf9d2c0f45339e9fULL, 79, 70},
+    {0xbfaed4c8024097ccULL, 69, 61},
+    {0xbfaed4c8024097ccULL, 69, 70},
+    {0xbfb2555560f005ecULL, 29, 51},
+    {0xbfb2555560f005ecULL, 29, 49},
+    {0xbfb2555560f005ecULL, 29, 51},
+    {0xbfb2555560f005ecULL, 28, 14},
+    {0xbfb2555560f005ecULL, 29, 67},
+    {0xbfb2555560f005ecULL, 29, 51},
+    {0xbfb2555560f005ecULL, 29, 67},
+    {0xbfb2555560f005ecULL, 29, 49},
+    {0xc00607b3ee1231bbULL, 62, 56},
+    {0xc01edf6b3ad83b1fULL, 69, 60},
+    {0xc023a67befc556a7ULL, 20, 22},
+    {0xc06e9b310063ced9ULL, 39, 57},
+    {0xc074c2c80c4c74c3ULL, 60, 51},
+    {0xc0c5dcb1aaa2d17fULL, 52, 28},
+    {0xc0e3946de621d05bULL, 9, 29},
+    {0xc0ec5fe9fe2649b3ULL, 32, 28},
+    {0xc0ec5fe9fe2649b3ULL, 43, 57},
+    {0xc12102f08acdc03fULL, 51, 50},
+    {0xc12b99754e7204d9ULL, 23, 41},
+    {0xc13a1ec61bdf5121ULL, 41, 19},
+    {0xc13ede613b63e3e2ULL, 49, 47},
+    {0xc147b8126c44685dULL, 23, 32},
+    {0xc15ebbc3550df938ULL, 29, 65},
+    {0xc15ebbc3550df938ULL, 39, 41},
+    {0xc18d8d249a44fa9dULL, 42, 24},
+    {0xc18d8d249a44fa9dULL, 52, 46},
+    {0xc18d8d249a44fa9dULL, 58, 50},
+    {0xc1b3da52f0331801ULL, 48, 50},
+    {0xc1bbfa645e4e671bULL, 42, 24},
+    {0xc1bbfa645e4e671bULL, 60, 58},
+    {0xc1c9f6c17cf4f314ULL, 48, 57},
+    {0xc1c9f6c17cf4f314ULL, 12, 46},
+    {0xc226a6e495e2e3dfULL, 59, 58},
+    {0xc23379749afc5f88ULL, 38, 24},
+    {0xc2596e9c5ec4a93aULL, 68, 52},
+    {0xc267bd686e3e43b3ULL, 51, 50},
+    {0xc267bd686e3e43b3ULL, 41, 21},
+    {0xc26cae792f51b100ULL, 61, 23},
+    {0xc273d0bb42e5a92cULL, 11, 20},
+    {0xc27c3a8c716edf0fULL, 22, 42},
+    {0xc293537db4dd7f8eULL, 19, 11},
+    {0xc2ddff30aaf48cc2ULL, 28, 48},
+    {0xc34a0b889d2496deULL, 51, 47},
+    {0xc35e2fda3beb2bb1ULL, 21, 25},
+    {0xc36cfe1a20b61032ULL, 38, 47},
+    {0xc36cfe1a20b61032ULL, 48, 52},
+    {0xc36cfe1a20b61032ULL, 38, 47},
+    {0xc3d4499246d8195dULL, 42, 56},
+    {0xc3ddf173e566db2cULL, 37, 39},
+    {0xc3ddf173e566db2cULL, 11, 47},
+    {0xc3eb226b5e10fbffULL, 78, 60},
+    {0xc3f156227e3cd204ULL, 1, 10},
+    {0xc3fbf6031dee6b9eULL, 48, 70},
+    {0xc42458b500aa626bULL, 49, 31},
+    {0xc44f52a9b5cac51eULL, 19, 37},
+    {0xc49590640ff70101ULL, 12, 20},
+    {0xc49a118a87b1f5f0ULL, 47, 49},
+    {0xc4c1d785d2ec831fULL, 59, 57},
+    {0xc4cea211fca98e5fULL, 38, 40},
+    {0xc4db7be2707c0141ULL, 49, 47},
+    {0xc4e424514215140cULL, 52, 50},
+    {0xc4ea5bc15984d043ULL, 0, 22},
+    {0xc4ea5bc15984d043ULL, 38, 47},
+    {0xc4ea5bc15984d043ULL, 0, 22},
+    {0xc4ea5bc15984d043ULL, 40, 49},
+    {0xc4ea5bc15984d043ULL, 38, 47},
+    {0xc4ea5bc15984d043ULL, 0, 22},
+    {0xc4f0d90c859d4d90ULL, 58, 20},
+    {0xc4f9aa181f7d5f2aULL, 62, 60},
+    {0xc50c0eec3ff48b2eULL, 56, 47},
+    {0xc51312b73788847fULL, 71, 51},
+    {0xc5368065571cf2ebULL, 11, 20},
+    {0xc54bf62109151494ULL, 21, 19},
+    {0xc5617d6512b1d83dULL, 69, 67},
+    {0xc575ffdac86ca26aULL, 28, 30},
+    {0xc57bd20ce49c73f9ULL, 69, 47},
+    {0xc5869a5720b2b3e5ULL, 60, 51},
+    {0xc5869a5720b2b3e5ULL, 42, 40},
+    {0xc5c4f5847b60bf02ULL, 2, 38},
+    {0xc5c75806de720875ULL, 47, 48},
+    {0xc5d85fae44c51950ULL, 60, 51},
+    {0xc5d85fae44c51950ULL, 52, 32},
+    {0xc5d89074ed35431cULL, 39, 59},
+    {0xc5e469ce1f004680ULL, 42, 24},
+    {0xc5f39f84854ec959ULL, 60, 56},
+    {0xc5fd4794ae4a85d4ULL, 70, 32},
+    {0xc604cdfbb92c0227ULL, 70, 61},
+    {0xc62986ca0d61c9a8ULL, 42, 40},
+    {0xc62b8e474427a555ULL, 48, 47},
+    {0xc662c50933341103ULL, 28, 30},
+    {0xc6777585fc11bc4dULL, 42, 40},
+    {0xc6777585fc11bc4dULL, 62, 60},
+    {0xc6777585fc11bc4dULL, 70, 50},
+    {0xc6777585fc11bc4dULL, 62, 60},
+    {0xc6777585fc11bc4dULL, 58, 49},
+    {0xc6777585fc11bc4dULL, 62, 60},
+    {0xc68b72e5c54e1b38ULL, 34, 43},
+    {0xc69f6c2d07fd6cd9ULL, 27, 47},
+    {0xc6d753cfa4af0931ULL, 31, 33},
+    {0xc6db4c61a5d33b01ULL, 37, 38},
+    {0xc709ab4fde71c1f6ULL, 53, 33},
+    {0xc70f30d08f529bd4ULL, 58, 56},
+    {0xc70f30d08f529bd4ULL, 43, 59},
+    {0xc70f30d08f529bd4ULL, 40, 22},
+    {0xc736f0d50dd50b51ULL, 1, 23},
+    {0xc73a5c8837781816ULL, 33, 32},
+    {0xc73a5c8837781816ULL, 51, 65},
+    {0xc74ec7fcaea745d0ULL, 3, 23},
+    {0xc74ec7fcaea745d0ULL, 3, 39},
+    {0xc7d189d2b637ed83ULL, 31, 33},
+    {0xc7dc2516f90ad343ULL, 78, 42},
+    {0xc7dc2516f90ad343ULL, 62, 42},
+    {0xc7dc2516f90ad343ULL, 78, 42},
+    {0xc7dc2516f90ad343ULL, 62, 42},
+    {0xc7dc2516f90ad343ULL, 78, 42},
+    {0xc7dc2516f90ad343ULL, 62, 42},
+    {0xc7dc2516f90ad343ULL, 78, 42},
+    {0xc7fc66c78e288966ULL, 58, 40},
+    {0xc81441912bf50078ULL, 28, 29},
+    {0xc8172cbce3accbafULL, 71, 51},
+    {0xc818f55da12284c1ULL, 70, 61},
+    {0xc82040d9f8cfa275ULL, 38, 22},
+    {0xc84cf55475964b72ULL, 59, 50},
+    {0xc861ac897858257fULL, 71, 70},
+    {0xc861ac897858257fULL, 12, 20},
+    {0xc8b696cf986655afULL, 11, 47},
+    {0xc8d482acd3ad08c9ULL, 18, 10},
+    {0xc93ec23fee8c2058ULL, 69, 78},
+    {0xc94517454e2649a1ULL, 33, 13},
+    {0xc962bd7eaacc3017ULL, 28, 20},
+    {0xc975f01910f13851ULL, 79, 23},
+    {0xc97eaf40081b79ceULL, 60, 58},
+    {0xc9b067e8d151dab7ULL, 51, 42},
+    {0xc9bbf9f9800e5c09ULL, 37, 38},
+    {0xc9d17780657b22a6ULL, 22, 13},
+    {0xc9d1dc9cd2d7698eULL, 69, 33},
+    {0xca0134afe766b4d8ULL, 21, 23},
+    {0xca056b17fdc88484ULL, 33, 41},
+    {0xca07d966228225edULL, 28, 12},
+    {0xca13ba18c3578182ULL, 62, 70},
+    {0xca1e079111929304ULL, 80, 42},
+    {0xca1e079111929304ULL, 58, 40},
+    {0xca1e079111929304ULL, 80, 42},
+    {0xca1e079111929304ULL, 58, 40},
+    {0xca2e97c90ec55bdcULL, 77, 41},
+    {0xca4431db0e99224cULL, 42, 40},
+    {0xca766d536f6030e0ULL, 52, 50},
+    {0xca8a21826f8d4385ULL, 78, 60},
+    {0xca936dde61871f28ULL, 9, 47},
+    {0xca9bd8845ab33fdaULL, 51, 33},
+    {0xca9dd19b9561d8a8ULL, 53, 52},
+    {0xcb062e2fe4ec4fe6ULL, 79, 70},
+    {0xcb07ab3cdf45fc6dULL, 31, 33},
+    {0xcb15338bc7fa2255ULL, 12, 30},
+    {0xcb30ff3a0e44468cULL, 51, 33},
+    {0xcb6e8b1d41abd116ULL, 58, 49},
+    {0xcb97620c39a4b400ULL, 10, 19},
+    {0xcb996dcc6287de13ULL, 58, 57},
+    {0xcba09e772a571092ULL, 18, 27},
+    {0xcba63efef8e42895ULL, 38, 42},
+    {0xcbdd847ca59a5a2eULL, 43, 42},
+    {0xcc0e1cd83cc9c1bbULL, 28, 32},
+    {0xcc15bce15a639290ULL, 18, 20},
+    {0xcc43841372d92694ULL, 79, 59},
+    {0xcc8146c2a7802e26ULL, 20, 22},
+    {0xcc87bcb3f3111de4ULL, 52, 51},
+    {0xcc8d458ce5a22347ULL, 39, 61},
+    {0xcc8ea255a3560db2ULL, 31, 23},
+    {0xcc8ea255a3560db2ULL, 9, 13},
+    {0xcc8ea255a3560db2ULL, 2, 20},
+    {0xcc8ea255a3560db2ULL, 31, 23},
+    {0xcc945b7ca2ea7421ULL, 78, 58},
+    {0xccb6c5aff4be430bULL, 31, 32},
+    {0xccf194bc839661cbULL, 19, 39},
+    {0xccff9836c9be4e4dULL, 69, 61},
+    {0xccff9836c9be4e4dULL, 59, 50},
+    {0xcd30783a25b268c3ULL, 37, 57},
+    {0xcd30783a25b268c3ULL, 40, 58},
+    {0xcd34b8e9bcb71a11ULL, 51, 65},
+    {0xcd5ac4fc3c022fccULL, 20, 29},
+    {0xcd5e616781e9af2eULL, 41, 61},
+    {0xcd877391d17a4d60ULL, 47, 48},
+    {0xcd877391d17a4d60ULL, 21, 23},
+    {0xcd877391d17a4d60ULL, 49, 67},
+    {0xcd877391d17a4d60ULL, 20, 29},
+    {0xcd9afd3cc2cbbda3ULL, 43, 41},
+    {0xcdbb299b883613b0ULL, 30, 32},
+    {0xcdbb299b883613b0ULL, 23, 41},
+    {0xcdbb299b883613b0ULL, 11, 13},
+    {0xcde0f50bde42bc0cULL, 29, 20},
+    {0xcdf0ee45d1123454ULL, 29, 33},
+    {0xce02e9a66a630d66ULL, 60, 24},
+    {0xce230c9595cd145fULL, 38, 40},
+    {0xce230c9595cd145fULL, 22, 40},
+    {0xce230c9595cd145fULL, 28, 30},
+    {0xce230c9595cd145fULL, 32, 50},
+    {0xce55f076b4d74a9cULL, 50, 32},
+    {0xce5f384d52276f25ULL, 40, 41},
+    {0xce7ee315388d3d4eULL, 18, 19},
+    {0xcea5779c3389e40aULL, 0, 20},
+    {0xcec61baa395917cdULL, 22, 20},
+    {0xced0bd6d829704b8ULL, 37, 38},
+    {0xcf0c9e1738fa7429ULL, 39, 57},
+    {0xcf18072c03ccc7e6ULL, 41, 32},
+    {0xcf49f2a67bbb2414ULL, 28, 30},
+    {0xcf569ba618517d26ULL, 11, 47},
+    {0xcf59604c50fa5333ULL, 48, 68},
+    {0xcf59604c50fa5333ULL, 48, 50},
+    {0xcf62f88506b1336bULL, 39, 57},
+    {0xcfbdccc3bf774078ULL, 32, 14},
+    {0xcfbdd08091e21dc5ULL, 22, 31},
+    {0xcfbdd08091e21dc5ULL, 29, 49},
+    {0xcfc2def152bc960dULL, 20, 38},
+    {0xcfd7310968f1b7feULL, 79, 59},
+    {0xcfdbcbec23c30c33ULL, 70, 34},
+    {0xcfdbcf0c0d969da1ULL, 70, 68},
+    {0xcfee9e1bfde51adcULL, 61, 57},
+    {0xcff68afe47e53e29ULL, 28, 12},
+    {0xcffb2bc9aae7c0dbULL, 19, 21},
+    {0xcffb2bc9aae7c0dbULL, 19, 39},
+    {0xcffb2bc9aae7c0dbULL, 19, 21},
+    {0xcffb2bc9aae7c0dbULL, 19, 39},
+    {0xd002824706c9d9acULL, 20, 29},
+    {0xd02ab3dffb381131ULL, 40, 39},
+    {0xd02b2ea9b0fcc6d7ULL, 41, 21},
+    {0xd02cde6fad4b8221ULL, 66, 68},
+    {0xd05491c2629510ceULL, 31, 30},
+    {0xd0553e1d4684d91cULL, 22, 23},
+    {0xd0d9e5fae0741922ULL, 53, 52},
+    {0xd0d9e5fae0741922ULL, 77, 68},
+    {0xd0d9e5fae0741922ULL, 53, 52},
+    {0xd0d9e5fae0741922ULL, 77, 68},
+    {0xd0d9e5fae0741922ULL, 53, 52},
+    {0xd0d9e5fae0741922ULL, 77, 68},
+    {0xd0d9e5fae0741922ULL, 53, 52},
+    {0xd0d9e5fae0741922ULL, 77, 68},
+    {0xd0d9e5fae0741922ULL, 53, 52},
+    {0xd0d9e5fae0741922ULL, 77, 68},
+    {0xd0d9e5fae0741922ULL, 53, 52},
+    {0xd0d9e5fae0741922ULL, 77, 68},
+    {0xd0d9e5fae0741922ULL, 53, 52},
+    {0xd0d9e5fae0741922ULL, 77, 68},
+    {0xd0d9e5fae0741922ULL, 53, 52},
+    {0xd0d9e5fae0741922ULL, 77, 68},
+    {0xd0d9e5fae0741922ULL, 53, 52},
+    {0xd0d9e5fae0741922ULL, 77, 68},
+    {0xd0d9e5fae0741922ULL, 53, 52},
+    {0xd0d9e5fae0741922ULL, 77, 68},
+    {0xd0d9e5fae0741922ULL, 53, 52},
+    {0xd0d9e5fae0741922ULL, 77, 68},
+    {0xd0d9e5fae0741922ULL, 53, 52},
+    {0xd0d9e5fae0741922ULL, 77, 68},
+    {0xd0d9e5fae0741922ULL, 53, 52},
+    {0xd0f55e84ce4e94e7ULL, 49, 57},
+    {0xd0f55e84ce4e94e7ULL, 78, 60},
+    {0xd0f55e84ce4e94e7ULL, 49, 57},
+    {0xd0f55e84ce4e94e7ULL, 71, 67},
+    {0xd10ac68c4208093bULL, 69, 60},
+    {0xd10e1b96c3bddf66ULL, 12, 20},
+    {0xd1116ac328bd73a2ULL, 21, 22},
+    {0xd114042aded31175ULL, 78, 77},
+    {0xd1215faa24827131ULL, 62, 60},
+    {0xd1215faa24827131ULL, 62, 61},
+    {0xd1215faa24827131ULL, 52, 50},
+    {0xd1215faa24827131ULL, 62, 60},
+    {0xd1215faa24827131ULL, 58, 49},
+    {0xd1215faa24827131ULL, 70, 50},
+    {0xd1215faa24827131ULL, 62, 60},
+    {0xd135cbe78f7e8ab7ULL, 61, 41},
+    {0xd15d483d6fb1e32bULL, 19, 39},
+    {0xd168a72cffefdc59ULL, 22, 23},
+    {0xd17321a0231f7055ULL, 2, 38},
+    {0xd180575d91b1f84cULL, 19, 21},
+    {0xd1cfbfbd60dc08b1ULL, 71, 49},
+    {0xd1d7abda2dbdf808ULL, 40, 60},
+    {0xd1f8d4014907a685ULL, 29, 49},
+    {0xd210875850a391a4ULL, 69, 60},
+    {0xd21d0c380cf4a3a8ULL, 27, 28},
+    {0xd22072b4ce6312a9ULL, 59, 57},
+    {0xd23f45c8b8d5c389ULL, 50, 30},
+    {0xd244803678dd291eULL, 50, 48},
+    {0xd24536eab48033eaULL, 39, 48},
+    {0xd25318dd96b90a25ULL, 71, 51},
+    {0xd25d4f10994f0702ULL, 9, 31},
+    {0xd2605c55016fc9c6ULL, 1, 2},
+    {0xd27663eaad8be3a3ULL, 65, 56},
+    {0xd282f4b47ad3160cULL, 12, 14},
+    {0xd295fef65a6c6427ULL, 61, 57},
+    {0xd29d63b6c8912f29ULL, 42, 40},
+    {0xd2cd879faa6bb6e9ULL, 51, 49},
+    {0xd2d226153e448c21ULL, 51, 42},
+    {0xd2d226153e448c21ULL, 21, 20},
+    {0xd2d8a66ae2a840b1ULL, 29, 15},
+    {0xd2d8a66ae2a840b1ULL, 47, 48},
+    {0xd2dd2613d91483e6ULL, 33, 13},
+    {0xd2e17f5321e29915ULL, 22, 40},
+    {0xd2e1d37635c55d98ULL, 10, 11},
+    {0xd2fb834399cc24cdULL, 51, 42},
+    {0xd306178259cf9366ULL, 38, 42},
+    {0xd3342d94ed7e93faULL, 56, 47},
+    {0xd33c4bc2e5262cf2ULL, 59, 57},
+    {0xd33fba3f04b7e37aULL, 62, 58},
+    {0xd3689890d7128071ULL, 19, 20},
+    {0xd3756328a3387c24ULL, 14, 32},
+    {0xd39297677bb20075ULL, 69, 67},
+    {0xd39d6d17cd81c051ULL, 10, 50},
+    {0xd39fcf2291b32ab0ULL, 20, 56},
+    {0xd3ab9497640e6ba9ULL, 29, 47},
+    {0xd3bc71ee81171d3fULL, 29, 49},
+    {0xd3bc71ee81171d3fULL, 1, 10},
+    {0xd3bc71ee81171d3fULL, 28, 12},
+    {0xd3bc71ee81171d3fULL, 1, 10},
+    {0xd3c0a96db5764915ULL, 69, 49},
+    {0xd3c5a6a255a6ea85ULL, 69, 51},
+    {0xd3c8b365493f1073ULL, 58, 57},
+    {0xd3e37b718262657eULL, 69, 31},
+    {0xd3e37b718262657eULL, 69, 15},
+    {0xd3ebe840e03394bfULL, 12, 30},
+    {0xd3ebe840e03394bfULL, 49, 51},
+    {0xd3f14acb8c73633eULL, 77, 68},
+    {0xd42b3251a8db35ddULL, 10, 32},
+    {0xd439b18f63b84fffULL, 33, 13},
+    {0xd44a88d7c70fc268ULL, 77, 59},
+    {0xd46c4b74545ad88fULL, 51, 49},
+    {0xd48cce7eb58ece1dULL, 61, 43},
+    {0xd49f97abe48654f2ULL, 41, 19},
+    {0xd4c050d030a202bdULL, 2, 11},
+    {0xd51875c08ea63d2bULL, 0, 22},
+    {0xd55703e099827201ULL, 3, 39},
+    {0xd5828384526391f4ULL, 47, 51},
+    {0xd5828384526391f4ULL, 47, 69},
+    {0xd585e859e7c0fa15ULL, 1, 21},
+    {0xd5a22318bcf48800ULL, 21, 23},
+    {0xd5a22318bcf48800ULL, 28, 29},
+    {0xd5a22318bcf48800ULL, 21, 23},
+    {0xd5a75b9690a9d525ULL, 69, 51},
+    {0xd5b75180fd53d4caULL, 51, 49},
+    {0xd5b75180fd53d4caULL, 48, 40},
+    {0xd5d189c7fba24b9aULL, 39, 40},
+    {0xd5e24500eb972050ULL, 39, 57},
+    {0xd61ac2be7df44470ULL, 60, 24},
+    {0xd631f67f74e4619bULL, 33, 41},
+    {0xd64b2968150dfae6ULL, 18, 10},
+    {0xd64d35903d91cc58ULL, 58, 49},
+    {0xd64d35903d91cc58ULL, 60, 51},
+    {0xd66dfbe6e2e79994ULL, 47, 67},
+    {0xd679cbd2a255e1b9ULL, 70, 32},
+    {0xd695b2041e3358edULL, 20, 29},
+    {0xd69ba8a0f4054ff4ULL, 28, 66},
+    {0xd6b058398b5cf084ULL, 51, 47},
+    {0xd6b24a304b08395dULL, 19, 23},
+    {0xd71c518f20830d34ULL, 29, 30},
+    {0xd76f17c862a29785ULL, 69, 68},
+    {0xd773b5f036ca79c9ULL, 10, 30},
+    {0xd773b5f036ca79c9ULL, 1, 3},
+    {0xd773b5f036ca79c9ULL, 22, 31},
+    {0xd773b5f036ca79c9ULL, 29, 49},
+    {0xd773b5f036ca79c9ULL, 10, 30},
+    {0xd773b5f036ca79c9ULL, 1, 19},
+    {0xd773b5f036ca79c9ULL, 10, 46},
+    {0xd773b5f036ca79c9ULL, 10, 14},
+    {0xd773b5f036ca79c9ULL, 10, 30},
+    {0xd773b5f036ca79c9ULL, 10, 12},
+    {0xd7adc8a862208f8aULL, 80, 40},
+    {0xd7ca6b1f675ad0b5ULL, 29, 31},
+    {0xd7cab30ecd1ec5f1ULL, 48, 68},
+    {0xd7dd1c82a51975beULL, 51, 31},
+    {0xd7fc4485bb26df1dULL, 61, 52},
+    {0xd8028595431b75aaULL, 79, 78},
+    {0xd81a851369daed0bULL, 21, 30},
+    {0xd866127a1db3fce5ULL, 25, 41},
+    {0xd87710b8597294a5ULL, 18, 22},
+    {0xd8f1819f457bc583ULL, 29, 30},
+    {0xd8fbdfeeccc5f1e1ULL, 19, 20},
+    {0xd8fbdfeeccc5f1e1ULL, 28, 20},
+    {0xd8fbdfeeccc5f1e1ULL, 70, 69},
+    {0xd950595317170b79ULL, 2, 3},
+    {0xd96ebe48b958fe6fULL, 39, 41},
+    {0xd971ac9db2c50e1fULL, 70, 78},
+    {0xd987b75ab788341cULL, 49, 71},
+    {0xd990e9287d1d1cefULL, 47, 56},
+    {0xd99433cf765b3e39ULL, 60, 24},
+    {0xd99ba13691c37a79ULL, 62, 70},
+    {0xd99ba13691c37a79ULL, 59, 58},
+    {0xd9b5aed3e3ac92dfULL, 42, 40},
+    {0xda72be3a6c2bd0a3ULL, 40, 20},
+    {0xda81740126ad15b6ULL, 22, 24},
+    {0xda81740126ad15b6ULL, 37, 21},
+    {0xda81740126ad15b6ULL, 40, 58},
+    {0xda8fae0ec5ec4c11ULL, 21, 39},
+    {0xdad9afdaa86abcadULL, 29, 31},
+    {0xdaee9bcfee956604ULL, 70, 32},
+    {0xdaee9bcfee956604ULL, 41, 32},
+    {0xdaee9bcfee956604ULL, 62, 60},
+    {0xdaefab069bcd2e89ULL, 51, 49},
+    {0xdb27905caa3deef6ULL, 57, 58},
+    {0xdb27905caa3deef6ULL, 20, 21},
+    {0xdb3a698b000eb919ULL, 33, 32},
+    {0xdb3a74b269b09fb3ULL, 29, 30},
+    {0xdb56fe7f9f8e73bfULL, 58, 56},
+    {0xdb6cf46b7d62c874ULL, 29, 13},
+    {0xdb7bb7206f0a0261ULL, 70, 68},
+    {0xdbaaddf460be24c5ULL, 52, 48},
+    {0xdbbe134953bf812eULL, 33, 13},
+    {0xdc035a02e7dafb85ULL, 59, 57},
+    {0xdc1d79ecfe5cd70dULL, 22, 24},
+    {0xdc316debf1eb55cbULL, 32, 14},
+    {0xdc4a56a1913dd6a5ULL, 78, 42},
+    {0xdc5fcd1b0abddeeaULL, 28, 29},
+    {0xdc6061db48f324e2ULL, 12, 14},
+    {0xdcbdc8e7b4659149ULL, 62, 58},
+    {0xdcbdc8e7b4659149ULL, 80, 58},
+    {0xdcdcbb198b4d4ee1ULL, 60, 59},
+    {0xdcf353dfc1af6441ULL, 20, 56},
+    {0xdd0d1ae07520f4d6ULL, 39, 47},
+    {0xdd0d1ae07520f4d6ULL, 1, 37},
+    {0xdd11ef54a11d6be4ULL, 70, 61},
+    {0xdd4e51ddf6f87f9cULL, 48, 50},
+    {0xdd72801b59aa2389ULL, 68, 59},
+    {0xddccd7682d49e014ULL, 51, 33},
+    {0xdddb6aebbfed92c7ULL, 10, 11},
+    {0xdddea735e8f333b6ULL, 27, 29},
+    {0xdddea735e8f333b6ULL, 22, 30},
+    {0xdddea735e8f333b6ULL, 27, 29},
+    {0xde109e4ef5957602ULL, 58, 49},
+    {0xde109e4ef5957602ULL, 34, 33},
+    {0xde13ce3642d9343dULL, 69, 51},
+    {0xde2adfa414f8f975ULL, 22, 40},
+    {0xde8f0269ba18575cULL, 28, 48},
+    {0xde9abda889c27c13ULL, 20, 56},
+    {0xdeaeead5c63dbe19ULL, 12, 10},
+    {0xdebce8621edfa8f0ULL, 40, 22},
+    {0xdedfe5a92e5eb827ULL, 53, 49},
+    {0xdf03abd13612e3ffULL, 1, 10},
+    {0xdf1138c58fcf2887ULL, 24, 33},
+    {0xdf16ccd6fc59ee90ULL, 68, 50},
+    {0xdf2441f63a24a08bULL, 69, 33},
+    {0xdf244a798126d6d9ULL, 59, 58},
+    {0xdf4fd97ad7129ed3ULL, 58, 49},
+    {0xdf62f43554d26b92ULL, 57, 39},
+    {0xdf62f43554d26b92ULL, 57, 37},
+    {0xdf72f56999c5ac86ULL, 39, 48},
+    {0xdf7f8ba98ac2b713ULL, 29, 31},
+    {0xdf893f9b767b71f1ULL, 50, 46},
+    {0xdf93ca2ad35be4d6ULL, 28, 48},
+    {0xdf97959168af48b5ULL, 48, 68},
+    {0xdfa00e45ca6a9e8fULL, 32, 41},
+    {0xdfa175a5fdc311cdULL, 20, 28},
+    {0xdfa175a5fdc311cdULL, 70, 61},
+    {0xdfacc2ba5ca83ea5ULL, 70, 69},
+    {0xdfb4f29ab65e05f4ULL, 23, 41},
+    {0xdfc5360bfa9e3ab9ULL, 32, 14},
+    {0xdfdcbb1e0c78422aULL, 69, 47},
+    {0xdfed021dae7b86a7ULL, 70, 48},
+    {0xdfed021dae7b86a7ULL, 70, 32},
+    {0xe012cddbff129d8cULL, 49, 29},
+    {0xe01a5e11552d8c83ULL, 20, 24},
+    {0xe039ff7e9449663bULL, 11, 12},
+    {0xe046d88a6fa18c65ULL, 20, 56},
+    {0xe04d1bd8280c9206ULL, 60, 40},
+    {0xe0646cea30a61ce9ULL, 1, 57},
+    {0xe0b418d7977b4f21ULL, 57, 48},
+    {0xe0d04d629f48dc74ULL, 60, 40},
+    {0xe0df35aca0acda96ULL, 49, 67},
+    {0xe0df35aca0acda96ULL, 30, 66},
+    {0xe0df35aca0acda96ULL, 21, 23},
+    {0xe0df5cb60e5e6f10ULL, 70, 50},
+    {0xe0df5cb60e5e6f10ULL, 78, 77},
+    {0xe0f0a00f1d1186ddULL, 51, 49},
+    {0xe0f8bea458ec0714ULL, 32, 41},
+    {0xe1004f7873aa1613ULL, 47, 49},
+    {0xe19f19e019db696eULL, 18, 24},
+    {0xe1b03ed6d803a61dULL, 70, 50},
+    {0xe1c28dbe4d557291ULL, 50, 46},
+    {0xe1ced7b5e1b6a8abULL, 59, 41},
+    {0xe1fbcdec3f2fde3dULL, 62, 61},
+    {0xe23866bd4c63b145ULL, 69, 61},
+    {0xe25d112b83225ab5ULL, 32, 12},
+    {0xe287e8eb0c6c277cULL, 68, 34},
+    {0xe29154ffb7b279bcULL, 69, 68},
+    {0xe2a1dff3e3bf8cc7ULL, 1, 39},
+    {0xe2b6b8bcba8364c8ULL, 24, 23},
+    {0xe2f7bc29bd855bf8ULL, 77, 59},
+    {0xe34267f63d22cb0cULL, 10, 48},
+    {0xe3616f244a4ccae9ULL, 18, 20},
+    {0xe3644cc0d9890475ULL, 59, 57},
+    {0xe3644cc0d9890475ULL, 60, 51},
+    {0xe3644cc0d9890475ULL, 59, 55},
+    {0xe36d1ed34569698aULL, 9, 31},
+    {0xe379e2a337d4bc46ULL, 80, 58},
+    {0xe37e1539d5a6be6fULL, 28, 48},
+    {0xe38dc5947b0fbb2cULL, 3, 21},
+    {0xe39d1ccf60272abbULL, 0, 38},
+    {0xe3ee15f9fad85fa4ULL, 18, 10},
+    {0xe41980885df7cbeeULL, 42, 43},
+    {0xe45b1eca3ba05b9bULL, 33, 29},
+    {0xe46f3c948eab78c6ULL, 69, 47},
+    {0xe475422b06a8c3f3ULL, 10, 12},
+    {0xe484c3fcd291e0c5ULL, 10, 50},
+    {0xe4ae3ee2412dda8bULL, 41, 23},
+    {0xe4cafe940e4d0d94ULL, 49, 69},
+    {0xe4e5d0aa582f2178ULL, 30, 52},
+    {0xe50b6afa21ce2020ULL, 39, 48},
+    {0xe55e997609b525d5ULL, 69, 65},
+    {0xe58523b0c0f68e93ULL, 61, 43},
+    {0xe586da632e471c14ULL, 1, 21},
+    {0xe59a01b8619fff64ULL, 40, 42},
+    {0xe59a01b8619fff64ULL, 40, 60},
+    {0xe5d81c3bcb745980ULL, 18, 38},
+    {0xe5d81c3bcb745980ULL, 19, 21},
+    {0xe5d81c3bcb745980ULL, 2, 38},
+    {0xe5e6fae8751546dfULL, 61, 41},
+    {0xe5feeae81551aac1ULL, 23, 14},
+    {0xe5feeae81551aac1ULL, 41, 32},
+    {0xe60075ff28880fc7ULL, 33, 32},
+    {0xe6075cbd74281b2fULL, 70, 68},
+    {0xe6296ba0dc6a709aULL, 13, 14},
+    {0xe640605f91535331ULL, 38, 56},
+    {0xe657e4188404a3fcULL, 47, 67},
+    {0xe691dc8803ecb090ULL, 62, 60},
+    {0xe6b6f2245435ba3dULL, 0, 40},
+    {0xe6babdb5252cca13ULL, 33, 31},
+    {0xe6c3b74fcfaf36aeULL, 48, 46},
+    {0xe6dd47529e669c89ULL, 0, 20},
+    {0xe6ff20ecdc001ab9ULL, 60, 40},
+    {0xe70bb091af0c2af5ULL, 20, 29},
+    {0xe71042fa5adad161ULL, 58, 60},
+    {0xe71606248b090618ULL, 50, 48},
+    {0xe7343bdf1e7993aeULL, 31, 49},
+    {0xe7343bdf1e7993aeULL, 10, 66},
+    {0xe75857e21bac54e4ULL, 69, 68},
+    {0xe7ac2cb8208673d1ULL, 61, 57},
+    {0xe7dce345aa78ad4fULL, 52, 68},
+    {0xe81135f4aaacaff1ULL, 27, 29},
+    {0xe825c32ce5409a70ULL, 79, 41},
+    {0xe82e37814edf78a8ULL, 69, 51},
+    {0xe82e64519958478dULL, 19, 20},
+    {0xe84b33b2cc0cce34ULL, 43, 41},
+    {0xe84b33b2cc0cce34ULL, 69, 33},
+    {0xe86089ecc6425ed5ULL, 24, 33},
+    {0xe86089ecc6425ed5ULL, 37, 21},
+    {0xe86954552905ce7dULL, 71, 67},
+    {0xe86954552905ce7dULL, 78, 60},
+    {0xe86d2c4fe4442dcaULL, 32, 14},
+    {0xe86face3db95fdc2ULL, 21, 57},
+    {0xe884e2fd5af90dd1ULL, 19, 28},
+    {0xe889dd3057c73179ULL, 0, 40},
+    {0xe894e09996589333ULL, 38, 40},
+    {0xe8b8e35a02ae6615ULL, 27, 31},
+    {0xe8e1c5a23589aab7ULL, 30, 34},
+    {0xe8f126b0191fd086ULL, 10, 30},
+    {0xe8fa8d2fcf5ddac3ULL, 58, 49},
+    {0xe8fb6c9d7944fb95ULL, 70, 30},
+    {0xe908de861974e034ULL, 58, 36},
+    {0xe908de861974e034ULL, 58, 40},
+    {0xe934d3fa5a46c3ceULL, 28, 70},
+    {0xe93c26d2eb38aa7dULL, 47, 49},
+    {0xe945dd93291ec539ULL, 59, 50},
+    {0xe9540760e9755ddcULL, 41, 39},
+    {0xe95dc17eb356e248ULL, 24, 32},
+    {0xe95dc17eb356e248ULL, 59, 57},
+    {0xe95dc17eb356e248ULL, 33, 32},
+    {0xe95dc17eb356e248ULL, 59, 57},
+    {0xe95dc17eb356e248ULL, 43, 34},
+    {0xe986576838a5d679ULL, 69, 51},
+    {0xe98e939554901162ULL, 51, 42},
+    {0xe9d23b8c5ad91e29ULL, 39, 57},
+    {0xe9d4a75727d43276ULL, 79, 59},
+    {0xea024c733f01b1f4ULL, 60, 42},
+    {0xea024c733f01b1f4ULL, 51, 65},
+    {0xea1b9d0f1dfbb5d8ULL, 79, 59},
+    {0xea56abfd0ef61d6fULL, 12, 46},
+    {0xea5e3bc0345b4c64ULL, 69, 51},
+    {0xeaa5db15fa6d0903ULL, 22, 40},
+    {0xeab6d91e74c87106ULL, 69, 60},
+    {0xeab848b556ca557cULL, 52, 68},
+    {0xeacce690ce0a0e16ULL, 29, 49},
+    {0xeade5ac49407189aULL, 61, 41},
+    {0xeadfb0a350a396b0ULL, 53, 33},
+    {0xeae5df919ef16fd0ULL, 19, 39},
+    {0xeae66adfbce50714ULL, 11, 47},
+    {0xeb00bea5420c80d0ULL, 27, 67},
+    {0xeb2de23cfc91ef3bULL, 10, 30},
+    {0xeb2de23cfc91ef3bULL, 10, 48},
+    {0xeb2de23cfc91ef3bULL, 10, 30},
+    {0xeb2de23cfc91ef3bULL, 10, 48},
+    {0xeb2de23cfc91ef3bULL, 10, 30},
+    {0xeb2de23cfc91ef3bULL, 10, 48},
+    {0xeb2de23cfc91ef3bULL, 10, 30},
+    {0xeb2de23cfc91ef3bULL, 10, 48},
+    {0xeb2de23cfc91ef3bULL, 10, 30},
+    {0xeb45b23ae62aeb0bULL, 0, 22},
+    {0xeb659b3c762587c2ULL, 3, 37},
+    {0xeb6d2e49d555e1e0ULL, 10, 30},
+    {0xeb6d2e49d555e1e0ULL, 2, 3},
+    {0xeb7d080613fac72dULL, 33, 11},
+    {0xeb9295994b8975b3ULL, 61, 41},
+    {0xeb9295994b8975b3ULL, 61, 59},
+    {0xeb9295994b8975b3ULL, 61, 41},
+    {0xeb948c4a3a538a6bULL, 42, 33},
+    {0xeb948c4a3a538a6bULL, 49, 47},
+    {0xeba5d2849a9bebdeULL, 69, 65},
+    {0xebaea9073418fed9ULL, 66, 48},
+    {0xebb92deb9e62efc5ULL, 11, 20},
+    {0xebba829b54f7e9c2ULL, 69, 51},
+    {0xebbd34a417882540ULL, 59, 41},
+    {0xebbf30565181b2dbULL, 80, 58},
+    {0xebc3ea1663d846d1ULL, 60, 24},
+    {0xebd5d16c1176b9c3ULL, 20, 21},
+    {0xebecfc5e07ec3ff0ULL, 33, 67},
+    {0xec16a81f94805050ULL, 70, 32},
+    {0xec2b5aab736e48feULL, 10, 46},
+    {0xec74c97378118822ULL, 41, 23},
+    {0xec78d70302995e48ULL, 38, 58},
+    {0xec7f4a2288475918ULL, 79, 70},
+    {0xec7f4a2288475918ULL, 51, 47},
+    {0xec7f4a2288475918ULL, 62, 70},
+    {0xec7f4a2288475918ULL, 52, 50},
+    {0xec7f4a2288475918ULL, 79, 70},
+    {0xec7f4a2288475918ULL, 62, 61},
+    {0xec7f4a2288475918ULL, 58, 49},
+    {0xeca09dfe869b260aULL, 38, 40},
+    {0xecc0c023335f17ddULL, 62, 58},
+    {0xed24ddc276087156ULL, 1, 10},
+    {0xed3153394b0fe2c5ULL, 47, 67},
+    {0xed4805dc066ddd51ULL, 39, 57},
+    {0xed54ebd15db309b1ULL, 11, 13},
+    {0xed61d3f1c29cfab4ULL, 20, 40},
+    {0xed77d27e3bc6fb36ULL, 52, 51},
+    {0xed8f500f3dc669c3ULL, 61, 41},
+    {0xedc040f122f2b165ULL, 68, 32},
+    {0xedd27585f372e40bULL, 19, 20},
+    {0xedf1cce61ea843f6ULL, 41, 32},
+    {0xee0669e74a3dbc47ULL, 20, 29},
+    {0xee0669e74a3dbc47ULL, 21, 30},
+    {0xee0669e74a3dbc47ULL, 20, 29},
+    {0xee0669e74a3dbc47ULL, 21, 30},
+    {0xee0c9d977b5f3804ULL, 1, 21},
+    {0xee3b6246d689b08cULL, 20, 28},
+    {0xeea8ebc733377b49ULL, 32, 52},
+    {0xeeaaacb860a24edbULL, 57, 66},
+    {0xeeaaacb860a24edbULL, 39, 48},
+    {0xeeb3adf46add3f6bULL, 18, 20},
+    {0xeebbd4774862f019ULL, 10, 11},
+    {0xeebccb2e8f262fafULL, 19, 39},
+    {0xeeda9d3021d5d50dULL, 11, 13},
+    {0xeee1c00072673760ULL, 79, 78},
+    {0xeee6d4c5bfc7e208ULL, 62, 60},
+    {0xeeffcb9f1e500a13ULL, 28, 30},
+    {0xef031accbe46a9a1ULL, 78, 42},
+    {0xef031accbe46a9a1ULL, 52, 50},
+    {0xef031accbe46a9a1ULL, 78, 42},
+    {0xef031accbe46a9a1ULL, 78, 58},
+    {0xef031accbe46a9a1ULL, 52, 50},
+    {0xef031accbe46a9a1ULL, 78, 42},
+    {0xef33009feb992a28ULL, 50, 58},
+    {0xef72aef9f3a4bcacULL, 1, 10},
+    {0xef790fc9a9f5044dULL, 51, 31},
+    {0xef790fc9a9f5044dULL, 40, 31},
+    {0xef790fc9a9f5044dULL, 51, 31},
+    {0xefc4cc3c0b6d7bc5ULL, 62, 60},
+    {0xefd71ad1de76e6a4ULL, 77, 59},
+    {0xefd71ad1de76e6a4ULL, 80, 76},
+    {0xefd71ad1de76e6a4ULL, 77, 59},
+    {0xefff126f7d234a44ULL, 70, 50},
+    {0xf00602062697688dULL, 47, 13},
+    {0xf0174a1952c00e8aULL, 39, 40},
+    {0xf01e759900174b12ULL, 79, 78},
+    {0xf02546195efa0f00ULL, 60, 56},
+    {0xf038a07ebb5eaf68ULL, 19, 37},
+    {0xf058a560e20f0d3aULL, 68, 32},
+    {0xf06686060b18df5fULL, 28, 48},
+    {0xf06686060b18df5fULL, 39, 41},
+    {0xf097669341695f36ULL, 78, 58},
+    {0xf0a834326da6bff4ULL, 27, 13},
+    {0xf0c57aa4901dfad4ULL, 57, 39},
+    {0xf119c4c042f05dd8ULL, 31, 67},
+    {0xf119c4c042f05dd8ULL, 31, 49},
+    {0xf119c4c042f05dd8ULL, 31, 67},
+    {0xf119c4c042f05dd8ULL, 31, 49},
+    {0xf1359431f93b6605ULL, 29, 49},
+    {0xf1359431f93b6605ULL, 46, 47},
+    {0xf13a93b07dffaba3ULL, 30, 70},
+    {0xf153eecdffa20c16ULL, 67, 66},
+    {0xf1554fdc34891766ULL, 31, 49},
+    {0xf16a48df20ccff82ULL, 51, 49},
+    {0xf18a03827c66745bULL, 71, 33},
+    {0xf19d9b8bbdcee145ULL, 29, 30},
+    {0xf1a31f2c295d5e8fULL, 60, 59},
+    {0xf1ab6fe5e70b099fULL, 51, 33},
+    {0xf1b1623c2c6401bfULL, 79, 78},
+    {0xf1b50079cb1cce7eULL, 60, 68},
+    {0xf1e6a6f1bd145e72ULL, 0, 38},
+    {0xf1e7cbb6648a49ecULL, 42, 33},
+    {0xf1e7cbb6648a49ecULL, 39, 30},
+    {0xf1e7cbb6648a49ecULL, 41, 23},
+    {0xf1e7cbb6648a49ecULL, 60, 59},
+    {0xf20e86f499761f4bULL, 22, 23},
+    {0xf20e86f499761f4bULL, 12, 21},
+    {0xf2113a5d85c1b753ULL, 11, 20},
+    {0xf222c496bdfb125dULL, 20, 22},
+    {0xf240668590bebc60ULL, 30, 66},
+    {0xf240668590bebc60ULL, 50, 58},
+    {0xf27016acdecf1c9fULL, 50, 32},
+    {0xf29cee35d0ac4055ULL, 32, 23},
+    {0xf29cee35d0ac4055ULL, 49, 48},
+    {0xf29cee35d0ac4055ULL, 51, 65},
+    {0xf29cee35d0ac4055ULL, 50, 48},
+    {0xf29cee35d0ac4055ULL, 51, 33},
+    {0xf2a2a310192130abULL, 10, 48},
+    {0xf2e850b71085d150ULL, 69, 68},
+    {0xf310903b8b7acd8eULL, 2, 38},
+    {0xf314222986f3729fULL, 22, 23},
+    {0xf31a02614ce7ade0ULL, 20, 22},
+    {0xf321d1eb2faaad4cULL, 78, 60},
+    {0xf3223cb95ccbcf95ULL, 47, 56},
+    {0xf3223cb95ccbcf95ULL, 20, 21},
+    {0xf3492321895d8a9bULL, 77, 41},
+    {0xf35ad8e37eea11e2ULL, 10, 48},
+    {0xf35fef2dd9e28b66ULL, 48, 70},
+    {0xf3602154e2441741ULL, 70, 32},
+    {0xf37e7e43ca34ab63ULL, 9, 29},
+    {0xf39ced5326ea7680ULL, 47, 31},
+    {0xf39ced5326ea7680ULL, 11, 12},
+    {0xf410baeab19e52f6ULL, 80, 42},
+    {0xf4152f7d5d1445e4ULL, 1, 2},
+    {0xf42b31c2082f1107ULL, 42, 33},
+    {0xf4478d6f1b1702caULL, 2, 38},
+    {0xf448a9f60e4af98eULL, 9, 29},
+    {0xf4541d8b64ddc81cULL, 62, 60},
+    {0xf469393f27c85c31ULL, 20, 22},
+    {0xf4887701670a1bfeULL, 2, 20},
+    {0xf49be2f0d4b646a0ULL, 58, 38},
+    {0xf4b0763f09aff9d5ULL, 58, 49},
+    {0xf4b0763f09aff9d5ULL, 32, 31},
+    {0xf4b0763f09aff9d5ULL, 58, 49},
+    {0xf4b0763f09aff9d5ULL, 32, 31},
+    {0xf4b0763f09aff9d5ULL, 58, 49},
+    {0xf4b0763f09aff9d5ULL, 32, 31},
+    {0xf4b0763f09aff9d5ULL, 51, 13},
+    {0xf4b0763f09aff9d5ULL, 32, 31},
+    {0xf4b2d6f2d523337dULL, 79, 70},
+    {0xf4e555eef41544f1ULL, 33, 31},
+    {0xf4e555eef41544f1ULL, 40, 31},
+    {0xf4fbdadcc8365079ULL, 69, 33},
+    {0xf500b06a674b1da9ULL, 58, 60},
+    {0xf503ca99f95ad302ULL, 48, 50},
+    {0xf514cfb51003e6f4ULL, 51, 29},
+    {0xf518020419fa22caULL, 21, 30},
+    {0xf5208933ce4bf97fULL, 37, 55},
+    {0xf547e261e47b06f4ULL, 11, 20},
+    {0xf54e217cc59ae5a3ULL, 39, 59},
+    {0xf54eea3f3e892836ULL, 18, 22},
+    {0xf586fa994737e080ULL, 51, 42},
+    {0xf60b9f46782d0793ULL, 22, 31},
+    {0xf64218cd776b4871ULL, 31, 71},
+    {0xf64bc010a8d87b4eULL, 39, 57},
+    {0xf65305ea5c9c1cceULL, 1, 10},
+    {0xf693c04fcc0c1e97ULL, 12, 30},
+    {0xf6aa6b4f374a6b9bULL, 18, 20},
+    {0xf6c5b98df1400666ULL, 52, 32},
+    {0xf6e528877bd4e085ULL, 58, 38},
+    {0xf6eb89912286ad4eULL, 12, 21},
+    {0xf71a059f98eff3e6ULL, 77, 59},
+    {0xf71c47134856d02aULL, 29, 47},
+    {0xf72180ca921984acULL, 3, 21},
+    {0xf759dea3c152f446ULL, 68, 67},
+    {0xf759dea3c152f446ULL, 52, 51},
+    {0xf75be64afeb3b342ULL, 41, 40},
+    {0xf7732103525aa8e9ULL, 21, 25},
+    {0xf7732103525aa8e9ULL, 29, 47},
+    {0xf7741cac9251dc1fULL, 22, 23},
+    {0xf78fc53457e20175ULL, 52, 32},
+    {0xf78fc53457e20175ULL, 58, 50},
+    {0xf78fc53457e20175ULL, 46, 28},
+    {0xf79dfc53a14edb95ULL, 1, 39},
+    {0xf7e60b8fa0e68437ULL, 10, 50},
+    {0xf818da5fc41450aeULL, 2, 38},
+    {0xf83f7021e7d4410fULL, 38, 58},
+    {0xf843286319453811ULL, 21, 23},
+    {0xf85abfa42b555b61ULL, 51, 29},
+    {0xf86cd133cf430713ULL, 43, 23},
+    {0xf86cd133cf430713ULL, 40, 22},
+    {0xf88cc5d8c941b109ULL, 69, 67},
+    {0xf8a529ccd1df486dULL, 29, 21},
+    {0xf8a529ccd1df486dULL, 10, 12},
+    {0xf8addeaa105a3c03ULL, 28, 12},
+    {0xf8e2f7732d39883cULL, 42, 40},
+    {0xf8fcdb086722ce6dULL, 60, 56},
+    {0xf8fcdb086722ce6dULL, 71, 51},
+    {0xf9141afca8215957ULL, 60, 51},
+    {0xf9313f68404116ceULL, 62, 58},
+    {0xf93ab24780d47b6eULL, 50, 46},
+    {0xf9640c7cef10655bULL, 61, 59},
+    {0xf96cab9cf45d1861ULL, 29, 47},
+    {0xf9752cdc929bbf3eULL, 70, 78},
+    {0xf97f5a113f1666f8ULL, 77, 37},
+    {0xf99335b04e1026aaULL, 61, 41},
+    {0xf9b2014669139ac7ULL, 29, 47},
+    {0xf9b44e49f541f86aULL, 28, 30},
+    {0xf9c68e9acabb5189ULL, 10, 48},
+    {0xf9c68e9acabb5189ULL, 39, 48},
+    {0xf9c68e9acabb5189ULL, 10, 48},
+    {0xf9c68e9acabb5189ULL, 18, 20},
+    {0xf9ca52dcda0f3eb1ULL, 51, 49},
+    {0xf9d7f686d0cf6c7fULL, 68, 66},
+    {0xfa1e1a4be345e0dbULL, 42, 24},
+    {0xfa58bb49b2ac733cULL, 21, 23},
+    {0xfa58bb49b2ac733cULL, 30, 32},
+    {0xfa5b9a91de88fa7cULL, 30, 32},
+    {0xfa82571a354f3ec7ULL, 50, 48},
+    {0xfa94d0b70f174b44ULL, 68, 60},
+    {0xfab50b17bd0943c0ULL, 80, 42},
+    {0xfab50b17bd0943c0ULL, 53, 49},
+    {0xfb0ce00490b19c03ULL, 58, 56},
+    {0xfb1ba87f7f43d2d6ULL, 79, 59},
+    {0xfb1ba87f7f43d2d6ULL, 42, 56},
+    {0xfb4284830c22d386ULL, 41, 23},
+    {0xfb47aad1351665b0ULL, 42, 22},
+    {0xfb6d5cf39977889eULL, 18, 20},
+    {0xfb717d5af129d509ULL, 29, 30},
+    {0xfb717d5af129d509ULL, 19, 41},
+    {0xfb717d5af129d509ULL, 23, 32},
+    {0xfb717d5af129d509ULL, 19, 43},
+    {0xfb74495af155fce4ULL, 51, 50},
+    {0xfbcba099956eee26ULL, 51, 33},
+    {0xfbcd1675e6337fa1ULL, 22, 23},
+    {0xfbd03c625d73f67dULL, 1, 21},
+    {0xfbf1081f152f3b4dULL, 49, 47},
+    {0xfc09806c73eb2117ULL, 18, 20},
+    {0xfc09806c73eb2117ULL, 38, 40},
+    {0xfc09806c73eb2117ULL, 18, 20},
+    {0xfc09806c73eb2117ULL, 22, 31},
+    {0xfc09806c73eb2117ULL, 10, 30},
+    {0xfc09806c73eb2117ULL, 18, 20},
+    {0xfc4752942482dae6ULL, 70, 50},
+    {0xfc54dcf907d8b4ceULL, 2, 38},
+    {0xfc54dcf907d8b4ceULL, 18, 38},
+    {0xfc54dcf907d8b4ceULL, 2, 38},
+    {0xfc54dcf907d8b4ceULL, 18, 38},
+    {0xfc54dcf907d8b4ceULL, 2, 38},
+    {0xfc54dcf907d8b4ceULL, 18, 38},
+    {0xfc82de80668c660dULL, 42, 58},
+    {0xfc9b9e4395255b70ULL, 29, 37},
+    {0xfcbe5c0d89922de8ULL, 12, 11},
+    {0xfcbe5c0d89922de8ULL, 50, 14},
+    {0xfcf8ba5ff636e952ULL, 68, 50},
+    {0xfcf96aa3df08b6c9ULL, 55, 39},
+    {0xfcff7f4cdb214966ULL, 70, 48},
+    {0xfd5ade5635bf337fULL, 60, 24},
+    {0xfd61cc57dbbea28dULL, 41, 23},
+    {0xfd61cc57dbbea28dULL, 68, 67},
+    {0xfd61cc57dbbea28dULL, 52, 43},
+    {0xfd61cc57dbbea28dULL, 41, 23},
+    {0xfd61cc57dbbea28dULL, 52, 43},
+    {0xfd638e71f4298188ULL, 50, 48},
+    {0xfd712c2d2330e77eULL, 52, 32},
+    {0xfd73dbd65e4073daULL, 0, 38},
+    {0xfd74f6d3ecfef92aULL, 77, 68},
+    {0xfd93e8cb5cabf380ULL, 52, 32},
+    {0xfd93e8cb5cabf380ULL, 33, 11},
+    {0xfdd8ac3965f6b590ULL, 15, 33},
+    {0xfdd92dc747abdd36ULL, 50, 28},
+    {0xfe1ddb5ec8eae17fULL, 11, 29},
+    {0xfe4af22d71be4cd2ULL, 56, 55},
+    {0xfe51b90630d7c77dULL, 77, 41},
+    {0xfe55de231af6c645ULL, 57, 23},
+    {0xfe611016afb5807fULL, 11, 20},
+    {0xfe7b3a25e7c15736ULL, 22, 42},
+    {0xfe81170455797212ULL, 78, 60},
+    {0xfe96a03d79aaa8f4ULL, 69, 49},
+    {0xfe980d034228d3f8ULL, 28, 30},
+    {0xfebdc5ca8f715e00ULL, 33, 49},
+    {0xfee1a3543be15517ULL, 49, 48},
+    {0xfee6e65781974e49ULL, 62, 60},
+    {0xff28c90af25af9dcULL, 42, 50},
+    {0xff45bb5e1555b3f2ULL, 39, 59},
+    {0xff45bb5e1555b3f2ULL, 29, 30},
+    {0xff4b844da8ce488aULL, 51, 42},
+    {0xffa4523bb42e84e4ULL, 51, 49},
+    {0xffa51ca6da14530cULL, 56, 47},
+    {0xffac0071e066b76eULL, 32, 52},
+    {0xffcc50768658b46fULL, 29, 65},
+    {0xfff8be0a48487ec9ULL, 3, 23},
+    {0xfffbe19184c83f48ULL, 59, 57},
+    {0xfffbe19184c83f48ULL, 51, 49},
+    {0xfffbe19184c83f48ULL, 41, 23},
+    {0xfffbe19184c83f48ULL, 59, 57},
 };
-unsigned int book_dat_len = 56416;
@@ -1,4 +1,5 @@
 #include <cstdint>
+#include <cstdio>
 #include <fstream>
 #include <game.hpp>
 #include <iostream>
@@ -11,14 +12,14 @@ inline bool operator==(const BookEntry& a, const BookEntry& b) {
 
 int main(int argc, char* argv[]) {
   if (argc != 3) {
-    std::cerr << "Usage: " << argv[0] << " <input.txt> <output.dat>" << std::endl;
+    std::cerr << "Usage: " << argv[0] << " <input.txt> <book.hpp>" << std::endl;
     return 1;
   }
 
   std::cout << "sizeof(BookEntry): " << sizeof(BookEntry) << std::endl;
 
   std::ifstream file(argv[1]);
-  std::ofstream book(argv[2], std::ios::binary);
+  std::ofstream book(argv[2]);
   std::string line;
   bool even = true;
   GameState state;
@@ -41,10 +42,17 @@ int main(int argc, char* argv[]) {
   // 去重
   entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
 
+  // 输出为编译期常量数组，引擎启动时无需加载
+  book << "#pragma once\n\n#include <game.hpp>\n\n";
+  book << "// 由 bookmaker 生成，按 hash 排序，同一局面可能有多个着法\n";
+  book << "constexpr BookEntry BOOK[] = {\n";
+  char row[64];
   for (const auto& entry : entries) {
     std::cout << "Adding entry: " << entry.src << " -> " << entry.dst << std::endl;
-    book.write(reinterpret_cast<const char*>(&entry), sizeof(BookEntry));
+    snprintf(row, sizeof(row), "    {0x%016llxULL, %d, %d},\n", (unsigned long long)entry.hash, entry.src, entry.dst);
+    book << row;
   }
+  book << "};\n";
 
   std::cout << "Wrote " << entries.size() << " entries to " << argv[2] << std::endl;
 
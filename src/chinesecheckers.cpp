@@ -0,0 +1,131 @@
+#include "chinesecheckers.h"
+
+#include <algorithm>
+#include <atomic>
+#include <game.hpp>
+#include <mutex>
+#include <string>
+
+struct cc_engine {
+  GameState state;
+  std::atomic<bool> stop;
+  // 保护 stats，搜索线程写入，调用方可随时读取
+  std::mutex mutex;
+  cc_stats stats;
+};
+
+namespace {
+
+bool isLegal(GameState &state, Move move) {
+  if (move.src < 0 || move.src > 80 || move.dst < 0 || move.dst > 80) {
+    return false;
+  }
+  if (!((state.board[state.turn] >> move.src) & 1)) {
+    return false;
+  }
+  return (state.legalDestinations(move.src) >> move.dst) & 1;
+}
+
+}  // namespace
+
+extern "C" {
+
+const char *cc_version(void) { return "1.0"; }
+
+cc_engine *cc_engine_create(int hash_mb, int threads) {
+  try {
+    if (hash_mb > 0) {
+      setHashSize(hash_mb);
+    }
+    if (threads > 0) {
+      setSearchThreads(threads);
+    }
+    auto engine = new cc_engine();
+    engine->stop = false;
+    engine->stats = cc_stats{0, 0, {-1, -1}, 0, 0};
+    return engine;
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+void cc_engine_destroy(cc_engine *engine) { delete engine; }
+
+int cc_engine_set_position(cc_engine *engine, const char *state) {
+  if (engine == nullptr || state == nullptr) {
+    return -1;
+  }
+  std::string text(state);
+  if (text == "startpos") {
+    engine->state = GameState();
+    return 0;
+  }
+  GameState parsed;
+  try {
+    parsed = GameState(text);
+  } catch (...) {
+    return -1;
+  }
+  if (!isValidPosition(parsed)) {
+    return -1;
+  }
+  engine->state = parsed;
+  return 0;
+}
+
+int cc_engine_apply_move(cc_engine *engine, int src, int dst) {
+  if (engine == nullptr || !isLegal(engine->state, {src, dst})) {
+    return -1;
+  }
+  engine->state.applyMove({src, dst});
+  return 0;
+}
+
+int cc_engine_search(cc_engine *engine, int time_limit, cc_move *best_move) {
+  if (engine == nullptr || engine->state.isGameOver()) {
+    return -1;
+  }
+  SearchLimits limits;
+  limits.timeLimit = std::max(time_limit, 0);
+  limits.infinite = time_limit <= 0;
+  // 停止标志在搜索返回时才清除，搜索开始前调用的 cc_engine_stop 不会丢失
+  limits.stop = &engine->stop;
+  {
+    // 开局库命中时不会有迭代信息，先清空上一次的统计
+    std::lock_guard<std::mutex> lock(engine->mutex);
+    engine->stats = cc_stats{0, 0, {-1, -1}, 0, 0};
+  }
+  Move move;
+  try {
+    move = engine->state.searchBestMove(limits, [engine](const SearchInfo &info) {
+      std::lock_guard<std::mutex> lock(engine->mutex);
+      engine->stats = cc_stats{info.depth, info.score, {info.bestMove.src, info.bestMove.dst}, info.nodes, info.time};
+    });
+  } catch (...) {
+    engine->stop = false;
+    return -1;
+  }
+  engine->stop = false;
+  if (move.src < 0 || move.dst < 0) {
+    return -1;
+  }
+  if (best_move != nullptr) {
+    *best_move = cc_move{move.src, move.dst};
+  }
+  return 0;
+}
+
+void cc_engine_stop(cc_engine *engine) {
+  if (engine != nullptr) {
+    engine->stop = true;
+  }
+}
+
+void cc_engine_stats(cc_engine *engine, cc_stats *stats) {
+  if (engine == nullptr || stats == nullptr) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(engine->mutex);
+  *stats = engine->stats;
+}
+}
@@ -0,0 +1,71 @@
+/*
+ * 跳棋引擎的 C 接口，供其他程序在进程内直接调用搜索，无需经过 HTTP 服务。
+ *
+ * 局面字符串格式与 GameState 相同：81 个 0/1/2 (可用 / 分隔)，之后是走棋方 r/g 和回合数，
+ * 例如 "000000000/.../000000000 r 1"，也可以传入 "startpos" 表示初始局面。
+ *
+ * 注意：置换表和搜索线程数是全局设置，多个引擎实例共享同一张置换表，
+ * 同一时刻只应有一个实例在搜索。
+ */
+#ifndef CHINESECHECKERS_H
+#define CHINESECHECKERS_H
+
+#include <stdint.h>
+
+#if defined(_WIN32) && defined(CC_ENGINE_SHARED)
+#ifdef CC_ENGINE_BUILD
+#define CC_API __declspec(dllexport)
+#else
+#define CC_API __declspec(dllimport)
+#endif
+#elif defined(__GNUC__)
+#define CC_API __attribute__((visibility("default")))
+#else
+#define CC_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct cc_engine cc_engine;
+
+typedef struct cc_move {
+  int src;
+  int dst;
+} cc_move;
+
+/* 最近一次搜索的统计信息，score 为走棋一方的评分 */
+typedef struct cc_stats {
+  int depth;
+  int score;
+  cc_move best_move;
+  uint64_t nodes;
+  int64_t time_ms;
+} cc_stats;
+
+CC_API const char *cc_version(void);
+
+/* hash_mb 为置换表大小 (MB)，threads 为搜索线程数，传 0 使用默认值；失败时返回 NULL */
+CC_API cc_engine *cc_engine_create(int hash_mb, int threads);
+CC_API void cc_engine_destroy(cc_engine *engine);
+
+/* 设置局面，成功返回 0，局面不合法返回 -1 */
+CC_API int cc_engine_set_position(cc_engine *engine, const char *state);
+/* 在当前局面上走一步，成功返回 0，着法不合法返回 -1 */
+CC_API int cc_engine_apply_move(cc_engine *engine, int src, int dst);
+
+/* 搜索当前局面，time_limit 为思考时间 (秒)，传 0 则一直搜索到 cc_engine_stop 被调用；
+ * 成功返回 0 并写入 best_move，没有合法着法时返回 -1 */
+CC_API int cc_engine_search(cc_engine *engine, int time_limit, cc_move *best_move);
+/* 可以在其他线程调用，使正在进行的搜索尽快返回。没有搜索在进行时，停止请求会保留到
+ * 下一次 cc_engine_search，该次搜索立即返回 (第一层迭代没有完成时返回 -1)；每次搜索返回后清除停止请求 */
+CC_API void cc_engine_stop(cc_engine *engine);
+/* 可以在搜索过程中从其他线程调用，读取最近完成的一层迭代的统计信息 */
+CC_API void cc_engine_stats(cc_engine *engine, cc_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -1,11 +1,110 @@
 #include <spdlog/spdlog.h>
 
+#include <dfpn.hpp>
 #include <game.hpp>
 #include <iostream>
+#include <sstream>
+#include <string>
+#include <trace.hpp>
+
+// SOLVE 命令最多搜索的结点数，同时受 TIMELIMIT 限制
+const uint64_t SOLVE_NODE_LIMIT = 1 << 24;
+
+// 基准测试局面，取自 tests 目录中的对局，均不在开局库中
+const char* BENCH_POSITIONS[] = {
+    "020200000/022000000/202000000/022000000/002201100/000000110/000011001/000000110/000000010 g 6",
+    "000200000/022000000/202200000/022000000/002201110/000000110/000011001/000000110/000000000 g 7",
+    "000200000/002000000/202200000/022000010/002201100/000200110/000011001/000000110/000000000 g 8",
+    "000200000/012000000/022200000/022000010/002211000/000000100/000011001/000002110/000000000 g 10",
+    "000200000/102000000/202200000/020000000/002211110/000000010/000011000/000022110/000000000 g 10",
+    "000000000/101000000/201201000/000001000/000201010/000220220/000011200/000010200/000000200 r 19",
+};
+
+// 着法列表格式为 "src dst src dst ..."
+std::vector<Move> parseMoves(const std::string& text) {
+  std::vector<Move> moves;
+  std::istringstream iss(text);
+  Move move;
+  while (iss >> move.src >> move.dst) {
+    moves.push_back(move);
+  }
+  return moves;
+}
+
+// 以固定深度单线程搜索所有基准局面，结点数只取决于引擎本身，可以用来比较不同构建的 NPS，
+// 也作为 PGO 插桩构建的训练负载
+void bench(int depth) {
+  uint64_t totalNodes = 0;
+  int64_t totalTime = 0;
+  for (const char* position : BENCH_POSITIONS) {
+    GameState gameState{std::string(position)};
+    SearchLimits limits;
+    limits.depth = depth;
+    limits.threads = 1;
+    limits.timeLimit = 3600;
+    SearchInfo last{};
+    clearHash();
+    Move move = gameState.searchBestMove(limits, [&last](const SearchInfo& info) { last = info; });
+    totalNodes += last.nodes;
+    totalTime += last.time;
+    std::cout << "position " << position << std::endl;
+    std::cout << "  depth " << last.depth << " score " << last.score << " bestmove " << move.src << " "
+              << move.dst << " nodes " << last.nodes << " time " << last.time << std::endl;
+  }
+  std::cout << "nodes " << totalNodes << std::endl;
+  std::cout << "time " << totalTime << std::endl;
+  std::cout << "nps " << totalNodes * 1000 / std::max<int64_t>(totalTime, 1) << std::endl;
+}
 
 int main(int argc, char* argv[]) {
   int timelimit = 10;
+  SearchBackend backend = BACKEND_ALPHABETA;
+  TimeControl clock;
+  int skill = 0;
+  bool showInfo = false;
   spdlog::set_level(spdlog::level::err);
+  // 非交互模式：chinesecheckers_cli bench [depth]
+  if (argc > 1 && std::string(argv[1]) == "bench") {
+    bench(argc > 2 ? std::stoi(argv[2]) : 7);
+    return 0;
+  }
+  auto search = [&](GameState& gameState) {
+    TraceScope scope("command");
+    SearchLimits limits;
+    limits.timeLimit = timelimit;
+    limits.backend = backend;
+    limits.clock = clock;
+    limits.skill = skill;
+    SearchCallback callback = nullptr;
+    if (showInfo) {
+      callback = [](const SearchInfo& info) {
+        std::cout << "info depth " << info.depth << " score " << info.score << " nodes " << info.nodes << " time "
+                  << info.time << " pv";
+        for (auto& move : info.lines.empty() ? std::vector<Move>{info.bestMove} : info.lines[0].moves) {
+          std::cout << " " << move.src << " " << move.dst;
+        }
+        std::cout << std::endl;
+      };
+    }
+    Move move = gameState.searchBestMove(limits, callback);
+    std::cout << move.src << " " << move.dst << std::endl;
+  };
+  // POSITION/MOVES 设置的当前局面，在多条命令之间保留
+  GameState position;
+  std::string positionState = "startpos";
+  std::vector<Move> positionMoves;
+  // 依次走出着法并记入 positionMoves，遇到不合法的着法时停止
+  auto playMoves = [&](const std::vector<Move>& moves) {
+    for (auto& move : moves) {
+      if (move.src < 0 || move.src >= 81 || move.dst < 0 || move.dst >= 81 ||
+          !(position.board[position.turn] >> move.src & 1) || !(position.legalDestinations(move.src) >> move.dst & 1)) {
+        return false;
+      }
+      position.applyMove(move);
+      positionMoves.push_back(move);
+    }
+    return true;
+  };
   while (true) {
     std::string command;
     std::cin >> command;
@@ -39,12 +138,148 @@ int main(int argc, char* argv[]) {
       std::string state;
       std::getline(std::cin, state);
       GameState gameState(state);
-      Move move = gameState.searchBestMove(timelimit);
-      std::cout << move.src << " " << move.dst << std::endl;
+      if (!isValidPosition(gameState)) {
+        std::cout << "error invalid position" << std::endl;
+        continue;
+      }
+      search(gameState);
+    }
+    // POSITION <局面|startpos> [MOVES src dst src dst ...]: 设置当前局面。局面与上一次相同并且
+    // 着法列表是上一次的延续时只走新增的着法，否则从头设置
+    if (command == "POSITION") {
+      std::string line;
+      std::getline(std::cin, line);
+      size_t split = line.find("MOVES");
+      std::string state = line.substr(0, split);
+      state.erase(0, state.find_first_not_of(' '));
+      state.erase(state.find_last_not_of(' ') + 1);
+      std::vector<Move> moves = parseMoves(split == std::string::npos ? "" : line.substr(split + 5));
+      bool extends = state == positionState && moves.size() >= positionMoves.size() &&
+                     std::equal(positionMoves.begin(), positionMoves.end(), moves.begin(),
+                                [](const Move& a, const Move& b) { return a.src == b.src && a.dst == b.dst; });
+      if (!extends) {
+        GameState parsed = state == "startpos" ? GameState() : GameState(state);
+        if (!isValidPosition(parsed)) {
+          std::cout << "error invalid position" << std::endl;
+          continue;
+        }
+        position = parsed;
+        positionState = state;
+        positionMoves.clear();
+      }
+      std::vector<Move> added(moves.begin() + positionMoves.size(), moves.end());
+      std::cout << (playMoves(added) ? "ok" : "error illegal move") << std::endl;
+    }
+    // MOVES src dst ...: 在当前局面上继续走棋
+    if (command == "MOVES") {
+      std::string line;
+      std::getline(std::cin, line);
+      std::cout << (playMoves(parseMoves(line)) ? "ok" : "error illegal move") << std::endl;
+    }
+    // GO: 搜索当前局面，不走出着法
+    if (command == "GO") {
+      search(position);
+    }
+    if (command == "SOLVE") {
+      std::string state;
+      std::getline(std::cin, state);
+      GameState gameState(state);
+      if (!isValidPosition(gameState)) {
+        std::cout << "error invalid position" << std::endl;
+        continue;
+      }
+      SearchContext context;
+      context.deadline = std::chrono::high_resolution_clock::now() + std::chrono::seconds(timelimit);
+      context.stopped = false;
+      context.stop = nullptr;
+      context.nodes = 0;
+      ProofSolution solution = solveProof(gameState, SOLVE_NODE_LIMIT, context);
+      const char* results[] = {"unknown", "win", "loss"};
+      std::cout << results[solution.result];
+      for (auto& move : solution.line) {
+        std::cout << " " << move.src << " " << move.dst;
+      }
+      std::cout << std::endl;
+    }
+    if (command == "ENGINE") {
+      std::string name;
+      std::cin >> name;
+      backend = name == "MCTS" ? BACKEND_MCTS : BACKEND_ALPHABETA;
+      std::cout << "ok" << std::endl;
+    }
+    // CLOCK <剩余毫秒> <加时毫秒> [到时限的步数]: 之后的 SEARCH 按对局时钟分配时间，CLOCK 0 0 恢复 TIMELIMIT
+    if (command == "CLOCK") {
+      std::string line;
+      std::getline(std::cin, line);
+      std::istringstream iss(line);
+      clock = TimeControl();
+      iss >> clock.remaining >> clock.increment >> clock.movesToGo;
+      std::cout << "ok" << std::endl;
+    }
+    // INFO ON: SEARCH 在给出着法之前，每完成一层迭代输出一行 "info depth d score s nodes n time t pv ..."
+    if (command == "INFO") {
+      std::string value;
+      std::cin >> value;
+      showInfo = value == "ON";
+      std::cout << "ok" << std::endl;
+    }
+    // SKILL <0-5>: 0 为全力搜索
+    if (command == "SKILL") {
+      std::cin >> skill;
+      skill = std::max(0, std::min(skill, SKILL_LEVELS));
+      std::cout << "ok" << std::endl;
     }
     if (command == "TIMELIMIT") {
       std::cin >> timelimit;
       std::cout << "ok" << std::endl;
     }
+    if (command == "HASH") {
+      int megabytes;
+      std::cin >> megabytes;
+      setHashSize(megabytes);
+      std::cout << "ok" << std::endl;
+    }
+    // CLEARHASH: 清空置换表，之后的搜索不受之前搜索的影响
+    if (command == "CLEARHASH") {
+      clearHash();
+      std::cout << "ok" << std::endl;
+    }
+    // SAVEHASH <文件> [百分比]: 保存深度最大的条目；LOADHASH <文件>: 读入快照
+    if (command == "SAVEHASH" || command == "LOADHASH") {
+      std::string line, path;
+      int percent = 100;
+      std::getline(std::cin, line);
+      std::istringstream iss(line);
+      iss >> path >> percent;
+      try {
+        size_t count = command == "SAVEHASH" ? saveHash(path, percent) : loadHash(path);
+        std::cout << "ok " << count << std::endl;
+      } catch (std::runtime_error const& e) {
+        std::cout << "error " << e.what() << std::endl;
+      }
+    }
+    // TRACE ON/OFF: 开始或停止记录事件；TRACE <文件>: 以 Chrome Trace Event 格式导出已记录的事件
+    if (command == "TRACE") {
+      std::string argument;
+      std::cin >> argument;
+      if (argument == "ON" || argument == "OFF") {
+        clearTrace();
+        setTracing(argument == "ON");
+        std::cout << "ok" << std::endl;
+      } else {
+        std::cout << (writeTrace(argument) ? "ok" : "error") << std::endl;
+      }
+    }
+    if (command == "BENCH") {
+      int depth;
+      std::cin >> depth;
+      bench(depth);
+    }
+    if (command == "THREADS") {
+      int threads;
+      std::cin >> threads;
+      setSearchThreads(threads);
+      std::cout << "ok" << std::endl;
+    }
   }
 }
\ No newline at end of file
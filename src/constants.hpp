@@ -1,8 +1,7 @@
 #pragma once
 #include <cstdint>
-#include <map>
 using uint128_t = __uint128_t;
-uint64_t ZOBRIST_TABLE[81][3] = {
+constexpr uint64_t ZOBRIST_TABLE[81][3] = {
     {0x94ba027af0a5f8fbULL, 0xa236904c2c65b694ULL, 0xb130df348c7d2fd4ULL},
     {0x2113cafeb6df1536ULL, 0x9d7c2cca027d84fbULL, 0x19614b08a0b4971fULL},
     {0xf1e26a4a58395782ULL, 0xa9b6d2437f441623ULL, 0x95ecfd78c150d125ULL},
@@ -85,7 +84,7 @@ uint64_t ZOBRIST_TABLE[81][3] = {
     {0x7bcfab63185a0de4ULL, 0x73b1957db7a26965ULL, 0xf48f1f3ffaabd2e9ULL},
     {0xd51104db00506544ULL, 0x2268c590eb7eda90ULL, 0xf651c7b9c2fd763eULL},
 };
-const uint128_t ADJ_POSITIONS[81] = {
+constexpr uint128_t ADJ_POSITIONS[81] = {
     ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000202,
     ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000605,
     ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000c0a,
@@ -168,7383 +167,87 @@ const uint128_t ADJ_POSITIONS[81] = {
     ((uint128_t)0x00000000000140c0 << 64) | 0x0000000000000000,
     ((uint128_t)0x0000000000008080 << 64) | 0x0000000000000000,
 };
-const std::map<uint128_t, uint128_t> JUMP_POSITIONS[81] = {
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000200,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000040000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000002,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000004},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000202,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000040004},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000080000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000004,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000404,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000080008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000001,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000401,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000080000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000005,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000405,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000080008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000200,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000600,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000080000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000204,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000604,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000080008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000201,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000601,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000080000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000205,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000605,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000080008},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000040000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000c00,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000140000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000002,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000001},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000802,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000100001},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000402,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000040001},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000c02,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000140001},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000008,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000808,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000100010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000408,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000040010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000c08,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000140010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000000000a,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000011},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000000080a,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000100011},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000000040a,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000040011},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000c0a,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000140011},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000080000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000001800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000280000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000004,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000002},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000001004,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000200002},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000804,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000080002},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000001804,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000280002},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000001010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000200020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000810,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000080020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000001810,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000280020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000014,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000022},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000001014,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000200022},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000814,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000080022},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000001814,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000280022},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000002000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000003000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000500000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000008,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000004},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000002008,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000400004},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000001008,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000100004},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000003008,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000500004},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000002020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000400040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000001020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000100040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000003020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000500040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000028,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000044},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000002028,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000400044},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000001028,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000100044},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000003028,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000500044},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000004000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000002000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000006000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000a00000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000004010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000800008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000002010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000200008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000006010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000a00008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000004040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000800080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000002040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000200080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000006040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000a00080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000050,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000088},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000004050,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000800088},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000002050,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000200088},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000006050,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000a00088},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000008000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000004000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000000c000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000001400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000008020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000001000010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000004020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000400010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000000c020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000001400010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000100},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000008080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000001000100},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000004080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000400100},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000000c080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000001400100},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000000000a0,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000110},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000000080a0,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000001000110},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000000040a0,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000400110},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000000c0a0,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000001400110},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000008000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000018000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000002800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000010040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000002000020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000008040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000800020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000018040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000002800020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000100,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000010100,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000008100,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000018100,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000002800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000140,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000010140,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000002000020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000008140,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000800020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000018140,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000002800020},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000004000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000030000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000005000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000020080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000004000040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000010080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000001000040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000030080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000005000040},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000001,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040001,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000401,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040401,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000002,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040002,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000402,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040402,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000003,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040003,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000403,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040403,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008000800},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000002,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080002,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000802,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080802,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000004,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080004,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000804,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080804,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000006,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080006,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000806,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080806,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000000c0000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000000c0800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040002,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000000c0002,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040802,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000000c0802,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040004,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000000c0004,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040804,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000000c0804,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040006,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000000c0006,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040806,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000000c0806,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000200,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080200,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000a00,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080a00,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000202,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080202,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000a02,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080a02,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000204,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080204,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000a04,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080a04,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000206,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080206,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000a06,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080a06,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040200,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000000c0200,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040a00,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000000c0a00,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040202,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000000c0202,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040a02,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000000c0a02,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040204,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000000c0204,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040a04,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000000c0a04,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040206,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000000c0206,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040a06,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000000c0a06,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010001000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000180000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000028000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000100400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020000200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008000200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000180400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000028000200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000101000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000081000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000181000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000028002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000001400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000002200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000101400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020002200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000081400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008002200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000181400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000028002200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000004,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000100004,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080004,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000180004,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000028000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000404,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000100404,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020000200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080404,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008000200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000180404,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000028000200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000001004,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000101004,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000081004,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000181004,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000028002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000001404,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000002200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000101404,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020002200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000081404,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008002200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000181404,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000028002200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000008,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000100008,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080008,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000180008,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000028000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000408,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000100408,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020000200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080408,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008000200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000180408,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000028000200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000001008,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000101008,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000081008,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000181008,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000028002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000001408,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000002200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000101408,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020002200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000081408,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008002200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000181408,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000028002200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000000000c,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000010000c,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000008000c,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000018000c,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000028000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000000040c,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000010040c,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020000200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000008040c,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008000200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000018040c,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000028000200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000000100c,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000010100c,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000008100c,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000018100c,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000028002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000000140c,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000002200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000010140c,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020002200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000008140c,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008002200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000018140c,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000028002200},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000300000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000050000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000200800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000100800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000300800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000050000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000002000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000202000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000102000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000302000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000050004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000002800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000004400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000202800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040004400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000102800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010004400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000302800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000050004400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000008,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000200008,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000100008,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000300008,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000050000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000808,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000200808,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000100808,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000300808,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000050000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000002008,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000202008,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000102008,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000302008,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000050004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000002808,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000004400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000202808,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040004400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000102808,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010004400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000302808,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000050004400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000200010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000100010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000300010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000050000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000810,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000200810,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000100810,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000300810,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000050000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000002010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000202010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000102010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000302010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000050004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000002810,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000004400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000202810,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040004400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000102810,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010004400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000302810,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000050004400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000018,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000200018,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000100018,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000300018,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000050000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000818,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000200818,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000100818,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000300818,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000050000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000002018,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000202018,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000102018,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000302018,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000050004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000002818,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000004400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000202818,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040004400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000102818,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010004400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000302818,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000050004400},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000600000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000000a0000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000401000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000201000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000601000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000000a0000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000004000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000404000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000204000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000604000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000000a0008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000005000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000008800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000405000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080008800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000205000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020008800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000605000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000000a0008800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000400010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000200010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000600010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000000a0000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000001010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000401010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000201010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000601010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000000a0000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000004010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000404010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000204010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000604010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000000a0008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000005010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000008800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000405010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080008800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000205010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020008800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000605010,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000000a0008800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000400020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000200020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000600020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000000a0000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000001020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000401020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000201020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000601020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000000a0000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000004020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000404020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000204020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000604020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000000a0008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000005020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000008800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000405020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080008800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000205020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020008800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000605020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000000a0008800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000030,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000400030,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000200030,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000600030,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000000a0000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000001030,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000401030,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000201030,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000601030,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000000a0000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000004030,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000404030,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000204030,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000604030,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000000a0008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000005030,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000008800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000405030,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080008800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000205030,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020008800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000605030,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000000a0008800},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000c00000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000140000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000002000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000802000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000402000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000c02000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000140001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000008000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000808000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000408000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000c08000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000140010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000000a000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000011000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000080a000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100011000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000040a000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040011000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000c0a000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000140011000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000800020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000400020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000c00020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000140000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000002020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000802020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000402020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000c02020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000140001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000008020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000808020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000408020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000c08020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000140010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000000a020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000011000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000080a020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100011000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000040a020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040011000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000c0a020,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000140011000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000800040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000400040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000c00040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000140000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000002040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000802040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000402040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000c02040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000140001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000008040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000808040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000408040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000c08040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000140010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000000a040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000011000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000080a040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100011000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000040a040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040011000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000c0a040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000140011000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000060,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000800060,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000400060,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000c00060,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000140000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000002060,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000802060,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000402060,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000c02060,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000140001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000008060,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000808060,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000408060,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000c08060,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000140010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000000a060,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000011000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000080a060,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100011000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000040a060,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040011000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000c0a060,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000140011000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000280000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000004000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001004000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000200002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000804000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001804000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000280002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000200020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000810000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001810000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000280020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000014000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000022000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001014000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000200022000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000814000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080022000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001814000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000280022000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001000040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000800040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001800040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000280000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000004040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001004040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000200002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000804040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001804040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000280002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000010040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001010040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000200020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000810040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001810040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000280020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000014040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000022000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001014040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000200022000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000814040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080022000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001814040,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000280022000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001000080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000800080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001800080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000280000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000004080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001004080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000200002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000804080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001804080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000280002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000010080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001010080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000200020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000810080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001810080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000280020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000014080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000022000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001014080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000200022000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000814080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080022000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001814080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000280022000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000000000c0,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000010000c0,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000008000c0,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000018000c0,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000280000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000000040c0,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000010040c0,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000200002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000008040c0,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000018040c0,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000280002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000000100c0,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000010100c0,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000200020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000008100c0,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000018100c0,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000280020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000000140c0,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000022000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000010140c0,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000200022000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000008140c0,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080022000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000018140c0,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000280022000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000003000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000500000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000008000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002008000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000400004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001008000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000003008000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000500004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000100,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002000100,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001000100,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000003000100,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000500000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000008100,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002008100,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000400004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001008100,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000003008100,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000500004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000003020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000500000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000028000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002028000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000400004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001028000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000003028000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000500004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000020100,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002020100,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001020100,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000003020100,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000500000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000028100,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002028100,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000400004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001028100,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000003028100,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000500004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002000080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001000080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000003000080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000500000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000008080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002008080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000400004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001008080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000003008080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000500004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000180,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002000180,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001000180,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000003000180,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000500000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000008180,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002008180,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000400004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001008180,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000003008180,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000500004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000020080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002020080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001020080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000003020080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000500000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000028080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002028080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000400004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001028080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000003028080,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000500004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000020180,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002020180,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001020180,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000003020180,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000500000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000028180,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002028180,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000400004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001028180,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000003028180,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000500004000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000004000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000006000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000a00000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000004010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000800008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000200008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000006010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000a00008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000100,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000004000100,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002000100,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000006000100,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000a00000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000010100,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000004010100,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000800008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002010100,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000200008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000006010100,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000a00008000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000200,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000001},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000004},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000600,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000005},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008000200,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000000001},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008000400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000000004},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008000600,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000000005},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080200,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000100001},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000100004},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080600,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000100005},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008080000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008080200,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000100001},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008080400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000100004},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008080600,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000100005},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000002},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000c00,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000000000000a},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010000400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000000002},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010000800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000000008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010000c00,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000200000000a},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000100400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000200002},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000100800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000200008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000100c00,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000000020000a},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010100400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000200002},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010100800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000200008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010100c00,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000200020000a},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000002},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040c00,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000000000000a},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010040000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010040400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000000002},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010040800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000000008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010040c00,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000200000000a},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000140000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000140400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000200002},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000140800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000200008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000140c00,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000000020000a},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010140000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010140400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000200002},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010140800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000200008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010140c00,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000200020000a},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008000400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000002},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008000800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008000c00,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000000000000a},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000018000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000018000400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000000002},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000018000800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000000008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000018000c00,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000200000000a},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008100400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000200002},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008100800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000200008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008100c00,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000000020000a},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000018100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000018100400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000200002},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000018100800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000200008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000018100c00,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000200020000a},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008040000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008040400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000002},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008040800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008040c00,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000000000000a},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000018040000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000018040400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000000002},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000018040800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000000008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000018040c00,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000200000000a},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008140000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008140400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000200002},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008140800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000200008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008140c00,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000000020000a},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000018140000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000018140400,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000200002},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000018140800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000200008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000018140c00,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000200020000a},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000004},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000001800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000014},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020000800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000000004},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020001000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000000010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020001800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000000014},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010000800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000000004},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010001000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000000010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010001800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000000014},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000030000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000005000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000030000800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000005000000004},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000030001000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000005000000010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000030001800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000005000000014},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000040000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000040004},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000081000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000040010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000081800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000040014},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020080000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000040000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020080800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000040004},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020081000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000040010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020081800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000040014},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010080000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000040000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010080800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000040004},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010081000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000040010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010081800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000040014},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000030080000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000005000040000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000030080800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000005000040004},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000030081000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000005000040010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000030081800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000005000040014},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000200800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000400004},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000201000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000400010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000201800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000400014},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020200800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000400004},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020201000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000400010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020201800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000400014},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010200800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000400004},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010201000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000400010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010201800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000400014},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000030200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000005000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000030200800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000005000400004},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000030201000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000005000400010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000030201800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000005000400014},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000280000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000440000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000280800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000440004},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000281000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000440010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000281800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000440014},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020280000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000440000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020280800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000440004},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020281000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000440010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020281800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000440014},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010280000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000440000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010280800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000440004},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010281000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000440010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010281800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000440014},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000030280000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000005000440000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000030280800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000005000440004},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000030281000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000005000440010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000030281800,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000005000440014},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000002000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000003000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000028},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040001000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000000008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040002000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000000020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040003000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000000028},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020001000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000000008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020002000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000000020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020003000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000000028},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000060000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000a000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000060001000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000a000000008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000060002000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000a000000020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000060003000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000a000000028},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000080000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000101000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000080008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000102000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000080020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000103000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000080028},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000080000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040101000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000080008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040102000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000080020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040103000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000080028},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000080000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020101000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000080008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020102000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000080020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020103000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000080028},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000060100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000a000080000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000060101000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000a000080008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000060102000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000a000080020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000060103000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000a000080028},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000401000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000800008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000402000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000800020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000403000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000800028},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040401000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000800008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040402000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000800020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040403000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000800028},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020401000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000800008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020402000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000800020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020403000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000800028},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000060400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000a000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000060401000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000a000800008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000060402000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000a000800020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000060403000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000a000800028},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000500000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000880000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000501000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000880008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000502000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000880020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000503000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000880028},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040500000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000880000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040501000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000880008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040502000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000880020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040503000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000880028},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020500000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000880000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020501000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000880008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020502000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000880020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020503000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000880028},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000060500000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000a000880000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000060501000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000a000880008},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000060502000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000a000880020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000060503000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000a000880028},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000002000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000004000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000006000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000050},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080002000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010000000010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080004000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010000000040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080006000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010000000050},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040002000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000000010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040004000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000000040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040006000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000000050},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000c0000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000014000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000c0002000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000014000000010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000c0004000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000014000000040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000c0006000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000014000000050},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000202000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000100010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000204000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000100040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000206000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000100050},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010000100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080202000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010000100010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080204000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010000100040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080206000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010000100050},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040202000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000100010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040204000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000100040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040206000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000100050},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000c0200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000014000100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000c0202000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000014000100010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000c0204000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000014000100040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000c0206000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000014000100050},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000802000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000001000010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000804000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000001000040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000806000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000001000050},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080802000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010001000010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080804000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010001000040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080806000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010001000050},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040802000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004001000010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040804000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004001000040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040806000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004001000050},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000c0800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000014001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000c0802000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000014001000010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000c0804000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000014001000040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000c0806000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000014001000050},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000a00000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000001100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000a02000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000001100010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000a04000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000001100040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000a06000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000001100050},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080a00000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010001100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080a02000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010001100010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080a04000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010001100040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080a06000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010001100050},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040a00000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004001100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040a02000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004001100010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040a04000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004001100040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040a06000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004001100050},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000c0a00000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000014001100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000c0a02000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000014001100010},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000c0a04000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000014001100040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000c0a06000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000014001100050},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000004000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000008000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000000c000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000000000000a0},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000100004000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000000020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000100008000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000000080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000010000c000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000200000000a0},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080004000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000000020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080008000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000000080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000008000c000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000080000000a0},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000180000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000028000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000180004000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000028000000020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000180008000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000028000000080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000018000c000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000280000000a0},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000404000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000200020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000408000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000200080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000040c000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000000002000a0},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000100400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000100404000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000200020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000100408000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000200080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000010040c000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000200002000a0},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080404000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000200020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080408000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000200080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000008040c000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000080002000a0},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000180400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000028000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000180404000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000028000200020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000180408000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000028000200080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000018040c000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000280002000a0},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001004000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000002000020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001008000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000002000080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000100c000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000000020000a0},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000101000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000101004000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020002000020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000101008000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020002000080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000010100c000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000200020000a0},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000081000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000081004000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008002000020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000081008000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008002000080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000008100c000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000080020000a0},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000181000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000028002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000181004000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000028002000020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000181008000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000028002000080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000018100c000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000280020000a0},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000002200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001404000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000002200020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001408000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000002200080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000000140c000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000000022000a0},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000101400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020002200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000101404000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020002200020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000101408000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020002200080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000010140c000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000200022000a0},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000081400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008002200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000081404000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008002200020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000081408000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008002200080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000008140c000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000080022000a0},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000181400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000028002200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000181404000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000028002200020},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000181408000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000028002200080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000018140c000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000280022000a0},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000008000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000100},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000018000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000140},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000040000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000200008000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000040000000040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000200010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000040000000100},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000200018000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000040000000140},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000100008000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010000000040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000100010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010000000100},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000100018000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010000000140},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000300000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000050000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000300008000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000050000000040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000300010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000050000000100},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000300018000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000050000000140},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000808000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000400040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000810000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000400100},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000818000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000400140},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000200800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000040000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000200808000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000040000400040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000200810000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000040000400100},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000200818000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000040000400140},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000100800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000100808000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010000400040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000100810000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010000400100},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000100818000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010000400140},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000300800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000050000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000300808000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000050000400040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000300810000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000050000400100},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000300818000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000050000400140},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000004000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002008000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000004000040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000004000100},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002018000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000004000140},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000202000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000040004000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000202008000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000040004000040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000202010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000040004000100},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000202018000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000040004000140},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000102000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010004000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000102008000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010004000040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000102010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010004000100},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000102018000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010004000140},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000302000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000050004000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000302008000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000050004000040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000302010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000050004000100},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000302018000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000050004000140},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000004400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002808000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000004400040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002810000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000004400100},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002818000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000004400140},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000202800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000040004400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000202808000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000040004400040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000202810000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000040004400100},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000202818000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000040004400140},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000102800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010004400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000102808000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010004400040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000102810000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010004400100},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000102818000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010004400140},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000302800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000050004400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000302808000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000050004400040},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000302810000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000050004400100},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000302818000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000050004400140},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000080000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000400010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000080000000080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000200010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000000080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000600000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000a0000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000600010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000a0000000080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000800080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000401000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000080000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000401010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000080000800080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000201000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000201010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000800080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000601000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000a0000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000601010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000a0000800080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000030000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000400020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000080000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000400030000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000080000000080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000200020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000200030000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000000080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000600020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000a0000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000600030000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000a0000000080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001030000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000800080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000401020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000080000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000401030000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000080000800080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000201020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000201030000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000800080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000601020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000a0000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000601030000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000a0000800080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000004000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000004010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000404000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000080000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000404010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000080000000080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000204000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000204010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000000080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000604000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000a0000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000604010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000a0000000080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000005000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000005010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000800080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000405000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000080000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000405010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000080000800080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000205000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000205010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000800080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000605000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000a0000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000605010000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000a0000800080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000004020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000004030000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000404020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000080000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000404030000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000080000000080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000204020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000204030000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000000080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000604020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000a0000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000604030000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000a0000000080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000005020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000005030000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000800080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000405020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000080000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000405030000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000080000800080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000205020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000205030000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000800080},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000605020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000a0000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000605030000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000a0000800080},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000100},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000100000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000800020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000100000000100},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000040000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000400020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000040000000100},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000c00000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000140000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000c00020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000140000000100},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000001000100},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000802000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000100001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000802020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000100001000100},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000402000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000040001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000402020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000040001000100},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000c02000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000140001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000c02020000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000140001000100},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000040000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000000c0000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000a00},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000001000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000001000040000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200000000200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000001000080000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200000000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000010000c0000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200000000a00},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010040000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020000200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010080000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000100c0000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020000a00},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000001010000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000001010040000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200020000200},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000001010080000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200020000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000010100c0000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200020000a00},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000080000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000180000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002000080000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002000100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002000180000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000001400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020080000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020180000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040001400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002020080000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400040000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002020100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400040001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002020180000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400040001400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008080000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008180000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002008000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002008080000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002008100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002008180000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000001400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000028000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000028080000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000028100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000028180000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040001400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002028000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002028080000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400040000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002028100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400040001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002028180000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400040001400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000001000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000001000080000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000001000100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000001000180000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000003000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000003000080000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000003000100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000003000180000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000001400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000001020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000001020080000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000001020100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000001020180000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040001400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000003020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000003020080000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400040000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000003020100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400040001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000003020180000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400040001400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000001008000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000001008080000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000001008100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000001008180000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000003008000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000003008080000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000003008100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000003008180000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000001400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000001028000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000001028080000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000001028100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000001028180000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040001400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000003028000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000003028080000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400040000400},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000003028100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400040001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000003028180000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400040001400},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000300000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000002800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004000100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800000000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004000200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800000002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004000300000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800000002800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002000100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200000000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002000200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200000002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002000300000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200000002800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000006000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000a00000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000006000100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000a00000000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000006000200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000a00000002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000006000300000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000a00000002800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010300000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008002800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004010000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800008000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004010100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800008000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004010200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800008002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004010300000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800008002800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002010000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200008000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002010100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200008000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002010200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200008002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002010300000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200008002800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000006010000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000a00008000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000006010100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000a00008000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000006010200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000a00008002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000006010300000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000a00008002800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040300000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080002800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004040100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800080000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004040200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800080002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004040300000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800080002800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002040100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200080000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002040200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200080002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002040300000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200080002800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000006040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000a00080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000006040100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000a00080000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000006040200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000a00080002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000006040300000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000a00080002800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000050000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000088000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000050100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000088000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000050200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000088002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000050300000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000088002800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004050000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800088000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004050100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800088000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004050200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800088002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004050300000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800088002800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002050000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200088000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002050100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200088000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002050200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200088002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002050300000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200088002800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000006050000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000a00088000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000006050100000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000a00088000800},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000006050200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000a00088002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000006050300000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000a00088002800},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000600000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000005000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008000200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008000400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000000004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008000600000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000000005000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004000200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004000400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004000600000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000005000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000c000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001400000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000c000200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001400000001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000c000400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001400000004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000c000600000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001400000005000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020600000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010005000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008020200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000010001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008020400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000010004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008020600000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000010005000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004020200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400010001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004020400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400010004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004020600000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400010005000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000c020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001400010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000c020200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001400010001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000c020400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001400010004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000c020600000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001400010005000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080600000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100005000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008080200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000100001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008080400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000100004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008080600000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000100005000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004080200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400100001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004080400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400100004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004080600000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400100005000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000c080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001400100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000c080200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001400100001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000c080400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001400100004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000c080600000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001400100005000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000a0000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000110000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000a0200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000110001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000a0400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000110004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000a0600000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000110005000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000080a0000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000110000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000080a0200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000110001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000080a0400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000110004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000080a0600000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000110005000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000040a0000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400110000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000040a0200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400110001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000040a0400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400110004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000040a0600000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400110005000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000c0a0000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001400110000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000c0a0200000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001400110001000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000c0a0400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001400110004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000c0a0600000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001400110005000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000c00000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000000000a000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010000400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000000002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010000800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000000008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010000c00000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000200000000a000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008000400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800000002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008000800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800000008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008000c00000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000080000000a000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000018000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002800000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000018000400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002800000002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000018000800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002800000008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000018000c00000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000280000000a000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040c00000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000002000a000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010040400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000020002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010040800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000020008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010040c00000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000200002000a000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008040400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800020002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008040800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800020008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008040c00000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000080002000a000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000018040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002800020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000018040400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002800020002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000018040800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002800020008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000018040c00000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000280002000a000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000100400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000200002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000100800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000200008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000100c00000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000020000a000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010100400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000200002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010100800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000200008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010100c00000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000200020000a000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008100400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800200002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008100800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800200008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008100c00000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000080020000a000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000018100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002800200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000018100400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002800200002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000018100800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002800200008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000018100c00000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000280020000a000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000140000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000220000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000140400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000220002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000140800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000220008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000140c00000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000022000a000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010140000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000220000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010140400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000220002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010140800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000220008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010140c00000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000200022000a000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008140000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800220000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008140400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800220002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008140800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800220008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008140c00000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000080022000a000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000018140000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002800220000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000018140400000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002800220002000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000018140800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002800220008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000018140c00000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000280022000a000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000014000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020000800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000000004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020001000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000000010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020001800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000000014000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010000800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000000004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010001000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000000010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010001800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000000014000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000030000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0005000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000030000800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0005000000004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000030001000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0005000000010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000030001800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0005000000014000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000081000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000081800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040014000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020080800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000040004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020081000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000040010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020081800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000040014000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010080800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000040004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010081000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000040010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010081800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000040014000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000030080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0005000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000030080800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0005000040004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000030081000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0005000040010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000030081800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0005000040014000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000200800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000400004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000201000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000400010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000201800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000400014000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020200800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000400004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020201000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000400010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020201800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000400014000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010200800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000400004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010201000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000400010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010201800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000400014000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000030200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0005000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000030200800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0005000400004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000030201000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0005000400010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000030201800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0005000400014000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000280000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000440000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000280800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000440004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000281000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000440010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000281800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000440014000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020280000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000440000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020280800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000440004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020281000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000440010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020281800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000440014000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010280000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000440000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010280800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000440004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010281000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000440010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010281800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000440014000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000030280000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0005000440000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000030280800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0005000440004000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000030281000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0005000440010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000030281800000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0005000440014000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000001000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000003000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000028000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040001000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000000008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040002000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000000020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040003000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000000028000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020001000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000000008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020002000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000000020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020003000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000000028000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000060000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000a000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000060001000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000a000000008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000060002000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000a000000020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000060003000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000a000000028000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000101000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000102000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000103000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080028000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040101000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000080008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040102000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000080020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040103000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000080028000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020101000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000080008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020102000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000080020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020103000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000080028000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000060100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000a000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000060101000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000a000080008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000060102000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000a000080020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000060103000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000a000080028000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000401000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000800008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000402000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000800020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000403000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000800028000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040401000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000800008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040402000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000800020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040403000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000800028000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020401000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000800008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020402000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000800020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020403000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000800028000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000060400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000a000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000060401000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000a000800008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000060402000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000a000800020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000060403000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000a000800028000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000500000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000880000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000501000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000880008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000502000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000880020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000503000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000880028000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040500000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000880000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040501000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000880008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040502000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000880020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040503000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000880028000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020500000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000880000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020501000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000880008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020502000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000880020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020503000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000880028000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000060500000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000a000880000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000060501000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000a000880008000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000060502000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000a000880020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000060503000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000a000880028000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000002000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000080000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000080002000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040002000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000000010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000c0000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0014000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000c0002000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0014000000010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000202000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000080200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000080202000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000100010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040202000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000100010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000c0200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0014000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000c0202000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0014000100010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000004000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000006000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000080004000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000080006000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040004000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040006000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000000010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000c0004000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0014000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000c0006000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0014000000010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000204000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000206000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000080204000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000080206000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000100010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040204000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040206000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000100010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000c0204000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0014000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000c0206000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0014000100010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000802000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000080800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000080802000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040802000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000000010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000c0800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0014000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000c0802000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0014000000010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000a00000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000a02000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000080a00000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000080a02000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000100010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040a00000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040a02000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000100010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000c0a00000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0014000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000c0a02000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0014000100010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000804000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000806000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000080804000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000080806000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040804000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040806000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000000010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000c0804000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0014000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000c0806000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0014000000010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000a04000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000a06000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000080a04000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000080a06000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000100010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040a04000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040a06000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000100010000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000c0a04000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0014000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000c0a06000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0014000100010000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000004000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000100000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0020000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000100004000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0020000000020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000080000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000080004000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000000020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000180000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0028000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000180004000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0028000000020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000404000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000200020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000100400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0020000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000100404000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0020000200020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000080400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000080404000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000200020000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000180400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0028000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000180404000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0028000200020000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000008000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000040000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000018000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000140000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000200000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000200008000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040000000040000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000200010000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040000000100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000200018000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040000000140000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002008000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000040000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002010000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002018000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000140000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000202000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040004000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000202008000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040004000040000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000202010000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040004000100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000202018000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040004000140000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000080000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000030000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000280000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000400000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000400010000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080000000080000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000400020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080000000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000400030000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080000000280000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004010000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000080000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004030000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000280000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000404000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080008000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000404010000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080008000080000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000404020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080008000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000404030000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080008000280000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000001000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000001010000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000080000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000001020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000001030000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000280000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000401000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000401010000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080000000080000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000401020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080000000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000401030000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080000000280000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000005000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000005010000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000080000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000005020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000005030000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000280000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000405000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080008000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000405010000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080008000080000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000405020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080008000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000405030000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080008000280000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000200000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000200010000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000080000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000200020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000200030000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000280000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000600000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000600010000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080000000080000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000600020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080000000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000600030000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080000000280000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000204000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000204010000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000080000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000204020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000204030000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000280000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000604000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080008000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000604010000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080008000080000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000604020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080008000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000604030000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080008000280000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000201000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000201010000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000080000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000201020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000201030000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000280000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000601000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000601010000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080000000080000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000601020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080000000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000601030000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080000000280000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000205000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000205010000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000080000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000205020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000205030000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000280000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000605000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080008000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000605010000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080008000080000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000605020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080008000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000605030000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080008000280000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000060000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000500000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000800000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000800020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100000000100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000800040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100000000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000800060000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100000000500000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000400000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000400020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040000000100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000400040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040000000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000400060000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040000000500000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000c00000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0140000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000c00020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0140000000100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000c00040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0140000000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000c00060000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0140000000500000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002060000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000500000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000802000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100001000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000802020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100001000100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000802040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100001000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000802060000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100001000500000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000402000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040001000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000402020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040001000100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000402040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040001000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000402060000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040001000500000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000c02000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0140001000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000c02020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0140001000100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000c02040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0140001000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000c02060000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0140001000500000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010000100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008060000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010000500000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000808000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100010000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000808020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100010000100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000808040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100010000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000808060000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100010000500000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000408000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040010000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000408020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040010000100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000408040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040010000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000408060000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040010000500000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000c08000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0140010000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000c08020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0140010000100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000c08040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0140010000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000c08060000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0140010000500000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000a000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000011000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000a020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000011000100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000a040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000011000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000a060000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000011000500000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000080a000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100011000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000080a020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100011000100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000080a040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100011000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000080a060000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100011000500000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000040a000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040011000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000040a020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040011000100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000040a040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040011000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000040a060000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040011000500000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000c0a000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0140011000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000c0a020000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0140011000100000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000c0a040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0140011000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000c0a060000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0140011000500000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000c0000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000a00000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001000040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200000000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001000080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200000000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00010000c0000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200000000a00000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000800000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000800040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080000000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000800080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080000000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00008000c0000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080000000a00000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001800000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0280000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001800040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0280000000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001800080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0280000000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00018000c0000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0280000000a00000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000040c0000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000a00000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001004000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200002000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001004040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200002000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001004080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200002000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00010040c0000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200002000a00000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000804000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080002000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000804040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080002000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000804080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080002000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00008040c0000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080002000a00000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001804000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0280002000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001804040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0280002000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001804080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0280002000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00018040c0000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0280002000a00000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000100c0000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000a00000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001010000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001010040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200020000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001010080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200020000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00010100c0000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200020000a00000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000810000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000810040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080020000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000810080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080020000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00008100c0000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080020000a00000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001810000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0280020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001810040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0280020000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001810080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0280020000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00018100c0000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0280020000a00000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000014000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000022000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000014040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000022000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000014080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000022000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000140c0000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000022000a00000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001014000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200022000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001014040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200022000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001014080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200022000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00010140c0000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200022000a00000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000814000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080022000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000814040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080022000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000814080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080022000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00008140c0000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080022000a00000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001814000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0280022000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001814040000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0280022000200000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001814080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0280022000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00018140c0000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0280022000a00000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000180000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000001400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002000080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400000000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002000100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400000001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002000180000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400000001400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001000080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100000000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001000100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100000001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001000180000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100000001400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0003000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0500000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0003000080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0500000000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0003000100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0500000001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0003000180000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0500000001400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008180000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004001400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002008000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400004000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002008080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400004000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002008100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400004001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002008180000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400004001400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001008000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100004000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001008080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100004000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001008100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100004001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001008180000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100004001400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0003008000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0500004000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0003008080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0500004000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0003008100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0500004001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0003008180000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0500004001400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000040000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000040000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000040001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020180000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000040001400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002020000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400040000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002020080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400040000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002020100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400040001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002020180000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400040001400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001020000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100040000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001020080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100040000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001020100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100040001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001020180000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100040001400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0003020000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0500040000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0003020080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0500040000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0003020100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0500040001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0003020180000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0500040001400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000028000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000044000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000028080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000044000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000028100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000044001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000028180000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000044001400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002028000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400044000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002028080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400044000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002028100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400044001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002028180000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400044001400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001028000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100044000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001028080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100044000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001028100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100044001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001028180000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100044001400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0003028000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0500044000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0003028080000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0500044000400000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0003028100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0500044001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0003028180000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0500044001400000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000300000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000002800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004000100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800000000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004000200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800000002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004000300000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800000002800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002000100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200000000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002000200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200000002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002000300000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200000002800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0006000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0a00000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0006000100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0a00000000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0006000200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0a00000002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0006000300000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0a00000002800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010300000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008002800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004010000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800008000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004010100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800008000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004010200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800008002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004010300000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800008002800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002010000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200008000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002010100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200008000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002010200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200008002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002010300000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200008002800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0006010000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0a00008000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0006010100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0a00008000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0006010200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0a00008002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0006010300000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0a00008002800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000080000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000080000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000080002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040300000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000080002800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004040000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800080000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004040100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800080000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004040200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800080002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004040300000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800080002800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002040000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200080000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002040100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200080000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002040200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200080002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002040300000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200080002800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0006040000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0a00080000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0006040100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0a00080000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0006040200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0a00080002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0006040300000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0a00080002800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000050000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000088000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000050100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000088000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000050200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000088002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000050300000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000088002800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004050000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800088000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004050100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800088000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004050200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800088002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004050300000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800088002800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002050000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200088000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002050100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200088000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002050200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200088002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002050300000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200088002800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0006050000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0a00088000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0006050100000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0a00088000800000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0006050200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0a00088002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0006050300000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0a00088002800000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000004000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000600000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000005000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008000200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1000000001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008000400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1000000004000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008000600000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1000000005000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004000200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400000001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004000400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400000004000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004000600000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400000005000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000c000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1400000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000c000200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1400000001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000c000400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1400000004000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000c000600000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1400000005000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010004000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020600000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010005000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008020000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1000010000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008020200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1000010001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008020400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1000010004000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008020600000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1000010005000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004020000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400010000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004020200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400010001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004020400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400010004000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004020600000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400010005000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000c020000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1400010000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000c020200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1400010001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000c020400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1400010004000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000c020600000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1400010005000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000080000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000100000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000080200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000100001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000080400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000100004000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000080600000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000100005000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008080000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1000100000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008080200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1000100001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008080400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1000100004000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008080600000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1000100005000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004080000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400100000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004080200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400100001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004080400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400100004000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004080600000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400100005000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000c080000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1400100000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000c080200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1400100001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000c080400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1400100004000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000c080600000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1400100005000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000a0000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000110000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000a0200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000110001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000a0400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000110004000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000a0600000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000110005000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00080a0000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1000110000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00080a0200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1000110001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00080a0400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1000110004000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00080a0600000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1000110005000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00040a0000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400110000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00040a0200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400110001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00040a0400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400110004000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00040a0600000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400110005000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000c0a0000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1400110000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000c0a0200000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1400110001000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000c0a0400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1400110004000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000c0a0600000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1400110005000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0010000400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2000000002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008000400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800000002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0018000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2800000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0018000400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2800000002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0010040000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2000020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0010040400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2000020002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008040000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008040400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800020002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0018040000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2800020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0018040400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2800020002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000c00000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0010000800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0010000c00000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2000000002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008000800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008000c00000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800000002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0018000800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2800000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0018000c00000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2800000002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040c00000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0010040800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2000020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0010040c00000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2000020002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008040800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008040c00000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800020002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0018040800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2800020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0018040c00000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2800020002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000100000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000100400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0010100000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0010100400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2000000002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008100000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008100400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800000002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0018100000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2800000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0018100400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2800000002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000140000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000140400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0010140000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2000020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0010140400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2000020002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008140000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008140400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800020002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0018140000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2800020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0018140400000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2800020002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000100800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000100c00000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0010100800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0010100c00000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2000000002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008100800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008100c00000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800000002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0018100800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2800000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0018100c00000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2800000002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000140800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000140c00000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0010140800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2000020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0010140c00000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2000020002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008140800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008140c00000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800020002000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0018140800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2800020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0018140c00000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2800020002000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000004000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0020000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x4000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0020000800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x4000000004000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0010000800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1000000004000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0030000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x5000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0030000800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x5000000004000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000080000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000040000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000080800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000040004000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0020080000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x4000040000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0020080800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x4000040004000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0010080000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1000040000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0010080800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1000040004000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0030080000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x5000040000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0030080800000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x5000040004000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000001000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000008000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000003000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000028000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040001000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8000000008000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040002000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8000000020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040003000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8000000028000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000400000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000401000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800008000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000402000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000403000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800028000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040400000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8000800000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040401000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8000800008000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040402000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8000800020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040403000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8000800028000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000002000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000006000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000050000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080000000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080002000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080004000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0000000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080006000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0000000050000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000800000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000802000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000804000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000806000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000050000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080800000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080802000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0001000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080804000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0001000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080806000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0001000050000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000200000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000202000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000204000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000206000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000050000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080200000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080202000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080204000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0000000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080206000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0000000050000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000a00000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000a02000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000a04000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000a06000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000050000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080a00000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080a02000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0001000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080a04000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0001000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080a06000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0001000050000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040002000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040004000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040006000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000050000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00c0000000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00c0002000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00c0004000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0000000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00c0006000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0000000050000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040800000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040802000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040804000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040806000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000050000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00c0800000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00c0802000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0001000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00c0804000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0001000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00c0806000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0001000050000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040200000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040202000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040204000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040206000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000050000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00c0200000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00c0202000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0000000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00c0204000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0000000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00c0206000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0000000050000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040a00000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040a02000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040a04000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040a06000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000050000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00c0a00000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00c0a02000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0001000010000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00c0a04000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0001000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00c0a06000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0001000050000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000004000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000000c000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000000a0000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0100004000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0000000020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0100008000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0000000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x010000c000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x00000000a0000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080004000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8000000020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080008000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8000000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x008000c000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x80000000a0000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0180000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x8000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0180004000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x8000000020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0180008000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x8000000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x018000c000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x80000000a0000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000400000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000404000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000408000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000040c000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00002000a0000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0100400000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0000200000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0100404000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0000200020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0100408000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0000200080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x010040c000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x00002000a0000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080400000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8000200000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080404000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8000200020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080408000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8000200080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x008040c000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x80002000a0000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0180400000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x8000200000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0180404000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x8000200020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0180408000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x8000200080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x018040c000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x80002000a0000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001004000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001008000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000100c000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00020000a0000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0101000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0101004000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0002000020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0101008000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0002000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x010100c000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x00020000a0000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0081000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8002000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0081004000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8002000020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0081008000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8002000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x008100c000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x80020000a0000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0181000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x8002000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0181004000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x8002000020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0181008000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x8002000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x018100c000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x80020000a0000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001400000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002200000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001404000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002200020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001408000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002200080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000140c000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00022000a0000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0101400000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0002200000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0101404000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0002200020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0101408000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0002200080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x010140c000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x00022000a0000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0081400000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8002200000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0081404000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8002200020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0081408000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8002200080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x008140c000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x80022000a0000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0181400000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x8002200000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0181404000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x8002200020000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0181408000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x8002200080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x018140c000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x80022000a0000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000008000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000018000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000140000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0200008000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0200010000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0200018000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000000140000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0100008000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0000000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0100010000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0000000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0100018000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0000000140000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0300000000000000,
-         ((uint128_t)0x0000000000000005 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0300008000000000,
-         ((uint128_t)0x0000000000000005 << 64) | 0x0000000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0300010000000000,
-         ((uint128_t)0x0000000000000005 << 64) | 0x0000000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0300018000000000,
-         ((uint128_t)0x0000000000000005 << 64) | 0x0000000140000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000800000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000808000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000810000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000818000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400140000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0200800000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000400000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0200808000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000400040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0200810000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000400100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0200818000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000400140000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0100800000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0000400000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0100808000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0000400040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0100810000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0000400100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0100818000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0000400140000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0300800000000000,
-         ((uint128_t)0x0000000000000005 << 64) | 0x0000400000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0300808000000000,
-         ((uint128_t)0x0000000000000005 << 64) | 0x0000400040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0300810000000000,
-         ((uint128_t)0x0000000000000005 << 64) | 0x0000400100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0300818000000000,
-         ((uint128_t)0x0000000000000005 << 64) | 0x0000400140000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002008000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002010000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002018000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000140000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0202000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0202008000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0004000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0202010000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0004000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0202018000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0004000140000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0102000000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0102008000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0004000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0102010000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0004000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0102018000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0004000140000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0302000000000000,
-         ((uint128_t)0x0000000000000005 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0302008000000000,
-         ((uint128_t)0x0000000000000005 << 64) | 0x0004000040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0302010000000000,
-         ((uint128_t)0x0000000000000005 << 64) | 0x0004000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0302018000000000,
-         ((uint128_t)0x0000000000000005 << 64) | 0x0004000140000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002800000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004400000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002808000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004400040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002810000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004400100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002818000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004400140000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0202800000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0004400000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0202808000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0004400040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0202810000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0004400100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0202818000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0004400140000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0102800000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0004400000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0102808000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0004400040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0102810000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0004400100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0102818000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0004400140000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0302800000000000,
-         ((uint128_t)0x0000000000000005 << 64) | 0x0004400000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0302808000000000,
-         ((uint128_t)0x0000000000000005 << 64) | 0x0004400040000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0302810000000000,
-         ((uint128_t)0x0000000000000005 << 64) | 0x0004400100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0302818000000000,
-         ((uint128_t)0x0000000000000005 << 64) | 0x0004400140000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000010000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000030000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000280000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0400010000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0000000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0400020000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0000000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0400030000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0000000280000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0200010000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0000000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0200020000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0000000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0200030000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0000000280000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0600000000000000,
-         ((uint128_t)0x000000000000000a << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0600010000000000,
-         ((uint128_t)0x000000000000000a << 64) | 0x0000000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0600020000000000,
-         ((uint128_t)0x000000000000000a << 64) | 0x0000000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0600030000000000,
-         ((uint128_t)0x000000000000000a << 64) | 0x0000000280000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001010000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001020000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001030000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800280000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0401000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0000800000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0401010000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0000800080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0401020000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0000800200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0401030000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0000800280000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0201000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0000800000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0201010000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0000800080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0201020000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0000800200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0201030000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0000800280000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0601000000000000,
-         ((uint128_t)0x000000000000000a << 64) | 0x0000800000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0601010000000000,
-         ((uint128_t)0x000000000000000a << 64) | 0x0000800080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0601020000000000,
-         ((uint128_t)0x000000000000000a << 64) | 0x0000800200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0601030000000000,
-         ((uint128_t)0x000000000000000a << 64) | 0x0000800280000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004010000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004020000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004030000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000280000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0404000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0404010000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0008000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0404020000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0008000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0404030000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0008000280000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0204000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0204010000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0008000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0204020000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0008000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0204030000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0008000280000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0604000000000000,
-         ((uint128_t)0x000000000000000a << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0604010000000000,
-         ((uint128_t)0x000000000000000a << 64) | 0x0008000080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0604020000000000,
-         ((uint128_t)0x000000000000000a << 64) | 0x0008000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0604030000000000,
-         ((uint128_t)0x000000000000000a << 64) | 0x0008000280000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0005000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008800000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0005010000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008800080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0005020000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008800200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0005030000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008800280000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0405000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0008800000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0405010000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0008800080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0405020000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0008800200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0405030000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0008800280000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0205000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0008800000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0205010000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0008800080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0205020000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0008800200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0205030000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0008800280000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0605000000000000,
-         ((uint128_t)0x000000000000000a << 64) | 0x0008800000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0605010000000000,
-         ((uint128_t)0x000000000000000a << 64) | 0x0008800080000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0605020000000000,
-         ((uint128_t)0x000000000000000a << 64) | 0x0008800200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0605030000000000,
-         ((uint128_t)0x000000000000000a << 64) | 0x0008800280000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000020000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000060000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000500000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0800020000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0800040000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0800060000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000500000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0400020000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0400040000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0400060000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000000500000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0c00000000000000,
-         ((uint128_t)0x0000000000000014 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0c00020000000000,
-         ((uint128_t)0x0000000000000014 << 64) | 0x0000000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0c00040000000000,
-         ((uint128_t)0x0000000000000014 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0c00060000000000,
-         ((uint128_t)0x0000000000000014 << 64) | 0x0000000500000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002020000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002040000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002060000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000500000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0802000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0802020000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0001000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0802040000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0001000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0802060000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0001000500000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0402000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0402020000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0001000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0402040000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0001000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0402060000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0001000500000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0c02000000000000,
-         ((uint128_t)0x0000000000000014 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0c02020000000000,
-         ((uint128_t)0x0000000000000014 << 64) | 0x0001000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0c02040000000000,
-         ((uint128_t)0x0000000000000014 << 64) | 0x0001000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0c02060000000000,
-         ((uint128_t)0x0000000000000014 << 64) | 0x0001000500000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008020000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008040000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008060000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000500000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0808000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0808020000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0010000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0808040000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0010000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0808060000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0010000500000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0408000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0408020000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0010000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0408040000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0010000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0408060000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0010000500000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0c08000000000000,
-         ((uint128_t)0x0000000000000014 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0c08020000000000,
-         ((uint128_t)0x0000000000000014 << 64) | 0x0010000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0c08040000000000,
-         ((uint128_t)0x0000000000000014 << 64) | 0x0010000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0c08060000000000,
-         ((uint128_t)0x0000000000000014 << 64) | 0x0010000500000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000a000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0011000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000a020000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0011000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000a040000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0011000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000a060000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0011000500000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x080a000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0011000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x080a020000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0011000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x080a040000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0011000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x080a060000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0011000500000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x040a000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0011000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x040a020000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0011000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x040a040000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0011000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x040a060000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0011000500000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0c0a000000000000,
-         ((uint128_t)0x0000000000000014 << 64) | 0x0011000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0c0a020000000000,
-         ((uint128_t)0x0000000000000014 << 64) | 0x0011000100000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0c0a040000000000,
-         ((uint128_t)0x0000000000000014 << 64) | 0x0011000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0c0a060000000000,
-         ((uint128_t)0x0000000000000014 << 64) | 0x0011000500000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000040000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000080000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000c0000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000a00000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1000040000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0000000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1000080000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0000000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x10000c0000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0000000a00000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0800040000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0000000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0800080000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0000000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x08000c0000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0000000a00000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1800000000000000,
-         ((uint128_t)0x0000000000000028 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1800040000000000,
-         ((uint128_t)0x0000000000000028 << 64) | 0x0000000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1800080000000000,
-         ((uint128_t)0x0000000000000028 << 64) | 0x0000000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x18000c0000000000,
-         ((uint128_t)0x0000000000000028 << 64) | 0x0000000a00000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004040000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004080000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00040c0000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000a00000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1004000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1004040000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0002000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1004080000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0002000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x10040c0000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0002000a00000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0804000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0804040000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0002000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0804080000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0002000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x08040c0000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0002000a00000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1804000000000000,
-         ((uint128_t)0x0000000000000028 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1804040000000000,
-         ((uint128_t)0x0000000000000028 << 64) | 0x0002000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1804080000000000,
-         ((uint128_t)0x0000000000000028 << 64) | 0x0002000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x18040c0000000000,
-         ((uint128_t)0x0000000000000028 << 64) | 0x0002000a00000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0020000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0010040000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0020000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0010080000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0020000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00100c0000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0020000a00000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1010000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0020000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1010040000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0020000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1010080000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0020000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x10100c0000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0020000a00000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0810000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0020000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0810040000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0020000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0810080000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0020000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x08100c0000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0020000a00000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1810000000000000,
-         ((uint128_t)0x0000000000000028 << 64) | 0x0020000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1810040000000000,
-         ((uint128_t)0x0000000000000028 << 64) | 0x0020000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1810080000000000,
-         ((uint128_t)0x0000000000000028 << 64) | 0x0020000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x18100c0000000000,
-         ((uint128_t)0x0000000000000028 << 64) | 0x0020000a00000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0014000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0022000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0014040000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0022000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0014080000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0022000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00140c0000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0022000a00000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1014000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0022000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1014040000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0022000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1014080000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0022000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x10140c0000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0022000a00000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0814000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0022000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0814040000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0022000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0814080000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0022000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x08140c0000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0022000a00000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1814000000000000,
-         ((uint128_t)0x0000000000000028 << 64) | 0x0022000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1814040000000000,
-         ((uint128_t)0x0000000000000028 << 64) | 0x0022000200000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1814080000000000,
-         ((uint128_t)0x0000000000000028 << 64) | 0x0022000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x18140c0000000000,
-         ((uint128_t)0x0000000000000028 << 64) | 0x0022000a00000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000080000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2000080000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1000080000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x3000000000000000,
-         ((uint128_t)0x0000000000000050 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x3000080000000000,
-         ((uint128_t)0x0000000000000050 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008080000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2008000000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2008080000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0004000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1008000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1008080000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0004000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x3008000000000000,
-         ((uint128_t)0x0000000000000050 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x3008080000000000,
-         ((uint128_t)0x0000000000000050 << 64) | 0x0004000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000100000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000180000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2000100000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2000180000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1000100000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1000180000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x3000100000000000,
-         ((uint128_t)0x0000000000000050 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x3000180000000000,
-         ((uint128_t)0x0000000000000050 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008100000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008180000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2008100000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2008180000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0004000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1008100000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1008180000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0004000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x3008100000000000,
-         ((uint128_t)0x0000000000000050 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x3008180000000000,
-         ((uint128_t)0x0000000000000050 << 64) | 0x0004000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0020000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0020080000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2020000000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2020080000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1020000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1020080000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x3020000000000000,
-         ((uint128_t)0x0000000000000050 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x3020080000000000,
-         ((uint128_t)0x0000000000000050 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0028000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0028080000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2028000000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2028080000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0004000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1028000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1028080000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0004000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x3028000000000000,
-         ((uint128_t)0x0000000000000050 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x3028080000000000,
-         ((uint128_t)0x0000000000000050 << 64) | 0x0004000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0020100000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0020180000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2020100000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2020180000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1020100000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1020180000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x3020100000000000,
-         ((uint128_t)0x0000000000000050 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x3020180000000000,
-         ((uint128_t)0x0000000000000050 << 64) | 0x0000000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0028100000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0028180000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2028100000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2028180000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0004000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1028100000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1028180000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0004000400000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x3028100000000000,
-         ((uint128_t)0x0000000000000050 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x3028180000000000,
-         ((uint128_t)0x0000000000000050 << 64) | 0x0004000400000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000100000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x4000000000000000,
-         ((uint128_t)0x0000000000000080 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x4000100000000000,
-         ((uint128_t)0x0000000000000080 << 64) | 0x0000000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2000100000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0000000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x6000000000000000,
-         ((uint128_t)0x00000000000000a0 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x6000100000000000,
-         ((uint128_t)0x00000000000000a0 << 64) | 0x0000000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0010100000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x4010000000000000,
-         ((uint128_t)0x0000000000000080 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x4010100000000000,
-         ((uint128_t)0x0000000000000080 << 64) | 0x0008000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2010000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2010100000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0008000800000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x6010000000000000,
-         ((uint128_t)0x00000000000000a0 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x6010100000000000,
-         ((uint128_t)0x00000000000000a0 << 64) | 0x0008000800000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000200000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000001000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000400000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000600000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000005000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8000000000000000,
-         ((uint128_t)0x0000000000000100 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8000200000000000,
-         ((uint128_t)0x0000000000000100 << 64) | 0x0000001000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8000400000000000,
-         ((uint128_t)0x0000000000000100 << 64) | 0x0000004000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8000600000000000,
-         ((uint128_t)0x0000000000000100 << 64) | 0x0000005000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080200000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100001000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080400000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100004000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080600000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100005000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8080000000000000,
-         ((uint128_t)0x0000000000000100 << 64) | 0x0100000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8080200000000000,
-         ((uint128_t)0x0000000000000100 << 64) | 0x0100001000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8080400000000000,
-         ((uint128_t)0x0000000000000100 << 64) | 0x0100004000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8080600000000000,
-         ((uint128_t)0x0000000000000100 << 64) | 0x0100005000000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000400000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000800000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000c00000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000a000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0000400000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0000002000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0000800000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0000008000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0000c00000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x000000a000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0100400000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200002000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0100800000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200008000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0100c00000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x020000a000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0200000000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0100400000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0200002000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0100800000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0200008000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0100c00000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x020000a000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040400000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040800000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040c00000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000a000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0040000000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0040400000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0000002000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0040800000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0000008000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0040c00000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x000000a000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0140000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0140400000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200002000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0140800000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200008000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0140c00000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x020000a000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0140000000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0200000000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0140400000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0200002000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0140800000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0200008000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0140c00000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x020000a000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8000400000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8000800000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8000c00000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000a000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x8000000000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x8000400000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0000002000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x8000800000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0000008000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x8000c00000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x000000a000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8100000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8100400000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200002000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8100800000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200008000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8100c00000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x020000a000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x8100000000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0200000000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x8100400000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0200002000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x8100800000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0200008000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x8100c00000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x020000a000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8040000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8040400000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000002000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8040800000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8040c00000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000000a000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x8040000000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x8040400000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0000002000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x8040800000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0000008000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x8040c00000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x000000a000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8140000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8140400000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200002000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8140800000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200008000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8140c00000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x020000a000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x8140000000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0200000000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x8140400000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0200002000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x8140800000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0200008000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x8140c00000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x020000a000000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000800000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000004000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001800000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000014000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0000800000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0000004000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0001000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0000010000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0001800000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0000014000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000100 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0000800000000000,
-         ((uint128_t)0x0000000000000100 << 64) | 0x0000004000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0001000000000000,
-         ((uint128_t)0x0000000000000100 << 64) | 0x0000010000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0001800000000000,
-         ((uint128_t)0x0000000000000100 << 64) | 0x0000014000000000},
-        {((uint128_t)0x0000000000000003 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000500 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000003 << 64) | 0x0000800000000000,
-         ((uint128_t)0x0000000000000500 << 64) | 0x0000004000000000},
-        {((uint128_t)0x0000000000000003 << 64) | 0x0001000000000000,
-         ((uint128_t)0x0000000000000500 << 64) | 0x0000010000000000},
-        {((uint128_t)0x0000000000000003 << 64) | 0x0001800000000000,
-         ((uint128_t)0x0000000000000500 << 64) | 0x0000014000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080800000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040004000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0081000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040010000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0081800000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040014000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0080000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0040000000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0080800000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0040004000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0081000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0040010000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0081800000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0040014000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0080000000000000,
-         ((uint128_t)0x0000000000000100 << 64) | 0x0040000000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0080800000000000,
-         ((uint128_t)0x0000000000000100 << 64) | 0x0040004000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0081000000000000,
-         ((uint128_t)0x0000000000000100 << 64) | 0x0040010000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0081800000000000,
-         ((uint128_t)0x0000000000000100 << 64) | 0x0040014000000000},
-        {((uint128_t)0x0000000000000003 << 64) | 0x0080000000000000,
-         ((uint128_t)0x0000000000000500 << 64) | 0x0040000000000000},
-        {((uint128_t)0x0000000000000003 << 64) | 0x0080800000000000,
-         ((uint128_t)0x0000000000000500 << 64) | 0x0040004000000000},
-        {((uint128_t)0x0000000000000003 << 64) | 0x0081000000000000,
-         ((uint128_t)0x0000000000000500 << 64) | 0x0040010000000000},
-        {((uint128_t)0x0000000000000003 << 64) | 0x0081800000000000,
-         ((uint128_t)0x0000000000000500 << 64) | 0x0040014000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0200800000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400004000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0201000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400010000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0201800000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400014000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0400000000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0200800000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0400004000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0201000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0400010000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0201800000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0400014000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000100 << 64) | 0x0400000000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0200800000000000,
-         ((uint128_t)0x0000000000000100 << 64) | 0x0400004000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0201000000000000,
-         ((uint128_t)0x0000000000000100 << 64) | 0x0400010000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0201800000000000,
-         ((uint128_t)0x0000000000000100 << 64) | 0x0400014000000000},
-        {((uint128_t)0x0000000000000003 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000500 << 64) | 0x0400000000000000},
-        {((uint128_t)0x0000000000000003 << 64) | 0x0200800000000000,
-         ((uint128_t)0x0000000000000500 << 64) | 0x0400004000000000},
-        {((uint128_t)0x0000000000000003 << 64) | 0x0201000000000000,
-         ((uint128_t)0x0000000000000500 << 64) | 0x0400010000000000},
-        {((uint128_t)0x0000000000000003 << 64) | 0x0201800000000000,
-         ((uint128_t)0x0000000000000500 << 64) | 0x0400014000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0280000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0440000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0280800000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0440004000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0281000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0440010000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0281800000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0440014000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0280000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0440000000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0280800000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0440004000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0281000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0440010000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0281800000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0440014000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0280000000000000,
-         ((uint128_t)0x0000000000000100 << 64) | 0x0440000000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0280800000000000,
-         ((uint128_t)0x0000000000000100 << 64) | 0x0440004000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0281000000000000,
-         ((uint128_t)0x0000000000000100 << 64) | 0x0440010000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0281800000000000,
-         ((uint128_t)0x0000000000000100 << 64) | 0x0440014000000000},
-        {((uint128_t)0x0000000000000003 << 64) | 0x0280000000000000,
-         ((uint128_t)0x0000000000000500 << 64) | 0x0440000000000000},
-        {((uint128_t)0x0000000000000003 << 64) | 0x0280800000000000,
-         ((uint128_t)0x0000000000000500 << 64) | 0x0440004000000000},
-        {((uint128_t)0x0000000000000003 << 64) | 0x0281000000000000,
-         ((uint128_t)0x0000000000000500 << 64) | 0x0440010000000000},
-        {((uint128_t)0x0000000000000003 << 64) | 0x0281800000000000,
-         ((uint128_t)0x0000000000000500 << 64) | 0x0440014000000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0001000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000008000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0003000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000028000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0001000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0000008000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0002000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0000020000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0003000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0000028000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0001000000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0000008000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0002000000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0000020000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0003000000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0000028000000000},
-        {((uint128_t)0x0000000000000006 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000a00 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000006 << 64) | 0x0001000000000000,
-         ((uint128_t)0x0000000000000a00 << 64) | 0x0000008000000000},
-        {((uint128_t)0x0000000000000006 << 64) | 0x0002000000000000,
-         ((uint128_t)0x0000000000000a00 << 64) | 0x0000020000000000},
-        {((uint128_t)0x0000000000000006 << 64) | 0x0003000000000000,
-         ((uint128_t)0x0000000000000a00 << 64) | 0x0000028000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0101000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080008000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0102000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0103000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080028000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0080000000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0101000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0080008000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0102000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0080020000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0103000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0080028000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0080000000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0101000000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0080008000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0102000000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0080020000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0103000000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0080028000000000},
-        {((uint128_t)0x0000000000000006 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000a00 << 64) | 0x0080000000000000},
-        {((uint128_t)0x0000000000000006 << 64) | 0x0101000000000000,
-         ((uint128_t)0x0000000000000a00 << 64) | 0x0080008000000000},
-        {((uint128_t)0x0000000000000006 << 64) | 0x0102000000000000,
-         ((uint128_t)0x0000000000000a00 << 64) | 0x0080020000000000},
-        {((uint128_t)0x0000000000000006 << 64) | 0x0103000000000000,
-         ((uint128_t)0x0000000000000a00 << 64) | 0x0080028000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0401000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800008000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0402000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0403000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800028000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0401000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0800008000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0402000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0800020000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0403000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0800028000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0401000000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0800008000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0402000000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0800020000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0403000000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0800028000000000},
-        {((uint128_t)0x0000000000000006 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000a00 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000000006 << 64) | 0x0401000000000000,
-         ((uint128_t)0x0000000000000a00 << 64) | 0x0800008000000000},
-        {((uint128_t)0x0000000000000006 << 64) | 0x0402000000000000,
-         ((uint128_t)0x0000000000000a00 << 64) | 0x0800020000000000},
-        {((uint128_t)0x0000000000000006 << 64) | 0x0403000000000000,
-         ((uint128_t)0x0000000000000a00 << 64) | 0x0800028000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0500000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0880000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0501000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0880008000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0502000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0880020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0503000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0880028000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0500000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0880000000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0501000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0880008000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0502000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0880020000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0503000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0880028000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0500000000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0880000000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0501000000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0880008000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0502000000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0880020000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0503000000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0880028000000000},
-        {((uint128_t)0x0000000000000006 << 64) | 0x0500000000000000,
-         ((uint128_t)0x0000000000000a00 << 64) | 0x0880000000000000},
-        {((uint128_t)0x0000000000000006 << 64) | 0x0501000000000000,
-         ((uint128_t)0x0000000000000a00 << 64) | 0x0880008000000000},
-        {((uint128_t)0x0000000000000006 << 64) | 0x0502000000000000,
-         ((uint128_t)0x0000000000000a00 << 64) | 0x0880020000000000},
-        {((uint128_t)0x0000000000000006 << 64) | 0x0503000000000000,
-         ((uint128_t)0x0000000000000a00 << 64) | 0x0880028000000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0002000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000010000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000040000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0006000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000050000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0002000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x0000010000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0004000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x0000040000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0006000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x0000050000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0002000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0000010000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0004000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0000040000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0006000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0000050000000000},
-        {((uint128_t)0x000000000000000c << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000001400 << 64) | 0x0000000000000000},
-        {((uint128_t)0x000000000000000c << 64) | 0x0002000000000000,
-         ((uint128_t)0x0000000000001400 << 64) | 0x0000010000000000},
-        {((uint128_t)0x000000000000000c << 64) | 0x0004000000000000,
-         ((uint128_t)0x0000000000001400 << 64) | 0x0000040000000000},
-        {((uint128_t)0x000000000000000c << 64) | 0x0006000000000000,
-         ((uint128_t)0x0000000000001400 << 64) | 0x0000050000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0202000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100010000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0204000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100040000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0206000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100050000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x0100000000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0202000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x0100010000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0204000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x0100040000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0206000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x0100050000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0100000000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0202000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0100010000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0204000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0100040000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0206000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0100050000000000},
-        {((uint128_t)0x000000000000000c << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000001400 << 64) | 0x0100000000000000},
-        {((uint128_t)0x000000000000000c << 64) | 0x0202000000000000,
-         ((uint128_t)0x0000000000001400 << 64) | 0x0100010000000000},
-        {((uint128_t)0x000000000000000c << 64) | 0x0204000000000000,
-         ((uint128_t)0x0000000000001400 << 64) | 0x0100040000000000},
-        {((uint128_t)0x000000000000000c << 64) | 0x0206000000000000,
-         ((uint128_t)0x0000000000001400 << 64) | 0x0100050000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0802000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1000010000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0804000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1000040000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0806000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1000050000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x1000000000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0802000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x1000010000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0804000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x1000040000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0806000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x1000050000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x1000000000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0802000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x1000010000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0804000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x1000040000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0806000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x1000050000000000},
-        {((uint128_t)0x000000000000000c << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000001400 << 64) | 0x1000000000000000},
-        {((uint128_t)0x000000000000000c << 64) | 0x0802000000000000,
-         ((uint128_t)0x0000000000001400 << 64) | 0x1000010000000000},
-        {((uint128_t)0x000000000000000c << 64) | 0x0804000000000000,
-         ((uint128_t)0x0000000000001400 << 64) | 0x1000040000000000},
-        {((uint128_t)0x000000000000000c << 64) | 0x0806000000000000,
-         ((uint128_t)0x0000000000001400 << 64) | 0x1000050000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0a00000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1100000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0a02000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1100010000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0a04000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1100040000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0a06000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1100050000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0a00000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x1100000000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0a02000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x1100010000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0a04000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x1100040000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0a06000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x1100050000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0a00000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x1100000000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0a02000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x1100010000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0a04000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x1100040000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0a06000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x1100050000000000},
-        {((uint128_t)0x000000000000000c << 64) | 0x0a00000000000000,
-         ((uint128_t)0x0000000000001400 << 64) | 0x1100000000000000},
-        {((uint128_t)0x000000000000000c << 64) | 0x0a02000000000000,
-         ((uint128_t)0x0000000000001400 << 64) | 0x1100010000000000},
-        {((uint128_t)0x000000000000000c << 64) | 0x0a04000000000000,
-         ((uint128_t)0x0000000000001400 << 64) | 0x1100040000000000},
-        {((uint128_t)0x000000000000000c << 64) | 0x0a06000000000000,
-         ((uint128_t)0x0000000000001400 << 64) | 0x1100050000000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0004000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000080000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x000c000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x00000a0000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x0004000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0000020000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x0008000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0000080000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x000c000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x00000a0000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0004000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0000020000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0008000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0000080000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x000c000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x00000a0000000000},
-        {((uint128_t)0x0000000000000018 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000002800 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000018 << 64) | 0x0004000000000000,
-         ((uint128_t)0x0000000000002800 << 64) | 0x0000020000000000},
-        {((uint128_t)0x0000000000000018 << 64) | 0x0008000000000000,
-         ((uint128_t)0x0000000000002800 << 64) | 0x0000080000000000},
-        {((uint128_t)0x0000000000000018 << 64) | 0x000c000000000000,
-         ((uint128_t)0x0000000000002800 << 64) | 0x00000a0000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0404000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0408000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200080000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x040c000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x02000a0000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0200000000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x0404000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0200020000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x0408000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0200080000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x040c000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x02000a0000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0200000000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0404000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0200020000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0408000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0200080000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x040c000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x02000a0000000000},
-        {((uint128_t)0x0000000000000018 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000002800 << 64) | 0x0200000000000000},
-        {((uint128_t)0x0000000000000018 << 64) | 0x0404000000000000,
-         ((uint128_t)0x0000000000002800 << 64) | 0x0200020000000000},
-        {((uint128_t)0x0000000000000018 << 64) | 0x0408000000000000,
-         ((uint128_t)0x0000000000002800 << 64) | 0x0200080000000000},
-        {((uint128_t)0x0000000000000018 << 64) | 0x040c000000000000,
-         ((uint128_t)0x0000000000002800 << 64) | 0x02000a0000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1004000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2000020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1008000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2000080000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x100c000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x20000a0000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x2000000000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x1004000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x2000020000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x1008000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x2000080000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x100c000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x20000a0000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x2000000000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x1004000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x2000020000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x1008000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x2000080000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x100c000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x20000a0000000000},
-        {((uint128_t)0x0000000000000018 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000002800 << 64) | 0x2000000000000000},
-        {((uint128_t)0x0000000000000018 << 64) | 0x1004000000000000,
-         ((uint128_t)0x0000000000002800 << 64) | 0x2000020000000000},
-        {((uint128_t)0x0000000000000018 << 64) | 0x1008000000000000,
-         ((uint128_t)0x0000000000002800 << 64) | 0x2000080000000000},
-        {((uint128_t)0x0000000000000018 << 64) | 0x100c000000000000,
-         ((uint128_t)0x0000000000002800 << 64) | 0x20000a0000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1400000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2200000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1404000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2200020000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1408000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2200080000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x140c000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x22000a0000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x1400000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x2200000000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x1404000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x2200020000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x1408000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x2200080000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x140c000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x22000a0000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x1400000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x2200000000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x1404000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x2200020000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x1408000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x2200080000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x140c000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x22000a0000000000},
-        {((uint128_t)0x0000000000000018 << 64) | 0x1400000000000000,
-         ((uint128_t)0x0000000000002800 << 64) | 0x2200000000000000},
-        {((uint128_t)0x0000000000000018 << 64) | 0x1404000000000000,
-         ((uint128_t)0x0000000000002800 << 64) | 0x2200020000000000},
-        {((uint128_t)0x0000000000000018 << 64) | 0x1408000000000000,
-         ((uint128_t)0x0000000000002800 << 64) | 0x2200080000000000},
-        {((uint128_t)0x0000000000000018 << 64) | 0x140c000000000000,
-         ((uint128_t)0x0000000000002800 << 64) | 0x22000a0000000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0008000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000040000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000100000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0018000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000140000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000004000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x0008000000000000,
-         ((uint128_t)0x0000000000004000 << 64) | 0x0000040000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x0010000000000000,
-         ((uint128_t)0x0000000000004000 << 64) | 0x0000100000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x0018000000000000,
-         ((uint128_t)0x0000000000004000 << 64) | 0x0000140000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x0008000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x0000040000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x0010000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x0000100000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x0018000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x0000140000000000},
-        {((uint128_t)0x0000000000000030 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000005000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000030 << 64) | 0x0008000000000000,
-         ((uint128_t)0x0000000000005000 << 64) | 0x0000040000000000},
-        {((uint128_t)0x0000000000000030 << 64) | 0x0010000000000000,
-         ((uint128_t)0x0000000000005000 << 64) | 0x0000100000000000},
-        {((uint128_t)0x0000000000000030 << 64) | 0x0018000000000000,
-         ((uint128_t)0x0000000000005000 << 64) | 0x0000140000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0808000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400040000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0810000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400100000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0818000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400140000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000004000 << 64) | 0x0400000000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x0808000000000000,
-         ((uint128_t)0x0000000000004000 << 64) | 0x0400040000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x0810000000000000,
-         ((uint128_t)0x0000000000004000 << 64) | 0x0400100000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x0818000000000000,
-         ((uint128_t)0x0000000000004000 << 64) | 0x0400140000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x0400000000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x0808000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x0400040000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x0810000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x0400100000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x0818000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x0400140000000000},
-        {((uint128_t)0x0000000000000030 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000005000 << 64) | 0x0400000000000000},
-        {((uint128_t)0x0000000000000030 << 64) | 0x0808000000000000,
-         ((uint128_t)0x0000000000005000 << 64) | 0x0400040000000000},
-        {((uint128_t)0x0000000000000030 << 64) | 0x0810000000000000,
-         ((uint128_t)0x0000000000005000 << 64) | 0x0400100000000000},
-        {((uint128_t)0x0000000000000030 << 64) | 0x0818000000000000,
-         ((uint128_t)0x0000000000005000 << 64) | 0x0400140000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x4000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2008000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x4000040000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2010000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x4000100000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2018000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x4000140000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000004000 << 64) | 0x4000000000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x2008000000000000,
-         ((uint128_t)0x0000000000004000 << 64) | 0x4000040000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x2010000000000000,
-         ((uint128_t)0x0000000000004000 << 64) | 0x4000100000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x2018000000000000,
-         ((uint128_t)0x0000000000004000 << 64) | 0x4000140000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x4000000000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x2008000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x4000040000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x2010000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x4000100000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x2018000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x4000140000000000},
-        {((uint128_t)0x0000000000000030 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000005000 << 64) | 0x4000000000000000},
-        {((uint128_t)0x0000000000000030 << 64) | 0x2008000000000000,
-         ((uint128_t)0x0000000000005000 << 64) | 0x4000040000000000},
-        {((uint128_t)0x0000000000000030 << 64) | 0x2010000000000000,
-         ((uint128_t)0x0000000000005000 << 64) | 0x4000100000000000},
-        {((uint128_t)0x0000000000000030 << 64) | 0x2018000000000000,
-         ((uint128_t)0x0000000000005000 << 64) | 0x4000140000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2800000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x4400000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2808000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x4400040000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2810000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x4400100000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2818000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x4400140000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x2800000000000000,
-         ((uint128_t)0x0000000000004000 << 64) | 0x4400000000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x2808000000000000,
-         ((uint128_t)0x0000000000004000 << 64) | 0x4400040000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x2810000000000000,
-         ((uint128_t)0x0000000000004000 << 64) | 0x4400100000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x2818000000000000,
-         ((uint128_t)0x0000000000004000 << 64) | 0x4400140000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x2800000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x4400000000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x2808000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x4400040000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x2810000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x4400100000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x2818000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x4400140000000000},
-        {((uint128_t)0x0000000000000030 << 64) | 0x2800000000000000,
-         ((uint128_t)0x0000000000005000 << 64) | 0x4400000000000000},
-        {((uint128_t)0x0000000000000030 << 64) | 0x2808000000000000,
-         ((uint128_t)0x0000000000005000 << 64) | 0x4400040000000000},
-        {((uint128_t)0x0000000000000030 << 64) | 0x2810000000000000,
-         ((uint128_t)0x0000000000005000 << 64) | 0x4400100000000000},
-        {((uint128_t)0x0000000000000030 << 64) | 0x2818000000000000,
-         ((uint128_t)0x0000000000005000 << 64) | 0x4400140000000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000080000000000},
-        {((uint128_t)0x0000000000000040 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000008000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000040 << 64) | 0x0010000000000000,
-         ((uint128_t)0x0000000000008000 << 64) | 0x0000080000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x0010000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0000080000000000},
-        {((uint128_t)0x0000000000000060 << 64) | 0x0000000000000000,
-         ((uint128_t)0x000000000000a000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000060 << 64) | 0x0010000000000000,
-         ((uint128_t)0x000000000000a000 << 64) | 0x0000080000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1010000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800080000000000},
-        {((uint128_t)0x0000000000000040 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000008000 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000000040 << 64) | 0x1010000000000000,
-         ((uint128_t)0x0000000000008000 << 64) | 0x0800080000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x1010000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0800080000000000},
-        {((uint128_t)0x0000000000000060 << 64) | 0x1000000000000000,
-         ((uint128_t)0x000000000000a000 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000000060 << 64) | 0x1010000000000000,
-         ((uint128_t)0x000000000000a000 << 64) | 0x0800080000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0020000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0030000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000080000000000},
-        {((uint128_t)0x0000000000000040 << 64) | 0x0020000000000000,
-         ((uint128_t)0x0000000000008000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000040 << 64) | 0x0030000000000000,
-         ((uint128_t)0x0000000000008000 << 64) | 0x0000080000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x0020000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x0030000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0000080000000000},
-        {((uint128_t)0x0000000000000060 << 64) | 0x0020000000000000,
-         ((uint128_t)0x000000000000a000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000060 << 64) | 0x0030000000000000,
-         ((uint128_t)0x000000000000a000 << 64) | 0x0000080000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1020000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1030000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800080000000000},
-        {((uint128_t)0x0000000000000040 << 64) | 0x1020000000000000,
-         ((uint128_t)0x0000000000008000 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000000040 << 64) | 0x1030000000000000,
-         ((uint128_t)0x0000000000008000 << 64) | 0x0800080000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x1020000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x1030000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0800080000000000},
-        {((uint128_t)0x0000000000000060 << 64) | 0x1020000000000000,
-         ((uint128_t)0x000000000000a000 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000000060 << 64) | 0x1030000000000000,
-         ((uint128_t)0x000000000000a000 << 64) | 0x0800080000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x4000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x4010000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000080000000000},
-        {((uint128_t)0x0000000000000040 << 64) | 0x4000000000000000,
-         ((uint128_t)0x0000000000008000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000040 << 64) | 0x4010000000000000,
-         ((uint128_t)0x0000000000008000 << 64) | 0x0000080000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x4000000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x4010000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0000080000000000},
-        {((uint128_t)0x0000000000000060 << 64) | 0x4000000000000000,
-         ((uint128_t)0x000000000000a000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000060 << 64) | 0x4010000000000000,
-         ((uint128_t)0x000000000000a000 << 64) | 0x0000080000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x5000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x5010000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800080000000000},
-        {((uint128_t)0x0000000000000040 << 64) | 0x5000000000000000,
-         ((uint128_t)0x0000000000008000 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000000040 << 64) | 0x5010000000000000,
-         ((uint128_t)0x0000000000008000 << 64) | 0x0800080000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x5000000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x5010000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0800080000000000},
-        {((uint128_t)0x0000000000000060 << 64) | 0x5000000000000000,
-         ((uint128_t)0x000000000000a000 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000000060 << 64) | 0x5010000000000000,
-         ((uint128_t)0x000000000000a000 << 64) | 0x0800080000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x4020000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x4030000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000080000000000},
-        {((uint128_t)0x0000000000000040 << 64) | 0x4020000000000000,
-         ((uint128_t)0x0000000000008000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000040 << 64) | 0x4030000000000000,
-         ((uint128_t)0x0000000000008000 << 64) | 0x0000080000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x4020000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x4030000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0000080000000000},
-        {((uint128_t)0x0000000000000060 << 64) | 0x4020000000000000,
-         ((uint128_t)0x000000000000a000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000060 << 64) | 0x4030000000000000,
-         ((uint128_t)0x000000000000a000 << 64) | 0x0000080000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x5020000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x5030000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800080000000000},
-        {((uint128_t)0x0000000000000040 << 64) | 0x5020000000000000,
-         ((uint128_t)0x0000000000008000 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000000040 << 64) | 0x5030000000000000,
-         ((uint128_t)0x0000000000008000 << 64) | 0x0800080000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x5020000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x5030000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0800080000000000},
-        {((uint128_t)0x0000000000000060 << 64) | 0x5020000000000000,
-         ((uint128_t)0x000000000000a000 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000000060 << 64) | 0x5030000000000000,
-         ((uint128_t)0x000000000000a000 << 64) | 0x0800080000000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0020000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000100000000000},
-        {((uint128_t)0x0000000000000080 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000010000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000080 << 64) | 0x0020000000000000,
-         ((uint128_t)0x0000000000010000 << 64) | 0x0000100000000000},
-        {((uint128_t)0x0000000000000040 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000004000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000040 << 64) | 0x0020000000000000,
-         ((uint128_t)0x0000000000004000 << 64) | 0x0000100000000000},
-        {((uint128_t)0x00000000000000c0 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000014000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x00000000000000c0 << 64) | 0x0020000000000000,
-         ((uint128_t)0x0000000000014000 << 64) | 0x0000100000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2020000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1000100000000000},
-        {((uint128_t)0x0000000000000080 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000010000 << 64) | 0x1000000000000000},
-        {((uint128_t)0x0000000000000080 << 64) | 0x2020000000000000,
-         ((uint128_t)0x0000000000010000 << 64) | 0x1000100000000000},
-        {((uint128_t)0x0000000000000040 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000004000 << 64) | 0x1000000000000000},
-        {((uint128_t)0x0000000000000040 << 64) | 0x2020000000000000,
-         ((uint128_t)0x0000000000004000 << 64) | 0x1000100000000000},
-        {((uint128_t)0x00000000000000c0 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000014000 << 64) | 0x1000000000000000},
-        {((uint128_t)0x00000000000000c0 << 64) | 0x2020000000000000,
-         ((uint128_t)0x0000000000014000 << 64) | 0x1000100000000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0040000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00c0000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000a00000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0040000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0000200000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0080000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0000800000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x00c0000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0000a00000000000},
-        {((uint128_t)0x0000000000000100 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000100 << 64) | 0x0040000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000200000000000},
-        {((uint128_t)0x0000000000000100 << 64) | 0x0080000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800000000000},
-        {((uint128_t)0x0000000000000100 << 64) | 0x00c0000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000a00000000000},
-        {((uint128_t)0x0000000000000101 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000101 << 64) | 0x0040000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0000200000000000},
-        {((uint128_t)0x0000000000000101 << 64) | 0x0080000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0000800000000000},
-        {((uint128_t)0x0000000000000101 << 64) | 0x00c0000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0000a00000000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0080000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0180000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001400000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0080000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000400000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0180000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0001400000000000},
-        {((uint128_t)0x0000000000000100 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000100 << 64) | 0x0080000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000000000},
-        {((uint128_t)0x0000000000000100 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000100 << 64) | 0x0180000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001400000000000},
-        {((uint128_t)0x0000000000000102 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000102 << 64) | 0x0080000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000400000000000},
-        {((uint128_t)0x0000000000000102 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000102 << 64) | 0x0180000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0001400000000000},
-        {((uint128_t)0x0000000000000200 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000200 << 64) | 0x0080000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000000000},
-        {((uint128_t)0x0000000000000200 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000200 << 64) | 0x0180000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001400000000000},
-        {((uint128_t)0x0000000000000202 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000202 << 64) | 0x0080000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000400000000000},
-        {((uint128_t)0x0000000000000202 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000202 << 64) | 0x0180000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0001400000000000},
-        {((uint128_t)0x0000000000000300 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000300 << 64) | 0x0080000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000000000},
-        {((uint128_t)0x0000000000000300 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000300 << 64) | 0x0180000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001400000000000},
-        {((uint128_t)0x0000000000000302 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000302 << 64) | 0x0080000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000400000000000},
-        {((uint128_t)0x0000000000000302 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000302 << 64) | 0x0180000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0001400000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8080000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8100000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8180000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001400000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x8000000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x8080000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000400000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x8100000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x8180000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0001400000000000},
-        {((uint128_t)0x0000000000000100 << 64) | 0x8000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000100 << 64) | 0x8080000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000000000},
-        {((uint128_t)0x0000000000000100 << 64) | 0x8100000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000100 << 64) | 0x8180000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001400000000000},
-        {((uint128_t)0x0000000000000102 << 64) | 0x8000000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000102 << 64) | 0x8080000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000400000000000},
-        {((uint128_t)0x0000000000000102 << 64) | 0x8100000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000102 << 64) | 0x8180000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0001400000000000},
-        {((uint128_t)0x0000000000000200 << 64) | 0x8000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000200 << 64) | 0x8080000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000000000},
-        {((uint128_t)0x0000000000000200 << 64) | 0x8100000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000200 << 64) | 0x8180000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001400000000000},
-        {((uint128_t)0x0000000000000202 << 64) | 0x8000000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000202 << 64) | 0x8080000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000400000000000},
-        {((uint128_t)0x0000000000000202 << 64) | 0x8100000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000202 << 64) | 0x8180000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0001400000000000},
-        {((uint128_t)0x0000000000000300 << 64) | 0x8000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000300 << 64) | 0x8080000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000400000000000},
-        {((uint128_t)0x0000000000000300 << 64) | 0x8100000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000300 << 64) | 0x8180000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001400000000000},
-        {((uint128_t)0x0000000000000302 << 64) | 0x8000000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000302 << 64) | 0x8080000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000400000000000},
-        {((uint128_t)0x0000000000000302 << 64) | 0x8100000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000302 << 64) | 0x8180000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0001400000000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0300000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002800000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8000000000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8000800000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8002000000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0300000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8002800000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0000800000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0300000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0002800000000000},
-        {((uint128_t)0x0000000000000005 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x8000000000000000},
-        {((uint128_t)0x0000000000000005 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x8000800000000000},
-        {((uint128_t)0x0000000000000005 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x8002000000000000},
-        {((uint128_t)0x0000000000000005 << 64) | 0x0300000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x8002800000000000},
-        {((uint128_t)0x0000000000000200 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000200 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800000000000},
-        {((uint128_t)0x0000000000000200 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000000200 << 64) | 0x0300000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002800000000000},
-        {((uint128_t)0x0000000000000201 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8000000000000000},
-        {((uint128_t)0x0000000000000201 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8000800000000000},
-        {((uint128_t)0x0000000000000201 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8002000000000000},
-        {((uint128_t)0x0000000000000201 << 64) | 0x0300000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8002800000000000},
-        {((uint128_t)0x0000000000000204 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000204 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0000800000000000},
-        {((uint128_t)0x0000000000000204 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000000204 << 64) | 0x0300000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0002800000000000},
-        {((uint128_t)0x0000000000000205 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x8000000000000000},
-        {((uint128_t)0x0000000000000205 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x8000800000000000},
-        {((uint128_t)0x0000000000000205 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x8002000000000000},
-        {((uint128_t)0x0000000000000205 << 64) | 0x0300000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x8002800000000000},
-        {((uint128_t)0x0000000000000400 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000400 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800000000000},
-        {((uint128_t)0x0000000000000400 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000000400 << 64) | 0x0300000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002800000000000},
-        {((uint128_t)0x0000000000000401 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8000000000000000},
-        {((uint128_t)0x0000000000000401 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8000800000000000},
-        {((uint128_t)0x0000000000000401 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8002000000000000},
-        {((uint128_t)0x0000000000000401 << 64) | 0x0300000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8002800000000000},
-        {((uint128_t)0x0000000000000404 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000404 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0000800000000000},
-        {((uint128_t)0x0000000000000404 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000000404 << 64) | 0x0300000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0002800000000000},
-        {((uint128_t)0x0000000000000405 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x8000000000000000},
-        {((uint128_t)0x0000000000000405 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x8000800000000000},
-        {((uint128_t)0x0000000000000405 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x8002000000000000},
-        {((uint128_t)0x0000000000000405 << 64) | 0x0300000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x8002800000000000},
-        {((uint128_t)0x0000000000000600 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000600 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000800000000000},
-        {((uint128_t)0x0000000000000600 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000000600 << 64) | 0x0300000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002800000000000},
-        {((uint128_t)0x0000000000000601 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8000000000000000},
-        {((uint128_t)0x0000000000000601 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8000800000000000},
-        {((uint128_t)0x0000000000000601 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8002000000000000},
-        {((uint128_t)0x0000000000000601 << 64) | 0x0300000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x8002800000000000},
-        {((uint128_t)0x0000000000000604 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000604 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0000800000000000},
-        {((uint128_t)0x0000000000000604 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000000604 << 64) | 0x0300000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0002800000000000},
-        {((uint128_t)0x0000000000000605 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x8000000000000000},
-        {((uint128_t)0x0000000000000605 << 64) | 0x0100000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x8000800000000000},
-        {((uint128_t)0x0000000000000605 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x8002000000000000},
-        {((uint128_t)0x0000000000000605 << 64) | 0x0300000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x8002800000000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0600000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0005000000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0600000000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0005000000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0600000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0005000000000000},
-        {((uint128_t)0x000000000000000a << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000011 << 64) | 0x0000000000000000},
-        {((uint128_t)0x000000000000000a << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000011 << 64) | 0x0001000000000000},
-        {((uint128_t)0x000000000000000a << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000011 << 64) | 0x0004000000000000},
-        {((uint128_t)0x000000000000000a << 64) | 0x0600000000000000,
-         ((uint128_t)0x0000000000000011 << 64) | 0x0005000000000000},
-        {((uint128_t)0x0000000000000400 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000400 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000400 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000400 << 64) | 0x0600000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0005000000000000},
-        {((uint128_t)0x0000000000000402 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000402 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000402 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000402 << 64) | 0x0600000000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0005000000000000},
-        {((uint128_t)0x0000000000000408 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000408 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000408 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000408 << 64) | 0x0600000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0005000000000000},
-        {((uint128_t)0x000000000000040a << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000011 << 64) | 0x0000000000000000},
-        {((uint128_t)0x000000000000040a << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000011 << 64) | 0x0001000000000000},
-        {((uint128_t)0x000000000000040a << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000011 << 64) | 0x0004000000000000},
-        {((uint128_t)0x000000000000040a << 64) | 0x0600000000000000,
-         ((uint128_t)0x0000000000000011 << 64) | 0x0005000000000000},
-        {((uint128_t)0x0000000000000800 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000800 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000800 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000800 << 64) | 0x0600000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0005000000000000},
-        {((uint128_t)0x0000000000000802 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000802 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000802 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000802 << 64) | 0x0600000000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0005000000000000},
-        {((uint128_t)0x0000000000000808 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000808 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000808 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000808 << 64) | 0x0600000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0005000000000000},
-        {((uint128_t)0x000000000000080a << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000011 << 64) | 0x0000000000000000},
-        {((uint128_t)0x000000000000080a << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000011 << 64) | 0x0001000000000000},
-        {((uint128_t)0x000000000000080a << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000011 << 64) | 0x0004000000000000},
-        {((uint128_t)0x000000000000080a << 64) | 0x0600000000000000,
-         ((uint128_t)0x0000000000000011 << 64) | 0x0005000000000000},
-        {((uint128_t)0x0000000000000c00 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000c00 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000c00 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000c00 << 64) | 0x0600000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0005000000000000},
-        {((uint128_t)0x0000000000000c02 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000c02 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000c02 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000c02 << 64) | 0x0600000000000000,
-         ((uint128_t)0x0000000000000001 << 64) | 0x0005000000000000},
-        {((uint128_t)0x0000000000000c08 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000c08 << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000c08 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000c08 << 64) | 0x0600000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0005000000000000},
-        {((uint128_t)0x0000000000000c0a << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000011 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000c0a << 64) | 0x0200000000000000,
-         ((uint128_t)0x0000000000000011 << 64) | 0x0001000000000000},
-        {((uint128_t)0x0000000000000c0a << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000011 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000c0a << 64) | 0x0600000000000000,
-         ((uint128_t)0x0000000000000011 << 64) | 0x0005000000000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0c00000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000a000000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0c00000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x000a000000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x0c00000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x000a000000000000},
-        {((uint128_t)0x0000000000000014 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000022 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000014 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000022 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000000014 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000022 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000000014 << 64) | 0x0c00000000000000,
-         ((uint128_t)0x0000000000000022 << 64) | 0x000a000000000000},
-        {((uint128_t)0x0000000000000800 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000800 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000000800 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000000800 << 64) | 0x0c00000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000a000000000000},
-        {((uint128_t)0x0000000000000804 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000804 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000000804 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000000804 << 64) | 0x0c00000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x000a000000000000},
-        {((uint128_t)0x0000000000000810 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000810 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000000810 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000000810 << 64) | 0x0c00000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x000a000000000000},
-        {((uint128_t)0x0000000000000814 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000022 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000814 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000022 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000000814 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000022 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000000814 << 64) | 0x0c00000000000000,
-         ((uint128_t)0x0000000000000022 << 64) | 0x000a000000000000},
-        {((uint128_t)0x0000000000001000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000001000 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000001000 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000001000 << 64) | 0x0c00000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000a000000000000},
-        {((uint128_t)0x0000000000001004 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000001004 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000001004 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000001004 << 64) | 0x0c00000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x000a000000000000},
-        {((uint128_t)0x0000000000001010 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000001010 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000001010 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000001010 << 64) | 0x0c00000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x000a000000000000},
-        {((uint128_t)0x0000000000001014 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000022 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000001014 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000022 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000001014 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000022 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000001014 << 64) | 0x0c00000000000000,
-         ((uint128_t)0x0000000000000022 << 64) | 0x000a000000000000},
-        {((uint128_t)0x0000000000001800 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000001800 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000001800 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000001800 << 64) | 0x0c00000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x000a000000000000},
-        {((uint128_t)0x0000000000001804 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000001804 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000001804 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000001804 << 64) | 0x0c00000000000000,
-         ((uint128_t)0x0000000000000002 << 64) | 0x000a000000000000},
-        {((uint128_t)0x0000000000001810 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000001810 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000001810 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000001810 << 64) | 0x0c00000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x000a000000000000},
-        {((uint128_t)0x0000000000001814 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000022 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000001814 << 64) | 0x0400000000000000,
-         ((uint128_t)0x0000000000000022 << 64) | 0x0002000000000000},
-        {((uint128_t)0x0000000000001814 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000022 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000001814 << 64) | 0x0c00000000000000,
-         ((uint128_t)0x0000000000000022 << 64) | 0x000a000000000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1800000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0014000000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x1800000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0014000000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x1800000000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0014000000000000},
-        {((uint128_t)0x0000000000000028 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000044 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000028 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000044 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000000028 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000044 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000000028 << 64) | 0x1800000000000000,
-         ((uint128_t)0x0000000000000044 << 64) | 0x0014000000000000},
-        {((uint128_t)0x0000000000001000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000001000 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000001000 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000001000 << 64) | 0x1800000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0014000000000000},
-        {((uint128_t)0x0000000000001008 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000001008 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000001008 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000001008 << 64) | 0x1800000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0014000000000000},
-        {((uint128_t)0x0000000000001020 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000001020 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000001020 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000001020 << 64) | 0x1800000000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0014000000000000},
-        {((uint128_t)0x0000000000001028 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000044 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000001028 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000044 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000001028 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000044 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000001028 << 64) | 0x1800000000000000,
-         ((uint128_t)0x0000000000000044 << 64) | 0x0014000000000000},
-        {((uint128_t)0x0000000000002000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000002000 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000002000 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000002000 << 64) | 0x1800000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0014000000000000},
-        {((uint128_t)0x0000000000002008 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000002008 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000002008 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000002008 << 64) | 0x1800000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0014000000000000},
-        {((uint128_t)0x0000000000002020 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000002020 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000002020 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000002020 << 64) | 0x1800000000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0014000000000000},
-        {((uint128_t)0x0000000000002028 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000044 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000002028 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000044 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000002028 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000044 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000002028 << 64) | 0x1800000000000000,
-         ((uint128_t)0x0000000000000044 << 64) | 0x0014000000000000},
-        {((uint128_t)0x0000000000003000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000003000 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000003000 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000003000 << 64) | 0x1800000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0014000000000000},
-        {((uint128_t)0x0000000000003008 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000003008 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000003008 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000003008 << 64) | 0x1800000000000000,
-         ((uint128_t)0x0000000000000004 << 64) | 0x0014000000000000},
-        {((uint128_t)0x0000000000003020 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000003020 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000003020 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000003020 << 64) | 0x1800000000000000,
-         ((uint128_t)0x0000000000000040 << 64) | 0x0014000000000000},
-        {((uint128_t)0x0000000000003028 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000044 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000003028 << 64) | 0x0800000000000000,
-         ((uint128_t)0x0000000000000044 << 64) | 0x0004000000000000},
-        {((uint128_t)0x0000000000003028 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000044 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000003028 << 64) | 0x1800000000000000,
-         ((uint128_t)0x0000000000000044 << 64) | 0x0014000000000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0020000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x3000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0028000000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0020000000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x3000000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0028000000000000},
-        {((uint128_t)0x0000000000000040 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000080 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000040 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000080 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000000040 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000080 << 64) | 0x0020000000000000},
-        {((uint128_t)0x0000000000000040 << 64) | 0x3000000000000000,
-         ((uint128_t)0x0000000000000080 << 64) | 0x0028000000000000},
-        {((uint128_t)0x0000000000000050 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000088 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000050 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000088 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000000050 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000088 << 64) | 0x0020000000000000},
-        {((uint128_t)0x0000000000000050 << 64) | 0x3000000000000000,
-         ((uint128_t)0x0000000000000088 << 64) | 0x0028000000000000},
-        {((uint128_t)0x0000000000002000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000002000 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000002000 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0020000000000000},
-        {((uint128_t)0x0000000000002000 << 64) | 0x3000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0028000000000000},
-        {((uint128_t)0x0000000000002010 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000002010 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000002010 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0020000000000000},
-        {((uint128_t)0x0000000000002010 << 64) | 0x3000000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0028000000000000},
-        {((uint128_t)0x0000000000002040 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000080 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000002040 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000080 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000002040 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000080 << 64) | 0x0020000000000000},
-        {((uint128_t)0x0000000000002040 << 64) | 0x3000000000000000,
-         ((uint128_t)0x0000000000000080 << 64) | 0x0028000000000000},
-        {((uint128_t)0x0000000000002050 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000088 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000002050 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000088 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000002050 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000088 << 64) | 0x0020000000000000},
-        {((uint128_t)0x0000000000002050 << 64) | 0x3000000000000000,
-         ((uint128_t)0x0000000000000088 << 64) | 0x0028000000000000},
-        {((uint128_t)0x0000000000004000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000004000 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000004000 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0020000000000000},
-        {((uint128_t)0x0000000000004000 << 64) | 0x3000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0028000000000000},
-        {((uint128_t)0x0000000000004010 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000004010 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000004010 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0020000000000000},
-        {((uint128_t)0x0000000000004010 << 64) | 0x3000000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0028000000000000},
-        {((uint128_t)0x0000000000004040 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000080 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000004040 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000080 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000004040 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000080 << 64) | 0x0020000000000000},
-        {((uint128_t)0x0000000000004040 << 64) | 0x3000000000000000,
-         ((uint128_t)0x0000000000000080 << 64) | 0x0028000000000000},
-        {((uint128_t)0x0000000000004050 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000088 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000004050 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000088 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000004050 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000088 << 64) | 0x0020000000000000},
-        {((uint128_t)0x0000000000004050 << 64) | 0x3000000000000000,
-         ((uint128_t)0x0000000000000088 << 64) | 0x0028000000000000},
-        {((uint128_t)0x0000000000006000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000006000 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000006000 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0020000000000000},
-        {((uint128_t)0x0000000000006000 << 64) | 0x3000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0028000000000000},
-        {((uint128_t)0x0000000000006010 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000006010 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000006010 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0020000000000000},
-        {((uint128_t)0x0000000000006010 << 64) | 0x3000000000000000,
-         ((uint128_t)0x0000000000000008 << 64) | 0x0028000000000000},
-        {((uint128_t)0x0000000000006040 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000080 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000006040 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000080 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000006040 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000080 << 64) | 0x0020000000000000},
-        {((uint128_t)0x0000000000006040 << 64) | 0x3000000000000000,
-         ((uint128_t)0x0000000000000080 << 64) | 0x0028000000000000},
-        {((uint128_t)0x0000000000006050 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000088 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000006050 << 64) | 0x1000000000000000,
-         ((uint128_t)0x0000000000000088 << 64) | 0x0008000000000000},
-        {((uint128_t)0x0000000000006050 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000088 << 64) | 0x0020000000000000},
-        {((uint128_t)0x0000000000006050 << 64) | 0x3000000000000000,
-         ((uint128_t)0x0000000000000088 << 64) | 0x0028000000000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x4000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x6000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x4000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x6000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000008000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000008000 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000008020 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000008020 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000008000 << 64) | 0x4000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000008000 << 64) | 0x6000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000008020 << 64) | 0x4000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000008020 << 64) | 0x6000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000004000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000004000 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000004020 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000004020 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000004000 << 64) | 0x4000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000004000 << 64) | 0x6000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000004020 << 64) | 0x4000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000004020 << 64) | 0x6000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0010000000000000},
-        {((uint128_t)0x000000000000c000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x000000000000c000 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000},
-        {((uint128_t)0x000000000000c020 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000},
-        {((uint128_t)0x000000000000c020 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0010000000000000},
-        {((uint128_t)0x000000000000c000 << 64) | 0x4000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x000000000000c000 << 64) | 0x6000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000},
-        {((uint128_t)0x000000000000c020 << 64) | 0x4000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000},
-        {((uint128_t)0x000000000000c020 << 64) | 0x6000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000000080 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000080 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000},
-        {((uint128_t)0x00000000000000a0 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000},
-        {((uint128_t)0x00000000000000a0 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000000080 << 64) | 0x4000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000080 << 64) | 0x6000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000},
-        {((uint128_t)0x00000000000000a0 << 64) | 0x4000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000},
-        {((uint128_t)0x00000000000000a0 << 64) | 0x6000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000008080 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000008080 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000},
-        {((uint128_t)0x00000000000080a0 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000},
-        {((uint128_t)0x00000000000080a0 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000008080 << 64) | 0x4000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000008080 << 64) | 0x6000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000},
-        {((uint128_t)0x00000000000080a0 << 64) | 0x4000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000},
-        {((uint128_t)0x00000000000080a0 << 64) | 0x6000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000004080 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000004080 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000},
-        {((uint128_t)0x00000000000040a0 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000},
-        {((uint128_t)0x00000000000040a0 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0010000000000000},
-        {((uint128_t)0x0000000000004080 << 64) | 0x4000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000004080 << 64) | 0x6000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000},
-        {((uint128_t)0x00000000000040a0 << 64) | 0x4000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000},
-        {((uint128_t)0x00000000000040a0 << 64) | 0x6000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0010000000000000},
-        {((uint128_t)0x000000000000c080 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x000000000000c080 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000},
-        {((uint128_t)0x000000000000c0a0 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000},
-        {((uint128_t)0x000000000000c0a0 << 64) | 0x2000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0010000000000000},
-        {((uint128_t)0x000000000000c080 << 64) | 0x4000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x000000000000c080 << 64) | 0x6000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0010000000000000},
-        {((uint128_t)0x000000000000c0a0 << 64) | 0x4000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000},
-        {((uint128_t)0x000000000000c0a0 << 64) | 0x6000000000000000,
-         ((uint128_t)0x0000000000000010 << 64) | 0x0010000000000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x4000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0020000000000000},
-        {((uint128_t)0x0000000000000040 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000040 << 64) | 0x4000000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0020000000000000},
-        {((uint128_t)0x0000000000010000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000010000 << 64) | 0x4000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0020000000000000},
-        {((uint128_t)0x0000000000010040 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000010040 << 64) | 0x4000000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0020000000000000},
-        {((uint128_t)0x0000000000008000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000008000 << 64) | 0x4000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0020000000000000},
-        {((uint128_t)0x0000000000008040 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000008040 << 64) | 0x4000000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0020000000000000},
-        {((uint128_t)0x0000000000018000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000018000 << 64) | 0x4000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0020000000000000},
-        {((uint128_t)0x0000000000018040 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000018040 << 64) | 0x4000000000000000,
-         ((uint128_t)0x0000000000000020 << 64) | 0x0020000000000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000000 << 64) | 0x8000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0040000000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100000000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x8000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0140000000000000},
-        {((uint128_t)0x0000000000000200 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000200 << 64) | 0x8000000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0040000000000000},
-        {((uint128_t)0x0000000000000201 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0100000000000000},
-        {((uint128_t)0x0000000000000201 << 64) | 0x8000000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0140000000000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000001 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080000000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200000000000000},
-        {((uint128_t)0x0000000000000003 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0280000000000000},
-        {((uint128_t)0x0000000000000400 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000401 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0080000000000000},
-        {((uint128_t)0x0000000000000402 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0200000000000000},
-        {((uint128_t)0x0000000000000403 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0280000000000000},
-        {((uint128_t)0x0000000000000100 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000101 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0080000000000000},
-        {((uint128_t)0x0000000000000102 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200000000000000},
-        {((uint128_t)0x0000000000000103 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0280000000000000},
-        {((uint128_t)0x0000000000000500 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000501 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0080000000000000},
-        {((uint128_t)0x0000000000000502 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0200000000000000},
-        {((uint128_t)0x0000000000000503 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0280000000000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000002 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0100000000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400000000000000},
-        {((uint128_t)0x0000000000000006 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0500000000000000},
-        {((uint128_t)0x0000000000000200 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000100 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000202 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000100 << 64) | 0x0100000000000000},
-        {((uint128_t)0x0000000000000204 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000100 << 64) | 0x0400000000000000},
-        {((uint128_t)0x0000000000000206 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000100 << 64) | 0x0500000000000000},
-        {((uint128_t)0x0000000000000800 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000802 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x0100000000000000},
-        {((uint128_t)0x0000000000000804 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x0400000000000000},
-        {((uint128_t)0x0000000000000806 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x0500000000000000},
-        {((uint128_t)0x0000000000000a00 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000001100 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000a02 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000001100 << 64) | 0x0100000000000000},
-        {((uint128_t)0x0000000000000a04 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000001100 << 64) | 0x0400000000000000},
-        {((uint128_t)0x0000000000000a06 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000001100 << 64) | 0x0500000000000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000004 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0200000000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800000000000000},
-        {((uint128_t)0x000000000000000c << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0a00000000000000},
-        {((uint128_t)0x0000000000000400 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000404 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0200000000000000},
-        {((uint128_t)0x0000000000000408 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0800000000000000},
-        {((uint128_t)0x000000000000040c << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000200 << 64) | 0x0a00000000000000},
-        {((uint128_t)0x0000000000001000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000001004 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0200000000000000},
-        {((uint128_t)0x0000000000001008 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0800000000000000},
-        {((uint128_t)0x000000000000100c << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0a00000000000000},
-        {((uint128_t)0x0000000000001400 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000002200 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000001404 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000002200 << 64) | 0x0200000000000000},
-        {((uint128_t)0x0000000000001408 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000002200 << 64) | 0x0800000000000000},
-        {((uint128_t)0x000000000000140c << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000002200 << 64) | 0x0a00000000000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000008 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0400000000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1000000000000000},
-        {((uint128_t)0x0000000000000018 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1400000000000000},
-        {((uint128_t)0x0000000000000800 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000808 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x0400000000000000},
-        {((uint128_t)0x0000000000000810 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x1000000000000000},
-        {((uint128_t)0x0000000000000818 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000400 << 64) | 0x1400000000000000},
-        {((uint128_t)0x0000000000002000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000004000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000002008 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000004000 << 64) | 0x0400000000000000},
-        {((uint128_t)0x0000000000002010 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000004000 << 64) | 0x1000000000000000},
-        {((uint128_t)0x0000000000002018 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000004000 << 64) | 0x1400000000000000},
-        {((uint128_t)0x0000000000002800 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000004400 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000002808 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000004400 << 64) | 0x0400000000000000},
-        {((uint128_t)0x0000000000002810 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000004400 << 64) | 0x1000000000000000},
-        {((uint128_t)0x0000000000002818 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000004400 << 64) | 0x1400000000000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2000000000000000},
-        {((uint128_t)0x0000000000000030 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2800000000000000},
-        {((uint128_t)0x0000000000001000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000001010 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000001020 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x2000000000000000},
-        {((uint128_t)0x0000000000001030 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000800 << 64) | 0x2800000000000000},
-        {((uint128_t)0x0000000000004000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000008000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000004010 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000008000 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000004020 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000008000 << 64) | 0x2000000000000000},
-        {((uint128_t)0x0000000000004030 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000008000 << 64) | 0x2800000000000000},
-        {((uint128_t)0x0000000000005000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000008800 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000005010 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000008800 << 64) | 0x0800000000000000},
-        {((uint128_t)0x0000000000005020 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000008800 << 64) | 0x2000000000000000},
-        {((uint128_t)0x0000000000005030 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000008800 << 64) | 0x2800000000000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000020 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x1000000000000000},
-        {((uint128_t)0x0000000000000040 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x4000000000000000},
-        {((uint128_t)0x0000000000000060 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x5000000000000000},
-        {((uint128_t)0x0000000000002000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000002020 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x1000000000000000},
-        {((uint128_t)0x0000000000002040 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x4000000000000000},
-        {((uint128_t)0x0000000000002060 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000001000 << 64) | 0x5000000000000000},
-        {((uint128_t)0x0000000000008000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000010000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000008020 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000010000 << 64) | 0x1000000000000000},
-        {((uint128_t)0x0000000000008040 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000010000 << 64) | 0x4000000000000000},
-        {((uint128_t)0x0000000000008060 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000010000 << 64) | 0x5000000000000000},
-        {((uint128_t)0x000000000000a000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000011000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x000000000000a020 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000011000 << 64) | 0x1000000000000000},
-        {((uint128_t)0x000000000000a040 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000011000 << 64) | 0x4000000000000000},
-        {((uint128_t)0x000000000000a060 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000011000 << 64) | 0x5000000000000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000040 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2000000000000000},
-        {((uint128_t)0x0000000000004000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000004040 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x2000000000000000},
-        {((uint128_t)0x0000000000010000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000010040 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2000000000000000},
-        {((uint128_t)0x0000000000014000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000014040 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x2000000000000000},
-        {((uint128_t)0x0000000000000080 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x00000000000000c0 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2000000000000000},
-        {((uint128_t)0x0000000000004080 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x00000000000040c0 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x2000000000000000},
-        {((uint128_t)0x0000000000010080 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x00000000000100c0 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x2000000000000000},
-        {((uint128_t)0x0000000000014080 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x00000000000140c0 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000002000 << 64) | 0x2000000000000000},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000000080 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000000000 << 64) | 0x4000000000000000},
-        {((uint128_t)0x0000000000008000 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000004000 << 64) | 0x0000000000000000},
-        {((uint128_t)0x0000000000008080 << 64) | 0x0000000000000000,
-         ((uint128_t)0x0000000000004000 << 64) | 0x4000000000000000},
-    },
+constexpr int8_t JUMP_TABLE[81][6][2] = {
+    {{9, 18}, {1, 2}, {-1, -1}, {-1, -1}, {-1, -1}, {-1, -1}},
+    {{10, 19}, {2, 3}, {-1, -1}, {-1, -1}, {-1, -1}, {-1, -1}},
+    {{11, 20}, {10, 18}, {1, 0}, {3, 4}, {-1, -1}, {-1, -1}},
+    {{12, 21}, {11, 19}, {2, 1}, {4, 5}, {-1, -1}, {-1, -1}},
+    {{13, 22}, {12, 20}, {3, 2}, {5, 6}, {-1, -1}, {-1, -1}},
+    {{14, 23}, {13, 21}, {4, 3}, {6, 7}, {-1, -1}, {-1, -1}},
+    {{15, 24}, {14, 22}, {5, 4}, {7, 8}, {-1, -1}, {-1, -1}},
+    {{16, 25}, {15, 23}, {6, 5}, {-1, -1}, {-1, -1}, {-1, -1}},
+    {{17, 26}, {16, 24}, {7, 6}, {-1, -1}, {-1, -1}, {-1, -1}},
+    {{18, 27}, {10, 11}, {-1, -1}, {-1, -1}, {-1, -1}, {-1, -1}},
+    {{19, 28}, {11, 12}, {-1, -1}, {-1, -1}, {-1, -1}, {-1, -1}},
+    {{20, 29}, {19, 27}, {10, 9}, {12, 13}, {-1, -1}, {-1, -1}},
+    {{21, 30}, {20, 28}, {11, 10}, {13, 14}, {-1, -1}, {-1, -1}},
+    {{22, 31}, {21, 29}, {12, 11}, {14, 15}, {-1, -1}, {-1, -1}},
+    {{23, 32}, {22, 30}, {13, 12}, {15, 16}, {-1, -1}, {-1, -1}},
+    {{24, 33}, {23, 31}, {14, 13}, {16, 17}, {-1, -1}, {-1, -1}},
+    {{25, 34}, {24, 32}, {15, 14}, {-1, -1}, {-1, -1}, {-1, -1}},
+    {{26, 35}, {25, 33}, {16, 15}, {-1, -1}, {-1, -1}, {-1, -1}},
+    {{9, 0}, {10, 2}, {27, 36}, {19, 20}, {-1, -1}, {-1, -1}},
+    {{10, 1}, {11, 3}, {28, 37}, {20, 21}, {-1, -1}, {-1, -1}},
+    {{11, 2}, {12, 4}, {29, 38}, {28, 36}, {19, 18}, {21, 22}},
+    {{12, 3}, {13, 5}, {30, 39}, {29, 37}, {20, 19}, {22, 23}},
+    {{13, 4}, {14, 6}, {31, 40}, {30, 38}, {21, 20}, {23, 24}},
+    {{14, 5}, {15, 7}, {32, 41}, {31, 39}, {22, 21}, {24, 25}},
+    {{15, 6}, {16, 8}, {33, 42}, {32, 40}, {23, 22}, {25, 26}},
+    {{16, 7}, {34, 43}, {33, 41}, {24, 23}, {-1, -1}, {-1, -1}},
+    {{17, 8}, {35, 44}, {34, 42}, {25, 24}, {-1, -1}, {-1, -1}},
+    {{18, 9}, {19, 11}, {36, 45}, {28, 29}, {-1, -1}, {-1, -1}},
+    {{19, 10}, {20, 12}, {37, 46}, {29, 30}, {-1, -1}, {-1, -1}},
+    {{20, 11}, {21, 13}, {38, 47}, {37, 45}, {28, 27}, {30, 31}},
+    {{21, 12}, {22, 14}, {39, 48}, {38, 46}, {29, 28}, {31, 32}},
+    {{22, 13}, {23, 15}, {40, 49}, {39, 47}, {30, 29}, {32, 33}},
+    {{23, 14}, {24, 16}, {41, 50}, {40, 48}, {31, 30}, {33, 34}},
+    {{24, 15}, {25, 17}, {42, 51}, {41, 49}, {32, 31}, {34, 35}},
+    {{25, 16}, {43, 52}, {42, 50}, {33, 32}, {-1, -1}, {-1, -1}},
+    {{26, 17}, {44, 53}, {43, 51}, {34, 33}, {-1, -1}, {-1, -1}},
+    {{27, 18}, {28, 20}, {45, 54}, {37, 38}, {-1, -1}, {-1, -1}},
+    {{28, 19}, {29, 21}, {46, 55}, {38, 39}, {-1, -1}, {-1, -1}},
+    {{29, 20}, {30, 22}, {47, 56}, {46, 54}, {37, 36}, {39, 40}},
+    {{30, 21}, {31, 23}, {48, 57}, {47, 55}, {38, 37}, {40, 41}},
+    {{31, 22}, {32, 24}, {49, 58}, {48, 56}, {39, 38}, {41, 42}},
+    {{32, 23}, {33, 25}, {50, 59}, {49, 57}, {40, 39}, {42, 43}},
+    {{33, 24}, {34, 26}, {51, 60}, {50, 58}, {41, 40}, {43, 44}},
+    {{34, 25}, {52, 61}, {51, 59}, {42, 41}, {-1, -1}, {-1, -1}},
+    {{35, 26}, {53, 62}, {52, 60}, {43, 42}, {-1, -1}, {-1, -1}},
+    {{36, 27}, {37, 29}, {54, 63}, {46, 47}, {-1, -1}, {-1, -1}},
+    {{37, 28}, {38, 30}, {55, 64}, {47, 48}, {-1, -1}, {-1, -1}},
+    {{38, 29}, {39, 31}, {56, 65}, {55, 63}, {46, 45}, {48, 49}},
+    {{39, 30}, {40, 32}, {57, 66}, {56, 64}, {47, 46}, {49, 50}},
+    {{40, 31}, {41, 33}, {58, 67}, {57, 65}, {48, 47}, {50, 51}},
+    {{41, 32}, {42, 34}, {59, 68}, {58, 66}, {49, 48}, {51, 52}},
+    {{42, 33}, {43, 35}, {60, 69}, {59, 67}, {50, 49}, {52, 53}},
+    {{43, 34}, {61, 70}, {60, 68}, {51, 50}, {-1, -1}, {-1, -1}},
+    {{44, 35}, {62, 71}, {61, 69}, {52, 51}, {-1, -1}, {-1, -1}},
+    {{45, 36}, {46, 38}, {63, 72}, {55, 56}, {-1, -1}, {-1, -1}},
+    {{46, 37}, {47, 39}, {64, 73}, {56, 57}, {-1, -1}, {-1, -1}},
+    {{47, 38}, {48, 40}, {65, 74}, {64, 72}, {55, 54}, {57, 58}},
+    {{48, 39}, {49, 41}, {66, 75}, {65, 73}, {56, 55}, {58, 59}},
+    {{49, 40}, {50, 42}, {67, 76}, {66, 74}, {57, 56}, {59, 60}},
+    {{50, 41}, {51, 43}, {68, 77}, {67, 75}, {58, 57}, {60, 61}},
+    {{51, 42}, {52, 44}, {69, 78}, {68, 76}, {59, 58}, {61, 62}},
+    {{52, 43}, {70, 79}, {69, 77}, {60, 59}, {-1, -1}, {-1, -1}},
+    {{53, 44}, {71, 80}, {70, 78}, {61, 60}, {-1, -1}, {-1, -1}},
+    {{54, 45}, {55, 47}, {64, 65}, {-1, -1}, {-1, -1}, {-1, -1}},
+    {{55, 46}, {56, 48}, {65, 66}, {-1, -1}, {-1, -1}, {-1, -1}},
+    {{56, 47}, {57, 49}, {64, 63}, {66, 67}, {-1, -1}, {-1, -1}},
+    {{57, 48}, {58, 50}, {65, 64}, {67, 68}, {-1, -1}, {-1, -1}},
+    {{58, 49}, {59, 51}, {66, 65}, {68, 69}, {-1, -1}, {-1, -1}},
+    {{59, 50}, {60, 52}, {67, 66}, {69, 70}, {-1, -1}, {-1, -1}},
+    {{60, 51}, {61, 53}, {68, 67}, {70, 71}, {-1, -1}, {-1, -1}},
+    {{61, 52}, {69, 68}, {-1, -1}, {-1, -1}, {-1, -1}, {-1, -1}},
+    {{62, 53}, {70, 69}, {-1, -1}, {-1, -1}, {-1, -1}, {-1, -1}},
+    {{63, 54}, {64, 56}, {73, 74}, {-1, -1}, {-1, -1}, {-1, -1}},
+    {{64, 55}, {65, 57}, {74, 75}, {-1, -1}, {-1, -1}, {-1, -1}},
+    {{65, 56}, {66, 58}, {73, 72}, {75, 76}, {-1, -1}, {-1, -1}},
+    {{66, 57}, {67, 59}, {74, 73}, {76, 77}, {-1, -1}, {-1, -1}},
+    {{67, 58}, {68, 60}, {75, 74}, {77, 78}, {-1, -1}, {-1, -1}},
+    {{68, 59}, {69, 61}, {76, 75}, {78, 79}, {-1, -1}, {-1, -1}},
+    {{69, 60}, {70, 62}, {77, 76}, {79, 80}, {-1, -1}, {-1, -1}},
+    {{70, 61}, {78, 77}, {-1, -1}, {-1, -1}, {-1, -1}, {-1, -1}},
+    {{71, 62}, {79, 78}, {-1, -1}, {-1, -1}, {-1, -1}, {-1, -1}},
 };
+
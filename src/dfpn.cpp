@@ -0,0 +1,199 @@
+#include <algorithm>
+#include <dfpn.hpp>
+
+const uint32_t PROOF_INF = 1u << 30;
+// 证明的最大步数，超过时视为进攻方没有获胜；从较短的证明开始逐步放宽
+const int PROOF_PLY_STEPS[] = {8, 16, 24, 40};
+const size_t PROOF_TABLE_SIZE = 1 << 20;
+
+struct ProofEntry {
+  uint64_t hash;
+  uint32_t pn;
+  uint32_t dn;
+  // 计算该结点时剩余的步数，证明只对更多的剩余步数有效，反证只对更少的剩余步数有效
+  int remaining;
+  Move bestMove;
+};
+
+// 证明数搜索的置换表，和 alpha-beta 搜索的置换表分开，键为局面 hash 与进攻方
+std::vector<ProofEntry> PROOF_TABLE;
+
+void clearProofTable() { std::vector<ProofEntry>().swap(PROOF_TABLE); }
+
+inline uint32_t saturatedAdd(uint32_t a, uint32_t b) { return std::min(PROOF_INF, a + b); }
+
+class ProofSolver {
+ public:
+  ProofSolver(GameState &gameState, Color attacker, uint64_t nodeLimit, SearchContext &context)
+      : state(gameState), attacker(attacker), nodeLimit(nodeLimit), nodes(0), context(context) {
+    if (PROOF_TABLE.empty()) {
+      PROOF_TABLE.resize(PROOF_TABLE_SIZE, ProofEntry{0, 1, 1, -1, {-1, -1}});
+    }
+  }
+
+  // 在 maxPly 步内搜索，返回根结点的证明数与反证数
+  ProofEntry solve(int maxPly) {
+    mid(PROOF_INF - 1, PROOF_INF - 1, maxPly);
+    return lookup(maxPly);
+  }
+
+  // 沿置换表中的最佳着法取出证明树上的主要变例
+  std::vector<Move> line(int maxPly) {
+    std::vector<Move> moves;
+    std::vector<Move> played;
+    int remaining = maxPly;
+    while (remaining > 0 && !state.isGameOver()) {
+      ProofEntry entry = lookup(remaining);
+      if ((entry.pn != 0 && entry.dn != 0) || entry.bestMove.src < 0) {
+        break;
+      }
+      moves.push_back(entry.bestMove);
+      state.applyMove(entry.bestMove);
+      played.push_back(entry.bestMove);
+      remaining--;
+    }
+    for (auto it = played.rbegin(); it != played.rend(); it++) {
+      state.undoMove(*it);
+    }
+    return moves;
+  }
+
+  uint64_t nodeCount() const { return nodes; }
+  bool interrupted() {
+    return nodes > nodeLimit || timeout(context);
+  }
+
+ private:
+  GameState &state;
+  Color attacker;
+  uint64_t nodeLimit;
+  uint64_t nodes;
+  SearchContext &context;
+
+  ProofEntry &slot() {
+    uint64_t key = state.hash() ^ (attacker == RED ? 0 : 0x9e3779b97f4a7c15ULL);
+    return PROOF_TABLE[key & (PROOF_TABLE_SIZE - 1)];
+  }
+
+  ProofEntry lookup(int remaining) {
+    uint64_t key = state.hash() ^ (attacker == RED ? 0 : 0x9e3779b97f4a7c15ULL);
+    ProofEntry &entry = slot();
+    if (entry.hash == key) {
+      if (entry.pn == 0 && entry.remaining <= remaining) {
+        return entry;
+      }
+      if (entry.dn == 0 && entry.remaining >= remaining) {
+        return entry;
+      }
+      if (entry.pn != 0 && entry.dn != 0) {
+        return entry;
+      }
+    }
+    return ProofEntry{key, 1, 1, remaining, {-1, -1}};
+  }
+
+  void store(uint32_t pn, uint32_t dn, int remaining, Move bestMove) {
+    uint64_t key = state.hash() ^ (attacker == RED ? 0 : 0x9e3779b97f4a7c15ULL);
+    slot() = ProofEntry{key, pn, dn, remaining, bestMove};
+  }
+
+  bool aborted() { return nodes > nodeLimit || ((nodes & 1023) == 0 && interrupted()); }
+
+  // 终局或步数用完时返回 true 并写入证明数与反证数
+  bool terminal(int remaining, uint32_t &pn, uint32_t &dn) {
+    if (state.isGameOver()) {
+      Color winner = state.board[RED] == INITIAL_GREEN ? RED : GREEN;
+      pn = winner == attacker ? 0 : PROOF_INF;
+      dn = winner == attacker ? PROOF_INF : 0;
+      return true;
+    }
+    // 营地外的每枚棋子至少还要走一步，剩余步数内走不完时进攻方不可能获胜
+    uint128_t outside = state.board[attacker] & ~(attacker == RED ? INITIAL_GREEN : INITIAL_RED);
+    int attackerMoves = state.turn == attacker ? (remaining + 1) / 2 : remaining / 2;
+    if (popcount_u128(outside) > attackerMoves) {
+      pn = PROOF_INF;
+      dn = 0;
+      return true;
+    }
+    return false;
+  }
+
+  // 多重迭代加深 (MID)，直到结点的证明数或反证数达到阈值
+  void mid(uint32_t thpn, uint32_t thdn, int remaining) {
+    uint32_t pn, dn;
+    if (terminal(remaining, pn, dn)) {
+      store(pn, dn, remaining, {-1, -1});
+      return;
+    }
+    nodes++;
+    bool orNode = state.turn == attacker;
+    std::vector<Move> moves = state.legalMoves();
+    std::vector<ProofEntry> children(moves.size());
+    Move bestMove = {-1, -1};
+    while (true) {
+      // 根据子结点计算本结点的证明数与反证数，同时找出最有希望的子结点
+      uint32_t sum = 0, best = PROOF_INF, second = PROOF_INF;
+      int bestIndex = -1;
+      for (size_t i = 0; i < moves.size(); i++) {
+        state.applyMove(moves[i]);
+        if (!terminal(remaining - 1, children[i].pn, children[i].dn)) {
+          children[i] = lookup(remaining - 1);
+        }
+        state.undoMove(moves[i]);
+        uint32_t select = orNode ? children[i].pn : children[i].dn;
+        uint32_t other = orNode ? children[i].dn : children[i].pn;
+        sum = saturatedAdd(sum, other);
+        if (select < best) {
+          second = best;
+          best = select;
+          bestIndex = (int)i;
+        } else if (select < second) {
+          second = select;
+        }
+      }
+      pn = orNode ? best : sum;
+      dn = orNode ? sum : best;
+      if (bestIndex >= 0) {
+        bestMove = moves[bestIndex];
+      }
+      if (pn == 0 || dn == 0 || pn >= thpn || dn >= thdn || aborted()) {
+        break;
+      }
+      uint32_t childPn, childDn;
+      if (orNode) {
+        childPn = std::min(thpn, saturatedAdd(second, 1));
+        childDn = saturatedAdd(thdn - dn, children[bestIndex].dn);
+      } else {
+        childPn = saturatedAdd(thpn - pn, children[bestIndex].pn);
+        childDn = std::min(thdn, saturatedAdd(second, 1));
+      }
+      state.applyMove(bestMove);
+      mid(childPn, childDn, remaining - 1);
+      state.undoMove(bestMove);
+    }
+    store(pn, dn, remaining, bestMove);
+  }
+};
+
+ProofSolution solveProof(GameState &gameState, uint64_t nodeLimit, SearchContext &context) {
+  ProofSolution solution{PROOF_UNKNOWN, {}, 0};
+  Color opponent = gameState.turn == RED ? GREEN : RED;
+  for (int maxPly : PROOF_PLY_STEPS) {
+    // 结论只在 maxPly 步内成立，双方都不能获胜时放宽步数再试
+    for (Color attacker : {gameState.turn, opponent}) {
+      ProofSolver solver(gameState, attacker, nodeLimit - solution.nodes, context);
+      ProofEntry root = solver.solve(maxPly);
+      solution.nodes += solver.nodeCount();
+      if (root.pn == 0) {
+        solution.result = attacker == gameState.turn ? PROOF_WIN : PROOF_LOSS;
+        solution.line = solver.line(maxPly);
+        return solution;
+      }
+      if (root.dn != 0 || solver.interrupted()) {
+        // 没有在结点数或时间限制内得出结论
+        return solution;
+      }
+    }
+  }
+  return solution;
+}
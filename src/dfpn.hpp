@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+#include <game.hpp>
+#include <vector>
+
+enum ProofResult {
+  PROOF_UNKNOWN,
+  // 走棋一方可以强制获胜
+  PROOF_WIN,
+  // 对方可以强制获胜
+  PROOF_LOSS,
+};
+
+struct ProofSolution {
+  ProofResult result;
+  // 证明树上的主要变例，从走棋一方开始
+  std::vector<Move> line;
+  uint64_t nodes;
+};
+
+// 深度优先证明数搜索 (DF-PN)，使用独立的置换表，给出 40 步以内的强制胜负。
+// 步数上限逐步放宽，每一档先证明走棋一方获胜，再证明对方获胜，全部共用 nodeLimit 个结点
+ProofSolution solveProof(GameState &gameState, uint64_t nodeLimit, SearchContext &context);
+void clearProofTable();
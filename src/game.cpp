@@ -4,11 +4,24 @@
 #include <algorithm>
 #include <book.hpp>
 #include <constants.hpp>
+#include <dfpn.hpp>
 #include <game.hpp>
+#include <mcts.hpp>
+#include <race.hpp>
 #include <random>
+#include <thread>
+#include <trace.hpp>
 #include <transtable.hpp>
 
 const int NULL_MOVE_R = 2;
+const int MAX_SEARCH_THREADS = 64;
+// 赛跑阶段单人求解每一方最多访问的结点数，超出后退回普通搜索
+const uint64_t RACE_NODE_LIMIT = 1 << 18;
+// 对方的单人求解只用来给出评分，着法已经确定，只用很少的结点数
+const uint64_t RACE_OPPONENT_NODE_LIMIT = 1 << 12;
+// 营地外的棋子不超过这个数时尝试证明数搜索
+const int PROOF_MAX_OUTSIDE = 3;
+const uint64_t PROOF_NODE_LIMIT = 1 << 16;
 
 inline int bitlen_u128(uint128_t u) {
   if (u == 0) {
@@ -23,7 +36,6 @@ inline int bitlen_u128(uint128_t u) {
 }
 
 #define INF INT_MAX
-#define SECONDS_LATER(x) std::chrono::high_resolution_clock::now() + std::chrono::seconds(x)
 #define NOW std::chrono::high_resolution_clock::now()
 #define NULL_MOVE \
   Move { -1, -1 }
@@ -44,10 +56,50 @@ inline bool operator==(const Move &a, const Move &b) { return a.src == b.src &&
 
 // 全局置换表
 TranspositionTable HASH_TABLE;
-// Killer 着法表
-Move KILLER_TABLE[32][2];
-// 开局库
-std::vector<BookEntry> BOOK;
+// 棋力等级搜索使用的小置换表，每次搜索前清空，使走法不受之前搜索的影响
+const size_t SKILL_HASH_TABLE_MB = 4;
+TranspositionTable SKILL_HASH_TABLE(SKILL_HASH_TABLE_MB);
+// 当前搜索使用的置换表。同一时间只进行一个搜索，由 skillSearch 临时切换
+TranspositionTable *SEARCH_TABLE = &HASH_TABLE;
+// Killer 着法表，每个搜索线程独立一份
+thread_local Move KILLER_TABLE[32][2];
+// 搜索线程数
+int SEARCH_THREADS = 1;
+// 当前线程搜索过的结点数
+thread_local uint64_t SEARCH_NODES = 0;
+
+// 超时、被外部停止或者当前线程的结点数达到上限
+inline bool searchStopped(const SearchContext &context) {
+  return SEARCH_NODES >= context.nodeLimit || timeout(context);
+}
+
+inline void clearKillerTable() {
+  for (int i = 0; i < 32; i++) {
+    KILLER_TABLE[i][0] = NULL_MOVE;
+    KILLER_TABLE[i][1] = NULL_MOVE;
+  }
+}
+
+bool isValidPosition(const GameState &gameState) {
+  uint128_t red = gameState.board[RED], green = gameState.board[GREEN];
+  return (gameState.turn == RED || gameState.turn == GREEN) && popcount_u128(red) == 10 &&
+         popcount_u128(green) == 10 && (red & green) == 0 && ((red | green) & ~BOARD_MASK) == 0;
+}
+
+void setHashSize(int megabytes) { HASH_TABLE.resize(std::max(1, megabytes)); }
+
+void clearHash() {
+  TraceScope scope("clearHash");
+  HASH_TABLE.clear();
+}
+
+size_t saveHash(const std::string &path, int percent) { return HASH_TABLE.save(path, percent); }
+
+size_t loadHash(const std::string &path) { return HASH_TABLE.load(path); }
+
+void setSearchThreads(int threads) { SEARCH_THREADS = std::max(1, std::min(threads, MAX_SEARCH_THREADS)); }
+
+int getSearchThreads() { return SEARCH_THREADS; }
 
 GameState::GameState() : board{0, INITIAL_RED, INITIAL_GREEN}, turn(RED), round(1), zobristHash(0) { hash(); }
 
@@ -132,8 +184,7 @@ std::vector<Move> GameState::legalMoves() {
   std::vector<Move> moves;
   uint128_t from = board[turn];
   SCAN_REVERSE_START(from, src)
-  uint128_t to = ADJ_POSITIONS[pos_src] & ~(board[RED] | board[GREEN]);
-  jumpMoves(pos_src, to);
+  uint128_t to = legalDestinations(pos_src);
   SCAN_REVERSE_START(to, dst)
   moves.push_back({pos_src, pos_dst});
   SCAN_REVERSE_END(to, dst)
@@ -148,8 +199,7 @@ std::vector<Move> GameState::sortedLegalMoves(int depth, Move historyBestMove) {
   bool killer1Legal = false, killer2Legal = false;
   uint128_t from = board[turn];
   SCAN_REVERSE_START(from, src)
-  uint128_t to = ADJ_POSITIONS[pos_src] & ~(board[RED] | board[GREEN]);
-  jumpMoves(pos_src, to);
+  uint128_t to = legalDestinations(pos_src);
   SCAN_REVERSE_START(to, dst)
   distance = PIECE_DISTANCES[pos_dst] - PIECE_DISTANCES[pos_src];
   if (KILLER_TABLE[depth][0].src == pos_src && KILLER_TABLE[depth][0].dst == pos_dst) {
@@ -194,9 +244,24 @@ std::vector<Move> GameState::sortedLegalMoves(int depth, Move historyBestMove) {
   return moves;
 }
 
+uint128_t GameState::legalDestinations(int src) {
+  uint128_t to = ADJ_POSITIONS[src] & ~(board[RED] | board[GREEN]);
+  jumpMoves(src, to);
+  return to;
+}
+
 void GameState::jumpMoves(int src, uint128_t &to) {
-  uint128_t jumps = JUMP_POSITIONS[src].at(ADJ_POSITIONS[src] & (board[RED] | board[GREEN]));
-  jumps &= ~(board[RED] | board[GREEN]);
+  uint128_t occupied = board[RED] | board[GREEN];
+  uint128_t jumps = 0;
+  for (auto &jump : JUMP_TABLE[src]) {
+    if (jump[0] < 0) {
+      break;
+    }
+    if (occupied >> jump[0] & 1) {
+      jumps |= (uint128_t)1 << jump[1];
+    }
+  }
+  jumps &= ~occupied;
   if ((jumps | to) == to) {
     return;
   }
@@ -231,12 +296,13 @@ void GameState::applyNullMove() {
 }
 
 void GameState::undoMove(Move move) {
-  turn = turn == Color::RED ? Color::GREEN : Color::RED;
-  board[turn] ^= (uint128_t)1 << move.dst;
-  board[turn] |= (uint128_t)1 << move.src;
+  // 绿方走完后回合数加一，撤销时相应减一
   if (turn == RED) {
     round--;
   }
+  turn = turn == Color::RED ? Color::GREEN : Color::RED;
+  board[turn] ^= (uint128_t)1 << move.dst;
+  board[turn] |= (uint128_t)1 << move.src;
   if (zobristHash != 0) {
     zobristHash ^= ZOBRIST_TABLE[move.src][turn];
     zobristHash ^= ZOBRIST_TABLE[move.dst][turn];
@@ -245,10 +311,10 @@ void GameState::undoMove(Move move) {
 }
 
 void GameState::undoNullMove() {
-  turn = turn == Color::RED ? Color::GREEN : Color::RED;
   if (turn == RED) {
     round--;
   }
+  turn = turn == Color::RED ? Color::GREEN : Color::RED;
   if (zobristHash != 0) {
     zobristHash ^= 0xc503204d9e521ac5ULL;
   }
@@ -303,73 +369,416 @@ uint64_t GameState::hash() {
   return zobristHash;
 }
 
-bool GameState::isGameOver() { return board[RED] == INITIAL_GREEN || board[GREEN] == INITIAL_RED; }
+bool GameState::isGameOver() const { return board[RED] == INITIAL_GREEN || board[GREEN] == INITIAL_RED; }
+
+// 预计到终局还要走的步数，只用于分配时间
+const int EXPECTED_GAME_ROUNDS = 50;
+const int MIN_MOVES_LEFT = 10;
+// 为避免超时在剩余时间中保留的余量 (毫秒)
+const int64_t CLOCK_MARGIN = 50;
+
+// 按对局时钟计算本步的计划用时 optimum 和最多用时 maximum
+void allocateTime(const TimeControl &clock, int round, int64_t &optimum, int64_t &maximum) {
+  int movesLeft = clock.movesToGo > 0 ? clock.movesToGo : std::max(MIN_MOVES_LEFT, EXPECTED_GAME_ROUNDS - round);
+  int64_t available = std::max<int64_t>(clock.remaining - CLOCK_MARGIN, 1);
+  optimum = available / movesLeft + clock.increment * 3 / 4;
+  // 不稳定时最多用到计划用时的三倍，但不超过剩余时间的三分之一
+  maximum = std::min(optimum * 3, available / 3 + clock.increment);
+  maximum = std::max<int64_t>(std::min(maximum, available), 1);
+  optimum = std::max<int64_t>(std::min(optimum, maximum), 1);
+}
+
+struct SkillLevel {
+  int depth;
+  uint64_t nodes;
+  // 比最佳着法差不超过 margin 分的根着法都可能被选中
+  int margin;
+  int multiPV;
+};
+
+// 各棋力等级的搜索限制。只用一个线程，搜索量由深度和结点数决定，在任何机器上走法都相同，
+// 低等级只需要几毫秒
+const SkillLevel SKILL_LEVEL_TABLE[SKILL_LEVELS] = {
+    {1, 2000, 60, 6}, {2, 10000, 40, 5}, {3, 50000, 24, 4}, {5, 250000, 12, 3}, {7, 1000000, 6, 2},
+};
+
+// 按棋力等级搜索：用多主要变例找出接近最佳的几个根着法，再按与最佳着法的分差加权随机选择。
+// 随机数由局面 hash 决定，同一局面总是走同一步
+Move skillSearch(GameState &gameState, const SearchLimits &limits, SearchCallback callback) {
+  const SkillLevel &level = SKILL_LEVEL_TABLE[std::min(limits.skill, SKILL_LEVELS) - 1];
+  uint64_t random = gameState.hash() * 0x9e3779b97f4a7c15ULL;
+  // 开局库着法也按局面 hash 选择，不用 searchBook 的随机数
+  std::vector<Move> book = bookMoves(gameState.hash());
+  if (!book.empty()) {
+    return book[(random >> 32) % book.size()];
+  }
+  SearchLimits skillLimits = limits;
+  skillLimits.skill = 0;
+  skillLimits.threads = 1;
+  skillLimits.backend = BACKEND_ALPHABETA;
+  skillLimits.depth = limits.depth > 0 ? std::min(limits.depth, level.depth) : level.depth;
+  skillLimits.nodes = limits.nodes > 0 ? std::min(limits.nodes, level.nodes) : level.nodes;
+  // 多主要变例搜索同时跳过了精确求解器，低等级在残局中也不会下得完美
+  skillLimits.multiPV = level.multiPV;
+  // 不使用全局置换表：其中之前搜索留下的深层条目会让走法随搜索历史变化，也会让低等级下得比深度限制更强
+  SKILL_HASH_TABLE.newSearch();
+  SKILL_HASH_TABLE.clear();
+  SEARCH_TABLE = &SKILL_HASH_TABLE;
+  std::vector<PVLine> lines;
+  Move move = gameState.searchBestMove(skillLimits, [&lines, &callback](const SearchInfo &info) {
+    lines = info.lines;
+    if (callback) {
+      callback(info);
+    }
+  });
+  SEARCH_TABLE = &HASH_TABLE;
+  if (lines.empty() || !(lines[0].moves[0] == move)) {
+    // 第一层都没有搜完
+    return move;
+  }
+  std::vector<int> weights;
+  int total = 0;
+  for (auto &line : lines) {
+    int weight = std::max(0, level.margin - (lines[0].score - line.score) + 1);
+    weights.push_back(weight);
+    total += weight;
+  }
+  int pick = (int)((random >> 32) % (uint64_t)total);
+  for (size_t i = 0; i < lines.size(); i++) {
+    if (pick < weights[i]) {
+      return lines[i].moves[0];
+    }
+    pick -= weights[i];
+  }
+  return move;
+}
 
 Move GameState::searchBestMove(int timeLimit) {
+  SearchLimits limits;
+  limits.timeLimit = timeLimit;
+  return searchBestMove(limits);
+}
+
+Move GameState::searchBestMove(const SearchLimits &limits, SearchCallback callback) {
+  if (limits.skill > 0) {
+    return skillSearch(*this, limits, callback);
+  }
+  TraceScope searchScope("search");
+  // 只搜索部分根着法时 (分布式搜索的工作进程)，跳过开局库和精确求解器
+  bool restricted = !limits.searchMoves.empty();
   // 搜索开局库
-  auto m = searchBook(hash());
+  TraceScope bookScope("book");
+  auto m = restricted ? NULL_MOVE : searchBook(hash());
+  bookScope.end();
   if (m.src >= 0) {
 #ifdef HAVE_SPDLOG
     spdlog::info("book move: {} {}", m.src, m.dst);
 #endif
     return m;
   }
-  // 初始化 Killer 着法表
-  for (int i = 0; i < 32; i++) {
-    KILLER_TABLE[i][0] = NULL_MOVE;
-    KILLER_TABLE[i][1] = NULL_MOVE;
+  auto start = NOW;
+  // 使用对局时钟时，budget 为计划用时，maximum 为不稳定局面最多可以用到的时间
+  bool clocked = limits.clock.remaining > 0 && !limits.infinite;
+  int64_t budget = limits.moveTime > 0 ? limits.moveTime : (int64_t)limits.timeLimit * 1000;
+  int64_t maximum = budget;
+  if (clocked) {
+    std::vector<Move> moves = legalMoves();
+    if (moves.size() == 1 && !restricted) {
+      // 只有一个着法时不需要思考
+      return moves[0];
+    }
+    allocateTime(limits.clock, round, budget, maximum);
+    // 刚离开开局库的局面已经被充分研究过，只用一半时间
+    for (Move legal : moves) {
+      applyMove(legal);
+      bool inBook = !bookMoves(hash()).empty();
+      undoMove(legal);
+      if (inBook) {
+        budget /= 2;
+        break;
+      }
+    }
   }
-  // 初始化置换表
-  HASH_TABLE.clear();
+  // 初始化 Killer 着法表
+  clearKillerTable();
+  // 置换表在多次搜索之间保留，只推进代数，旧条目优先被替换
+  TraceScope newSearchScope("newSearch");
+  SEARCH_TABLE->newSearch();
+  newSearchScope.end();
   int depth = 1, eval = -INF, bestEval = -INF;
   Move move = NULL_MOVE, bestMove = NULL_MOVE;
-  auto deadline = SECONDS_LATER(timeLimit);
-  while (depth < 100) {
+  SearchContext context;
+  context.deadline = limits.infinite ? time_point_t::max() : start + std::chrono::milliseconds(maximum);
+  context.stopped = false;
+  context.stop = limits.stop;
+  context.nodes = 0;
+  context.nodeLimit = limits.nodes > 0 ? limits.nodes : UINT64_MAX;
+  SEARCH_NODES = 0;
+  // 精确求解器最多占用四分之一的思考时间，求不出时剩余时间留给普通搜索；
+  // 多主要变例分析时仍然使用普通搜索
+  SearchContext solverContext;
+  solverContext.deadline =
+      limits.infinite ? time_point_t::max() : start + std::chrono::milliseconds(budget / 4);
+  solverContext.stopped = false;
+  solverContext.stop = limits.stop;
+  solverContext.nodes = 0;
+  // 双方已经分开时直接求出最短走法
+  if (limits.multiPV <= 1 && !restricted && isRacePhase(*this)) {
+    TraceScope raceScope("race");
+    Color opponent = turn == RED ? GREEN : RED;
+    RaceSolution own = solveRace(*this, turn, RACE_NODE_LIMIT, solverContext);
+    // 单人求解时对方棋子被移除，后退或横走的着法可能落在对方棋子上，这时退回普通搜索
+    if (own.moves > 0 && (legalDestinations(own.line[0].src) >> own.line[0].dst & 1)) {
+      // 一方走完对局立即结束，走棋一方步数不多于对方时获胜
+      RaceSolution other = solveRace(*this, opponent, RACE_OPPONENT_NODE_LIMIT, solverContext);
+      int score = other.moves < 0 ? evaluate() : own.moves <= other.moves ? 10000 : -10000;
+#ifdef HAVE_SPDLOG
+      spdlog::info("race solved: {} moves, opponent: {} moves, move: {} {}", own.moves, other.moves,
+                   own.line[0].src, own.line[0].dst);
+#endif
+      if (callback) {
+        SearchInfo info;
+        info.depth = own.moves;
+        info.score = score;
+        info.bestMove = own.line[0];
+        info.nodes = own.nodes + other.nodes;
+        info.time = std::chrono::duration_cast<std::chrono::milliseconds>(NOW - start).count();
+        info.lines = {{score, own.line}};
+        callback(info);
+      }
+      return own.line[0];
+    }
+  }
+  // 走棋一方只差几枚棋子进营时，先用证明数搜索寻找强制获胜的走法。只在根结点调用，
+  // alpha-beta 的内部结点不调用证明搜索。对局已经结束时证明的主要变例为空，直接交给普通搜索
+  uint128_t outside = board[turn] & ~(turn == RED ? INITIAL_GREEN : INITIAL_RED);
+  if (limits.multiPV <= 1 && !restricted && !isGameOver() && popcount_u128(outside) <= PROOF_MAX_OUTSIDE) {
+    TraceScope proofScope("proof");
+    ProofSolution proof = solveProof(*this, PROOF_NODE_LIMIT, solverContext);
+    proofScope.end();
+    if (proof.result == PROOF_WIN && !proof.line.empty()) {
+#ifdef HAVE_SPDLOG
+      spdlog::info("proved win in {} plies, move: {} {}", proof.line.size(), proof.line[0].src, proof.line[0].dst);
+#endif
+      if (callback) {
+        SearchInfo info;
+        info.depth = proof.line.size();
+        info.score = 10000;
+        info.bestMove = proof.line[0];
+        info.nodes = proof.nodes;
+        info.time = std::chrono::duration_cast<std::chrono::milliseconds>(NOW - start).count();
+        info.lines = {{10000, proof.line}};
+        callback(info);
+      }
+      return proof.line[0];
+    }
+  }
+  int threads = limits.threads > 0 ? std::min(limits.threads, MAX_SEARCH_THREADS) : SEARCH_THREADS;
+  if (limits.backend == BACKEND_MCTS && !restricted) {
+    // 蒙特卡洛树搜索没有迭代边界，直接按计划用时停止
+    if (!limits.infinite) {
+      context.deadline = start + std::chrono::milliseconds(budget);
+    }
+    return mctsSearch(*this, threads, limits.multiPV, context, callback);
+  }
+  // Lazy SMP: 辅助线程在各自的局面副本上做迭代加深，通过共享置换表加速主线程，
+  // 奇数编号的线程从更深一层开始，使各线程的搜索树错开
+  std::vector<std::thread> helpers;
+  for (int i = 1; i < threads; i++) {
+    helpers.emplace_back([&context, i](GameState state) {
+      clearKillerTable();
+      Move helperMove;
+      for (int d = 1 + (i & 1); d < 100 && !searchStopped(context); d++) {
+        TraceScope iteration("helperDepth", d);
+        SEARCH_NODES = 0;
+        alphaBetaSearch(state, d, -INF, INF, context, helperMove);
+        context.nodes += SEARCH_NODES;
+      }
+    }, *this);
+  }
+  int multiPV = std::max(1, limits.multiPV);
+  std::vector<PVLine> lines;
+  std::vector<Move> excluded;
+  if (restricted) {
+    for (Move legal : legalMoves()) {
+      if (std::find(limits.searchMoves.begin(), limits.searchMoves.end(), legal) == limits.searchMoves.end()) {
+        excluded.push_back(legal);
+      }
+    }
+  }
+  int maxDepth = limits.depth > 0 ? std::min(limits.depth, 99) : 99;
+  // 最佳着法在最近几层迭代中的变化程度，越不稳定用时越多
+  double instability = 0;
+  while (depth <= maxDepth) {
+    TraceScope iteration("depth", depth);
     bestEval = eval;
     bestMove = move;
-    // eval = mtdf(*this, depth, eval, deadline, move);
-    eval = alphaBetaSearch(*this, depth, -INF, INF, deadline, move);
-    uint64_t h = hash();
+    if (multiPV == 1 && !restricted) {
+      // eval = mtdf(*this, depth, eval, context, move);
+      eval = alphaBetaSearch(*this, depth, -INF, INF, context, move);
+    } else {
+      eval = multiPVSearch(*this, depth, multiPV, context, lines, excluded);
+      move = lines.empty() ? NULL_MOVE : lines[0].moves[0];
+    }
 #ifdef HAVE_SPDLOG
     spdlog::info("complete search depth: {}, score: {}, move: {} {}", depth, eval, move.src, move.dst);
 #endif
-    if (eval > 9999 || NOW >= deadline) {
+    iteration.end();
+    bool completed = !searchStopped(context);
+    if (callback && completed) {
+      SearchInfo info;
+      info.depth = depth;
+      info.score = eval;
+      info.bestMove = move;
+      info.nodes = SEARCH_NODES + context.nodes;
+      info.time = std::chrono::duration_cast<std::chrono::milliseconds>(NOW - start).count();
+      if (multiPV == 1 && !restricted) {
+        info.lines = {{eval, principalVariation(*this, move)}};
+      } else {
+        info.lines = lines;
+      }
+      callback(info);
+    }
+    if (eval > 9999 || !completed) {
       // 找到胜利着法
       break;
     }
+    if (clocked) {
+      instability = instability / 2 + (depth > 1 && !(move == bestMove) ? 1 : 0);
+      int64_t elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(NOW - start).count();
+      // 下一层迭代通常要花掉比已用时间更多的时间，预计在计划用时内完成不了时不再开始
+      if (elapsed > budget * (0.5 + 0.5 * instability)) {
+        break;
+      }
+    }
     depth++;
   }
+  context.stopped = true;
+  for (auto &helper : helpers) {
+    helper.join();
+  }
   if (eval > bestEval) {
     bestEval = eval;
     bestMove = move;
   }
 #ifdef HAVE_SPDLOG
-  spdlog::info("final eval: {}", bestEval);
+  spdlog::info("final eval: {}, nodes: {}", bestEval, SEARCH_NODES + context.nodes);
 #endif
   return bestMove;
 }
 
-int mtdf(GameState &gameState, int depth, int guess, time_point_t deadline, Move &bestMove) {
+// 根结点搜索，跳过 excluded 中的着法，不写入置换表
+int rootSearch(GameState &gameState, int depth, const std::vector<Move> &excluded, SearchContext &context,
+               Move &bestMove) {
+  TranspositionTableEntry entry;
+  Move hashMove = NULL_MOVE;
+  if (SEARCH_TABLE->get(gameState.hash(), entry)) {
+    hashMove = entry.bestMove;
+  }
+  SEARCH_NODES++;
+  auto moves = gameState.sortedLegalMoves(depth, hashMove);
+  int alpha = -INF, beta = INF, value = -INF, index = -1;
+  Move opponentMove;
+  std::vector<Move> searched;
+  bestMove = NULL_MOVE;
+  for (auto it = moves.rbegin(); it != moves.rend(); it++) {
+    Move move = *it;
+    // 置换表着法可能在列表中出现两次
+    if (std::find(excluded.begin(), excluded.end(), move) != excluded.end() ||
+        std::find(searched.begin(), searched.end(), move) != searched.end()) {
+      continue;
+    }
+    searched.push_back(move);
+    index++;
+    gameState.applyMove(move);
+    int current;
+    if (index > 1) {
+      current = -alphaBetaSearch(gameState, depth - 1, -alpha - 1, -alpha, context, opponentMove);
+      if (current > alpha && current < beta) {
+        current = -alphaBetaSearch(gameState, depth - 1, -beta, -alpha, context, opponentMove);
+      }
+    } else {
+      current = -alphaBetaSearch(gameState, depth - 1, -beta, -alpha, context, opponentMove);
+    }
+    gameState.undoMove(move);
+    if (current > value) {
+      value = current;
+      bestMove = move;
+    }
+    alpha = std::max(alpha, value);
+    if (searchStopped(context)) {
+      break;
+    }
+  }
+  return value;
+}
+
+int multiPVSearch(GameState &gameState, int depth, int count, SearchContext &context, std::vector<PVLine> &lines,
+                  std::vector<Move> excluded) {
+  lines.clear();
+  // 依次搜索每条变例，每次排除之前已经找到的根着法
+  for (int i = 0; i < count; i++) {
+    Move move;
+    int score = rootSearch(gameState, depth, excluded, context, move);
+    if (move.src < 0) {
+      break;
+    }
+    lines.push_back({score, principalVariation(gameState, move)});
+    excluded.push_back(move);
+    if (searchStopped(context)) {
+      break;
+    }
+  }
+  return lines.empty() ? -INF : lines[0].score;
+}
+
+std::vector<Move> principalVariation(GameState gameState, Move first, int maxLength) {
+  std::vector<Move> pv;
+  if (first.src < 0) {
+    return pv;
+  }
+  pv.push_back(first);
+  gameState.applyMove(first);
+  TranspositionTableEntry entry;
+  // 沿置换表中的最佳着法前进，着法不合法或局面结束时停止
+  while ((int)pv.size() < maxLength && !gameState.isGameOver() && SEARCH_TABLE->get(gameState.hash(), entry)) {
+    Move move = entry.bestMove;
+    if (move.src < 0 || !(gameState.board[gameState.turn] >> move.src & 1) ||
+        !(gameState.legalDestinations(move.src) >> move.dst & 1)) {
+      break;
+    }
+    pv.push_back(move);
+    gameState.applyMove(move);
+  }
+  return pv;
+}
+
+int mtdf(GameState &gameState, int depth, int guess, SearchContext &context, Move &bestMove) {
   int beta;
   int upperbound = INF;
   int lowerbound = -INF;
   int score = guess;
   do {
     beta = (score == lowerbound ? score + 1 : score);
-    score = alphaBetaSearch(gameState, depth, beta - 1, beta, deadline, bestMove);
+    score = alphaBetaSearch(gameState, depth, beta - 1, beta, context, bestMove);
     (score < beta ? upperbound : lowerbound) = score;
   } while (lowerbound < upperbound);
   return score;
 }
 
-int alphaBetaSearch(GameState &gameState, int depth, int alpha, int beta, time_point_t deadline, Move &bestMove) {
+int alphaBetaSearch(GameState &gameState, int depth, int alpha, int beta, SearchContext &context, Move &bestMove) {
   // 查询置换表
   uint64_t hash = gameState.hash();
   int alphaOrig = alpha;
   bestMove = NULL_MOVE;
 
-  if (HASH_TABLE.exists(hash)) {
-    auto result = HASH_TABLE.get(hash);
+  TranspositionTableEntry result;
+  SEARCH_NODES++;
+  if (SEARCH_TABLE->get(hash, result)) {
+    // 先取出置换表着法，命中截断时根结点也能返回有效着法
+    if (result.bestMove.src >= 0) {
+      bestMove = result.bestMove;
+    }
     if (result.depth >= depth) {
       if (result.flag == HASH_EXACT) {
         return result.value;
@@ -382,9 +791,6 @@ int alphaBetaSearch(GameState &gameState, int depth, int alpha, int beta, time_p
         return result.value;
       }
     }
-    if (result.bestMove.src >= 0) {
-      bestMove = result.bestMove;
-    }
   }
 
   // 叶子结点
@@ -401,7 +807,7 @@ int alphaBetaSearch(GameState &gameState, int depth, int alpha, int beta, time_p
   // 空着裁剪
   if (depth - 1 - NULL_MOVE_R > 0) {
     gameState.applyNullMove();
-    int current = -alphaBetaSearch(gameState, depth - 1 - NULL_MOVE_R, -beta, -beta + 1, deadline, opponentMove);
+    int current = -alphaBetaSearch(gameState, depth - 1 - NULL_MOVE_R, -beta, -beta + 1, context, opponentMove);
     gameState.undoNullMove();
     if (current >= beta) {
       return current;
@@ -415,12 +821,12 @@ int alphaBetaSearch(GameState &gameState, int depth, int alpha, int beta, time_p
     gameState.applyMove(move);
     int current;
     if (index > 1) {
-      current = -alphaBetaSearch(gameState, depth - 1, -alpha - 1, -alpha, deadline, opponentMove);
+      current = -alphaBetaSearch(gameState, depth - 1, -alpha - 1, -alpha, context, opponentMove);
       if (current > alpha && current < beta) {
-        current = -alphaBetaSearch(gameState, depth - 1, -beta, -alpha, deadline, opponentMove);
+        current = -alphaBetaSearch(gameState, depth - 1, -beta, -alpha, context, opponentMove);
       }
     } else {
-      current = -alphaBetaSearch(gameState, depth - 1, -beta, -alpha, deadline, opponentMove);
+      current = -alphaBetaSearch(gameState, depth - 1, -beta, -alpha, context, opponentMove);
     }
     gameState.undoMove(move);
     if (current > value) {
@@ -435,7 +841,7 @@ int alphaBetaSearch(GameState &gameState, int depth, int alpha, int beta, time_p
       break;
     }
     // 超时检测
-    if (NOW >= deadline) {
+    if (searchStopped(context)) {
       return value;
     }
   }
@@ -446,37 +852,35 @@ int alphaBetaSearch(GameState &gameState, int depth, int alpha, int beta, time_p
   } else {
     flag = HASH_EXACT;
   }
-  HASH_TABLE.put(hash, {hash, value, depth, flag, bestMove});
+  SEARCH_TABLE->put(hash, {hash, value, depth, flag, bestMove});
   return value;
 }
 
 Move searchBook(uint64_t hash) {
-  if (BOOK.empty()) {
-#ifdef HAVE_SPDLOG
-    spdlog::info("loading opening book");
-#endif
-    int count = book_dat_len / sizeof(BookEntry);
-    BookEntry entry;
-    for (int i = 0; i < count; i++) {
-      memcpy(&entry, book_dat + i * sizeof(BookEntry), sizeof(BookEntry));
-      BOOK.push_back(entry);
-    }
-  }
+  // 开局库是编译期常量数组，直接在原地二分查找
   BookEntry entry = {hash, 0, 0};
-  auto it = std::lower_bound(BOOK.begin(), BOOK.end(), entry);
-  std::vector<BookEntry> match;
-  if (it != BOOK.end()) {
-    while (it->hash == hash) {
-      match.push_back(*it);
-      it++;
-    }
+  auto end = std::end(BOOK);
+  auto first = std::lower_bound(std::begin(BOOK), end, entry);
+  auto last = first;
+  while (last != end && last->hash == hash) {
+    last++;
   }
 
   // 随机选择一个着法
-  if (!match.empty()) {
-    int i = std::rand() % match.size();
-    return {match[i].src, match[i].dst};
+  if (first != last) {
+    int i = std::rand() % (last - first);
+    return {first[i].src, first[i].dst};
   }
 
   return NULL_MOVE;
 }
+
+std::vector<Move> bookMoves(uint64_t hash) {
+  BookEntry entry = {hash, 0, 0};
+  std::vector<Move> moves;
+  for (auto it = std::lower_bound(std::begin(BOOK), std::end(BOOK), entry); it != std::end(BOOK) && it->hash == hash;
+       it++) {
+    moves.push_back({it->src, it->dst});
+  }
+  return moves;
+}
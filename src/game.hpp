@@ -1,12 +1,13 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <cache.hpp>
 #include <chrono>
 #include <climits>
 #include <fstream>
+#include <functional>
 #include <list>
-#include <map>
 #include <set>
 #include <string>
 #include <vector>
@@ -31,6 +32,90 @@ struct Move {
   int dst;
 };
 
+enum SearchBackend {
+  // 迭代加深的 PVS 搜索
+  BACKEND_ALPHABETA,
+  // 多线程 PUCT 蒙特卡洛树搜索，见 mcts.hpp
+  BACKEND_MCTS,
+};
+
+// 对局时钟，设置后按剩余时间为每一步分配思考时间
+struct TimeControl {
+  // 走棋一方的剩余时间 (毫秒)，0 表示不使用时钟
+  int64_t remaining = 0;
+  // 每步加时 (毫秒)
+  int64_t increment = 0;
+  // 到下一个时限还要走的步数，0 表示剩余时间要用到终局
+  int movesToGo = 0;
+};
+
+// 搜索限制
+struct SearchLimits {
+  // 思考时间 (秒)
+  int timeLimit = 10;
+  // 思考时间 (毫秒)，不为 0 时代替 timeLimit，用于毫秒级的快速应答
+  int moveTime = 0;
+  // 对局时钟，remaining 不为 0 时代替 timeLimit 和 moveTime
+  TimeControl clock;
+  // 无限搜索直到 stop 被置位，用于后台思考
+  bool infinite = false;
+  // 外部停止标志，可以为空
+  const std::atomic<bool> *stop = nullptr;
+  // 搜索线程数，0 表示使用 setSearchThreads 的设置
+  int threads = 0;
+  // 同时给出的主要变例条数
+  int multiPV = 1;
+  // 搜索算法
+  SearchBackend backend = BACKEND_ALPHABETA;
+  // 只搜索这些根着法，为空时搜索全部着法
+  std::vector<Move> searchMoves;
+  // 最大搜索深度，0 表示不限制
+  int depth = 0;
+  // 主线程最多搜索的结点数，0 表示不限制。只用一个线程时搜索结果与机器快慢无关
+  uint64_t nodes = 0;
+  // 棋力等级 1 到 SKILL_LEVELS，0 表示全力搜索，见 SKILL_LEVEL_TABLE
+  int skill = 0;
+};
+
+const int SKILL_LEVELS = 5;
+
+// 一条主要变例，score 为走棋一方的评分
+struct PVLine {
+  int score;
+  std::vector<Move> moves;
+};
+
+// 每完成一层迭代加深后报告的搜索进度
+struct SearchInfo {
+  int depth;
+  int score;
+  Move bestMove;
+  uint64_t nodes;
+  // 已用时间 (毫秒)
+  int64_t time;
+  // 按评分从高到低排列的主要变例
+  std::vector<PVLine> lines;
+};
+
+using SearchCallback = std::function<void(const SearchInfo &)>;
+
+// 一次搜索中所有搜索线程共享的控制信息
+struct SearchContext {
+  time_point_t deadline;
+  std::atomic<bool> stopped;
+  const std::atomic<bool> *stop;
+  // 辅助线程完成每层迭代后累加的结点数
+  std::atomic<uint64_t> nodes;
+  // 主线程最多搜索的结点数
+  uint64_t nodeLimit = UINT64_MAX;
+};
+
+inline bool timeout(const SearchContext &context) {
+  return context.stopped.load(std::memory_order_relaxed) ||
+         (context.stop != nullptr && context.stop->load(std::memory_order_relaxed)) ||
+         std::chrono::high_resolution_clock::now() >= context.deadline;
+}
+
 struct BookEntry {
   uint64_t hash;
   int src;
@@ -63,25 +148,14 @@ const int PIECE_SCORE_TABLE[81] = {
     10, 10, 12, 20, 31, 36, 38, 40, 42,  // 8
 };
 
+inline int popcount_u128(uint128_t u) {
+  return __builtin_popcountll((uint64_t)u) + __builtin_popcountll((uint64_t)(u >> 64));
+}
+
 inline bool operator<(const Move &a, const Move &b);
 inline bool operator==(const Move &a, const Move &b);
 inline bool operator<(const BookEntry &a, const BookEntry &b) { return a.hash < b.hash; }
 
-const std::map<uint128_t, Move> OPENINGS[3] = {
-    {},
-    {
-        {((uint128_t)0x000000000001e0e0 << 64) | 0x6020000000000000, {53, 52}},
-        {((uint128_t)0x000000000001e0e0 << 64) | 0x6010000000000000, {71, 51}},
-        {((uint128_t)0x000000000001e060 << 64) | 0x6018000000000000, {78, 42}},
-        {((uint128_t)0x000000000001a060 << 64) | 0x6018040000000000, {61, 41}},
-    },
-    {
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000080c0e0f, {27, 28}},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000100c0e0f, {9, 29}},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000000300c0c0f, {2, 38}},
-        {((uint128_t)0x0000000000000000 << 64) | 0x00000040300c0c0b, {19, 39}},
-    }};
-
 class GameState {
  public:
   uint128_t board[3];
@@ -90,23 +164,43 @@ class GameState {
   uint64_t zobristHash;
   GameState();
   GameState(GameState const &gameState);
+  GameState &operator=(GameState const &gameState) = default;
   explicit GameState(const std::string &state);
   std::vector<int> getBoard();
   Color getTurn() const;
   std::vector<Move> legalMoves();
   std::vector<Move> sortedLegalMoves(int depth, Move historyBestMove);
+  // src 位置的棋子可以到达的所有位置
+  uint128_t legalDestinations(int src);
   void jumpMoves(int src, uint128_t &to);
   void applyMove(Move move);
   void undoMove(Move move);
   void applyNullMove();
   void undoNullMove();
   int evaluate();
-  bool isGameOver();
+  bool isGameOver() const;
   Move searchBestMove(int timeLimit);
+  Move searchBestMove(const SearchLimits &limits, SearchCallback callback = nullptr);
   std::string toString();
   uint64_t hash();
 };
 
-int mtdf(GameState &gameState, int depth, int guess, time_point_t deadline, Move &bestMove);
-int alphaBetaSearch(GameState &gameState, int depth, int alpha, int beta, time_point_t deadline, Move &bestMove);
+int mtdf(GameState &gameState, int depth, int guess, SearchContext &context, Move &bestMove);
+int alphaBetaSearch(GameState &gameState, int depth, int alpha, int beta, SearchContext &context, Move &bestMove);
+// excluded 中的根着法不参与搜索
+int multiPVSearch(GameState &gameState, int depth, int count, SearchContext &context, std::vector<PVLine> &lines,
+                  std::vector<Move> excluded = std::vector<Move>());
+std::vector<Move> principalVariation(GameState gameState, Move first, int maxLength = 32);
+// 局面是否可以交给搜索：走棋方为红或绿，每方正好 10 枚棋子，棋子都在棋盘上并且互不重叠。
+// 搜索和各个求解器都假定局面满足这些条件，外部输入的局面在搜索前必须检查
+bool isValidPosition(const GameState &gameState);
 Move searchBook(uint64_t hash);
+// 开局库中该局面的全部着法，不在开局库中时为空
+std::vector<Move> bookMoves(uint64_t hash);
+void setHashSize(int megabytes);
+void clearHash();
+// 保存深度最大的 percent% 置换表条目，供重启后用 loadHash 预热；失败时抛出 std::runtime_error
+size_t saveHash(const std::string &path, int percent = 100);
+size_t loadHash(const std::string &path);
+void setSearchThreads(int threads);
+int getSearchThreads();
@@ -0,0 +1,144 @@
+#include "engine.hpp"
+
+#include <FL/Fl.H>
+
+#include <algorithm>
+#include <memory>
+
+// 搜索进度刷新到界面的最小间隔 (秒)
+const double INFO_INTERVAL = 0.2;
+
+Engine::Engine() : stop_flag(false), generation(0), mode(IDLE), latest_generation(-1), info_pending(false) {}
+
+Engine::~Engine() {
+  stop();
+  Fl::remove_timeout(Engine::deliver_info, this);
+}
+
+void Engine::think(const GameState& state, int time_limit, int skill, callback_t on_done,
+                   info_callback_t on_info) {
+  SearchLimits limits;
+  limits.timeLimit = time_limit;
+  limits.skill = skill;
+  limits.threads = std::max(1, (int)std::thread::hardware_concurrency());
+  start(state, limits, THINKING, on_done, on_info);
+}
+
+void Engine::ponder(const GameState& state) {
+  if (state.isGameOver()) {
+    stop();
+    return;
+  }
+  SearchLimits limits;
+  limits.infinite = true;
+  limits.threads = std::max(1, (int)std::thread::hardware_concurrency() - 1);
+  start(state, limits, PONDERING, nullptr, nullptr);
+}
+
+void Engine::analyze(const GameState& state, int multi_pv, info_callback_t on_info) {
+  if (state.isGameOver()) {
+    stop();
+    return;
+  }
+  SearchLimits limits;
+  limits.infinite = true;
+  limits.threads = std::max(1, (int)std::thread::hardware_concurrency());
+  limits.multiPV = multi_pv;
+  start(state, limits, ANALYZING, nullptr, on_info);
+}
+
+void Engine::move_now() {
+  if (mode == THINKING) {
+    stop_flag = true;
+  }
+}
+
+void Engine::stop() {
+  stop_flag = true;
+  if (search_thread.joinable()) {
+    search_thread.join();
+  }
+  // 使已经排队的 Fl::awake 结果失效
+  generation++;
+  mode = IDLE;
+  on_done = nullptr;
+  on_info = nullptr;
+}
+
+bool Engine::thinking() const { return mode == THINKING; }
+
+bool Engine::analyzing() const { return mode == ANALYZING; }
+
+void Engine::start(const GameState& state, const SearchLimits& limits, Mode mode, callback_t on_done,
+                   info_callback_t on_info) {
+  stop();
+  stop_flag = false;
+  this->mode = mode;
+  this->on_done = on_done;
+  this->on_info = on_info;
+  int current = generation;
+  bool report = on_info != nullptr;
+  search_thread = std::thread(
+      [this, limits, current, report](GameState state) {
+        SearchLimits search_limits = limits;
+        search_limits.stop = &stop_flag;
+        SearchCallback callback = nullptr;
+        if (report) {
+          callback = [this, current](const SearchInfo& info) { post_info(current, info); };
+        }
+        Move move = state.searchBestMove(search_limits, callback);
+        Fl::awake(Engine::deliver, new Result{this, current, move});
+      },
+      state);
+}
+
+void Engine::post_info(int generation, const SearchInfo& info) {
+  std::lock_guard<std::mutex> guard(info_mutex);
+  latest_info = info;
+  latest_generation = generation;
+  // 上一次的进度还没被主线程取走时只更新内容，不再唤醒
+  if (!info_pending) {
+    info_pending = true;
+    Fl::awake(Engine::deliver_info, this);
+  }
+}
+
+void Engine::deliver_info(void* data) {
+  Engine* engine = static_cast<Engine*>(data);
+  auto now = std::chrono::steady_clock::now();
+  double elapsed = std::chrono::duration<double>(now - engine->last_info_time).count();
+  if (elapsed < INFO_INTERVAL) {
+    Fl::add_timeout(INFO_INTERVAL - elapsed, Engine::deliver_info, engine);
+    return;
+  }
+  SearchInfo info;
+  int info_generation;
+  {
+    std::lock_guard<std::mutex> guard(engine->info_mutex);
+    info = engine->latest_info;
+    info_generation = engine->latest_generation;
+    engine->info_pending = false;
+  }
+  engine->last_info_time = now;
+  if (info_generation == engine->generation && engine->on_info) {
+    engine->on_info(info);
+  }
+}
+
+void Engine::deliver(void* data) {
+  std::unique_ptr<Result> result(static_cast<Result*>(data));
+  Engine* engine = result->engine;
+  if (result->generation != engine->generation || engine->mode != THINKING) {
+    return;
+  }
+  if (engine->search_thread.joinable()) {
+    engine->search_thread.join();
+  }
+  auto on_done = engine->on_done;
+  engine->mode = IDLE;
+  engine->on_done = nullptr;
+  engine->on_info = nullptr;
+  if (on_done) {
+    on_done(result->move);
+  }
+}
@@ -0,0 +1,59 @@
+#ifndef ENGINE_H
+#define ENGINE_H
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <game.hpp>
+#include <mutex>
+#include <thread>
+
+// GUI 持有的引擎句柄。搜索在后台线程中的局面副本上进行，结果通过 Fl::awake
+// 交给主线程；停止或开始新的搜索时会等待旧线程退出，过期的结果直接丢弃。
+class Engine {
+ public:
+  using callback_t = std::function<void(Move move)>;
+  using info_callback_t = std::function<void(const SearchInfo& info)>;
+  Engine();
+  ~Engine();
+  // 电脑走棋，使用全部核心，完成后在主线程调用 on_done，搜索进度交给 on_info；skill 为 0 时全力搜索
+  void think(const GameState& state, int time_limit, int skill, callback_t on_done,
+             info_callback_t on_info = nullptr);
+  // 玩家回合在后台搜索当前局面以预热置换表，留一个核心给界面
+  void ponder(const GameState& state);
+  // 分析模式，使用全部核心在当前局面上无限搜索，给出 multi_pv 条主要变例
+  void analyze(const GameState& state, int multi_pv, info_callback_t on_info);
+  // 立即结束思考，走出目前最好的着法
+  void move_now();
+  // 停止搜索并丢弃结果
+  void stop();
+  bool thinking() const;
+  bool analyzing() const;
+
+ private:
+  enum Mode { IDLE, THINKING, PONDERING, ANALYZING };
+  struct Result {
+    Engine* engine;
+    int generation;
+    Move move;
+  };
+  static void deliver(void* data);
+  static void deliver_info(void* data);
+  void post_info(int generation, const SearchInfo& info);
+  void start(const GameState& state, const SearchLimits& limits, Mode mode, callback_t on_done,
+             info_callback_t on_info);
+  std::thread search_thread;
+  std::atomic<bool> stop_flag;
+  int generation;
+  Mode mode;
+  callback_t on_done;
+  info_callback_t on_info;
+  // 搜索线程写入最新进度，主线程限频读取
+  std::mutex info_mutex;
+  SearchInfo latest_info;
+  int latest_generation;
+  bool info_pending;
+  std::chrono::steady_clock::time_point last_info_time;
+};
+
+#endif
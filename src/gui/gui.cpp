@@ -13,18 +13,25 @@
 #include <game.hpp>
 #include <iostream>
 #include <stack>
-#include <thread>
 
+#include "engine.hpp"
 #include "fonts/RubikMonoOne-Regular.h"
 #include "fonts/icon.h"
 #include "utils.hpp"
+#include "widgets/Fl_AnalysisPanel.hpp"
 #include "widgets/Fl_ChessBoard.hpp"
+#include "widgets/Fl_EvalGraph.hpp"
 #include "widgets/Fl_IconButton.hpp"
 
 namespace App {
 using cb_t = std::function<void(Fl_Widget* w)>;
 
 int COMPUTER_THINK_TIME[3] = {5, 10, 15};
+// 各难度的棋力等级，简单和中等按结点数限制搜索，几毫秒就能走棋，困难用满思考时间
+int COMPUTER_SKILL[3] = {2, 4, 0};
+// 分析面板宽度和显示的变例条数
+const int ANALYSIS_WIDTH = 300;
+const int ANALYSIS_LINES = 3;
 
 auto adapter = [](Fl_Widget* w, void* data) {
   cb_t* func = reinterpret_cast<cb_t*>(data);
@@ -71,6 +78,9 @@ void styled_input(Fl_Choice* input) {
   input->clear_visible_focus();
 }
 
+// 从开局算起的半回合数，用作评分曲线的横坐标
+inline int ply(const GameState& state) { return (state.round - 1) * 2 + (state.turn == GREEN ? 1 : 0); }
+
 void init() {
   Fl::lock();
   Fl_load_memory_font("RubicMonoOne.ttf", (const char*)RubikMonoOne_Regular_ttf, RubikMonoOne_Regular_ttf_len);
@@ -90,10 +100,13 @@ int run(int argc, char* argv[]) {
   int center_x = (Fl::w() - 620) / 2;
   int center_y = (Fl::h() - 724) / 2;
   auto window = new Fl_Double_Window(center_x, center_y, 620, 724, "中国跳棋");
+  auto mainArea = new Fl_Flex(0, 0, 620, 684, Fl_Flex::HORIZONTAL);
   auto gameArea = new Fl_Flex(0, 0, 620, 684);
   int my_color = RED;
   int difficulty = 1;
+  bool analysis_on = false;
   std::stack<Move> history;
+  Engine engine;
   auto game_state = new GameState();
   gameArea->box(FL_FLAT_BOX);
   gameArea->color(0xe8b06100);
@@ -103,6 +116,14 @@ int run(int argc, char* argv[]) {
   board->set_game_state(game_state);
   board->user_color(my_color);
   gameArea->end();
+  auto analysisArea = new Fl_Flex(0, 0, ANALYSIS_WIDTH, 684, Fl_Flex::VERTICAL);
+  auto panel = new Fl_AnalysisPanel(0, 0, 0, 0);
+  auto graph = new Fl_EvalGraph(0, 0, 0, 0);
+  analysisArea->end();
+  analysisArea->fixed(graph, 180);
+  analysisArea->hide();
+  mainArea->end();
+  mainArea->fixed(analysisArea, ANALYSIS_WIDTH);
   auto controlArea = new Fl_Flex(0, 684, 620, 40, Fl_Flex::HORIZONTAL);
   controlArea->box(FL_FLAT_BOX);
   controlArea->color(0x2060c800);
@@ -116,14 +137,41 @@ int run(int argc, char* argv[]) {
   auto line3 = new Fl_Box(0, 0, 0, 0);
   styled_line(line3);
   auto btn4 = new Fl_IconButton(0, 0, 0, 0, " 显示编号", Fl_IconButton::ICON_1_CIRCLE_FILL);
+  auto line4 = new Fl_Box(0, 0, 0, 0);
+  styled_line(line4);
+  auto btn5 = new Fl_IconButton(0, 0, 0, 0, " 立即走棋", Fl_IconButton::ICON_LIGHTNING_FILL);
+  auto line5 = new Fl_Box(0, 0, 0, 0);
+  styled_line(line5);
+  auto btn6 = new Fl_IconButton(0, 0, 0, 0, " 分析", Fl_IconButton::ICON_GRAPH_UP);
   controlArea->end();
   controlArea->fixed(line1, 1);
   controlArea->fixed(line2, 1);
   controlArea->fixed(line3, 1);
-  window->resizable(gameArea);
+  controlArea->fixed(line4, 1);
+  controlArea->fixed(line5, 1);
+  window->resizable(mainArea);
   window->end();
 
-  cb_t cb1 = [window, &game_state, &board, &history, &my_color, &difficulty](Fl_Widget* w) {
+  // 搜索进度：更新分析面板，并记录被搜索局面的红方视角评分
+  Engine::info_callback_t on_info = [&game_state, panel, graph](const SearchInfo& info) {
+    int turn = game_state->turn;
+    panel->update(info, turn);
+    graph->set(ply(*game_state), turn == RED ? info.score : -info.score);
+  };
+
+  // 玩家回合引擎的工作：分析模式下分析当前局面，否则在后台思考；低难度只搜索很少的结点，不需要后台思考
+  std::function<void()> engine_idle = [&engine, &game_state, &analysis_on, &on_info, &difficulty]() {
+    if (analysis_on) {
+      engine.analyze(*game_state, ANALYSIS_LINES, on_info);
+    } else if (COMPUTER_SKILL[difficulty] == 0) {
+      engine.ponder(*game_state);
+    } else {
+      engine.stop();
+    }
+  };
+
+  cb_t cb1 = [window, panel, graph, &game_state, &board, &history, &engine, &engine_idle, &my_color,
+              &difficulty](Fl_Widget* w) {
     int center_x = (window->w() - 300) / 2 + window->x();
     int center_y = (window->h() - 200) / 2 + window->y();
     auto dialog = new Fl_Double_Window(center_x, center_y, 300, 210, "新游戏");
@@ -169,10 +217,13 @@ int run(int argc, char* argv[]) {
     }
 
     if (confirmed) {
+      engine.stop();
       difficulty = difficulty_choice->value();
       auto old_state = game_state;
       game_state = new GameState();
       history = std::stack<Move>();
+      panel->clear();
+      graph->clear();
       board->set_game_state(game_state);
       if (color_choice->value() == 0) {
         my_color = RED;
@@ -182,6 +233,7 @@ int run(int argc, char* argv[]) {
         board->user_color(GREEN);
         board->move({53, 52});
       }
+      engine_idle();
       delete old_state;
     }
     delete ok_button;
@@ -208,30 +260,65 @@ int run(int argc, char* argv[]) {
     }
   };
 
-  cb_t cb3 = [&board, &game_state, &history, &difficulty](Fl_Widget* w) {
+  cb_t cb3 = [&board, &game_state, &history, &engine, &engine_idle, &on_info, &difficulty](Fl_Widget* w) {
     history.push(board->get_user_last_move());
-    std::thread searchThread([&game_state, &board, &history, &difficulty]() {
-      GameState state = *game_state;
-      Move move = state.searchBestMove(COMPUTER_THINK_TIME[difficulty]);
-      history.push(move);
-      Fl::lock();
-      board->move(move);
-      Fl::unlock();
-      Fl::awake();
-    });
-    searchThread.detach();
+    if (game_state->isGameOver()) {
+      engine.stop();
+      return;
+    }
+    engine.think(
+        *game_state, COMPUTER_THINK_TIME[difficulty], COMPUTER_SKILL[difficulty],
+        [&board, &history, &engine_idle](Move move) {
+          history.push(move);
+          board->move(move);
+          engine_idle();
+        },
+        on_info);
   };
 
-  cb_t cb5 = [&board, &game_state, &my_color, &history](Fl_Widget* w) {
-    if (game_state->turn == my_color && history.size() >= 2) {
+  cb_t cb5 = [&board, &game_state, &my_color, &history, &engine, &engine_idle, graph](Fl_Widget* w) {
+    if (engine.thinking() && !history.empty()) {
+      // 电脑思考中悔棋：放弃本次搜索，只撤销玩家刚走的一步
+      engine.stop();
+      game_state->undoMove(history.top());
+      history.pop();
+      board->reset_moves();
+      board->redraw();
+      graph->truncate(ply(*game_state) + 1);
+      engine_idle();
+    } else if (game_state->turn == my_color && history.size() >= 2) {
+      engine.stop();
       Move move = history.top();
       history.pop();
       game_state->undoMove(move);
       move = history.top();
       history.pop();
       game_state->undoMove(move);
-      board->fill_moves();
+      board->reset_moves();
       board->redraw();
+      graph->truncate(ply(*game_state) + 1);
+      engine_idle();
+    }
+  };
+
+  cb_t cb6 = [&engine](Fl_Widget* w) { engine.move_now(); };
+
+  cb_t cb7 = [window, mainArea, analysisArea, panel, btn6, &analysis_on, &engine, &engine_idle](Fl_Widget* w) {
+    analysis_on = !analysis_on;
+    if (analysis_on) {
+      analysisArea->show();
+      window->size(window->w() + ANALYSIS_WIDTH, window->h());
+      btn6->label(" 关闭分析");
+    } else {
+      analysisArea->hide();
+      window->size(window->w() - ANALYSIS_WIDTH, window->h());
+      btn6->label(" 分析");
+    }
+    mainArea->layout();
+    panel->clear();
+    // 电脑思考时不打断，走完后自动进入分析或后台思考
+    if (!engine.thinking()) {
+      engine_idle();
     }
   };
 
@@ -239,9 +326,12 @@ int run(int argc, char* argv[]) {
   btn2->callback(adapter, &cb5);
   btn3->callback(adapter, &cb4);
   btn4->callback(adapter, &cb2);
+  btn5->callback(adapter, &cb6);
+  btn6->callback(adapter, &cb7);
   board->callback(adapter, &cb3);
   window->size_range(400, 500, 0, 0);
   window->show(argc, argv);
+  engine_idle();
   return Fl::run();
 }
 }  // namespace App
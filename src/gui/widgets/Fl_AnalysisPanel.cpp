@@ -0,0 +1,69 @@
+#include "Fl_AnalysisPanel.hpp"
+
+#include <FL/fl_draw.H>
+
+#include <cstdio>
+#include <string>
+
+Fl_AnalysisPanel::Fl_AnalysisPanel(int x, int y, int w, int h)
+    : Fl_Widget(x, y, w, h), info(), has_info(false), turn(RED) {}
+
+inline std::string format_score(int score) { return (score > 0 ? "+" : "") + std::to_string(score); }
+
+inline std::string format_nps(uint64_t nodes, int64_t time) {
+  double nps = time > 0 ? nodes * 1000.0 / time : 0;
+  char buffer[32];
+  if (nps >= 1e6) {
+    snprintf(buffer, sizeof(buffer), "%.1fM/s", nps / 1e6);
+  } else {
+    snprintf(buffer, sizeof(buffer), "%.0fK/s", nps / 1e3);
+  }
+  return buffer;
+}
+
+void Fl_AnalysisPanel::draw() {
+  fl_rectf(x(), y(), w(), h(), 0xf3dfb900);
+  fl_push_clip(x(), y(), w(), h());
+  int line_height = 22;
+  int cx = x() + 10;
+  int cy = y() + 10;
+  fl_color(0x4b310c00);
+  fl_font(FL_HELVETICA_BOLD, 15);
+  fl_draw("分析", cx, cy, w() - 20, line_height, FL_ALIGN_LEFT);
+  cy += line_height + 4;
+  fl_font(FL_HELVETICA, 13);
+  if (!has_info) {
+    fl_draw("等待搜索结果…", cx, cy, w() - 20, line_height, FL_ALIGN_LEFT);
+    fl_pop_clip();
+    return;
+  }
+  int sign = turn == RED ? 1 : -1;
+  std::string summary = "深度 " + std::to_string(info.depth) + "   速度 " + format_nps(info.nodes, info.time) +
+                        "   红方评分 " + format_score(sign * info.score);
+  fl_draw(summary.c_str(), cx, cy, w() - 20, line_height, FL_ALIGN_LEFT | FL_ALIGN_CLIP);
+  cy += line_height + 6;
+  fl_font(FL_COURIER, 13);
+  for (size_t i = 0; i < info.lines.size(); i++) {
+    auto& line = info.lines[i];
+    std::string text = std::to_string(i + 1) + ". " + format_score(sign * line.score) + "  ";
+    for (auto& move : line.moves) {
+      text += std::to_string(move.src) + "-" + std::to_string(move.dst) + " ";
+    }
+    // 变例较长时折行显示，最多占两行
+    fl_draw(text.c_str(), cx, cy, w() - 20, line_height * 2, FL_ALIGN_LEFT | FL_ALIGN_TOP | FL_ALIGN_WRAP | FL_ALIGN_CLIP);
+    cy += line_height * 2 + 4;
+  }
+  fl_pop_clip();
+}
+
+void Fl_AnalysisPanel::update(const SearchInfo& info, int turn) {
+  this->info = info;
+  this->turn = turn;
+  has_info = true;
+  redraw();
+}
+
+void Fl_AnalysisPanel::clear() {
+  has_info = false;
+  redraw();
+}
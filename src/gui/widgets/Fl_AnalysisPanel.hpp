@@ -0,0 +1,23 @@
+#ifndef Fl_AnalysisPanel_H
+#define Fl_AnalysisPanel_H
+
+#include <FL/Fl_Widget.H>
+
+#include <game.hpp>
+
+// 显示分析结果：深度、速度、评分和若干条主要变例
+class Fl_AnalysisPanel : public Fl_Widget {
+ private:
+  SearchInfo info;
+  bool has_info;
+  int turn;
+
+ public:
+  Fl_AnalysisPanel(int x, int y, int w, int h);
+  void draw() override;
+  // turn 为被分析局面的走棋方，评分统一换算为红方视角
+  void update(const SearchInfo& info, int turn);
+  void clear();
+};
+
+#endif
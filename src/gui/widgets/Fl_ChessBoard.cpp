@@ -2,12 +2,12 @@
 
 #include <FL/Fl_Group.H>
 #include <FL/Fl_Widget.H>
+#include <FL/Fl_Window.H>
 #include <FL/fl_draw.H>
 
 #include <cmath>
+#include <cstdio>
 #include <cstring>
-#include <iostream>
-#include <vector>
 
 const double M_SQRT3 = 1.732050807568877293;
 
@@ -130,6 +130,29 @@ inline void circle(double x, double y, double r, Fl_Color fill_color, Fl_Color b
   fl_end_line();
 }
 
+// 棋孔编号文本，避免每帧格式化字符串
+struct CellLabels {
+  char text[81][3];
+  CellLabels() {
+    for (int i = 0; i < 81; i++) {
+      std::snprintf(text[i], sizeof(text[i]), "%d", i);
+    }
+  }
+};
+
+const CellLabels CELL_LABELS;
+
+const double CELL_RADIUS = 19;
+
+inline void cell_label(int index, double cx, double cy, Fl_Color text_color) {
+  int text_dx, text_dy, text_width, text_height;
+  const char* text = CELL_LABELS.text[index];
+  fl_color(text_color);
+  fl_text_extents(text, text_dx, text_dy, text_width, text_height);
+  fl_graphics_driver->draw(text, std::strlen(text), (float)(cx - text_dx - (float)text_width / 2),
+                           (float)(cy - text_dy - (float)text_height / 2));
+}
+
 Fl_ChessBoard::Fl_ChessBoard(int x, int y, int w, int h, int my_color)
     : Fl_Widget(x, y, w, h),
       scale(1),
@@ -137,23 +160,35 @@ Fl_ChessBoard::Fl_ChessBoard(int x, int y, int w, int h, int my_color)
       dy(0),
       game_state(nullptr),
       selected_piece(-1),
+      cached_sources(0),
       last_move{-1, -1},
       show_number(false),
       my_color(my_color),
+      static_layer(0),
+      layer_w(0),
+      layer_h(0),
+      layer_scale(0),
+      layer_dirty(true),
       is_tick(true) {
   Fl::add_timeout(0.6, Fl_ChessBoard::tick, this);
 }
 
+Fl_ChessBoard::~Fl_ChessBoard() {
+  Fl::remove_timeout(Fl_ChessBoard::tick, this);
+  if (static_layer) {
+    fl_delete_offscreen(static_layer);
+  }
+}
+
 void Fl_ChessBoard::tick(void* data) {
   auto board = reinterpret_cast<Fl_ChessBoard*>(data);
   board->is_tick = !board->is_tick;
-  board->redraw();
+  // 闪烁只影响回合指示点
+  board->damage_indicator();
   Fl::repeat_timeout(0.6, Fl_ChessBoard::tick, data);
 }
 
-void Fl_ChessBoard::draw() {
-  fl_rectf(x(), y(), w(), h(), 0xe8b06100);
-  double radius = 19;
+void Fl_ChessBoard::update_layout() {
   dx = x();
   dy = y();
   if (w() * 684.0 > h() * 620.0) {
@@ -163,106 +198,180 @@ void Fl_ChessBoard::draw() {
     scale = w() / 620.0;
     dy += (h() - 684 * scale) / 2;
   }
-  radius *= scale;
+}
+
+void Fl_ChessBoard::cell_center(int index, double& cx, double& cy) {
+  if (my_color == GREEN) {
+    index = 80 - index;
+  }
+  cx = CIRCLE_POSITIONS[index][0] * scale + dx;
+  cy = CIRCLE_POSITIONS[index][1] * scale + dy;
+}
+
+bool Fl_ChessBoard::indicator_center(double& cx, double& cy) {
+  if (game_state == nullptr || game_state->isGameOver()) {
+    return false;
+  }
+  double radius = CELL_RADIUS * scale;
+  if (game_state->turn == my_color) {
+    cx = CIRCLE_POSITIONS[80][0] * scale + dx + 4 * radius;
+    cy = CIRCLE_POSITIONS[80][1] * scale + dy;
+  } else {
+    cx = CIRCLE_POSITIONS[0][0] * scale + dx - 4 * radius;
+    cy = CIRCLE_POSITIONS[0][1] * scale + dy;
+  }
+  return true;
+}
+
+void Fl_ChessBoard::draw_static_layer() {
+  // 离屏坐标以控件左上角为原点
+  double ox = dx - x();
+  double oy = dy - y();
+  double radius = CELL_RADIUS * scale;
+  fl_rectf(0, 0, w(), h(), 0xe8b06100);
   fl_color(0x4b310c00);
   fl_begin_complex_polygon();
   for (int i = 0; i < 18; i++) {
-    fl_vertex(STAR_SHAPE[i][0] * scale + dx, STAR_SHAPE[i][1] * scale + dy);
-  }
-  std::vector<int> board;
-  if (game_state != nullptr) {
-    board = game_state->getBoard();
-  } else {
-    for (int i = 0; i < 81; i++) {
-      board.push_back(EMPTY);
-    }
+    fl_vertex(STAR_SHAPE[i][0] * scale + ox, STAR_SHAPE[i][1] * scale + oy);
   }
   fl_end_complex_polygon();
-  fl_color(0x977d5a00);
   fl_font(FL_FREE_FONT, 16 * scale);
-  int text_dx, text_dy, text_width, text_height;
-  fl_line_style(FL_SOLID, 5 * scale);
   for (int i = 0; i < 81; i++) {
     double cx, cy;
-    if (my_color == RED) {
-      cx = CIRCLE_POSITIONS[i][0] * scale + dx;
-      cy = CIRCLE_POSITIONS[i][1] * scale + dy;
+    cell_center(i, cx, cy);
+    cx -= x();
+    cy -= y();
+    circle(cx, cy, radius, Fl_Color(0x977d5a00));
+    if (show_number) {
+      cell_label(i, cx, cy, 0x5b4b3600);
+    }
+  }
+  for (int i = 0; i < 40; i++) {
+    circle(FAKE_CIRCLE_POSITIONS[i][0] * scale + ox, FAKE_CIRCLE_POSITIONS[i][1] * scale + oy, radius,
+           Fl_Color(0x977d5a00));
+  }
+}
+
+void Fl_ChessBoard::draw_cell(int index) {
+  double cx, cy, radius = CELL_RADIUS * scale;
+  cell_center(index, cx, cy);
+  if ((game_state->board[RED] >> index) & 1) {
+    if ((game_state->turn == RED && selected_piece == index) || last_move.dst == index) {
+      circle(cx, cy, radius, Fl_Color(0xe5000000), Fl_Color(0xffafaf00));
     } else {
-      cx = CIRCLE_POSITIONS[80 - i][0] * scale + dx;
-      cy = CIRCLE_POSITIONS[80 - i][1] * scale + dy;
+      circle(cx, cy, radius, Fl_Color(0xe5000000));
     }
-    if (game_state && board[i] == RED) {
-      if ((game_state->turn == RED && selected_piece == i) || last_move.dst == i) {
-        circle(cx, cy, radius, Fl_Color(0xe5000000), Fl_Color(0xffafaf00));
-      } else {
-        circle(cx, cy, radius, Fl_Color(0xe5000000));
-      }
-      if (show_number) {
-        fl_color(0x89000000);
-        fl_text_extents(std::to_string(i).c_str(), text_dx, text_dy, text_width, text_height);
-        fl_graphics_driver->draw(std::to_string(i).c_str(), std::to_string(i).size(),
-                                 (float)(cx - text_dx - (float)text_width / 2),
-                                 (float)(cy - text_dy - (float)text_height / 2));
-      }
-    } else if (game_state && board[i] == GREEN) {
-      if ((game_state->turn == GREEN && selected_piece == i) || last_move.dst == i) {
-        circle(cx, cy, radius, Fl_Color(0x35cc3500), Fl_Color(0xcfffcf00));
-      } else {
-        circle(cx, cy, radius, Fl_Color(0x35cc3500));
-      }
-      if (show_number) {
-        fl_color(0x207a2000);
-        fl_text_extents(std::to_string(i).c_str(), text_dx, text_dy, text_width, text_height);
-        fl_graphics_driver->draw(std::to_string(i).c_str(), std::to_string(i).size(),
-                                 (float)(cx - text_dx - (float)text_width / 2),
-                                 (float)(cy - text_dy - (float)text_height / 2));
-      }
+    if (show_number) {
+      cell_label(index, cx, cy, 0x89000000);
+    }
+  } else if ((game_state->board[GREEN] >> index) & 1) {
+    if ((game_state->turn == GREEN && selected_piece == index) || last_move.dst == index) {
+      circle(cx, cy, radius, Fl_Color(0x35cc3500), Fl_Color(0xcfffcf00));
     } else {
-      Fl_Color fill_color = Fl_Color(0x977d5a00);
-      Fl_Color border_color = Fl_Color(0x977d5a00);
-      bool have_border = false;
-      if (game_state && last_move.src == i) {
-        border_color = game_state->turn == RED ? Fl_Color(0xcfffcf00) : Fl_Color(0xffafaf00);
-        have_border = true;
-      }
-      if (selected_piece >= 0 && moves[selected_piece][i] == 1) {
-        fill_color = Fl_Color(0xd6b17d00);
-      }
-      if (have_border) {
-        circle(cx, cy, radius, fill_color, border_color);
-      } else {
-        circle(cx, cy, radius, fill_color);
-      }
-      if (show_number) {
-        fl_color(0x5b4b3600);
-        fl_text_extents(std::to_string(i).c_str(), text_dx, text_dy, text_width, text_height);
-        fl_graphics_driver->draw(std::to_string(i).c_str(), std::to_string(i).size(),
-                                 (float)(cx - text_dx - (float)text_width / 2),
-                                 (float)(cy - text_dy - (float)text_height / 2));
-      }
+      circle(cx, cy, radius, Fl_Color(0x35cc3500));
+    }
+    if (show_number) {
+      cell_label(index, cx, cy, 0x207a2000);
+    }
+  } else {
+    bool is_src = last_move.src == index;
+    bool is_dst = selected_piece >= 0 && ((destinations(selected_piece) >> index) & 1);
+    // 普通空棋孔已经在静态层中
+    if (!is_src && !is_dst) {
+      return;
+    }
+    Fl_Color fill_color = is_dst ? Fl_Color(0xd6b17d00) : Fl_Color(0x977d5a00);
+    if (is_src) {
+      circle(cx, cy, radius, fill_color,
+             game_state->turn == RED ? Fl_Color(0xcfffcf00) : Fl_Color(0xffafaf00));
+    } else {
+      circle(cx, cy, radius, fill_color);
+    }
+    if (show_number) {
+      cell_label(index, cx, cy, 0x5b4b3600);
     }
   }
-  for (int i = 0; i < 40; i++) {
-    double cx = FAKE_CIRCLE_POSITIONS[i][0] * scale + dx;
-    double cy = FAKE_CIRCLE_POSITIONS[i][1] * scale + dy;
-    circle(cx, cy, radius, Fl_Color(0x977d5a00));
+}
+
+void Fl_ChessBoard::draw() {
+  update_layout();
+  float screen_scale = window() ? Fl::screen_scale(window()->screen_num()) : 1;
+  if (!static_layer || layer_dirty || layer_w != w() || layer_h != h() || layer_scale != screen_scale) {
+    if (static_layer) {
+      fl_delete_offscreen(static_layer);
+    }
+    static_layer = fl_create_offscreen(w(), h());
+    fl_begin_offscreen(static_layer);
+    fl_line_style(FL_SOLID, 5 * scale);
+    draw_static_layer();
+    fl_line_style(0);
+    fl_end_offscreen();
+    layer_w = w();
+    layer_h = h();
+    layer_scale = screen_scale;
+    layer_dirty = false;
   }
 
-  double cx, cy;
-  if (game_state != nullptr && !game_state->isGameOver() && is_tick) {
-    if (game_state->turn == my_color) {
-      cx = CIRCLE_POSITIONS[80][0] * scale + dx + 4 * radius;
-      cy = CIRCLE_POSITIONS[80][1] * scale + dy;
-    } else {
-      cx = CIRCLE_POSITIONS[0][0] * scale + dx - 4 * radius;
-      cy = CIRCLE_POSITIONS[0][1] * scale + dy;
+  // 局部重绘时只恢复被裁剪的区域，再叠加其中的动态元素
+  int X, Y, W, H;
+  fl_clip_box(x(), y(), w(), h(), X, Y, W, H);
+  fl_copy_offscreen(X, Y, W, H, static_layer, X - x(), Y - y());
+
+  double radius = CELL_RADIUS * scale;
+  int extent = (int)std::ceil(radius + 3 * scale) + 1;
+  fl_line_style(FL_SOLID, 5 * scale);
+  if (game_state != nullptr) {
+    fl_font(FL_FREE_FONT, 16 * scale);
+    for (int i = 0; i < 81; i++) {
+      double cx, cy;
+      cell_center(i, cx, cy);
+      if (fl_not_clipped((int)cx - extent, (int)cy - extent, 2 * extent, 2 * extent)) {
+        draw_cell(i);
+      }
     }
+  }
+
+  double cx, cy;
+  if (is_tick && indicator_center(cx, cy)) {
     circle(cx, cy, radius * 0.75, Fl_Color(0x4b310c00));
   }
 
   fl_line_style(0);
 }
 
+void Fl_ChessBoard::damage_cell(int index) {
+  double cx, cy;
+  cell_center(index, cx, cy);
+  int extent = (int)std::ceil((CELL_RADIUS + 3) * scale) + 1;
+  damage(FL_DAMAGE_USER1, (int)cx - extent, (int)cy - extent, 2 * extent, 2 * extent);
+}
+
+void Fl_ChessBoard::damage_selection() {
+  if (selected_piece < 0) return;
+  damage_cell(selected_piece);
+  uint128_t to = destinations(selected_piece);
+  for (int i = 0; i < 81; i++) {
+    if ((to >> i) & 1) {
+      damage_cell(i);
+    }
+  }
+}
+
+void Fl_ChessBoard::damage_indicator() {
+  double cx, cy;
+  if (indicator_center(cx, cy)) {
+    int extent = (int)std::ceil(CELL_RADIUS * scale) + 1;
+    damage(FL_DAMAGE_USER1, (int)cx - extent, (int)cy - extent, 2 * extent, 2 * extent);
+  }
+}
+
+void Fl_ChessBoard::select(int index) {
+  if (selected_piece == index) return;
+  damage_selection();
+  selected_piece = index;
+  damage_selection();
+}
+
 int Fl_ChessBoard::handle(int event) {
   double col, row, first_x, first_y, target_x, target_y, gap = 45 * M_SQRT3 * scale;
   double x = Fl::event_x();
@@ -280,8 +389,7 @@ int Fl_ChessBoard::handle(int event) {
       row /= gap;
       click_number = std::round(row) * 9 + std::round(col);
       if (click_number < 0 || click_number > 80) {
-        selected_piece = -1;
-        redraw();
+        select(-1);
         return 1;
       }
       target_x = CIRCLE_POSITIONS[click_number][0] * scale + dx;
@@ -293,8 +401,7 @@ int Fl_ChessBoard::handle(int event) {
         }
         handle_circle_click(click_number);
       } else {
-        selected_piece = -1;
-        redraw();
+        select(-1);
       }
       return 1;
     default:
@@ -306,7 +413,7 @@ void Fl_ChessBoard::set_game_state(GameState* game_state) {
   this->game_state = game_state;
   selected_piece = -1;
   last_move = {-1, -1};
-  fill_moves();
+  reset_moves();
   if (game_state == nullptr) {
     selected_piece = -1;
     last_move = {-1, -1};
@@ -317,13 +424,11 @@ void Fl_ChessBoard::set_game_state(GameState* game_state) {
 void Fl_ChessBoard::handle_circle_click(int index) {
   if (game_state == nullptr || game_state->isGameOver()) return;
   if ((game_state->board[game_state->turn] >> index) & 1 && my_color == game_state->turn) {
-    selected_piece = index;
-    redraw();
-  } else if (selected_piece != -1 && moves[selected_piece][index] == 1) {
+    select(index);
+  } else if (selected_piece != -1 && ((destinations(selected_piece) >> index) & 1)) {
     move({selected_piece, index});
   } else if (selected_piece != -1) {
-    selected_piece = -1;
-    redraw();
+    select(-1);
   }
 }
 
@@ -331,7 +436,7 @@ void Fl_ChessBoard::move(Move move) {
   last_move = move;
   game_state->applyMove(last_move);
   selected_piece = -1;
-  fill_moves();
+  reset_moves();
   if (my_color != game_state->turn) {
     do_callback();
   }
@@ -341,15 +446,20 @@ void Fl_ChessBoard::move(Move move) {
   redraw();
 }
 
-void Fl_ChessBoard::fill_moves() {
-  std::memset(moves, 0, sizeof(moves));
-  for (auto move : game_state->legalMoves()) {
-    this->moves[move.src][move.dst] = 1;
+void Fl_ChessBoard::reset_moves() { cached_sources = 0; }
+
+uint128_t Fl_ChessBoard::destinations(int src) {
+  uint128_t bit = (uint128_t)1 << src;
+  if (!(cached_sources & bit)) {
+    moves[src] = game_state->legalDestinations(src);
+    cached_sources |= bit;
   }
+  return moves[src];
 }
 
 void Fl_ChessBoard::number(bool is_show) {
   show_number = is_show;
+  layer_dirty = true;
   redraw();
 }
 
@@ -357,7 +467,8 @@ bool Fl_ChessBoard::number() { return show_number; }
 
 void Fl_ChessBoard::user_color(int my_color) {
   this->my_color = my_color;
-  fill_moves();
+  layer_dirty = true;
+  reset_moves();
   selected_piece = -1;
   last_move = {-1, -1};
   redraw();
@@ -3,6 +3,7 @@
 
 #include <FL/Fl_Timer.H>
 #include <FL/Fl_Widget.H>
+#include <FL/platform.H>
 
 #include <game.hpp>
 
@@ -13,19 +14,39 @@ class Fl_ChessBoard : public Fl_Widget {
   double dy;
   GameState *game_state;
   int selected_piece;
-  int moves[81][81];
+  // 每个棋子的可达位置按需计算并缓存，cached_sources 记录已计算的棋子
+  uint128_t moves[81];
+  uint128_t cached_sources;
   Move last_move;
   bool show_number;
   int my_color;
+  // 静态棋盘层（背景、星形、空棋孔和编号）的离屏缓存，只在尺寸、缩放或显示设置变化时重绘
+  Fl_Offscreen static_layer;
+  int layer_w;
+  int layer_h;
+  float layer_scale;
+  bool layer_dirty;
+
+  void update_layout();
+  void draw_static_layer();
+  void draw_cell(int index);
+  void cell_center(int index, double &cx, double &cy);
+  bool indicator_center(double &cx, double &cy);
+  void damage_cell(int index);
+  void damage_selection();
+  void damage_indicator();
+  void select(int index);
+  uint128_t destinations(int src);
 
  public:
   bool is_tick;
   Fl_ChessBoard(int x, int y, int w, int h, int my_color = RED);
+  ~Fl_ChessBoard();
   void draw() override;
   virtual int handle(int event) override;
   void set_game_state(GameState *game_state);
   void handle_circle_click(int index);
-  void fill_moves();
+  void reset_moves();
   void number(bool is_show);
   bool number();
   void user_color(int my_color);
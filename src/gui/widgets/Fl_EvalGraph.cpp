@@ -0,0 +1,73 @@
+#include "Fl_EvalGraph.hpp"
+
+#include <FL/fl_draw.H>
+
+#include <algorithm>
+
+// 纵轴显示的评分范围，超出的评分 (例如必胜) 贴边显示
+const int EVAL_GRAPH_RANGE = 100;
+
+Fl_EvalGraph::Fl_EvalGraph(int x, int y, int w, int h) : Fl_Widget(x, y, w, h) {}
+
+void Fl_EvalGraph::draw() {
+  fl_rectf(x(), y(), w(), h(), 0xf3dfb900);
+  int gx = x() + 10;
+  int gy = y() + 10;
+  int gw = w() - 20;
+  int gh = h() - 20;
+  fl_rectf(gx, gy, gw, gh, 0xfaf0dc00);
+  fl_color(0xc9b08a00);
+  fl_line(gx, gy + gh / 2, gx + gw, gy + gh / 2);
+  int count = scores.size();
+  if (count < 2) {
+    return;
+  }
+  fl_push_clip(gx, gy, gw, gh);
+  fl_color(0xe5000000);
+  fl_line_style(FL_SOLID, 2);
+  int last_x = 0, last_y = 0;
+  bool has_last = false;
+  for (int i = 0; i < count; i++) {
+    if (!known[i]) {
+      continue;
+    }
+    int score = std::max(-EVAL_GRAPH_RANGE, std::min(EVAL_GRAPH_RANGE, scores[i]));
+    int px = gx + i * gw / (count - 1);
+    int py = gy + gh / 2 - score * (gh / 2) / EVAL_GRAPH_RANGE;
+    if (has_last) {
+      fl_line(last_x, last_y, px, py);
+    }
+    last_x = px;
+    last_y = py;
+    has_last = true;
+  }
+  fl_line_style(0);
+  fl_pop_clip();
+}
+
+void Fl_EvalGraph::set(int ply, int score) {
+  if (ply < 0) {
+    return;
+  }
+  if ((int)scores.size() <= ply) {
+    scores.resize(ply + 1, 0);
+    known.resize(ply + 1, false);
+  }
+  scores[ply] = score;
+  known[ply] = true;
+  redraw();
+}
+
+void Fl_EvalGraph::truncate(int plies) {
+  if ((int)scores.size() > plies) {
+    scores.resize(plies);
+    known.resize(plies);
+    redraw();
+  }
+}
+
+void Fl_EvalGraph::clear() {
+  scores.clear();
+  known.clear();
+  redraw();
+}
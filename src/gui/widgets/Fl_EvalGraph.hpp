@@ -0,0 +1,23 @@
+#ifndef Fl_EvalGraph_H
+#define Fl_EvalGraph_H
+
+#include <FL/Fl_Widget.H>
+
+#include <vector>
+
+// 评分随步数变化的曲线，评分为红方视角
+class Fl_EvalGraph : public Fl_Widget {
+ private:
+  std::vector<int> scores;
+  std::vector<bool> known;
+
+ public:
+  Fl_EvalGraph(int x, int y, int w, int h);
+  void draw() override;
+  void set(int ply, int score);
+  // 只保留前 plies 步的评分，用于悔棋
+  void truncate(int plies);
+  void clear();
+};
+
+#endif
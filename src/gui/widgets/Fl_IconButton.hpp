@@ -11,7 +11,14 @@ class Fl_IconButton : public Fl_Button {
   Fl_SVG_Image svg_image;
 
  public:
-  enum { ICON_DICE_5_FILL, ICON_ARROW_LEFT_SQUARE_FILL, ICON_CLIPBOARD_CHECK_FILL, ICON_1_CIRCLE_FILL };
+  enum {
+    ICON_DICE_5_FILL,
+    ICON_ARROW_LEFT_SQUARE_FILL,
+    ICON_CLIPBOARD_CHECK_FILL,
+    ICON_1_CIRCLE_FILL,
+    ICON_LIGHTNING_FILL,
+    ICON_GRAPH_UP
+  };
   Fl_IconButton(int x, int y, int w, int h, const char* label, int icon);
 };
 
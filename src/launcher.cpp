@@ -0,0 +1,97 @@
+// 发布包中每个程序有按指令集分别构建的多个版本，例如
+//   chinesecheckers_cli-x86-64-v3  chinesecheckers_cli-x86-64-v2  chinesecheckers_cli
+// 启动器根据当前 CPU 支持的指令集选择最快的一个运行：
+//   chinesecheckers cli [args...]
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#include <windows.h>
+#define EXE_SUFFIX ".exe"
+#else
+#include <unistd.h>
+#define EXE_SUFFIX ""
+#endif
+
+// 按从快到慢的顺序返回 CPU 可以运行的版本后缀
+std::vector<std::string> supportedLevels() {
+  std::vector<std::string> levels;
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+  __builtin_cpu_init();
+  bool v2 = __builtin_cpu_supports("popcnt") && __builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("ssse3");
+  bool v3 = v2 && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi") &&
+            __builtin_cpu_supports("bmi2") && __builtin_cpu_supports("fma");
+  if (v3) {
+    levels.push_back("-x86-64-v3");
+  }
+  if (v2) {
+    levels.push_back("-x86-64-v2");
+  }
+#endif
+  levels.push_back("");
+  return levels;
+}
+
+std::string executableDirectory(const char *argv0) {
+  std::string path = argv0;
+#ifdef _WIN32
+  char buffer[MAX_PATH];
+  DWORD length = GetModuleFileNameA(NULL, buffer, MAX_PATH);
+  if (length > 0 && length < MAX_PATH) {
+    path.assign(buffer, length);
+  }
+#elif defined(__linux__)
+  char buffer[4096];
+  ssize_t length = readlink("/proc/self/exe", buffer, sizeof(buffer));
+  if (length > 0 && length < (ssize_t)sizeof(buffer)) {
+    path.assign(buffer, length);
+  }
+#endif
+  size_t slash = path.find_last_of("/\\");
+  return slash == std::string::npos ? "." : path.substr(0, slash);
+}
+
+bool fileExists(const std::string &path) {
+  FILE *file = fopen(path.c_str(), "rb");
+  if (file == nullptr) {
+    return false;
+  }
+  fclose(file);
+  return true;
+}
+
+int main(int argc, char *argv[]) {
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s <server|cli|bookmaker> [args...]\n", argv[0]);
+    return 1;
+  }
+  std::string directory = executableDirectory(argv[0]);
+  std::string name = std::string("chinesecheckers_") + argv[1];
+  if (std::string(argv[1]) == "bookmaker") {
+    name = "bookmaker";
+  }
+  for (auto &level : supportedLevels()) {
+    std::string path = directory + "/" + name + level + EXE_SUFFIX;
+    if (!fileExists(path)) {
+      continue;
+    }
+    std::vector<char *> args;
+    args.push_back(&path[0]);
+    for (int i = 2; i < argc; i++) {
+      args.push_back(argv[i]);
+    }
+    args.push_back(nullptr);
+#ifdef _WIN32
+    // _execv 在 Windows 上不会替换当前进程，改为等待子进程结束并转发退出码
+    return (int)_spawnv(_P_WAIT, path.c_str(), args.data());
+#else
+    execv(path.c_str(), args.data());
+    perror(path.c_str());
+    return 1;
+#endif
+  }
+  fprintf(stderr, "%s: no executable found in %s\n", name.c_str(), directory.c_str());
+  return 1;
+}
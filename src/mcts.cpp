@@ -0,0 +1,335 @@
+#ifdef HAVE_SPDLOG
+#include <spdlog/spdlog.h>
+#endif
+#include <algorithm>
+#include <cmath>
+#include <mcts.hpp>
+#include <memory>
+#include <thread>
+
+// PUCT 探索系数
+const float MCTS_CPUCT = 1.5f;
+// 虚拟损失按几次失败计
+const int MCTS_VIRTUAL_LOSS = 3;
+// evaluate 的评分经 tanh(score / MCTS_EVAL_SCALE) 映射到 [-1, 1]
+const float MCTS_EVAL_SCALE = 200.0f;
+// 先验概率为 exp(前进距离 / MCTS_PRIOR_TEMPERATURE) 归一化
+const float MCTS_PRIOR_TEMPERATURE = 2.0f;
+// 价值以定点数累加，便于原子操作
+const int64_t MCTS_VALUE_ONE = 1 << 16;
+// 两次进度报告之间的最短间隔 (毫秒)
+const int MCTS_REPORT_INTERVAL = 500;
+
+enum MctsNodeState {
+  MCTS_UNEXPANDED,
+  MCTS_EXPANDING,
+  MCTS_EXPANDED,
+  // 对局已经结束，走棋一方输
+  MCTS_TERMINAL,
+};
+
+struct MctsNode {
+  Move move;
+  float prior;
+  std::atomic<int> visits;
+  // 以走出 move 的一方的视角累计的价值
+  std::atomic<int64_t> valueSum;
+  std::atomic<int> state;
+  // 子结点在结点池中连续存放，state 变为 MCTS_EXPANDED 之前写入
+  int firstChild;
+  int childCount;
+};
+
+std::unique_ptr<MctsNode[]> MCTS_NODES;
+std::atomic<int> MCTS_NODE_COUNT(0);
+// 保留的搜索树的根结点
+int MCTS_ROOT = -1;
+
+// 根结点对应的局面。GameState 的构造函数不是 constexpr，放在函数内第一次使用时才构造，
+// 避免全局对象的动态初始化
+GameState &mctsRootState() {
+  static GameState state;
+  return state;
+}
+
+void clearMctsTree() {
+  MCTS_NODE_COUNT = 0;
+  MCTS_ROOT = -1;
+}
+
+namespace {
+
+// 从结点池中分配 count 个连续的结点，池满时返回 -1
+int allocateNodes(int count) {
+  int first = MCTS_NODE_COUNT.fetch_add(count, std::memory_order_relaxed);
+  if (first + count > MCTS_ARENA_NODES) {
+    MCTS_NODE_COUNT.fetch_sub(count, std::memory_order_relaxed);
+    return -1;
+  }
+  return first;
+}
+
+void initNode(MctsNode &node, Move move, float prior) {
+  node.move = move;
+  node.prior = prior;
+  node.visits.store(0, std::memory_order_relaxed);
+  node.valueSum.store(0, std::memory_order_relaxed);
+  node.state.store(MCTS_UNEXPANDED, std::memory_order_relaxed);
+  node.firstChild = -1;
+  node.childCount = 0;
+}
+
+// 走棋一方视角的叶子估值
+float leafValue(GameState &state) { return std::tanh(state.evaluate() / MCTS_EVAL_SCALE); }
+
+// 展开结点，成功时返回 true。结点池满时恢复为未展开，之后按叶子结点处理
+bool expand(MctsNode &node, GameState &state) {
+  std::vector<Move> moves = state.isGameOver() ? std::vector<Move>() : state.legalMoves();
+  if (moves.empty()) {
+    node.state.store(MCTS_TERMINAL, std::memory_order_release);
+    return true;
+  }
+  int first = allocateNodes(moves.size());
+  if (first < 0) {
+    node.state.store(MCTS_UNEXPANDED, std::memory_order_release);
+    return false;
+  }
+  std::vector<float> priors(moves.size());
+  float total = 0;
+  for (size_t i = 0; i < moves.size(); i++) {
+    int gain = PIECE_DISTANCES[moves[i].dst] - PIECE_DISTANCES[moves[i].src];
+    if (state.turn == RED) {
+      gain = -gain;
+    }
+    priors[i] = std::exp(gain / MCTS_PRIOR_TEMPERATURE);
+    total += priors[i];
+  }
+  for (size_t i = 0; i < moves.size(); i++) {
+    initNode(MCTS_NODES[first + i], moves[i], priors[i] / total);
+  }
+  node.firstChild = first;
+  node.childCount = moves.size();
+  node.state.store(MCTS_EXPANDED, std::memory_order_release);
+  return true;
+}
+
+float nodeValue(const MctsNode &node) {
+  int visits = node.visits.load(std::memory_order_relaxed);
+  if (visits <= 0) {
+    return 0;
+  }
+  return (float)node.valueSum.load(std::memory_order_relaxed) / MCTS_VALUE_ONE / visits;
+}
+
+int selectChild(const MctsNode &node) {
+  float sqrtVisits = std::sqrt((float)std::max(1, node.visits.load(std::memory_order_relaxed)));
+  int best = -1;
+  float bestScore = -1e30f;
+  for (int i = node.firstChild; i < node.firstChild + node.childCount; i++) {
+    const MctsNode &child = MCTS_NODES[i];
+    int visits = child.visits.load(std::memory_order_relaxed);
+    float score = nodeValue(child) + MCTS_CPUCT * child.prior * sqrtVisits / (1 + visits);
+    if (score > bestScore) {
+      bestScore = score;
+      best = i;
+    }
+  }
+  return best;
+}
+
+// 从根结点做一次模拟，返回到达的深度
+int simulate(GameState state, int root) {
+  int path[128];
+  int length = 0;
+  path[length++] = root;
+  float value;
+  while (true) {
+    MctsNode &node = MCTS_NODES[path[length - 1]];
+    int status = node.state.load(std::memory_order_acquire);
+    if (status == MCTS_TERMINAL) {
+      value = -1;
+      break;
+    }
+    if (status != MCTS_EXPANDED || length == 128) {
+      // 叶子结点第二次被访问时才展开，只访问过一次的结点不占用结点池；
+      // 访问次数中包含本线程加上的虚拟损失
+      int expected = MCTS_UNEXPANDED;
+      bool revisited = length == 1 || node.visits.load(std::memory_order_relaxed) > MCTS_VIRTUAL_LOSS;
+      if (status == MCTS_UNEXPANDED && revisited && node.state.compare_exchange_strong(expected, MCTS_EXPANDING)) {
+        expand(node, state);
+      }
+      value = state.isGameOver() ? -1 : leafValue(state);
+      break;
+    }
+    int index = selectChild(node);
+    MctsNode &child = MCTS_NODES[index];
+    child.visits.fetch_add(MCTS_VIRTUAL_LOSS, std::memory_order_relaxed);
+    child.valueSum.fetch_sub(MCTS_VIRTUAL_LOSS * MCTS_VALUE_ONE, std::memory_order_relaxed);
+    state.applyMove(child.move);
+    path[length++] = index;
+  }
+  // value 为路径末端结点走棋一方的视角，逐层取反回传，同时撤销虚拟损失
+  for (int i = length - 1; i >= 0; i--) {
+    MctsNode &node = MCTS_NODES[path[i]];
+    int64_t delta = (int64_t)(-value * MCTS_VALUE_ONE);
+    if (i > 0) {
+      node.visits.fetch_add(1 - MCTS_VIRTUAL_LOSS, std::memory_order_relaxed);
+      delta += MCTS_VIRTUAL_LOSS * MCTS_VALUE_ONE;
+    } else {
+      node.visits.fetch_add(1, std::memory_order_relaxed);
+    }
+    node.valueSum.fetch_add(delta, std::memory_order_relaxed);
+    value = -value;
+  }
+  return length - 1;
+}
+
+// 在上次搜索树中寻找两步以内到达 gameState 的结点
+int findRoot(GameState &gameState) {
+  if (MCTS_ROOT < 0 || MCTS_NODE_COUNT.load() > MCTS_ARENA_NODES * 9 / 10) {
+    return -1;
+  }
+  GameState state = mctsRootState();
+  // hash 不包含回合数，两者都相同才是同一局面
+  auto same = [&state, &gameState]() { return state.hash() == gameState.hash() && state.round == gameState.round; };
+  if (same()) {
+    return MCTS_ROOT;
+  }
+  const MctsNode &root = MCTS_NODES[MCTS_ROOT];
+  if (root.state.load() != MCTS_EXPANDED) {
+    return -1;
+  }
+  for (int i = root.firstChild; i < root.firstChild + root.childCount; i++) {
+    const MctsNode &child = MCTS_NODES[i];
+    state.applyMove(child.move);
+    if (same()) {
+      return i;
+    }
+    if (child.state.load() == MCTS_EXPANDED) {
+      for (int j = child.firstChild; j < child.firstChild + child.childCount; j++) {
+        state.applyMove(MCTS_NODES[j].move);
+        bool found = same();
+        state.undoMove(MCTS_NODES[j].move);
+        if (found) {
+          return j;
+        }
+      }
+    }
+    state.undoMove(child.move);
+  }
+  return -1;
+}
+
+// 按访问次数从多到少排列的子结点，搜索线程仍在更新访问次数，排序前先取快照
+std::vector<int> rankedChildren(int index) {
+  const MctsNode &node = MCTS_NODES[index];
+  std::vector<std::pair<int, int>> visits;
+  std::vector<int> children;
+  if (node.state.load(std::memory_order_acquire) != MCTS_EXPANDED) {
+    return children;
+  }
+  for (int i = node.firstChild; i < node.firstChild + node.childCount; i++) {
+    visits.push_back({MCTS_NODES[i].visits.load(std::memory_order_relaxed), i});
+  }
+  std::stable_sort(visits.begin(), visits.end(),
+                   [](const std::pair<int, int> &a, const std::pair<int, int> &b) { return a.first > b.first; });
+  for (auto &item : visits) {
+    children.push_back(item.second);
+  }
+  return children;
+}
+
+// 从 index 开始沿访问次数最多的子结点得到主要变例
+std::vector<Move> principalLine(int index) {
+  std::vector<Move> line;
+  while (index >= 0 && line.size() < 32) {
+    line.push_back(MCTS_NODES[index].move);
+    auto children = rankedChildren(index);
+    index = children.empty() || MCTS_NODES[children[0]].visits.load() == 0 ? -1 : children[0];
+  }
+  return line;
+}
+
+// 把 [-1, 1] 的价值换算回 evaluate 的评分
+int valueToScore(float value) {
+  value = std::max(-0.999f, std::min(0.999f, value));
+  return (int)std::lround(MCTS_EVAL_SCALE * std::atanh(value));
+}
+
+}  // namespace
+
+Move mctsSearch(GameState &gameState, int threads, int multiPV, SearchContext &context, SearchCallback callback) {
+  auto start = std::chrono::high_resolution_clock::now();
+  if (!MCTS_NODES) {
+    MCTS_NODES.reset(new MctsNode[MCTS_ARENA_NODES]);
+  }
+  int root = findRoot(gameState);
+  if (root < 0) {
+    MCTS_NODE_COUNT = 0;
+    root = allocateNodes(1);
+    initNode(MCTS_NODES[root], {-1, -1}, 1);
+  }
+  MCTS_ROOT = root;
+  mctsRootState() = gameState;
+  std::atomic<uint64_t> simulations(0);
+  std::atomic<int> maxDepth(0);
+  auto step = [&]() {
+    int depth = simulate(gameState, root);
+    simulations.fetch_add(1, std::memory_order_relaxed);
+    int seen = maxDepth.load(std::memory_order_relaxed);
+    while (depth > seen && !maxDepth.compare_exchange_weak(seen, depth)) {
+    }
+  };
+  auto worker = [&]() {
+    while (!timeout(context)) {
+      step();
+    }
+  };
+  std::vector<std::thread> helpers;
+  for (int i = 1; i < threads; i++) {
+    helpers.emplace_back(worker);
+  }
+  auto report = [&]() {
+    auto children = rankedChildren(root);
+    if (!callback || children.empty()) {
+      return;
+    }
+    SearchInfo info;
+    info.depth = maxDepth.load();
+    info.score = valueToScore(nodeValue(MCTS_NODES[children[0]]));
+    info.bestMove = MCTS_NODES[children[0]].move;
+    info.nodes = simulations.load();
+    info.time =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
+    for (int i = 0; i < std::min<int>(std::max(1, multiPV), children.size()); i++) {
+      info.lines.push_back({valueToScore(nodeValue(MCTS_NODES[children[i]])), principalLine(children[i])});
+    }
+    callback(info);
+  };
+  // 主线程同样参与模拟，每隔一段时间报告一次进度
+  auto lastReport = start;
+  while (!timeout(context)) {
+    for (int i = 0; i < 64 && !timeout(context); i++) {
+      step();
+    }
+    auto now = std::chrono::high_resolution_clock::now();
+    if (now - lastReport >= std::chrono::milliseconds(MCTS_REPORT_INTERVAL)) {
+      lastReport = now;
+      report();
+    }
+  }
+  context.stopped = true;
+  for (auto &helper : helpers) {
+    helper.join();
+  }
+  report();
+  auto children = rankedChildren(root);
+#ifdef HAVE_SPDLOG
+  spdlog::info("mcts simulations: {}, root visits: {}, tree nodes: {}", simulations.load(),
+               MCTS_NODES[root].visits.load(), MCTS_NODE_COUNT.load());
+#endif
+  if (children.empty()) {
+    return {-1, -1};
+  }
+  return MCTS_NODES[children[0]].move;
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <game.hpp>
+
+// 结点池大小，浏览器中内存紧张，默认值较小
+#ifdef __EMSCRIPTEN__
+#define MCTS_ARENA_NODES (1 << 18)
+#else
+#define MCTS_ARENA_NODES (1 << 21)
+#endif
+
+// 多线程 PUCT 蒙特卡洛树搜索。结点存放在预先分配的结点池中，各线程用原子操作分配结点和更新统计，
+// 选择时加虚拟损失使各线程分散到不同分支。叶子结点用 evaluate 估值，先验概率按着法前进的距离给出。
+// 搜索树在相邻两次搜索之间保留，新局面是上次根结点两步以内的后继时从对应的子树继续搜索。
+Move mctsSearch(GameState &gameState, int threads, int multiPV, SearchContext &context, SearchCallback callback);
+// 丢弃保留的搜索树
+void clearMctsTree();
@@ -0,0 +1,259 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <game.hpp>
+#include <iostream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <transtable.hpp>
+#include <vector>
+
+// 引擎基本操作的微基准测试。局面取自 tests 目录中的对局脚本和固定种子的随机对局，
+// 每个操作单独计时，结果以 JSON 输出，可以和之前保存的结果比较。
+//
+// 用法: chinesecheckers_microbench [--out result.json] [--baseline baseline.json] [--threshold 10]
+//                                  [--min-time 200] [tests/a.txt ...]
+
+const char* DEFAULT_CORPUS[] = {"tests/a.txt", "tests/b.txt", "tests/c.txt"};
+const int RANDOM_GAMES = 32;
+const int RANDOM_GAME_PLIES = 120;
+const int RANDOM_SAMPLE_INTERVAL = 4;
+const uint64_t RANDOM_SEED = 20240601;
+
+// 防止被测调用被优化掉
+volatile uint64_t SINK;
+
+struct Result {
+  std::string name;
+  uint64_t ops;
+  double nsPerOp;
+};
+
+// 读取脚本中 SEARCH 命令的局面
+void loadScript(const std::string& path, std::vector<GameState>& positions) {
+  std::ifstream file(path);
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.compare(0, 7, "SEARCH ") == 0) {
+      positions.push_back(GameState(line.substr(7)));
+    }
+  }
+}
+
+// 随机对局，大多数时候走向前的着法，使对局能推进到中局和残局
+void randomPlayouts(std::vector<GameState>& positions) {
+  std::mt19937_64 rng(RANDOM_SEED);
+  for (int game = 0; game < RANDOM_GAMES; game++) {
+    GameState state;
+    for (int ply = 0; ply < RANDOM_GAME_PLIES && !state.isGameOver(); ply++) {
+      std::vector<Move> moves = state.legalMoves();
+      std::vector<Move> forward;
+      for (auto& move : moves) {
+        int gain = PIECE_DISTANCES[move.src] - PIECE_DISTANCES[move.dst];
+        if ((state.turn == RED ? gain : -gain) > 0) {
+          forward.push_back(move);
+        }
+      }
+      const std::vector<Move>& candidates = !forward.empty() && rng() % 5 != 0 ? forward : moves;
+      state.applyMove(candidates[rng() % candidates.size()]);
+      if (ply % RANDOM_SAMPLE_INTERVAL == 0) {
+        positions.push_back(state);
+      }
+    }
+  }
+}
+
+// 反复对整个局面集执行 body，直到累计时间超过 minTime 毫秒。body 返回本轮执行的操作数
+template <typename Body>
+Result measure(const std::string& name, int minTime, Body body) {
+  uint64_t ops = 0;
+  auto start = std::chrono::steady_clock::now();
+  double elapsed = 0;
+  do {
+    ops += body();
+    elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  } while (elapsed < minTime * 1e6);
+  return Result{name, ops, elapsed / std::max<uint64_t>(ops, 1)};
+}
+
+std::vector<Result> runKernels(std::vector<GameState>& positions, int minTime) {
+  std::vector<std::vector<Move>> moves;
+  for (auto& state : positions) {
+    moves.push_back(state.legalMoves());
+  }
+  std::vector<Result> results;
+  results.push_back(measure("jumpMoves", minTime, [&]() {
+    uint64_t ops = 0;
+    for (auto& state : positions) {
+      uint128_t from = state.board[state.turn];
+      for (int src = 0; src < 81; src++) {
+        if (from >> src & 1) {
+          uint128_t to = 0;
+          state.jumpMoves(src, to);
+          SINK = SINK + (uint64_t)to;
+          ops++;
+        }
+      }
+    }
+    return ops;
+  }));
+  results.push_back(measure("legalMoves", minTime, [&]() {
+    for (auto& state : positions) {
+      SINK = SINK + state.legalMoves().size();
+    }
+    return (uint64_t)positions.size();
+  }));
+  results.push_back(measure("sortedLegalMoves", minTime, [&]() {
+    for (auto& state : positions) {
+      SINK = SINK + state.sortedLegalMoves(0, {-1, -1}).size();
+    }
+    return (uint64_t)positions.size();
+  }));
+  results.push_back(measure("applyUndoMove", minTime, [&]() {
+    uint64_t ops = 0;
+    for (size_t i = 0; i < positions.size(); i++) {
+      for (auto& move : moves[i]) {
+        positions[i].applyMove(move);
+        SINK = SINK + positions[i].zobristHash;
+        positions[i].undoMove(move);
+      }
+      ops += moves[i].size();
+    }
+    return ops;
+  }));
+  results.push_back(measure("evaluate", minTime, [&]() {
+    for (auto& state : positions) {
+      SINK = SINK + state.evaluate();
+    }
+    return (uint64_t)positions.size();
+  }));
+  results.push_back(measure("hash", minTime, [&]() {
+    for (auto& state : positions) {
+      // 清除缓存的 hash，测量从头计算的开销
+      GameState copy(state);
+      copy.zobristHash = 0;
+      SINK = SINK + copy.hash();
+    }
+    return (uint64_t)positions.size();
+  }));
+  TranspositionTable table(DEFAULT_TRANSPOSITION_TABLE_MB);
+  table.newSearch();
+  // 置换表用 calloc 分配，第一次写入时才分配物理页。先把整张表写一遍，计时中不包含缺页的开销
+  table.clear();
+  std::vector<uint64_t> keys;
+  std::mt19937_64 rng(RANDOM_SEED);
+  for (int i = 0; i < 1 << 16; i++) {
+    keys.push_back(rng() | 1);
+  }
+  results.push_back(measure("ttPut", minTime, [&]() {
+    for (size_t i = 0; i < keys.size(); i++) {
+      table.put(keys[i], {keys[i], (int)i, (int)(i & 31), HASH_EXACT, {(int)(i % 81), (int)(i * 7 % 81)}});
+    }
+    return (uint64_t)keys.size();
+  }));
+  results.push_back(measure("ttGet", minTime, [&]() {
+    TranspositionTableEntry entry;
+    for (auto key : keys) {
+      SINK = SINK + table.get(key, entry);
+    }
+    return (uint64_t)keys.size();
+  }));
+  results.push_back(measure("searchBook", minTime, [&]() {
+    for (auto& state : positions) {
+      SINK = SINK + searchBook(state.hash()).src;
+    }
+    return (uint64_t)positions.size();
+  }));
+  return results;
+}
+
+std::string toJson(const std::vector<Result>& results, size_t positions) {
+  std::ostringstream out;
+  out << "{\n  \"positions\": " << positions << ",\n  \"kernels\": {\n";
+  for (size_t i = 0; i < results.size(); i++) {
+    char nsPerOp[32];
+    std::snprintf(nsPerOp, sizeof(nsPerOp), "%.3f", results[i].nsPerOp);
+    out << "    \"" << results[i].name << "\": {\"ops\": " << results[i].ops << ", \"ns_per_op\": " << nsPerOp
+        << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+  }
+  out << "  }\n}\n";
+  return out.str();
+}
+
+// 只解析本程序输出的格式：每个操作一行 "name": {"ops": n, "ns_per_op": x}
+std::map<std::string, double> parseBaseline(const std::string& path) {
+  std::map<std::string, double> baseline;
+  std::ifstream file(path);
+  std::string line;
+  while (std::getline(file, line)) {
+    size_t key = line.find("\"ns_per_op\":");
+    size_t begin = line.find('"');
+    if (key == std::string::npos || begin == std::string::npos) {
+      continue;
+    }
+    size_t end = line.find('"', begin + 1);
+    baseline[line.substr(begin + 1, end - begin - 1)] = std::stod(line.substr(key + 12));
+  }
+  return baseline;
+}
+
+int main(int argc, char* argv[]) {
+  std::string out, baselinePath;
+  double threshold = 10;
+  int minTime = 200;
+  std::vector<std::string> corpus;
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if (arg == "--out" && i + 1 < argc) {
+      out = argv[++i];
+    } else if (arg == "--baseline" && i + 1 < argc) {
+      baselinePath = argv[++i];
+    } else if (arg == "--threshold" && i + 1 < argc) {
+      threshold = std::stod(argv[++i]);
+    } else if (arg == "--min-time" && i + 1 < argc) {
+      minTime = std::stoi(argv[++i]);
+    } else {
+      corpus.push_back(arg);
+    }
+  }
+  if (corpus.empty()) {
+    corpus.assign(std::begin(DEFAULT_CORPUS), std::end(DEFAULT_CORPUS));
+  }
+
+  std::vector<GameState> positions;
+  for (auto& path : corpus) {
+    loadScript(path, positions);
+  }
+  randomPlayouts(positions);
+
+  std::vector<Result> results = runKernels(positions, minTime);
+  std::string json = toJson(results, positions.size());
+  if (out.empty()) {
+    std::cout << json;
+  } else {
+    std::ofstream(out) << json;
+  }
+
+  if (baselinePath.empty()) {
+    return 0;
+  }
+  // 比较模式：输出每个操作相对基准的变化，有操作变慢超过 threshold% 时返回 1
+  std::map<std::string, double> baseline = parseBaseline(baselinePath);
+  bool regressed = false;
+  std::fprintf(stderr, "%-18s %12s %12s %9s\n", "kernel", "baseline", "current", "change");
+  for (auto& result : results) {
+    auto it = baseline.find(result.name);
+    if (it == baseline.end() || it->second <= 0) {
+      std::fprintf(stderr, "%-18s %12s %12.3f %9s\n", result.name.c_str(), "-", result.nsPerOp, "-");
+      continue;
+    }
+    double change = (result.nsPerOp / it->second - 1) * 100;
+    regressed = regressed || change > threshold;
+    std::fprintf(stderr, "%-18s %12.3f %12.3f %+8.1f%%%s\n", result.name.c_str(), it->second, result.nsPerOp, change,
+                 change > threshold ? " !" : "");
+  }
+  return regressed ? 1 : 0;
+}
@@ -0,0 +1,196 @@
+#include <algorithm>
+#include <climits>
+#include <race.hpp>
+
+// 一步棋最多能让棋子前进的距离：连跳时每跳过一枚己方棋子前进 2，最多跳过其余 9 枚
+const int RACE_MAX_GAIN = 18;
+// 目标营地 10 个位置到底线的距离之和 (0 + 1 * 2 + 2 * 3 + 3 * 4)
+const int RACE_GOAL_DISTANCE = 20;
+const int RACE_CACHE_SIZE = 1 << 16;
+const int RACE_FOUND = -1;
+const int RACE_ABORTED = -2;
+
+struct RaceCacheEntry {
+  uint128_t key;
+  // 从该局面走完至少需要的步数
+  int bound;
+};
+
+// 单人求解缓存，红绿各一份，键为己方棋子的位棋盘
+std::vector<RaceCacheEntry> RACE_CACHE[3];
+
+// pos 到 color 一方目标底线的距离，目标营地内为 0 ~ 3
+inline int goalDistance(Color color, int pos) {
+  return color == RED ? PIECE_DISTANCES[pos] : 16 - PIECE_DISTANCES[pos];
+}
+
+inline RaceCacheEntry &cacheEntry(Color color, uint128_t key) {
+  auto &cache = RACE_CACHE[color];
+  if (cache.empty()) {
+    cache.resize(RACE_CACHE_SIZE, RaceCacheEntry{0, 0});
+  }
+  uint64_t mixed = ((uint64_t)key ^ (uint64_t)(key >> 64)) * 0x9e3779b97f4a7c15ULL;
+  return cache[mixed >> 48];
+}
+
+// 按 PIECE_DISTANCES 分组的位置掩码
+struct DistanceMasks {
+  uint128_t masks[17];
+  constexpr DistanceMasks() : masks() {
+    for (int i = 0; i < 81; i++) {
+      masks[PIECE_DISTANCES[i]] |= (uint128_t)1 << i;
+    }
+  }
+  constexpr uint128_t operator[](int distance) const { return masks[distance]; }
+};
+constexpr DistanceMasks DISTANCE_MASKS;
+
+bool isRacePhase(const GameState &gameState) {
+  int maxRed = -1, minGreen = INT_MAX;
+  for (int i = 0; i < 81; i++) {
+    if (gameState.board[RED] >> i & 1) {
+      maxRed = std::max(maxRed, PIECE_DISTANCES[i]);
+    } else if (gameState.board[GREEN] >> i & 1) {
+      minGreen = std::min(minGreen, PIECE_DISTANCES[i]);
+    }
+  }
+  return maxRed < minGreen;
+}
+
+class RaceSolver {
+ public:
+  RaceSolver(const GameState &gameState, Color color, uint64_t nodeLimit, SearchContext &context)
+      : puzzle(gameState), color(color), nodeLimit(nodeLimit), nodes(0), context(context) {
+    // 对方棋子在身后，不会再影响己方向前的走子
+    puzzle.board[color == RED ? GREEN : RED] = 0;
+    puzzle.turn = color;
+    target = color == RED ? INITIAL_GREEN : INITIAL_RED;
+  }
+
+  RaceSolution solve() {
+    RaceSolution solution{-1, {}, 0};
+    uint128_t pieces = puzzle.board[color];
+    int distance = -RACE_GOAL_DISTANCE;
+    for (int pos = 0; pos < 81; pos++) {
+      if (pieces >> pos & 1) {
+        distance += goalDistance(color, pos);
+      }
+    }
+    int threshold = heuristic(pieces, distance);
+    while (true) {
+      line.clear();
+      int result = search(0, threshold, distance);
+      solution.nodes = nodes;
+      if (result == RACE_FOUND) {
+        solution.moves = threshold;
+        solution.line.assign(line.rbegin(), line.rend());
+        return solution;
+      }
+      if (result == RACE_ABORTED || result == INT_MAX) {
+        return solution;
+      }
+      threshold = result;
+    }
+  }
+
+ private:
+  GameState puzzle;
+  Color color;
+  uint128_t target;
+  uint64_t nodeLimit;
+  uint64_t nodes;
+  SearchContext &context;
+  // 找到解时从叶子向根依次记录的走法
+  std::vector<Move> line;
+
+  // 可采纳的下界：营地外的每枚棋子至少走一步，一步最多前进 RACE_MAX_GAIN，
+  // distance 为所有棋子到底线的距离之和超出 RACE_GOAL_DISTANCE 的部分
+  int heuristic(uint128_t pieces, int distance) {
+    int outside = popcount_u128(pieces & ~target);
+    int bound = std::max(outside, (distance + RACE_MAX_GAIN - 1) / RACE_MAX_GAIN);
+    RaceCacheEntry &entry = cacheEntry(color, pieces);
+    if (entry.key == pieces) {
+      bound = std::max(bound, entry.bound);
+    }
+    return bound;
+  }
+
+  bool aborted() {
+    if (nodes > nodeLimit) {
+      return true;
+    }
+    return (nodes & 1023) == 0 && timeout(context);
+  }
+
+  // 返回 RACE_FOUND 表示在 threshold 步内走完，否则返回超出 threshold 的最小估值
+  int search(int g, int threshold, int distance) {
+    uint128_t pieces = puzzle.board[color];
+    int f = g + heuristic(pieces, distance);
+    if (f > threshold) {
+      return f;
+    }
+    if (pieces == target) {
+      return RACE_FOUND;
+    }
+    nodes++;
+    if (aborted()) {
+      return RACE_ABORTED;
+    }
+    // 按前进距离分桶，先走前进最多的着法；前进距离在 -16 ~ 16 之间
+    uint128_t destinations[10];
+    int sources[10];
+    int count = 0;
+    for (int src = 0; src < 81; src++) {
+      if (pieces >> src & 1) {
+        sources[count] = src;
+        destinations[count++] = puzzle.legalDestinations(src);
+      }
+    }
+    int next = INT_MAX;
+    for (int gain = 16; gain >= -16; gain--) {
+      for (int i = 0; i < count; i++) {
+        int dstDistance = goalDistance(color, sources[i]) - gain;
+        if (dstDistance < 0 || dstDistance > 16) {
+          continue;
+        }
+        uint128_t to = destinations[i] & DISTANCE_MASKS[color == RED ? dstDistance : 16 - dstDistance];
+        for (int dst = 0; to != 0; dst++, to >>= 1) {
+          if (!(to & 1)) {
+            continue;
+          }
+          Move move = {sources[i], dst};
+          uint128_t child = pieces ^ ((uint128_t)1 << move.src) ^ ((uint128_t)1 << move.dst);
+          puzzle.board[color] = child;
+          int result = search(g + 1, threshold, distance - gain);
+          puzzle.board[color] = pieces;
+          if (result == RACE_FOUND) {
+            line.push_back(move);
+            return RACE_FOUND;
+          }
+          if (result == RACE_ABORTED) {
+            return RACE_ABORTED;
+          }
+          next = std::min(next, result);
+        }
+      }
+    }
+    // 没有在 threshold 内走完，记录这个局面的新下界
+    if (next != INT_MAX) {
+      RaceCacheEntry &entry = cacheEntry(color, pieces);
+      if (entry.key != pieces) {
+        entry = RaceCacheEntry{pieces, 0};
+      }
+      entry.bound = std::max(entry.bound, next - g);
+    }
+    return next;
+  }
+};
+
+RaceSolution solveRace(const GameState &gameState, Color color, uint64_t nodeLimit, SearchContext &context) {
+  // 求解器按每方 10 枚棋子分配缓冲区
+  if (popcount_u128(gameState.board[color]) != 10) {
+    return RaceSolution{-1, {}, 0};
+  }
+  RaceSolver solver(gameState, color, nodeLimit, context);
+  return solver.solve();
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+#include <game.hpp>
+#include <vector>
+
+// 单人求解的结果
+struct RaceSolution {
+  // 走完所需的最少步数，在结点数限制内没有求出时为 -1
+  int moves;
+  // 一条最短的走法序列
+  std::vector<Move> line;
+  uint64_t nodes;
+};
+
+// 所有红方棋子都已越过所有绿方棋子 (按 PIECE_DISTANCES 比较)，之后双方向前走子互不影响，
+// 对局变成两个独立的单人问题
+bool isRacePhase(const GameState &gameState);
+
+// 用 IDA* 求 color 一方只走自己的棋子、全部进入对方营地所需的最少步数。
+// 对方的棋子视为不存在，结果缓存在每一方独立的求解缓存中，多次调用之间保留
+RaceSolution solveRace(const GameState &gameState, Color color, uint64_t nodeLimit, SearchContext &context);
@@ -1,10 +1,510 @@
 #include <httplib.h>
 #include <spdlog/spdlog.h>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <dfpn.hpp>
+#include <future>
 #include <game.hpp>
+#include <map>
 #include <mutex>
+#include <sstream>
+#include <thread>
+#include <trace.hpp>
 
-std::mutex mtx;
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+enum Priority {
+  // 对局中的走棋请求
+  PRIORITY_INTERACTIVE,
+  // 长时间的分析请求，可以被对局请求抢占
+  PRIORITY_BACKGROUND,
+};
+
+// 思考时间超过这个值 (秒) 的请求默认作为后台请求
+const int BACKGROUND_TIME = 15;
+// 两类请求都在等待时，每连续执行 INTERACTIVE_WEIGHT 个对局请求后让一个后台请求执行
+const int INTERACTIVE_WEIGHT = 4;
+// 后台请求开始执行后至少运行这么久 (毫秒) 才会被抢占，避免后台请求一直没有进展
+const int BACKGROUND_MIN_SLICE = 200;
+
+// 引擎同一时间只能进行一个搜索 (各求解器的表和蒙特卡洛搜索树都是全局的)，所有搜索线程
+// 按时间片在请求之间分配。对局请求到达时抢占正在运行的后台请求，后台请求在之后继续，
+// 置换表在两次运行之间保留。同一类请求按到达顺序执行
+class Scheduler {
+ public:
+  // 等待轮到本请求，preempt 不为空时请求可以被抢占，被抢占时 preempt 被置位
+  void acquire(Priority priority, std::atomic<bool>* preempt) {
+    TraceScope wait("wait");
+    std::unique_lock<std::mutex> lock(mutex);
+    uint64_t ticket = nextTicket[priority]++;
+    waiting[priority]++;
+    while (true) {
+      if (!busy && ticket == serving[priority] && allowed(priority)) {
+        break;
+      }
+      if (priority == PRIORITY_INTERACTIVE && busy && running == PRIORITY_BACKGROUND &&
+          runningPreempt != nullptr && allowed(PRIORITY_INTERACTIVE)) {
+        // 后台请求运行满最短时间片后抢占
+        auto sliceEnd = runningSince + std::chrono::milliseconds(BACKGROUND_MIN_SLICE);
+        if (std::chrono::steady_clock::now() >= sliceEnd) {
+          runningPreempt->store(true);
+          cv.wait(lock);
+        } else {
+          cv.wait_until(lock, sliceEnd);
+        }
+        continue;
+      }
+      cv.wait(lock);
+    }
+    waiting[priority]--;
+    serving[priority]++;
+    busy = true;
+    running = priority;
+    runningPreempt = preempt;
+    runningSince = std::chrono::steady_clock::now();
+    streak = priority == PRIORITY_INTERACTIVE ? streak + 1 : 0;
+    if (preempt != nullptr) {
+      preempt->store(false);
+    }
+    cv.notify_all();
+  }
+
+  void release() {
+    std::lock_guard<std::mutex> lock(mutex);
+    busy = false;
+    runningPreempt = nullptr;
+    cv.notify_all();
+  }
+
+ private:
+  // 加权轮转：有后台请求在等待并且对局请求已经连续执行了 INTERACTIVE_WEIGHT 次时，先执行后台请求
+  bool allowed(Priority priority) const {
+    bool backgroundTurn = waiting[PRIORITY_BACKGROUND] > 0 && streak >= INTERACTIVE_WEIGHT;
+    if (priority == PRIORITY_INTERACTIVE) {
+      return !backgroundTurn;
+    }
+    return waiting[PRIORITY_INTERACTIVE] == 0 || backgroundTurn;
+  }
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool busy = false;
+  Priority running = PRIORITY_INTERACTIVE;
+  std::atomic<bool>* runningPreempt = nullptr;
+  std::chrono::steady_clock::time_point runningSince;
+  uint64_t nextTicket[2] = {0, 0};
+  uint64_t serving[2] = {0, 0};
+  int waiting[2] = {0, 0};
+  int streak = 0;
+};
+
+Scheduler scheduler;
+
+// 在作用域内占用引擎
+class EngineSlot {
+ public:
+  explicit EngineSlot(Priority priority, std::atomic<bool>* preempt = nullptr) { scheduler.acquire(priority, preempt); }
+  ~EngineSlot() { scheduler.release(); }
+  EngineSlot(const EngineSlot&) = delete;
+  EngineSlot& operator=(const EngineSlot&) = delete;
+};
+
+// priority 参数为 interactive 或 background，不给出时按思考时间决定
+Priority requestPriority(const httplib::Request& req, int time) {
+  std::string priority = req.get_param_value("priority");
+  if (priority == "background" || priority == "interactive") {
+    return priority == "background" ? PRIORITY_BACKGROUND : PRIORITY_INTERACTIVE;
+  }
+  return time > BACKGROUND_TIME ? PRIORITY_BACKGROUND : PRIORITY_INTERACTIVE;
+}
+
+// 按优先级占用引擎搜索。后台请求被抢占时记下已经用掉的时间，重新排队后用剩余时间继续搜索，
+// 之前的结果保留在置换表中，迭代加深很快就能回到被打断时的深度
+Move scheduledSearch(GameState& gameState, SearchLimits limits, Priority priority, SearchCallback callback = nullptr) {
+  bool preemptible = priority == PRIORITY_BACKGROUND && !limits.infinite && limits.clock.remaining == 0;
+  if (!preemptible) {
+    EngineSlot slot(priority);
+    return gameState.searchBestMove(limits, callback);
+  }
+  int64_t remaining = limits.moveTime > 0 ? limits.moveTime : (int64_t)limits.timeLimit * 1000;
+  std::atomic<bool> preempt(false);
+  limits.stop = &preempt;
+  Move move = {-1, -1};
+  while (true) {
+    EngineSlot slot(priority, &preempt);
+    auto start = std::chrono::steady_clock::now();
+    limits.moveTime = (int)std::max<int64_t>(remaining, 1);
+    Move result = gameState.searchBestMove(limits, callback);
+    if (result.src >= 0) {
+      move = result;
+    }
+    remaining -= std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    if (!preempt.load() || (remaining <= 0 && move.src >= 0)) {
+      return move;
+    }
+    spdlog::info("background search preempted, {} ms left", remaining);
+  }
+}
+
+// 正在进行的搜索，键为局面 hash、回合数和影响结果的请求参数
+std::map<std::string, std::shared_future<std::string>> inflight;
+std::mutex inflightMutex;
+
+std::string requestKey(const std::string& path, const httplib::Request& req) {
+  // hash 不包含回合数，而对局时钟按回合数分配时间，回合数不同的请求不能合并
+  GameState gameState(req.get_param_value("state"));
+  std::string key = path + " " + std::to_string(gameState.hash()) + " " + std::to_string(gameState.round);
+  for (auto& param : req.params) {
+    if (param.first != "state") {
+      key += " " + param.first + "=" + param.second;
+    }
+  }
+  return key;
+}
+
+// 相同的请求正在搜索时不再重复搜索，等待它完成后返回同一个结果
+std::string singleflight(const std::string& key, const std::function<std::string()>& compute) {
+  std::unique_lock<std::mutex> lock(inflightMutex);
+  auto it = inflight.find(key);
+  if (it != inflight.end()) {
+    std::shared_future<std::string> result = it->second;
+    lock.unlock();
+    TraceScope scope("coalesced");
+    spdlog::info("joined in-flight search: {}", key);
+    return result.get();
+  }
+  std::promise<std::string> promise;
+  inflight[key] = promise.get_future().share();
+  lock.unlock();
+  std::string result;
+  try {
+    result = compute();
+    promise.set_value(result);
+  } catch (...) {
+    promise.set_exception(std::current_exception());
+    lock.lock();
+    inflight.erase(key);
+    throw;
+  }
+  lock.lock();
+  inflight.erase(key);
+  return result;
+}
+
+// 分析结果，score 为走棋一方的评分
+struct Analysis {
+  int depth;
+  int score;
+  uint64_t nodes;
+  std::vector<Move> pv;
+};
+
+// 协调模式下的工作进程，都是普通的 chinesecheckers_server 实例
+std::vector<std::pair<std::string, int>> workers;
+// 置换表快照文件，为空时不能保存和读入
+std::string hashFile;
+
+int parseTime(const httplib::Request& req) {
+  std::string time = req.get_param_value("time");
+  int searchTime = 1;
+  if (!time.empty()) {
+    try {
+      searchTime = std::stoi(time);
+    } catch (std::invalid_argument const& e) {
+      searchTime = 1;
+    }
+  }
+  if (searchTime < 1 || searchTime > 100) {
+    searchTime = 1;
+  }
+  return searchTime;
+}
+
+// state 参数不是合法局面时返回 400，不交给引擎
+bool checkState(const httplib::Request& req, httplib::Response& res) {
+  if (isValidPosition(GameState(req.get_param_value("state")))) {
+    return true;
+  }
+  res.status = 400;
+  res.set_header("Access-Control-Allow-Origin", "*");
+  res.set_content("invalid state", "text/plain");
+  return false;
+}
+
+// 着法列表格式为 "src,dst,src,dst,..."
+std::vector<Move> parseMoves(const std::string& text) {
+  std::vector<Move> moves;
+  std::istringstream iss(text);
+  std::string src, dst;
+  while (std::getline(iss, src, ',') && std::getline(iss, dst, ',')) {
+    try {
+      moves.push_back({std::stoi(src), std::stoi(dst)});
+    } catch (std::invalid_argument const& e) {
+      break;
+    }
+  }
+  return moves;
+}
+
+std::string formatMoves(const std::vector<Move>& moves) {
+  std::string text;
+  for (auto& move : moves) {
+    text += (text.empty() ? "" : ",") + std::to_string(move.src) + "," + std::to_string(move.dst);
+  }
+  return text;
+}
+
+// 响应格式为 "depth score nodes src dst src dst ..."，之后是主要变例
+std::string formatAnalysis(const Analysis& analysis) {
+  std::string text =
+      std::to_string(analysis.depth) + " " + std::to_string(analysis.score) + " " + std::to_string(analysis.nodes);
+  for (auto& move : analysis.pv) {
+    text += " " + std::to_string(move.src) + " " + std::to_string(move.dst);
+  }
+  return text;
+}
+
+bool parseAnalysis(const std::string& text, Analysis& analysis) {
+  std::istringstream iss(text);
+  if (!(iss >> analysis.depth >> analysis.score >> analysis.nodes)) {
+    return false;
+  }
+  Move move;
+  while (iss >> move.src >> move.dst) {
+    analysis.pv.push_back(move);
+  }
+  return !analysis.pv.empty();
+}
+
+// 在本进程中搜索，searchMoves 非空时只搜索这些根着法
+Analysis analyseLocal(const std::string& state, int time, const std::vector<Move>& searchMoves, SearchBackend backend,
+                      Priority priority) {
+  GameState gameState(state);
+  SearchLimits limits;
+  limits.timeLimit = time;
+  limits.backend = backend;
+  limits.searchMoves = searchMoves;
+  Analysis analysis{0, 0, 0, {}};
+  Move move = scheduledSearch(gameState, limits, priority, [&analysis](const SearchInfo& info) {
+    analysis.depth = info.depth;
+    analysis.score = info.score;
+    analysis.nodes = info.nodes;
+    analysis.pv = info.lines.empty() ? std::vector<Move>{info.bestMove} : info.lines[0].moves;
+  });
+  // 开局库着法或者第一层都没有搜完时没有进度信息
+  if (analysis.pv.empty() || analysis.pv[0].src != move.src || analysis.pv[0].dst != move.dst) {
+    analysis.pv = {move};
+  }
+  return analysis;
+}
+
+// 根结点分割：把根着法轮流分给各个工作进程，每个进程只搜索分到的着法，取评分最高的结果。
+// 各进程完成的深度可能不同，返回的深度为其中最浅的一个
+Analysis analyseDistributed(const std::string& state, int time, Priority priority) {
+  GameState gameState(state);
+  Move bookMove = searchBook(gameState.hash());
+  if (bookMove.src >= 0) {
+    return Analysis{0, 0, 0, {bookMove}};
+  }
+  // 按前进距离排序，使较好的着法分散到不同的进程
+  std::vector<Move> moves = gameState.legalMoves();
+  auto gain = [&gameState](const Move& move) {
+    int distance = PIECE_DISTANCES[move.dst] - PIECE_DISTANCES[move.src];
+    return gameState.turn == RED ? -distance : distance;
+  };
+  std::stable_sort(moves.begin(), moves.end(), [&gain](const Move& a, const Move& b) { return gain(a) > gain(b); });
+  std::vector<std::vector<Move>> parts(workers.size());
+  for (size_t i = 0; i < moves.size(); i++) {
+    parts[i % workers.size()].push_back(moves[i]);
+  }
+  std::vector<Analysis> results(workers.size(), Analysis{0, 0, 0, {}});
+  std::vector<bool> succeeded(workers.size(), false);
+  std::vector<std::thread> requests;
+  for (size_t i = 0; i < workers.size(); i++) {
+    if (parts[i].empty()) {
+      continue;
+    }
+    requests.emplace_back([&, i]() {
+      httplib::Client client(workers[i].first, workers[i].second);
+      client.set_read_timeout(time + 10, 0);
+      httplib::Params params{{"state", state},
+                             {"time", std::to_string(time)},
+                             {"moves", formatMoves(parts[i])},
+                             {"priority", priority == PRIORITY_BACKGROUND ? "background" : "interactive"}};
+      auto res = client.Get("/analyse", params, httplib::Headers());
+      if (!res || res->status != 200) {
+        spdlog::warn("worker {}:{} failed", workers[i].first, workers[i].second);
+        return;
+      }
+      succeeded[i] = parseAnalysis(res->body, results[i]);
+    });
+  }
+  for (auto& request : requests) {
+    request.join();
+  }
+  Analysis best{0, -INT_MAX, 0, {}};
+  int depth = INT_MAX;
+  uint64_t nodes = 0;
+  for (size_t i = 0; i < workers.size(); i++) {
+    if (!succeeded[i]) {
+      continue;
+    }
+    spdlog::info("worker {}:{} depth: {}, score: {}, move: {} {}", workers[i].first, workers[i].second,
+                 results[i].depth, results[i].score, results[i].pv[0].src, results[i].pv[0].dst);
+    depth = std::min(depth, results[i].depth);
+    nodes += results[i].nodes;
+    if (results[i].score > best.score) {
+      best = results[i];
+    }
+  }
+  if (best.pv.empty()) {
+    // 所有工作进程都不可用时在本进程中搜索
+    spdlog::warn("no worker available, searching locally");
+    return analyseLocal(state, time, {}, BACKEND_ALPHABETA, priority);
+  }
+  best.depth = depth;
+  best.nodes = nodes;
+  return best;
+}
+
+#ifndef _WIN32
+// Unix 域套接字协议，供同一台机器上的程序低延迟调用。请求和响应都是定长的二进制帧 (小端序)，
+// 局面直接以位棋盘传递，一个连接上可以连续发送多个请求
+const uint32_t SOCKET_MAGIC = 0x43434531;  // "1ECC"
+// 思考时间的上限 (毫秒)，更大的值按上限处理
+const uint32_t SOCKET_MAX_MOVE_TIME = 3600 * 1000;
+// 所有连接线程都在使用时最多排队等待的连接数，超出时直接关闭新连接
+const size_t SOCKET_MAX_QUEUED = 64;
+
+struct SocketRequest {
+  uint32_t magic;
+  // 思考时间 (毫秒)
+  uint32_t moveTime;
+  // 双方棋子的位棋盘，低 64 位在前
+  uint64_t red[2];
+  uint64_t green[2];
+  uint8_t turn;
+  // 最大搜索深度，0 表示不限制
+  uint8_t depth;
+  uint16_t round;
+  uint32_t reserved;
+};
+
+struct SocketResponse {
+  uint32_t magic;
+  int32_t src;
+  int32_t dst;
+  int32_t score;
+  int32_t depth;
+  uint32_t reserved;
+  uint64_t nodes;
+};
+
+static_assert(sizeof(SocketRequest) == 48, "SocketRequest must be 48 bytes");
+static_assert(sizeof(SocketResponse) == 32, "SocketResponse must be 32 bytes");
+
+bool readFully(int fd, void* buffer, size_t size) {
+  char* p = static_cast<char*>(buffer);
+  while (size > 0) {
+    ssize_t n = read(fd, p, size);
+    if (n <= 0) {
+      return false;
+    }
+    p += n;
+    size -= n;
+  }
+  return true;
+}
+
+bool writeFully(int fd, const void* buffer, size_t size) {
+  const char* p = static_cast<const char*>(buffer);
+  while (size > 0) {
+    ssize_t n = write(fd, p, size);
+    if (n <= 0) {
+      return false;
+    }
+    p += n;
+    size -= n;
+  }
+  return true;
+}
+
+SocketResponse searchSocketRequest(const SocketRequest& request) {
+  SocketResponse response{SOCKET_MAGIC, -1, -1, 0, 0, 0, 0};
+  GameState gameState;
+  gameState.board[RED] = (uint128_t)request.red[1] << 64 | request.red[0];
+  gameState.board[GREEN] = (uint128_t)request.green[1] << 64 | request.green[0];
+  gameState.turn = request.turn == GREEN ? GREEN : RED;
+  gameState.round = request.round;
+  gameState.zobristHash = 0;
+  if ((request.turn != RED && request.turn != GREEN) || !isValidPosition(gameState)) {
+    return response;
+  }
+  gameState.hash();
+  SearchLimits limits;
+  limits.moveTime = (int)std::max<uint32_t>(std::min(request.moveTime, SOCKET_MAX_MOVE_TIME), 1);
+  limits.depth = request.depth;
+  TraceScope scope("socket");
+  EngineSlot slot(PRIORITY_INTERACTIVE);
+  Move move = gameState.searchBestMove(limits, [&response](const SearchInfo& info) {
+    response.score = info.score;
+    response.depth = info.depth;
+    response.nodes = info.nodes;
+  });
+  response.src = move.src;
+  response.dst = move.dst;
+  return response;
+}
+
+void serveSocketConnection(int fd) {
+  SocketRequest request;
+  while (readFully(fd, &request, sizeof(request))) {
+    if (request.magic != SOCKET_MAGIC) {
+      break;
+    }
+    SocketResponse response = searchSocketRequest(request);
+    if (!writeFully(fd, &response, sizeof(response))) {
+      break;
+    }
+  }
+  close(fd);
+}
+
+// 在 path 上监听 Unix 域套接字。连接由与 HTTP 服务器同样大小的线程池处理，每个连接占用一个线程，
+// 搜索时和 HTTP 请求共用同一个调度器和同一组搜索线程
+bool listenSocket(const std::string& path) {
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  if (fd < 0 || path.size() >= sizeof(address.sun_path)) {
+    return false;
+  }
+  std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+  unlink(path.c_str());
+  if (bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(fd, 64) != 0) {
+    close(fd);
+    return false;
+  }
+  std::thread([fd]() {
+    // 监听线程不会退出，线程池随之一直保留
+    httplib::ThreadPool pool(CPPHTTPLIB_THREAD_POOL_COUNT, SOCKET_MAX_QUEUED);
+    while (true) {
+      int client = accept(fd, nullptr, nullptr);
+      if (client >= 0 && !pool.enqueue([client]() { serveSocketConnection(client); })) {
+        close(client);
+      }
+    }
+  }).detach();
+  return true;
+}
+#endif
 
 int main(int argc, char* argv[]) {
   using namespace httplib;
@@ -13,41 +513,221 @@ int main(int argc, char* argv[]) {
 
   std::string host = "localhost";
   int port = 1234;
+  int threads = std::thread::hardware_concurrency();
 
-  if (argc > 1) {
-    host = argv[1];
+  std::string socketPath;
+
+  // 用法: chinesecheckers_server [host] [port] [threads] [--workers host:port,...] [--hash-file path]
+  //       [--unix-socket path] [--trace]
+  std::vector<std::string> args;
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if (arg == "--trace") {
+      setTracing(true);
+    } else if (arg == "--unix-socket" && i + 1 < argc) {
+      socketPath = argv[++i];
+    } else if (arg == "--hash-file" && i + 1 < argc) {
+      hashFile = argv[++i];
+    } else if (arg == "--workers" && i + 1 < argc) {
+      std::istringstream iss(argv[++i]);
+      std::string address;
+      while (std::getline(iss, address, ',')) {
+        size_t colon = address.rfind(':');
+        if (colon == std::string::npos) {
+          continue;
+        }
+        workers.push_back({address.substr(0, colon), std::stoi(address.substr(colon + 1))});
+      }
+    } else {
+      args.push_back(arg);
+    }
+  }
+  if (args.size() > 0) {
+    host = args[0];
   }
-  if (argc > 2) {
-    port = std::stoi(argv[2]);
+  if (args.size() > 1) {
+    port = std::stoi(args[1]);
+  }
+  if (args.size() > 2) {
+    threads = std::stoi(args[2]);
+  }
+  setSearchThreads(threads);
+  // 启动时读入上次保存的置换表快照，文件不存在时冷启动
+  if (!hashFile.empty()) {
+    try {
+      spdlog::info("loaded {} hash entries from {}", loadHash(hashFile), hashFile);
+    } catch (std::runtime_error const& e) {
+      spdlog::warn("{}", e.what());
+    }
   }
 
   Server svr;
 
-  spdlog::info("Server running at http://{}:{}", host, port);
+  spdlog::info("Server running at http://{}:{} with {} search threads", host, port, getSearchThreads());
+  for (auto& worker : workers) {
+    spdlog::info("worker: {}:{}", worker.first, worker.second);
+  }
+#ifndef _WIN32
+  if (!socketPath.empty()) {
+    if (listenSocket(socketPath)) {
+      spdlog::info("Unix socket listening at {}", socketPath);
+    } else {
+      spdlog::error("cannot listen at {}", socketPath);
+    }
+  }
+#endif
 
   svr.Get("/search", [](const Request& req, Response& res) {
-    std::lock_guard<std::mutex> guard(mtx);
+    TraceScope scope("/search");
+    if (!checkState(req, res)) {
+      return;
+    }
+    std::string body = singleflight(requestKey("/search", req), [&req]() {
+      std::string state = req.get_param_value("state");
+      int searchTime = parseTime(req);
+      Priority priority = requestPriority(req, searchTime);
+      spdlog::info("state: {}", state);
+      spdlog::info("think: {} seconds", searchTime);
+      Move move;
+      if (workers.empty()) {
+        GameState gameState(state);
+        SearchLimits limits;
+        limits.timeLimit = searchTime;
+        limits.backend = req.get_param_value("engine") == "mcts" ? BACKEND_MCTS : BACKEND_ALPHABETA;
+        if (req.has_param("depth")) {
+          limits.depth = std::atoi(req.get_param_value("depth").c_str());
+        }
+        // 棋力等级 1-5，按结点数限制搜索量，不给出时全力搜索
+        if (req.has_param("level")) {
+          limits.skill = std::max(0, std::min(std::atoi(req.get_param_value("level").c_str()), SKILL_LEVELS));
+        }
+        // 对局时钟 (毫秒)，给出 remaining 时代替 time
+        if (req.has_param("remaining")) {
+          limits.clock.remaining = std::atoll(req.get_param_value("remaining").c_str());
+          limits.clock.increment = std::atoll(req.get_param_value("increment").c_str());
+          limits.clock.movesToGo = std::atoi(req.get_param_value("movestogo").c_str());
+        }
+        move = scheduledSearch(gameState, limits, priority);
+      } else {
+        move = analyseDistributed(state, searchTime, priority).pv[0];
+      }
+      spdlog::info("bestmove: {} {}", move.src, move.dst);
+      return std::to_string(move.src) + " " + std::to_string(move.dst);
+    });
+    res.set_header("Access-Control-Allow-Origin", "*");
+    res.set_content(body, "text/plain");
+  });
+
+  // 返回搜索深度、评分、结点数和主要变例；moves 参数限定只搜索部分根着法，供协调进程调用
+  svr.Get("/analyse", [](const Request& req, Response& res) {
+    TraceScope scope("/analyse");
+    if (!checkState(req, res)) {
+      return;
+    }
+    std::string body = singleflight(requestKey("/analyse", req), [&req]() {
+      std::string state = req.get_param_value("state");
+      int searchTime = parseTime(req);
+      Priority priority = requestPriority(req, searchTime);
+      std::vector<Move> searchMoves = parseMoves(req.get_param_value("moves"));
+      Analysis analysis;
+      if (workers.empty() || !searchMoves.empty()) {
+        SearchBackend backend = req.get_param_value("engine") == "mcts" ? BACKEND_MCTS : BACKEND_ALPHABETA;
+        analysis = analyseLocal(state, searchTime, searchMoves, backend, priority);
+      } else {
+        analysis = analyseDistributed(state, searchTime, priority);
+      }
+      std::string body = formatAnalysis(analysis);
+      spdlog::info("analyse: {} -> {}", state, body);
+      return body;
+    });
+    res.set_header("Access-Control-Allow-Origin", "*");
+    res.set_content(body, "text/plain");
+  });
+
+  // 证明当前局面的强制胜负，返回 win/loss/unknown 和证明树上的主要变例
+  svr.Get("/solve", [](const Request& req, Response& res) {
+    TraceScope scope("/solve");
+    if (!checkState(req, res)) {
+      return;
+    }
     std::string state = req.get_param_value("state");
-    std::string time = req.get_param_value("time");
-    int searchTime = 1;
-    if (!time.empty()) {
+    int solveTime = parseTime(req);
+    // 证明搜索没有迭代边界，不能被抢占，只按优先级排队
+    EngineSlot slot(requestPriority(req, solveTime));
+    GameState gameState(state);
+    SearchContext context;
+    context.deadline = std::chrono::high_resolution_clock::now() + std::chrono::seconds(solveTime);
+    context.stopped = false;
+    context.stop = nullptr;
+    context.nodes = 0;
+    ProofSolution solution = solveProof(gameState, UINT64_MAX, context);
+    const char* results[] = {"unknown", "win", "loss"};
+    std::string body = results[solution.result];
+    for (auto& move : solution.line) {
+      body += " " + std::to_string(move.src) + " " + std::to_string(move.dst);
+    }
+    spdlog::info("solve: {} -> {}, nodes: {}", state, body, solution.nodes);
+    res.set_header("Access-Control-Allow-Origin", "*");
+    res.set_content(body, "text/plain");
+  });
+
+  // 管理接口：部署前保存深度最大的 percent% 置换表条目，只写入启动时指定的快照文件
+  svr.Post("/admin/savehash", [](const Request& req, Response& res) {
+    TraceScope scope("/admin/savehash");
+    EngineSlot slot(PRIORITY_INTERACTIVE);
+    if (hashFile.empty()) {
+      res.status = 400;
+      res.set_content("no hash file", "text/plain");
+      return;
+    }
+    int percent = 100;
+    if (req.has_param("percent")) {
       try {
-        searchTime = std::stoi(time);
+        percent = std::stoi(req.get_param_value("percent"));
       } catch (std::invalid_argument const& e) {
-        searchTime = 1;
+        percent = 100;
       }
     }
-    if (searchTime < 1 || searchTime > 100) {
-      searchTime = 1;
+    try {
+      size_t count = saveHash(hashFile, percent);
+      spdlog::info("saved {} hash entries to {}", count, hashFile);
+      res.set_content(std::to_string(count), "text/plain");
+    } catch (std::runtime_error const& e) {
+      res.status = 500;
+      res.set_content(e.what(), "text/plain");
     }
-    GameState gameState(state);
-    spdlog::info("state: {}", state);
-    spdlog::info("think: {} seconds", searchTime);
-    Move move = gameState.searchBestMove(searchTime);
-    spdlog::info("bestmove: {} {}", move.src, move.dst);
+  });
+
+  svr.Post("/admin/loadhash", [](const Request&, Response& res) {
+    TraceScope scope("/admin/loadhash");
+    EngineSlot slot(PRIORITY_INTERACTIVE);
+    if (hashFile.empty()) {
+      res.status = 400;
+      res.set_content("no hash file", "text/plain");
+      return;
+    }
+    try {
+      size_t count = loadHash(hashFile);
+      spdlog::info("loaded {} hash entries from {}", count, hashFile);
+      res.set_content(std::to_string(count), "text/plain");
+    } catch (std::runtime_error const& e) {
+      res.status = 500;
+      res.set_content(e.what(), "text/plain");
+    }
+  });
+
+  // 跟踪：POST /admin/trace?enable=1 开始记录 (同时清空之前的事件)，enable=0 停止，
+  // GET /admin/trace 以 Chrome Trace Event 格式返回已记录的事件
+  svr.Post("/admin/trace", [](const Request& req, Response& res) {
+    clearTrace();
+    setTracing(req.get_param_value("enable") != "0");
+    res.set_content("ok", "text/plain");
+  });
+
+  svr.Get("/admin/trace", [](const Request&, Response& res) {
     res.set_header("Access-Control-Allow-Origin", "*");
-    res.set_content(std::to_string(move.src) + " " + std::to_string(move.dst), "text/plain");
+    res.set_content(traceJson(), "application/json");
   });
 
   svr.listen(host, port);
-}
\ No newline at end of file
+}
@@ -0,0 +1,118 @@
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <trace.hpp>
+
+struct TraceRecord {
+  const char *name;
+  int64_t start;
+  int64_t duration;
+  int64_t value;
+};
+
+// 单个线程的环形缓冲区，只有所属线程写入，导出时由其他线程读取
+struct TraceRing {
+  std::atomic<bool> used;
+  std::atomic<uint64_t> head;
+  TraceRecord records[TRACE_RING_SIZE];
+};
+
+std::atomic<bool> TRACE_ENABLED(false);
+// 已经分配的缓冲区，分配后不再释放
+TraceRing *TRACE_RINGS[MAX_TRACE_THREADS];
+std::atomic<int> TRACE_RING_COUNT(0);
+std::mutex TRACE_MUTEX;
+
+// 线程第一次记录事件时取得一个缓冲区，退出时归还
+struct TraceThread {
+  TraceRing *ring = nullptr;
+  ~TraceThread() {
+    if (ring != nullptr) {
+      ring->used.store(false, std::memory_order_release);
+    }
+  }
+};
+
+thread_local TraceThread TRACE_THREAD;
+
+static TraceRing *acquireRing() {
+  std::lock_guard<std::mutex> guard(TRACE_MUTEX);
+  int count = TRACE_RING_COUNT.load(std::memory_order_relaxed);
+  for (int i = 0; i < count; i++) {
+    bool expected = false;
+    if (TRACE_RINGS[i]->used.compare_exchange_strong(expected, true)) {
+      return TRACE_RINGS[i];
+    }
+  }
+  if (count == MAX_TRACE_THREADS) {
+    return nullptr;
+  }
+  TraceRing *ring = new TraceRing();
+  ring->used = true;
+  ring->head = 0;
+  TRACE_RINGS[count] = ring;
+  TRACE_RING_COUNT.store(count + 1, std::memory_order_release);
+  return ring;
+}
+
+void setTracing(bool enabled) { TRACE_ENABLED.store(enabled, std::memory_order_relaxed); }
+
+void clearTrace() {
+  int count = TRACE_RING_COUNT.load(std::memory_order_acquire);
+  for (int i = 0; i < count; i++) {
+    TRACE_RINGS[i]->head.store(0, std::memory_order_release);
+  }
+}
+
+int64_t traceNow() {
+  static const auto epoch = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - epoch).count();
+}
+
+void traceEvent(const char *name, int64_t start, int64_t end, int64_t value) {
+  TraceRing *ring = TRACE_THREAD.ring;
+  if (ring == nullptr) {
+    ring = TRACE_THREAD.ring = acquireRing();
+    if (ring == nullptr) {
+      return;
+    }
+  }
+  uint64_t head = ring->head.load(std::memory_order_relaxed);
+  ring->records[head % TRACE_RING_SIZE] = TraceRecord{name, start, end - start, value};
+  ring->head.store(head + 1, std::memory_order_release);
+}
+
+std::string traceJson() {
+  std::string json = "{\"traceEvents\":[";
+  bool first = true;
+  char buffer[256];
+  int count = TRACE_RING_COUNT.load(std::memory_order_acquire);
+  for (int tid = 0; tid < count; tid++) {
+    TraceRing *ring = TRACE_RINGS[tid];
+    uint64_t head = ring->head.load(std::memory_order_acquire);
+    for (uint64_t i = head > TRACE_RING_SIZE ? head - TRACE_RING_SIZE : 0; i < head; i++) {
+      const TraceRecord &record = ring->records[i % TRACE_RING_SIZE];
+      int length = std::snprintf(buffer, sizeof(buffer),
+                                 "%s\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%" PRId64
+                                 ",\"dur\":%" PRId64,
+                                 first ? "" : ",", record.name, tid, record.start, record.duration);
+      json.append(buffer, length);
+      if (record.value >= 0) {
+        length = std::snprintf(buffer, sizeof(buffer), ",\"args\":{\"value\":%" PRId64 "}", record.value);
+        json.append(buffer, length);
+      }
+      json += "}";
+      first = false;
+    }
+  }
+  json += "\n]}\n";
+  return json;
+}
+
+bool writeTrace(const std::string &path) {
+  std::ofstream file(path);
+  file << traceJson();
+  return file.good();
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+// 每个线程最多保留的事件数，写满后覆盖最早的事件
+const uint64_t TRACE_RING_SIZE = 1 << 14;
+// 最多记录事件的线程数，线程退出后它的缓冲区留给新线程使用
+const int MAX_TRACE_THREADS = 256;
+
+// 是否记录事件。关闭时每个埋点只多一次原子读取
+extern std::atomic<bool> TRACE_ENABLED;
+
+void setTracing(bool enabled);
+// 丢弃已经记录的事件
+void clearTrace();
+// 自进程启动以来的微秒数
+int64_t traceNow();
+// 记录一个从 start 到 end 的事件，value 为 -1 时不输出参数。name 必须是字符串常量
+void traceEvent(const char *name, int64_t start, int64_t end, int64_t value = -1);
+// 以 Chrome Trace Event 格式 (chrome://tracing、Perfetto) 输出所有线程记录的事件。
+// 导出时仍在写入的事件可能不完整，最好在没有搜索时导出
+std::string traceJson();
+bool writeTrace(const std::string &path);
+
+// 在作用域内计时的事件
+class TraceScope {
+ public:
+  explicit TraceScope(const char *name, int64_t value = -1)
+      : name(name), value(value), start(TRACE_ENABLED.load(std::memory_order_relaxed) ? traceNow() : -1) {}
+  ~TraceScope() { end(); }
+  TraceScope(const TraceScope &) = delete;
+  TraceScope &operator=(const TraceScope &) = delete;
+  void setValue(int64_t value) { this->value = value; }
+  // 提前结束事件
+  void end() {
+    if (start >= 0) {
+      traceEvent(name, start, traceNow(), value);
+      start = -1;
+    }
+  }
+
+ private:
+  const char *name;
+  int64_t value;
+  int64_t start;
+};
@@ -1,19 +1,215 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
+#include <new>
+#include <vector>
 #include <transtable.hpp>
 
+// data 布局: value(32) | depth(8) | flag(2) | src + 1(7) | dst + 1(7) | generation(8)
+static inline uint64_t pack(const TranspositionTableEntry& entry, uint8_t generation) {
+  return (uint64_t)(uint32_t)entry.value | (uint64_t)(entry.depth & 0xff) << 32 | (uint64_t)(entry.flag & 0x3) << 40 |
+         (uint64_t)(entry.bestMove.src + 1) << 42 | (uint64_t)(entry.bestMove.dst + 1) << 49 |
+         (uint64_t)generation << 56;
+}
+
+static inline void unpack(uint64_t hash, uint64_t data, TranspositionTableEntry& entry) {
+  entry.hash = hash;
+  entry.value = (int)(uint32_t)data;
+  entry.depth = (int)(data >> 32 & 0xff);
+  entry.flag = (HashFlag)(data >> 40 & 0x3);
+  entry.bestMove.src = (int)(data >> 42 & 0x7f) - 1;
+  entry.bestMove.dst = (int)(data >> 49 & 0x7f) - 1;
+}
+
+TranspositionTable::~TranspositionTable() { std::free(items); }
+
+void TranspositionTable::resize(size_t megabytes) {
+  this->megabytes = megabytes;
+  size_t count = 1;
+  while (count * 2 * sizeof(Slot) <= std::max<size_t>(megabytes, 1) << 20) {
+    count *= 2;
+  }
+  std::free(items);
+  // calloc 得到的内存按需清零，不会在启动时触碰整张表
+  items = static_cast<Slot*>(std::calloc(count, sizeof(Slot)));
+  if (items == nullptr) {
+    throw std::bad_alloc();
+  }
+  mask = count - 1;
+}
+
 void TranspositionTable::put(const uint64_t hash, const TranspositionTableEntry& value) {
-  if (exists(hash) && items[hash & TRANSPOSITION_TABLE_MASK].depth > value.depth) {
+  Slot& slot = items[hash & mask];
+  uint64_t data = slot.data.load(std::memory_order_relaxed);
+  uint64_t key = slot.key.load(std::memory_order_relaxed) ^ data;
+  int depth = (int)(data >> 32 & 0xff);
+  // 同一局面保留更深的结果；不同局面时保留本次搜索写入的、明显更深的条目，其余情况直接覆盖
+  if (key == hash && depth > value.depth) {
+    return;
+  }
+  if (key != hash && key != 0 && (uint8_t)(data >> 56) == generation && depth > value.depth + 2) {
     return;
   }
-  items[hash & TRANSPOSITION_TABLE_MASK] = value;
+  data = pack(value, generation);
+  slot.data.store(data, std::memory_order_relaxed);
+  slot.key.store(hash ^ data, std::memory_order_relaxed);
 }
 
-const TranspositionTableEntry& TranspositionTable::get(const uint64_t hash) {
-  return items[hash & TRANSPOSITION_TABLE_MASK];
+bool TranspositionTable::get(const uint64_t hash, TranspositionTableEntry& entry) const {
+  if (items == nullptr) {
+    return false;
+  }
+  const Slot& slot = items[hash & mask];
+  uint64_t key = slot.key.load(std::memory_order_relaxed);
+  uint64_t data = slot.data.load(std::memory_order_relaxed);
+  if ((key ^ data) != hash) {
+    return false;
+  }
+  unpack(hash, data, entry);
+  return true;
 }
 
 bool TranspositionTable::exists(const uint64_t hash) const {
-  return items[hash & TRANSPOSITION_TABLE_MASK].hash == hash;
+  if (items == nullptr) {
+    return false;
+  }
+  const Slot& slot = items[hash & mask];
+  return (slot.key.load(std::memory_order_relaxed) ^ slot.data.load(std::memory_order_relaxed)) == hash;
+}
+
+void TranspositionTable::newSearch() {
+  if (items == nullptr) {
+    resize(megabytes);
+  }
+  generation++;
 }
 
-void TranspositionTable::clear() { memset(items, 0, sizeof(items)); }
+void TranspositionTable::clear() {
+  if (items == nullptr) {
+    return;
+  }
+  for (uint64_t i = 0; i <= mask; i++) {
+    items[i].key.store(0, std::memory_order_relaxed);
+    items[i].data.store(0, std::memory_order_relaxed);
+  }
+}
+
+// 快照文件格式: 文件头之后是 count 个 (hash, data) 对，data 与置换表中的布局相同，
+// 布局改变时需要增加版本号
+const char SNAPSHOT_MAGIC[4] = {'C', 'C', 'T', 'T'};
+const uint32_t SNAPSHOT_VERSION = 1;
+
+struct SnapshotHeader {
+  char magic[4];
+  uint32_t version;
+  uint64_t count;
+  uint64_t checksum;
+};
+
+static inline uint64_t checksum(uint64_t sum, uint64_t word) {
+  sum ^= word;
+  sum *= 0x100000001b3ULL;
+  return sum ^ (sum >> 29);
+}
+
+size_t TranspositionTable::save(const std::string& path, int percent) const {
+  std::vector<uint64_t> words;
+  if (items != nullptr) {
+    // 统计各深度的条目数，从最深的开始取，直到取够 percent%
+    size_t histogram[256] = {0};
+    size_t used = 0;
+    for (uint64_t i = 0; i <= mask; i++) {
+      uint64_t data = items[i].data.load(std::memory_order_relaxed);
+      if ((items[i].key.load(std::memory_order_relaxed) ^ data) != 0) {
+        histogram[data >> 32 & 0xff]++;
+        used++;
+      }
+    }
+    size_t quota = used * (size_t)std::max(0, std::min(percent, 100)) / 100;
+    size_t taken = 0;
+    int minDepth = 256;
+    while (minDepth > 0 && taken < quota) {
+      taken += histogram[--minDepth];
+    }
+    // 处于分界深度的条目只取一部分
+    size_t boundary = minDepth < 256 ? histogram[minDepth] - (taken - quota) : 0;
+    for (uint64_t i = 0; i <= mask && words.size() < quota * 2; i++) {
+      uint64_t data = items[i].data.load(std::memory_order_relaxed);
+      uint64_t hash = items[i].key.load(std::memory_order_relaxed) ^ data;
+      int depth = (int)(data >> 32 & 0xff);
+      if (hash == 0 || depth < minDepth) {
+        continue;
+      }
+      if (depth == minDepth) {
+        if (boundary == 0) {
+          continue;
+        }
+        boundary--;
+      }
+      words.push_back(hash);
+      words.push_back(data);
+    }
+  }
+  SnapshotHeader header;
+  std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+  header.version = SNAPSHOT_VERSION;
+  header.count = words.size() / 2;
+  header.checksum = 0;
+  for (uint64_t word : words) {
+    header.checksum = checksum(header.checksum, word);
+  }
+  // 先写临时文件再改名，写到一半失败时不会破坏原有的快照
+  std::string temp = path + ".tmp";
+  FILE* file = std::fopen(temp.c_str(), "wb");
+  if (file == nullptr) {
+    throw std::runtime_error("cannot open " + temp);
+  }
+  bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1 &&
+            std::fwrite(words.data(), sizeof(uint64_t), words.size(), file) == words.size();
+  ok = std::fclose(file) == 0 && ok;
+  if (!ok || std::rename(temp.c_str(), path.c_str()) != 0) {
+    std::remove(temp.c_str());
+    throw std::runtime_error("cannot write " + path);
+  }
+  return header.count;
+}
+
+size_t TranspositionTable::load(const std::string& path) {
+  FILE* file = std::fopen(path.c_str(), "rb");
+  if (file == nullptr) {
+    throw std::runtime_error("cannot open " + path);
+  }
+  // 条目数要和文件长度一致才分配内存，头部损坏时不会按错误的条目数分配
+  long size = std::fseek(file, 0, SEEK_END) == 0 ? std::ftell(file) : -1;
+  std::rewind(file);
+  SnapshotHeader header;
+  bool ok = size >= (long)sizeof(header) && std::fread(&header, sizeof(header), 1, file) == 1 &&
+            std::memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic)) == 0 &&
+            header.version == SNAPSHOT_VERSION &&
+            header.count == (uint64_t)(size - sizeof(header)) / (2 * sizeof(uint64_t)) &&
+            (uint64_t)(size - sizeof(header)) % (2 * sizeof(uint64_t)) == 0;
+  std::vector<uint64_t> words;
+  if (ok) {
+    words.resize(header.count * 2);
+    ok = std::fread(words.data(), sizeof(uint64_t), words.size(), file) == words.size();
+  }
+  std::fclose(file);
+  uint64_t sum = 0;
+  for (uint64_t word : words) {
+    sum = checksum(sum, word);
+  }
+  if (!ok || sum != header.checksum) {
+    throw std::runtime_error("invalid snapshot " + path);
+  }
+  if (items == nullptr) {
+    resize(megabytes);
+  }
+  // 按普通写入的替换规则放入，快照条目的代数为当前代数，下一次搜索开始后变为旧条目
+  TranspositionTableEntry entry;
+  for (size_t i = 0; i < words.size(); i += 2) {
+    unpack(words[i], words[i + 1], entry);
+    put(words[i], entry);
+  }
+  return header.count;
+}
@@ -1,14 +1,20 @@
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <game.hpp>
 #include <list>
 #include <stdexcept>
+#include <string>
 #include <unordered_map>
 
-#define TRANSPOSITION_TABLE_SIZE (1 << 22)
-#define TRANSPOSITION_TABLE_MASK ((1 << 22) - 1)
+// 默认置换表大小 (MB)，浏览器中内存紧张，默认值较小
+#ifdef __EMSCRIPTEN__
+#define DEFAULT_TRANSPOSITION_TABLE_MB 16
+#else
+#define DEFAULT_TRANSPOSITION_TABLE_MB 64
+#endif
 
 struct TranspositionTableEntry {
   uint64_t hash;
@@ -18,13 +24,37 @@ struct TranspositionTableEntry {
   Move bestMove;
 };
 
+// 置换表由多个搜索线程共享，采用无锁的 key ^ data 校验方式存储，
+// 读到被并发写坏的条目时校验失败，按未命中处理。
 class TranspositionTable {
  public:
+  // 构造时不分配内存，全局置换表可以常量初始化，第一次搜索 (newSearch) 时才按 megabytes 分配
+  constexpr explicit TranspositionTable(size_t megabytes = DEFAULT_TRANSPOSITION_TABLE_MB)
+      : items(nullptr), mask(0), generation(0), megabytes(megabytes) {}
+  ~TranspositionTable();
+  TranspositionTable(const TranspositionTable&) = delete;
+  TranspositionTable& operator=(const TranspositionTable&) = delete;
   void put(const uint64_t hash, const TranspositionTableEntry& value);
-  const TranspositionTableEntry& get(const uint64_t hash);
+  bool get(const uint64_t hash, TranspositionTableEntry& entry) const;
   bool exists(const uint64_t hash) const;
   void clear();
+  // 开始新的一次搜索，之前搜索留下的条目变为旧条目
+  void newSearch();
+  // 重新分配置换表，大小向下取整到 2 的幂，原有内容全部丢弃
+  void resize(size_t megabytes);
+  size_t size() const { return items == nullptr ? 0 : mask + 1; }
+  // 把深度最大的 percent% 条目写入快照文件，返回写入的条目数，失败时抛出 std::runtime_error
+  size_t save(const std::string& path, int percent = 100) const;
+  // 读入快照文件并放入置换表，返回读入的条目数，文件损坏或版本不符时抛出 std::runtime_error
+  size_t load(const std::string& path);
 
  private:
-  TranspositionTableEntry items[TRANSPOSITION_TABLE_SIZE];
-};
\ No newline at end of file
+  struct Slot {
+    std::atomic<uint64_t> key;
+    std::atomic<uint64_t> data;
+  };
+  Slot* items;
+  uint64_t mask;
+  uint8_t generation;
+  size_t megabytes;
+};
@@ -1,10 +1,90 @@
 #include <emscripten/bind.h>
 #include <emscripten/emscripten.h>
 
+#include <atomic>
 #include <game.hpp>
 #include <iostream>
 #include <string>
 
+// 搜索停止标志。多线程版本中 WASM 内存是 SharedArrayBuffer，页面主线程可以通过
+// Atomics 直接写入该地址，打断正在 worker 中进行的搜索。
+std::atomic<bool> STOP_FLAG(false);
+
+// 供 JS 直接读取的缓冲区。返回的 TypedArray 视图指向 WASM 线性内存，
+// 内存增长后会失效，JS 侧需要立即使用或拷贝。
+uint8_t BOARD_BUFFER[81];
+// 着法打包为 src | dst << 8，最多 10 个棋子 * 81 个落点
+uint16_t MOVES_BUFFER[810];
+// 81 位的落点位图，按 32 位分为 3 个字
+uint32_t DESTINATIONS_BUFFER[3];
+
+emscripten::val boardView(GameState &state) {
+  for (int i = 0; i < 81; i++) {
+    if (state.board[RED] >> i & 1) {
+      BOARD_BUFFER[i] = RED;
+    } else if (state.board[GREEN] >> i & 1) {
+      BOARD_BUFFER[i] = GREEN;
+    } else {
+      BOARD_BUFFER[i] = EMPTY;
+    }
+  }
+  return emscripten::val(emscripten::typed_memory_view(81, BOARD_BUFFER));
+}
+
+emscripten::val legalMovesView(GameState &state) {
+  size_t count = 0;
+  for (int src = 0; src < 81; src++) {
+    if (!(state.board[state.turn] >> src & 1)) {
+      continue;
+    }
+    uint128_t to = state.legalDestinations(src);
+    for (int dst = 0; dst < 81; dst++) {
+      if (to >> dst & 1) {
+        MOVES_BUFFER[count++] = src | dst << 8;
+      }
+    }
+  }
+  return emscripten::val(emscripten::typed_memory_view(count, MOVES_BUFFER));
+}
+
+emscripten::val destinationsView(GameState &state, int src) {
+  uint128_t to = 0;
+  if (src >= 0 && src < 81 && (state.board[state.turn] >> src & 1)) {
+    to = state.legalDestinations(src);
+  }
+  DESTINATIONS_BUFFER[0] = (uint32_t)to;
+  DESTINATIONS_BUFFER[1] = (uint32_t)(to >> 32);
+  DESTINATIONS_BUFFER[2] = (uint32_t)(to >> 64);
+  return emscripten::val(emscripten::typed_memory_view(3, DESTINATIONS_BUFFER));
+}
+
+uintptr_t stopFlagAddress() { return reinterpret_cast<uintptr_t>(&STOP_FLAG); }
+
+void resumeSearch() { STOP_FLAG = false; }
+
+// infinite 为 true 时一直搜索到 STOP_FLAG 被置位，每完成一层调用一次 onInfo；
+// engine 为 "mcts" 时使用蒙特卡洛树搜索，否则使用 alpha-beta 搜索；局面不合法时返回 -1 -1
+Move search(GameState &state, int timeLimit, bool infinite, std::string engine, emscripten::val onInfo) {
+  if (!isValidPosition(state)) {
+    return Move{-1, -1};
+  }
+  SearchLimits limits;
+  limits.timeLimit = timeLimit;
+  limits.infinite = infinite;
+  limits.stop = &STOP_FLAG;
+  limits.backend = engine == "mcts" ? BACKEND_MCTS : BACKEND_ALPHABETA;
+  return state.searchBestMove(limits, [&onInfo](const SearchInfo &info) {
+    auto object = emscripten::val::object();
+    object.set("depth", info.depth);
+    object.set("score", info.score);
+    object.set("src", info.bestMove.src);
+    object.set("dst", info.bestMove.dst);
+    object.set("nodes", (double)info.nodes);
+    object.set("time", (double)info.time);
+    onInfo(object);
+  });
+}
+
 EMSCRIPTEN_BINDINGS(wasm) {
   using namespace emscripten;
   enum_<Color>("Color").value("RED", Color::RED).value("GREEN", Color::GREEN);
@@ -15,13 +95,22 @@ EMSCRIPTEN_BINDINGS(wasm) {
       .property("turn", &GameState::getTurn)
       .function("getBoard", &GameState::getBoard)
       .function("legalMoves", &GameState::legalMoves)
+      .function("boardView", &boardView)
+      .function("legalMovesView", &legalMovesView)
+      .function("destinationsView", &destinationsView)
       .function("applyMove", &GameState::applyMove)
       .function("undoMove", &GameState::undoMove)
       .function("evaluate", &GameState::evaluate)
       .function("isGameOver", &GameState::isGameOver)
-      .function("searchBestMove", &GameState::searchBestMove)
+      .function("searchBestMove", select_overload<Move(int)>(&GameState::searchBestMove))
+      .function("search", &search)
       .function("toString", &GameState::toString)
       .function("hash", &GameState::hash);
+  function("stopFlagAddress", &stopFlagAddress);
+  function("resumeSearch", &resumeSearch);
+  function("setHashSize", &setHashSize);
+  function("setSearchThreads", &setSearchThreads);
+  function("getSearchThreads", &getSearchThreads);
   register_vector<int>("VectorInt");
   register_vector<Move>("VectorMove");
 }
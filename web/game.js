@@ -2,6 +2,10 @@ const EMPTY = 0;
 const RED = 1;
 const GREEN = 2;
 
+function hasDestination(destinations, p) {
+  return destinations !== null && ((destinations[p >> 5] >>> (p & 31)) & 1) === 1;
+}
+
 class GameState {
   constructor(str) {
     if (str) {
@@ -13,17 +17,20 @@ class GameState {
   }
   legalMoves() {
     const moves = {};
-    const legalMoves = this.state.legalMoves();
-    for (let i = 0; i < legalMoves.size(); i++) {
-      const { src, dst } = legalMoves.get(i);
+    for (const move of this.state.legalMovesView()) {
+      const src = move & 0xff;
+      const dst = move >> 8;
       if (moves[src] === undefined) {
         moves[src] = new Set();
       }
       moves[src].add(dst);
     }
-    legalMoves.delete();
     return moves;
   }
+  // src 位置棋子的落点位图，配合 hasDestination 使用
+  destinations(src) {
+    return this.state.destinationsView(src).slice();
+  }
   applyMove(src, dst) {
     this.state.applyMove({ src, dst });
     this.cacheBoard();
@@ -33,12 +40,8 @@ class GameState {
     this.cacheBoard();
   }
   cacheBoard() {
-    const board = this.state.getBoard();
-    this.boardCache = [];
-    for (let i = 0; i < board.size(); i++) {
-      this.boardCache.push(board.get(i));
-    }
-    board.delete();
+    // 视图指向 WASM 内存，内存增长后失效，拷贝一份
+    this.boardCache = this.state.boardView().slice();
   }
   toString() {
     return this.state.toString();
@@ -52,6 +55,10 @@ class GameState {
   searchBestMove(timeLimit) {
     return this.state.searchBestMove(timeLimit);
   }
+  // 带进度回调的搜索，infinite 为 true 时搜索到被停止为止，engine 为 'alphabeta' 或 'mcts'
+  search(timeLimit, infinite, onInfo, engine = 'alphabeta') {
+    return this.state.search(timeLimit, infinite, engine, onInfo);
+  }
   get board() {
     return this.boardCache;
   }
@@ -20,29 +20,77 @@ function App() {
   const pieceClasses = ['empty', 'red', 'green'];
   // State
   let gameState = savedState ? new GameState(savedState.board) : new GameState();
-  let moves = gameState.legalMoves();
+  let destinations = null;
   let lastMove = savedState ? savedState.lastMove : null;
   let srcPiece = -1;
   let windowWidth = window.innerWidth;
   let myColor = savedState ? savedState.color : RED;
   let showNumber = false;
   let computerThinkTime = savedState ? savedState.computerThinkTime : 10;
+  // 搜索算法，可以通过 ?engine=mcts 切换为蒙特卡洛树搜索
+  const searchEngine = new URLSearchParams(location.search).get('engine') || 'alphabeta';
   let showDialog = false;
   let countDown = 0;
-  let gameId = 0;
+  let searchId = 0;
+  let thinking = null;
   let myLastMove = null;
   // Bind value
   let userSelectColor = RED;
   let userSelectMode = 10;
 
+  // 引擎在 worker 中常驻，整局游戏共享局面和置换表，这里只发送增量着法
   const worker = new Worker('worker.js');
+  // 多线程版本的停止标志，位于 worker 的共享内存中
+  let stopFlag = null;
 
-  // Init
-  if (gameState.turn != myColor) {
-    countDown = computerThinkTime;
-    // 等待 worker 初始化
-    setTimeout(() => computerMove(), 200);
-  }
+  // 打断正在进行和已经排队的搜索
+  const stopSearch = () => {
+    if (stopFlag) {
+      Atomics.store(stopFlag, 0, 1);
+      worker.postMessage({ type: 'resume' });
+    }
+  };
+
+  // 玩家思考时让引擎在后台搜索，只有可以被打断的多线程版本才启用
+  const ponder = () => {
+    if (stopFlag && !gameState.isGameOver()) {
+      worker.postMessage({ type: 'ponder' });
+    }
+  };
+
+  worker.onmessage = (e) => {
+    const data = e.data;
+    switch (data.type) {
+      case 'ready':
+        if (data.threaded) {
+          stopFlag = new Int8Array(data.memory, data.stopFlag, 1);
+        }
+        if (gameState.turn === myColor) {
+          ponder();
+        }
+        break;
+      case 'info':
+        if (data.id === searchId) {
+          thinking = data;
+          m.redraw();
+        }
+        break;
+      case 'bestmove': {
+        if (data.id !== searchId) {
+          return;
+        }
+        const { src, dst } = data;
+        gameState.applyMove(src, dst);
+        worker.postMessage({ type: 'move', src, dst });
+        lastMove = [src, dst];
+        thinking = null;
+        saveState(gameState.toString(), myColor, lastMove);
+        ponder();
+        m.redraw();
+        break;
+      }
+    }
+  };
 
   // Event handlers
   const handlePieceClick = (p) => {
@@ -54,13 +102,16 @@ function App() {
     }
     if (gameState.board[p] === gameState.turn) {
       srcPiece = p;
-    } else if (moves[srcPiece] && moves[srcPiece].has(p)) {
+      destinations = gameState.destinations(p);
+    } else if (hasDestination(destinations, p)) {
       gameState.applyMove(srcPiece, p);
       myLastMove = [srcPiece, p];
       lastMove = [srcPiece, p];
       srcPiece = -1;
-      moves = gameState.legalMoves();
+      destinations = null;
       saveState(gameState.toString(), myColor, lastMove);
+      stopSearch();
+      worker.postMessage({ type: 'move', src: myLastMove[0], dst: myLastMove[1] });
       computerMove();
     }
   };
@@ -69,7 +120,8 @@ function App() {
     if (gameState.isGameOver()) {
       return;
     }
-    const sessionId = gameId;
+    searchId++;
+    thinking = null;
     countDown = computerThinkTime;
     const t = setInterval(() => {
       if (countDown === 0) {
@@ -79,25 +131,17 @@ function App() {
       countDown--;
       m.redraw();
     }, 1000);
-    worker.postMessage({ state: gameState.toString(), time: computerThinkTime });
-    worker.onmessage = (e) => {
-      if (gameId !== sessionId) {
-        return;
-      }
-      const { src, dst } = e.data;
-      gameState.applyMove(src, dst);
-      lastMove = [src, dst];
-      moves = gameState.legalMoves();
-      saveState(gameState.toString(), myColor, lastMove);
-      m.redraw();
-    };
+    worker.postMessage({ type: 'go', id: searchId, time: computerThinkTime, engine: searchEngine });
   };
 
   const handleRestart = () => {
+    stopSearch();
+    searchId++;
+    thinking = null;
     gameState.delete();
     gameState = new GameState();
-    gameId++;
-    moves = gameState.legalMoves();
+    worker.postMessage({ type: 'position', state: gameState.toString() });
+    destinations = null;
     lastMove = null;
     srcPiece = -1;
     countDown = 0;
@@ -107,6 +151,8 @@ function App() {
     localStorage.setItem('mode', computerThinkTime);
     if (myColor === GREEN) {
       computerMove();
+    } else {
+      ponder();
     }
     showDialog = false;
     saveState(gameState.toString(), myColor, lastMove);
@@ -131,18 +177,28 @@ function App() {
 
   const handleUndoMove = () => {
     if (myLastMove && gameState.turn === myColor) {
+      stopSearch();
       let [src, dst] = lastMove;
       gameState.undoMove(src, dst);
+      worker.postMessage({ type: 'undo', src, dst });
       [src, dst] = myLastMove;
       gameState.undoMove(src, dst);
-      moves = gameState.legalMoves();
+      worker.postMessage({ type: 'undo', src, dst });
+      destinations = null;
       lastMove = null;
       srcPiece = -1;
       myLastMove = null;
+      ponder();
       m.redraw();
     }
   };
 
+  // Init
+  worker.postMessage({ type: 'position', state: gameState.toString() });
+  if (gameState.turn != myColor) {
+    computerMove();
+  }
+
   window.addEventListener('resize', () => {
     windowWidth = window.innerWidth;
     m.redraw();
@@ -158,7 +214,10 @@ function App() {
               ? [m('i.bi.bi-trophy-fill'), '游戏结束']
               : gameState.turn == myColor
               ? [m('i.bi.bi-joystick'), '你的回合']
-              : [m('i.bi.bi-hourglass-split'), '电脑思考中：' + countDown]
+              : [
+                  m('i.bi.bi-hourglass-split'),
+                  '电脑思考中：' + countDown + (thinking ? ` · 深度 ${thinking.depth}` : ''),
+                ]
           ),
         ]),
         m('div', { class: 'game-area' }, [
@@ -192,7 +251,7 @@ function App() {
                     r: 19,
                     class: classNames('circle', pieceClasses[gameState.board[p]], {
                       bordered: srcPiece === p || lastMove?.includes(p),
-                      path: moves[srcPiece] && moves[srcPiece].has(p),
+                      path: hasDestination(destinations, p),
                     }),
                   }),
                   showNumber && m('text', { x: cx, y: cy, class: 'piece-label' }, p),
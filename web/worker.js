@@ -1,14 +1,90 @@
+// 页面跨源隔离时可以使用 SharedArrayBuffer，加载多线程版本，否则退回单线程版本
+const threaded = typeof SharedArrayBuffer !== 'undefined' && self.crossOriginIsolated;
+
+// 按设备内存选择置换表大小 (MB)，navigator.deviceMemory 不可用时按低内存设备处理
+function hashSize() {
+  const memory = navigator.deviceMemory || 1;
+  if (memory >= 8) {
+    return 128;
+  }
+  if (memory >= 4) {
+    return 64;
+  }
+  return 16;
+}
+
+// 引擎会话：整局游戏使用同一个局面和置换表，页面只发送增量着法
+let session = null;
+let ready = false;
+const pending = [];
+
 self.Module = {
-  onRuntimeInitialized() {},
+  onRuntimeInitialized() {
+    Module.setHashSize(hashSize());
+    if (threaded) {
+      Module.setSearchThreads(navigator.hardwareConcurrency || 1);
+    }
+    // performance.now() 从 worker 创建开始计时，即引擎冷启动耗时
+    console.info(`engine ready in ${performance.now().toFixed(1)} ms (${threaded ? 'threaded' : 'single thread'})`);
+    ready = true;
+    // 多线程版本把停止标志所在的共享内存交给页面，页面可以随时打断搜索
+    self.postMessage({
+      type: 'ready',
+      threaded,
+      memory: threaded ? Module.HEAP8.buffer : null,
+      stopFlag: Module.stopFlagAddress(),
+    });
+    pending.splice(0).forEach(handleMessage);
+  },
 };
 
-importScripts('chinesecheckers.js');
+importScripts(threaded ? 'chinesecheckers_mt.js' : 'chinesecheckers.js');
 importScripts('game.js');
 
+function handleMessage(data) {
+  switch (data.type) {
+    case 'position':
+      if (session) {
+        session.delete();
+      }
+      session = new GameState(data.state);
+      break;
+    case 'move':
+      session.applyMove(data.src, data.dst);
+      break;
+    case 'undo':
+      session.undoMove(data.src, data.dst);
+      break;
+    case 'resume':
+      // 页面置位停止标志后紧接着发送 resume，之前排队的搜索都会立即返回
+      Module.resumeSearch();
+      break;
+    case 'go': {
+      const { src, dst } = session.search(
+        data.time,
+        false,
+        (info) => {
+          self.postMessage({ type: 'info', id: data.id, ...info });
+        },
+        data.engine
+      );
+      self.postMessage({ type: 'bestmove', id: data.id, src, dst });
+      break;
+    }
+    case 'ponder':
+      // 对手思考时在当前局面上后台搜索，只为预热置换表，结果丢弃。
+      // 单线程版本无法被打断，不进行后台搜索
+      if (threaded) {
+        session.search(0, true, () => {});
+      }
+      break;
+  }
+}
+
 self.addEventListener('message', (event) => {
-  let { state, time } = event.data;
-  const gameState = new GameState(state);
-  const bestMove = gameState.searchBestMove(time);
-  self.postMessage(bestMove);
-  gameState.delete();
+  if (ready) {
+    handleMessage(event.data);
+  } else {
+    pending.push(event.data);
+  }
 });